@@ -13,5 +13,10 @@ namespace host {
 
 std::unordered_map<std::string_view, std::string_view> GetHeaders();
 
+// Subset of GetHeaders() needed to compile src: the headers included by src, directly or through
+// other headers, and ck/config.h. Includes in disabled preprocessor branches are kept, so the
+// subset may be larger than needed but never misses a header.
+std::unordered_map<std::string_view, std::string_view> GetHeadersFor(std::string_view src);
+
 } // namespace host
 } // namespace ck
@@ -1,5 +1,9 @@
 #include "ck/host/headers.hpp"
 #include "ck_headers.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <mutex>
+#include <vector>
 
 namespace ck {
 namespace host {
@@ -16,5 +20,108 @@ std::unordered_map<std::string_view, std::string_view> GetHeaders()
     return headers;
 }
 
+namespace {
+
+const std::unordered_map<std::string_view, std::string_view>& GetAllHeaders()
+{
+    static const auto headers = GetHeaders();
+    return headers;
+}
+
+std::string_view TrimLeft(std::string_view s)
+{
+    s.remove_prefix(std::min(s.find_first_not_of(" \t"), s.size()));
+    return s;
+}
+
+// names of the #include directives of src, with true for the quoted ones
+std::vector<std::pair<std::string_view, bool>> GetIncludeDirectives(std::string_view src)
+{
+    std::vector<std::pair<std::string_view, bool>> result;
+    for(std::size_t pos = 0; pos < src.size();)
+    {
+        const auto eol = std::min(src.find('\n', pos), src.size());
+        auto line      = TrimLeft(src.substr(pos, eol - pos));
+        pos            = eol + 1;
+
+        if(line.empty() or line.front() != '#')
+            continue;
+        line = TrimLeft(line.substr(1));
+        if(line.substr(0, 7) != "include")
+            continue;
+        line = TrimLeft(line.substr(7));
+        if(line.empty() or (line.front() != '"' and line.front() != '<'))
+            continue;
+
+        const bool quoted = line.front() == '"';
+        const auto end    = line.find(quoted ? '"' : '>', 1);
+        if(end != std::string_view::npos)
+            result.emplace_back(line.substr(1, end - 1), quoted);
+    }
+    return result;
+}
+
+// headers directly included by the header at path (empty for the source to compile), the quoted
+// includes are looked up relative to the directory of the header first
+std::vector<std::string_view> GetIncludedHeaders(std::string_view path, std::string_view src)
+{
+    const auto& headers = GetAllHeaders();
+
+    std::vector<std::string_view> result;
+    for(const auto& [name, quoted] : GetIncludeDirectives(src))
+    {
+        if(quoted and not path.empty())
+        {
+            const auto relative =
+                (std::filesystem::path{path}.parent_path() / name).lexically_normal().string();
+            const auto it = headers.find(relative);
+            if(it != headers.end())
+            {
+                result.push_back(it->first);
+                continue;
+            }
+        }
+
+        const auto it = headers.find(name);
+        if(it != headers.end())
+            result.push_back(it->first);
+    }
+    return result;
+}
+
+} // namespace
+
+std::unordered_map<std::string_view, std::string_view> GetHeadersFor(std::string_view src)
+{
+    const auto& headers = GetAllHeaders();
+
+    // the direct includes of each header are only parsed once per process
+    static std::mutex mutex;
+    static std::unordered_map<std::string_view, std::vector<std::string_view>> included_headers;
+
+    std::unordered_map<std::string_view, std::string_view> result;
+    result.insert(*headers.find("ck/config.h"));
+
+    std::vector<std::string_view> stack = GetIncludedHeaders("", src);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    while(not stack.empty())
+    {
+        const auto path = stack.back();
+        stack.pop_back();
+
+        const auto content = headers.at(path);
+        if(not result.emplace(path, content).second)
+            continue;
+
+        auto it = included_headers.find(path);
+        if(it == included_headers.end())
+            it = included_headers.emplace(path, GetIncludedHeaders(path, content)).first;
+
+        stack.insert(stack.end(), it->second.begin(), it->second.end());
+    }
+    return result;
+}
+
 } // namespace host
 } // namespace ck
@@ -9,10 +9,10 @@
 #include <rtc/hip.hpp>
 #include <fstream>
 
-std::vector<rtc::src_file> get_headers_for_test()
+std::vector<rtc::src_file> get_headers_for_test(const std::string& src)
 {
     std::vector<rtc::src_file> result;
-    auto hs = ck::host::GetHeaders();
+    auto hs = ck::host::GetHeadersFor(src);
     std::transform(
         hs.begin(), hs.end(), std::back_inserter(result), [&](const auto& p) -> rtc::src_file {
             return {p.first, p.second};
@@ -165,7 +165,7 @@ struct Epilogue
             conv_compile_check,
             {{"include", prob.GetIncludeHeader()}, {"template", solution.ToTemplateString()}});
 
-        auto srcs = get_headers_for_test();
+        auto srcs = get_headers_for_test(src);
         srcs.push_back({"main.cpp", src});
         rtc::compile_options options;
         auto name           = solution.GetTemplateParameter<std::string>("name");
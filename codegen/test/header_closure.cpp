@@ -0,0 +1,88 @@
+#include "ck/host/device_gemm_multiple_d/problem.hpp"
+#include "ck/host/device_grouped_conv_fwd_multiple_d/conv_fwd_problem.hpp"
+#include "ck/host/headers.hpp"
+#include <filesystem>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <test.hpp>
+
+using headers_t = std::unordered_map<std::string_view, std::string_view>;
+
+std::size_t total_size(const headers_t& headers)
+{
+    return std::accumulate(headers.begin(), headers.end(), std::size_t{0}, [](auto n, auto p) {
+        return n + p.second.size();
+    });
+}
+
+// every header of GetHeaders() included by a header of the subset is in the subset
+bool is_closed(const headers_t& subset)
+{
+    const auto all = ck::host::GetHeaders();
+    for(const auto& [path, content] : subset)
+    {
+        std::istringstream is{std::string{content}};
+        for(std::string line; std::getline(is, line);)
+        {
+            const auto first = line.find_first_not_of(" \t");
+            if(first == std::string::npos or line.compare(first, 8, "#include") != 0)
+                continue;
+            const auto begin = line.find_first_of("\"<", first);
+            const auto end   = line.find_first_of("\">", begin + 1);
+            if(begin == std::string::npos or end == std::string::npos)
+                continue;
+            const auto name = line.substr(begin + 1, end - begin - 1);
+            const auto relative =
+                (std::filesystem::path{std::string{path}}.parent_path() / name).lexically_normal();
+
+            if(line[begin] == '"' and all.count(relative.string()) > 0)
+            {
+                if(subset.count(relative.string()) == 0)
+                    return false;
+            }
+            else if(all.count(name) > 0 and subset.count(name) == 0)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void check_closure(const std::string& header)
+{
+    const auto all    = ck::host::GetHeaders();
+    const auto subset = ck::host::GetHeadersFor("#include <" + header + ">\n");
+
+    std::cout << header << ": " << subset.size() << " of " << all.size() << " headers, "
+              << total_size(subset) << " of " << total_size(all) << " bytes" << std::endl;
+
+    EXPECT(subset.count(header) == 1);
+    EXPECT(subset.count("ck/ck.hpp") == 1);
+    EXPECT(subset.count("ck/config.h") == 1);
+    EXPECT(subset.size() < all.size());
+    EXPECT(is_closed(subset));
+}
+
+TEST_CASE(header_closure_gemm_multiple_d)
+{
+    check_closure(ck::host::device_gemm_multiple_d::Problem{}.GetIncludeHeader());
+}
+
+TEST_CASE(header_closure_grouped_conv_fwd)
+{
+    check_closure(ck::host::conv::Problem_Conv_Fwd{}.GetIncludeHeader());
+}
+
+TEST_CASE(header_closure_relative_include)
+{
+    const auto subset = ck::host::GetHeadersFor("#include \"ck/utility/common_header.hpp\"\n"
+                                                "#include <hip/hip_runtime.h>\n");
+    EXPECT(subset.count("ck/utility/common_header.hpp") == 1);
+    EXPECT(subset.count("ck/utility/data_type.hpp") == 1);
+    EXPECT(is_closed(subset));
+}
+
+int main(int argc, const char* argv[]) { test::run(argc, argv); }
@@ -4,9 +4,12 @@
 #include <rtc/kernel.hpp>
 #include <filesystem>
 #include <string>
+#include <vector>
 
 namespace rtc {
 
+struct kernel_cache;
+
 struct src_file
 {
     std::filesystem::path path;
@@ -17,8 +20,16 @@ struct compile_options
 {
     std::string flags       = "";
     std::string kernel_name = "main";
+    // compiler command and target, empty for hip clang and the arch of the current device
+    std::string compiler     = "";
+    std::string offload_arch = "";
+    // cache of the code objects, nullptr for kernel_cache::get_default()
+    kernel_cache* cache = nullptr;
 };
 
+std::vector<char> compile_code_object(const std::vector<src_file>& src,
+                                      compile_options options = compile_options{});
+
 kernel compile_kernel(const std::vector<src_file>& src,
                       compile_options options = compile_options{});
 
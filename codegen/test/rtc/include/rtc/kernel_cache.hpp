@@ -0,0 +1,66 @@
+#ifndef GUARD_HOST_TEST_RTC_INCLUDE_RTC_KERNEL_CACHE
+#define GUARD_HOST_TEST_RTC_INCLUDE_RTC_KERNEL_CACHE
+
+#include <rtc/compile_kernel.hpp>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace rtc {
+
+struct kernel_cache_stats
+{
+    std::size_t hits      = 0;
+    std::size_t misses    = 0;
+    std::size_t evictions = 0;
+};
+
+// On-disk cache of compiled code objects, shared by the processes using the same directory.
+//
+// Entries are addressed by a hash of everything the code object depends on (see make_key): the
+// sources including the ck headers, the flags and the compiler. An entry is written to a
+// temporary file and renamed into place, so readers only ever see complete entries and never need
+// a lock. Hits refresh the modification time of the entry, which is used to evict the least
+// recently used entries once the cache is larger than max_size bytes.
+struct kernel_cache
+{
+    static constexpr std::uintmax_t default_max_size = std::uintmax_t{1} << 30;
+
+    kernel_cache(std::filesystem::path dir, std::uintmax_t max_size = default_max_size);
+
+    // Cache configured by CK_RTC_CACHE_DIR (and CK_RTC_CACHE_MAX_SIZE, in bytes), nullptr if the
+    // variable is not set.
+    static kernel_cache* get_default();
+
+    // compiler is the compiler command, the size and time of its executable are hashed too so
+    // that an update of the compiler invalidates the entries
+    static std::string make_key(const std::vector<src_file>& srcs,
+                                const std::string& flags,
+                                const std::string& compiler);
+
+    std::optional<std::vector<char>> load(const std::string& key);
+    void store(const std::string& key, const std::vector<char>& obj);
+
+    // removes the least recently used entries until the cache holds at most max_size bytes
+    void evict();
+
+    kernel_cache_stats get_stats() const;
+    const std::filesystem::path& get_path() const { return path; }
+
+    private:
+    std::filesystem::path get_entry_path(const std::string& key) const;
+
+    std::filesystem::path path;
+    std::uintmax_t max_size;
+
+    std::atomic<std::size_t> hits{0};
+    std::atomic<std::size_t> misses{0};
+    std::atomic<std::size_t> evictions{0};
+};
+
+} // namespace rtc
+
+#endif
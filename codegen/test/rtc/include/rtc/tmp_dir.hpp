@@ -6,6 +6,8 @@
 
 namespace rtc {
 
+std::string unique_string(const std::string& prefix);
+
 struct tmp_dir
 {
     std::filesystem::path path;
@@ -1,5 +1,6 @@
 #include "rtc/hip.hpp"
 #include <rtc/compile_kernel.hpp>
+#include <rtc/kernel_cache.hpp>
 #include <rtc/tmp_dir.hpp>
 #include <stdexcept>
 #include <iostream>
@@ -59,13 +60,29 @@ std::string compiler() { return "/opt/rocm/llvm/bin/clang++ -x hip --cuda-device
 // TODO: undo after extracting the codeobj
 // std::string compiler() { return "/opt/rocm/llvm/bin/clang++ -x hip"; }
 
-kernel compile_kernel(const std::vector<src_file>& srcs, compile_options options)
+std::vector<char> compile_code_object(const std::vector<src_file>& srcs, compile_options options)
 {
     assert(not srcs.empty());
-    tmp_dir td{"compile"};
+    if(options.compiler.empty())
+        options.compiler = compiler();
+    if(options.offload_arch.empty())
+        options.offload_arch = get_device_name();
+    if(options.cache == nullptr)
+        options.cache = kernel_cache::get_default();
+
     options.flags += " -I. -O3";
     options.flags += " -std=c++17";
-    options.flags += " --offload-arch=" + get_device_name();
+    options.flags += " --offload-arch=" + options.offload_arch;
+
+    std::string key;
+    if(options.cache != nullptr)
+    {
+        key = kernel_cache::make_key(srcs, options.flags, options.compiler);
+        if(auto obj = options.cache->load(key))
+            return std::move(*obj);
+    }
+
+    tmp_dir td{"compile"};
     std::string out;
 
     for(const auto& src : srcs)
@@ -83,7 +100,7 @@ kernel compile_kernel(const std::vector<src_file>& srcs, compile_options options
     }
 
     options.flags += " -o " + out;
-    td.execute(compiler() + options.flags);
+    td.execute(options.compiler + options.flags);
 
     auto out_path = td.path / out;
     if(not std::filesystem::exists(out_path))
@@ -91,6 +108,16 @@ kernel compile_kernel(const std::vector<src_file>& srcs, compile_options options
 
     auto obj = read_buffer(out_path.string());
 
+    if(options.cache != nullptr)
+        options.cache->store(key, obj);
+
+    return obj;
+}
+
+kernel compile_kernel(const std::vector<src_file>& srcs, compile_options options)
+{
+    auto obj = compile_code_object(srcs, options);
+
     std::ofstream ofh("obj.o", std::ios::binary);
     for(auto i : obj)
         ofh << i;
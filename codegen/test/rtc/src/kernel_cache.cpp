@@ -0,0 +1,202 @@
+#include <rtc/kernel_cache.hpp>
+#include <rtc/tmp_dir.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <system_error>
+
+namespace rtc {
+
+// changes whenever the layout of the entries or of the hashed data changes
+constexpr std::uint64_t cache_version = 1;
+
+struct fnv1a_hash
+{
+    std::uint64_t value = 14695981039346656037ull;
+
+    void add(const void* data, std::size_t size)
+    {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for(std::size_t i = 0; i < size; ++i)
+        {
+            value ^= bytes[i];
+            value *= 1099511628211ull;
+        }
+    }
+
+    void add(std::uint64_t x) { add(&x, sizeof(x)); }
+
+    // the size is hashed first so that the concatenations of different strings differ
+    void add(std::string_view s)
+    {
+        add(static_cast<std::uint64_t>(s.size()));
+        add(s.data(), s.size());
+    }
+};
+
+kernel_cache::kernel_cache(std::filesystem::path dir, std::uintmax_t max_sz)
+    : path(std::move(dir)), max_size(max_sz)
+{
+}
+
+kernel_cache* kernel_cache::get_default()
+{
+    static const std::unique_ptr<kernel_cache> cache = []() -> std::unique_ptr<kernel_cache> {
+        const char* dir = std::getenv("CK_RTC_CACHE_DIR");
+        if(dir == nullptr or *dir == '\0')
+            return nullptr;
+        std::uintmax_t max_sz = default_max_size;
+        if(const char* size = std::getenv("CK_RTC_CACHE_MAX_SIZE"))
+            max_sz = std::stoull(size);
+        return std::make_unique<kernel_cache>(dir, max_sz);
+    }();
+    return cache.get();
+}
+
+std::string kernel_cache::make_key(const std::vector<src_file>& srcs,
+                                   const std::string& flags,
+                                   const std::string& compiler)
+{
+    fnv1a_hash hash;
+    hash.add(cache_version);
+
+    hash.add(static_cast<std::uint64_t>(srcs.size()));
+    for(const auto& src : srcs)
+    {
+        hash.add(src.path.string());
+        hash.add(src.content);
+    }
+
+    hash.add(flags);
+    hash.add(compiler);
+
+    // identity of the compiler executable, the first word of the command
+    std::error_code ec;
+    const std::filesystem::path exe = compiler.substr(0, compiler.find(' '));
+    const auto exe_size             = std::filesystem::file_size(exe, ec);
+    if(not ec)
+    {
+        hash.add(static_cast<std::uint64_t>(exe_size));
+        hash.add(static_cast<std::uint64_t>(
+            std::filesystem::last_write_time(exe, ec).time_since_epoch().count()));
+    }
+
+    std::stringstream ss;
+    ss << std::hex;
+    ss.width(16);
+    ss.fill('0');
+    ss << hash.value;
+    return ss.str();
+}
+
+std::filesystem::path kernel_cache::get_entry_path(const std::string& key) const
+{
+    return path / (key + ".o");
+}
+
+std::optional<std::vector<char>> kernel_cache::load(const std::string& key)
+{
+    // entries are only replaced by renames, an open entry stays complete even if it is evicted
+    const auto entry = get_entry_path(key);
+    std::ifstream is(entry, std::ios::binary);
+    if(is)
+    {
+        std::vector<char> obj{std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{}};
+        if(not is.bad() and not obj.empty())
+        {
+            std::error_code ec;
+            const auto now = std::filesystem::file_time_type::clock::now();
+            std::filesystem::last_write_time(entry, now, ec);
+            ++hits;
+            return obj;
+        }
+    }
+    ++misses;
+    return std::nullopt;
+}
+
+void kernel_cache::store(const std::string& key, const std::vector<char>& obj)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(path, ec);
+
+    // written next to the entry and renamed, which is atomic in a file system
+    const auto tmp = path / unique_string(key + ".o.tmp");
+    {
+        std::ofstream os(tmp, std::ios::binary);
+        os.write(obj.data(), obj.size());
+        if(not os)
+        {
+            std::filesystem::remove(tmp, ec);
+            return;
+        }
+    }
+
+    std::filesystem::rename(tmp, get_entry_path(key), ec);
+    if(ec)
+    {
+        std::filesystem::remove(tmp, ec);
+        return;
+    }
+
+    evict();
+}
+
+void kernel_cache::evict()
+{
+    struct entry
+    {
+        std::filesystem::path path;
+        std::uintmax_t size;
+        std::filesystem::file_time_type time;
+    };
+
+    std::vector<entry> entries;
+    std::uintmax_t total_size = 0;
+
+    std::error_code ec;
+    for(const auto& e : std::filesystem::directory_iterator(path, ec))
+    {
+        if(e.path().extension() != ".o")
+            continue;
+        const auto size = e.file_size(ec);
+        if(ec)
+            continue;
+        const auto time = e.last_write_time(ec);
+        if(ec)
+            continue;
+        entries.push_back({e.path(), size, time});
+        total_size += size;
+    }
+
+    if(total_size <= max_size)
+        return;
+
+    std::sort(entries.begin(), entries.end(), [](const entry& x, const entry& y) {
+        return x.time < y.time;
+    });
+
+    // other processes may evict the same entries concurrently, only the removals count
+    for(const auto& e : entries)
+    {
+        if(total_size <= max_size)
+            break;
+        if(std::filesystem::remove(e.path, ec))
+            ++evictions;
+        total_size -= e.size;
+    }
+}
+
+kernel_cache_stats kernel_cache::get_stats() const
+{
+    kernel_cache_stats stats;
+    stats.hits      = hits;
+    stats.misses    = misses;
+    stats.evictions = evictions;
+    return stats;
+}
+
+} // namespace rtc
@@ -0,0 +1,167 @@
+#include <rtc/compile_kernel.hpp>
+#include <rtc/kernel_cache.hpp>
+#include <rtc/tmp_dir.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <test.hpp>
+
+// Stand-in for the compiler, "compiles" main.cpp by copying it and counts its invocations
+struct fake_compiler
+{
+    rtc::tmp_dir td{"fake-compiler"};
+
+    std::string command() const
+    {
+        return "f() { echo x >> " + (td.path / "count").string() + "; cp main.cpp main.o; }; f";
+    }
+
+    std::size_t count() const
+    {
+        std::ifstream is(td.path / "count");
+        std::size_t n = 0;
+        for(std::string line; std::getline(is, line);)
+            ++n;
+        return n;
+    }
+};
+
+rtc::compile_options make_options(const fake_compiler& cc, rtc::kernel_cache& cache)
+{
+    rtc::compile_options options;
+    options.compiler     = cc.command();
+    options.offload_arch = "gfx000";
+    options.cache        = &cache;
+    return options;
+}
+
+std::vector<char> to_buffer(const std::string& s) { return {s.begin(), s.end()}; }
+
+TEST_CASE(cache_hit)
+{
+    fake_compiler cc;
+    rtc::tmp_dir dir{"cache"};
+    rtc::kernel_cache cache{dir.path};
+
+    const std::string src = "extern \"C\" __global__ void f() {}";
+    const std::string hdr = "#pragma once";
+
+    auto options = make_options(cc, cache);
+    auto obj1    = rtc::compile_code_object({{"main.cpp", src}, {"a.hpp", hdr}}, options);
+    auto obj2    = rtc::compile_code_object({{"main.cpp", src}, {"a.hpp", hdr}}, options);
+
+    EXPECT(obj1 == to_buffer(src));
+    EXPECT(obj2 == obj1);
+    EXPECT(cc.count() == 1);
+    EXPECT(cache.get_stats().hits == 1);
+    EXPECT(cache.get_stats().misses == 1);
+
+    // a new cache object on the same directory, like another process
+    rtc::kernel_cache other{dir.path};
+    auto obj3 = rtc::compile_code_object({{"main.cpp", src}, {"a.hpp", hdr}},
+                                         make_options(cc, other));
+    EXPECT(obj3 == obj1);
+    EXPECT(cc.count() == 1);
+    EXPECT(other.get_stats().hits == 1);
+}
+
+TEST_CASE(cache_key)
+{
+    fake_compiler cc;
+    rtc::tmp_dir dir{"cache"};
+    rtc::kernel_cache cache{dir.path};
+
+    const std::string src = "int x;";
+
+    auto options = make_options(cc, cache);
+    rtc::compile_code_object({{"main.cpp", src}, {"a.hpp", "a"}}, options);
+
+    // header, flags and target are part of the key
+    rtc::compile_code_object({{"main.cpp", src}, {"a.hpp", "b"}}, options);
+    auto flags_options = options;
+    flags_options.flags += " -DX";
+    rtc::compile_code_object({{"main.cpp", src}, {"a.hpp", "a"}}, flags_options);
+    auto arch_options         = options;
+    arch_options.offload_arch = "gfx001";
+    rtc::compile_code_object({{"main.cpp", src}, {"a.hpp", "a"}}, arch_options);
+
+    EXPECT(cc.count() == 4);
+    EXPECT(cache.get_stats().hits == 0);
+    EXPECT(cache.get_stats().misses == 4);
+}
+
+TEST_CASE(cache_concurrent)
+{
+    fake_compiler cc;
+    rtc::tmp_dir dir{"cache"};
+
+    const std::string src = "int y;";
+
+    std::vector<std::vector<char>> objs(8);
+    std::vector<std::thread> threads;
+    for(std::size_t i = 0; i < objs.size(); ++i)
+    {
+        threads.emplace_back([&, i] {
+            rtc::kernel_cache cache{dir.path};
+            for(int j = 0; j < 4; ++j)
+                objs[i] = rtc::compile_code_object({{"main.cpp", src}}, make_options(cc, cache));
+        });
+    }
+    for(auto& t : threads)
+        t.join();
+
+    for(const auto& obj : objs)
+        EXPECT(obj == to_buffer(src));
+    // no temporary file is left behind
+    std::size_t num_files = 0;
+    for(const auto& e : std::filesystem::directory_iterator(dir.path))
+    {
+        EXPECT(e.path().extension() == ".o");
+        ++num_files;
+    }
+    EXPECT(num_files == 1);
+}
+
+TEST_CASE(cache_eviction)
+{
+    fake_compiler cc;
+    rtc::tmp_dir dir{"cache"};
+
+    // room for 3 entries of 100 bytes
+    rtc::kernel_cache cache{dir.path, 350};
+    auto options = make_options(cc, cache);
+
+    auto src = [](char c) { return std::string(100, c); };
+
+    rtc::compile_code_object({{"main.cpp", src('a')}}, options);
+    rtc::compile_code_object({{"main.cpp", src('b')}}, options);
+    rtc::compile_code_object({{"main.cpp", src('c')}}, options);
+
+    // 'a' is the oldest entry but is used again, 'b' becomes the least recently used one
+    for(const auto& e : std::filesystem::directory_iterator(dir.path))
+    {
+        std::ifstream is(e.path());
+        const auto age  = std::chrono::hours{'d' - is.get()};
+        const auto time = std::filesystem::last_write_time(e.path());
+        std::filesystem::last_write_time(e.path(), time - age);
+    }
+    rtc::compile_code_object({{"main.cpp", src('a')}}, options);
+    rtc::compile_code_object({{"main.cpp", src('d')}}, options);
+
+    EXPECT(cache.get_stats().evictions == 1);
+    EXPECT(cc.count() == 4);
+
+    // 'a', 'c' and 'd' are still cached
+    rtc::compile_code_object({{"main.cpp", src('a')}}, options);
+    rtc::compile_code_object({{"main.cpp", src('c')}}, options);
+    rtc::compile_code_object({{"main.cpp", src('d')}}, options);
+    EXPECT(cc.count() == 4);
+
+    rtc::compile_code_object({{"main.cpp", src('b')}}, options);
+    EXPECT(cc.count() == 5);
+}
+
+int main(int argc, const char* argv[]) { test::run(argc, argv); }
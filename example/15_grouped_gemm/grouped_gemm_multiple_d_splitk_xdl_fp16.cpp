@@ -170,23 +170,28 @@ bool run_grouped_gemm(const ProblemSize& problem_size, const ExecutionConfig& co
                      sizeof(DDataType) * d_tensors[i][0].GetElementSize() * NumDMatrices +
                      sizeof(EDataType) * c_device_result_tensors[i].GetElementSize();
 
+        // distinct seeds for each group
+        const unsigned int seed = 16 * i;
+
         switch(config.init_method)
         {
         case 0: break;
         case 1:
-            a_tensors[i].GenerateTensorValue(GeneratorTensor_2<ADataType>{-5, 5});
-            b_tensors[i].GenerateTensorValue(GeneratorTensor_2<BDataType>{-5, 5});
+            a_tensors[i].GenerateTensorValue(GeneratorTensor_2<ADataType>{-5, 5, seed});
+            b_tensors[i].GenerateTensorValue(GeneratorTensor_2<BDataType>{-5, 5, seed + 1});
             for(int j = 0; j < NumDMatrices; ++j)
             {
-                d_tensors[i][j].GenerateTensorValue(GeneratorTensor_2<DDataType>{-5, 5});
+                d_tensors[i][j].GenerateTensorValue(
+                    GeneratorTensor_2<DDataType>{-5, 5, seed + 2 + j});
             }
             break;
         case 2:
-            a_tensors[i].GenerateTensorValue(GeneratorTensor_3<ADataType>{0.0, 1.0});
-            b_tensors[i].GenerateTensorValue(GeneratorTensor_3<BDataType>{-0.5, 0.5});
+            a_tensors[i].GenerateTensorValue(GeneratorTensor_3<ADataType>{0.0, 1.0, seed});
+            b_tensors[i].GenerateTensorValue(GeneratorTensor_3<BDataType>{-0.5, 0.5, seed + 1});
             for(int j = 0; j < NumDMatrices; ++j)
             {
-                d_tensors[i][j].GenerateTensorValue(GeneratorTensor_3<ADataType>{0.0, 1.0});
+                d_tensors[i][j].GenerateTensorValue(
+                    GeneratorTensor_3<ADataType>{0.0, 1.0, seed + 2 + j});
             }
             break;
         default:
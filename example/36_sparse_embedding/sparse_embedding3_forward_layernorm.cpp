@@ -1,12 +1,11 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #include <iostream>
 #include <numeric>
 #include <initializer_list>
 #include <cstdlib>
 #include <getopt.h>
-#include <ctime>
 
 #include "ck/ck.hpp"
 #include "ck/tensor_operation/gpu/device/impl/device_sparse_embeddings_forward_layernorm.hpp"
@@ -75,7 +74,6 @@ int main()
                                                                               OutType>;
 
     ck::static_for<0, dims.Size(), 1>{}([&](auto I) {
-        std::srand(std::time(nullptr));
         constexpr auto current_dim = dims.At(I);
         Tensor<EmbType> emb_a(f_host_tensor_desc_2d(num_rows, current_dim));
         Tensor<EmbType> emb_b(f_host_tensor_desc_2d(num_rows, current_dim));
@@ -90,16 +88,19 @@ int main()
 
         Tensor<OutType> out(f_host_tensor_desc_2d(index_length, current_dim));
 
-        emb_a.GenerateTensorValue(GeneratorTensor_3<EmbType>{0.0, 1.0});
-        emb_b.GenerateTensorValue(GeneratorTensor_3<EmbType>{0.0, 1.0});
-        emb_c.GenerateTensorValue(GeneratorTensor_3<EmbType>{0.0, 1.0});
+        // distinct seeds for each dimension
+        const unsigned int seed = 8 * I.value;
 
-        index_a.GenerateTensorValue(GeneratorTensor_2<IndexType>{0, num_rows});
-        index_b.GenerateTensorValue(GeneratorTensor_2<IndexType>{0, num_rows});
-        index_c.GenerateTensorValue(GeneratorTensor_2<IndexType>{0, num_rows});
+        emb_a.GenerateTensorValue(GeneratorTensor_3<EmbType>{0.0, 1.0, seed});
+        emb_b.GenerateTensorValue(GeneratorTensor_3<EmbType>{0.0, 1.0, seed + 1});
+        emb_c.GenerateTensorValue(GeneratorTensor_3<EmbType>{0.0, 1.0, seed + 2});
 
-        gamma.GenerateTensorValue(GeneratorTensor_3<GammaDataType>{0.0, 1.0});
-        beta.GenerateTensorValue(GeneratorTensor_3<BetaDataType>{0.0, 1.0});
+        index_a.GenerateTensorValue(GeneratorTensor_2<IndexType>{0, num_rows, seed + 3});
+        index_b.GenerateTensorValue(GeneratorTensor_2<IndexType>{0, num_rows, seed + 4});
+        index_c.GenerateTensorValue(GeneratorTensor_2<IndexType>{0, num_rows, seed + 5});
+
+        gamma.GenerateTensorValue(GeneratorTensor_3<GammaDataType>{0.0, 1.0, seed + 6});
+        beta.GenerateTensorValue(GeneratorTensor_3<BetaDataType>{0.0, 1.0, seed + 7});
 
         DeviceMem emb_a_dev(sizeof(EmbType) * emb_a.mDesc.GetElementSpaceSize());
         DeviceMem emb_b_dev(sizeof(EmbType) * emb_b.mDesc.GetElementSpaceSize());
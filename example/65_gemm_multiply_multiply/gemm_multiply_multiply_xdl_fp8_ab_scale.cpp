@@ -16,7 +16,7 @@
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
-#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm_ab_scale.hpp"
 #include "ck/library/utility/check_err.hpp"
 
 #include "ck/utility/blkgemmpipe_scheduler.hpp"
@@ -257,53 +257,29 @@ int main(int argc, char* argv[])
 
     if(do_verification)
     {
-        Tensor<AccDataType> c_m_n({M, N});
-        Tensor<float> a_m_k({M, K});
-        Tensor<float> b_k_n({K, N});
-
-        for(int m = 0; m < M; m++)
-        {
-            for(int k = 0; k < K; k++)
-            {
-                a_m_k(m, k) = ck::type_convert<float>(a0_m_k(m, k)) *
-                              a1_m_k(m / Scale_Block_M, k / Scale_Block_K);
-            }
-        }
-
-        for(int n = 0; n < N; n++)
-        {
-            for(int k = 0; k < K; k++)
-            {
-                b_k_n(k, n) = ck::type_convert<float>(b0_k_n(k, n)) *
-                              b1_k_n(k / Scale_Block_K, n / Scale_Block_N);
-            }
-        }
-
-        using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<float,
-                                                                                float,
-                                                                                CShuffleDataType,
-                                                                                AccDataType,
-                                                                                PassThrough,
-                                                                                PassThrough,
-                                                                                PassThrough>;
-        auto ref_gemm               = ReferenceGemmInstance{};
-        auto ref_invoker            = ref_gemm.MakeInvoker();
-
-        auto ref_argument =
-            ref_gemm.MakeArgument(a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+        using ReferenceGemmInstance =
+            ck::tensor_operation::host::ReferenceGemmABScale<A0DataType,
+                                                             A1DataType,
+                                                             B0DataType,
+                                                             B1DataType,
+                                                             EDataType,
+                                                             AccDataType,
+                                                             PassThrough>;
+        auto ref_gemm    = ReferenceGemmInstance{};
+        auto ref_invoker = ref_gemm.MakeInvoker();
+
+        auto ref_argument = ref_gemm.MakeArgument(a0_m_k,
+                                                  a1_m_k,
+                                                  b0_k_n,
+                                                  b1_k_n,
+                                                  e_m_n_host_result,
+                                                  Scale_Block_M,
+                                                  Scale_Block_N,
+                                                  Scale_Block_K,
+                                                  PassThrough{});
 
         ref_invoker.Run(ref_argument);
 
-#if 1
-        for(int m = 0; m < M; ++m)
-        {
-            for(int n = 0; n < N; ++n)
-            {
-                e_m_n_host_result(m, n) = ck::type_convert<EDataType>(c_m_n(m, n));
-            }
-        }
-#endif
-
         e_device_buf.FromDevice(e_m_n_device_result.mData.data());
 
         return ck::utils::check_err(
@@ -0,0 +1,97 @@
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+# emit the dispatch tables of the generated APIs, see fmha_dispatch.hpp
+
+from dataclasses import dataclass
+from typing import List, Tuple
+
+# sync with mask_enum/bias_enum, order of the values is the order of the keys
+MASK_ENUM_LIST = [
+    "mask_enum::no_mask",
+    "mask_enum::mask_top_left",
+    "mask_enum::mask_bottom_right",
+    "mask_enum::window_generic",
+]
+
+BIAS_ENUM_LIST = [
+    "bias_enum::no_bias",
+    "bias_enum::elementwise_bias",
+    "bias_enum::alibi",
+]
+
+_MASK_ENUM_MAP = {
+    "no" : ["mask_enum::no_mask"],
+    "causal" : ["mask_enum::mask_top_left", "mask_enum::mask_bottom_right"],
+    "generic" : ["mask_enum::window_generic"],
+}
+
+_MASK_SIMPLIFIED_ENUM_MAP = {
+    "s_no" : ["mask_enum::no_mask"],
+    "s_mask" : ["mask_enum::mask_top_left", "mask_enum::mask_bottom_right", "mask_enum::window_generic"],
+}
+
+# mask_enum values accepted by a mask, same as get_mask_check_map()
+def get_mask_enum_map(mask : str):
+    if mask == "generic":
+        return _MASK_ENUM_MAP
+    elif mask == "simplified":
+        return _MASK_SIMPLIFIED_ENUM_MAP
+    else:
+        assert False
+        return None
+
+@dataclass(frozen=True)
+class SizeCheck:
+    # sync with fmha_size_check
+    multiple     : int  = 1
+    not_multiple : int  = 0
+    zero         : bool = True
+
+    def __str__(self) -> str:
+        return f'{{{self.multiple}, {self.not_multiple}, {"true" if self.zero else "false"}}}'
+
+SIZE_ANY = SizeCheck()
+
+def size_multiple_of(n : int, zero : bool = True) -> SizeCheck:
+    return SizeCheck(multiple=n, zero=zero)
+
+def size_not_multiple_of(n : int, zero : bool = False) -> SizeCheck:
+    return SizeCheck(not_multiple=n, zero=zero)
+
+DISPATCH_TABLE_BODY="""
+constexpr std::array<fmha_dispatch_bucket, {F_num_buckets}> {F_name}_buckets = {{{{
+{F_buckets}}}}};
+
+constexpr std::array<fmha_dispatch_entry<{F_args}>, {F_num_entries}> {F_name}_table = {{{{
+{F_entries}}}}};
+static_assert(fmha_dispatch_is_sorted({F_name}_table));
+"""
+
+class DispatchTable:
+    """
+    (key, size checks, launcher) entries of one API. The key of an entry is given twice, as C++
+    expression and as python tuple of the same fields, which is used to sort the table.
+    """
+    def __init__(self, name : str, args : str):
+        self.name = name
+        self.args = args
+        self.buckets : List[Tuple[str, int]] = list()
+        self.entries : List[Tuple[tuple, str]] = list()
+
+    def add_bucket(self, dtype : str, hdim) -> int:
+        self.buckets.append((dtype, int(hdim)))
+        assert len(self.buckets) <= 256 # 8 bits in the key
+        return len(self.buckets) - 1
+
+    def add_entry(self, sort_key : tuple, key : str, checks : Tuple[SizeCheck, SizeCheck, SizeCheck, SizeCheck], launcher : str) -> None:
+        entry = f'    {{{key}, {", ".join(str(c) for c in checks)}, {launcher}}},\n'
+        self.entries.append((sort_key, entry))
+
+    @property
+    def body(self) -> str:
+        # stable sort, instances of the same key stay in order of generation
+        entries = sorted(self.entries, key=lambda e: e[0])
+        buckets = str().join(f'    {{"{dtype}", {hdim}}},\n' for dtype, hdim in self.buckets)
+        return DISPATCH_TABLE_BODY.format(F_name=self.name, F_args=self.args,
+                    F_num_buckets=len(self.buckets), F_buckets=buckets,
+                    F_num_entries=len(entries), F_entries=str().join(e[1] for e in entries))
@@ -11,6 +11,7 @@ from typing import List, Optional, Tuple
 
 from codegen.cmake_config import *
 from codegen.cpp_symbol_map import *
+from codegen.dispatch_table import *
 
 
 BWD_DQDKDV_PIPELINE_MAP = {
@@ -157,30 +158,32 @@ float fmha_bwd_(const ck_tile::stream_config& s, fmha_bwd_args a)
     );
 }}
 
+namespace {{
+constexpr uint64_t fmha_bwd_key(int bucket, bool is_group_mode, mask_enum mask_type, bias_enum bias_type, bool has_dbias, bool has_dropout)
+{{
+    return fmha_dispatch_key{{}}.field(bucket, 8).field(is_group_mode, 1).field(mask_type, 2).field(bias_type, 2)
+                                .field(has_dbias, 1).field(has_dropout, 1).value;
+}}
+{F_traits}{F_table}
+}} // namespace
+
+fmha_bwd_handle fmha_bwd_resolve(const fmha_bwd_traits& t){{
+    const int bucket = fmha_dispatch_find_bucket(fmha_bwd_buckets, t.data_type, t.hdim_q, t.hdim_v);
+    if(bucket < 0)
+        return {{}};
+    return fmha_dispatch_find(fmha_bwd_table, fmha_bwd_key(bucket, t.is_group_mode, t.mask_type, t.bias_type, t.has_dbias, t.has_dropout));
+}}
+
 float fmha_bwd(fmha_bwd_traits t, fmha_bwd_args a, const ck_tile::stream_config& s){{
-    float r = -1;
-{F_dispatch}
-    return r;
+    return fmha_bwd_resolve(t)(s, a);
 }}
 """
 
-FMHA_BWD_API_PER_DTYPE="""    {F_if}(t.data_type.compare(\"{F_dtype}\") == 0){{
-{F_hdim_case}
-    }}
-"""
-FMHA_BWD_API_PER_HDIM_CASE="""        {F_if} (t.hdim_q <= {F_hdim} && t.hdim_v <= {F_hdim}) {{
-{F_inner_dispatch}
-        }}
+FMHA_BWD_API_TRAIT="""using dq_dk_dv_trait_{F_idx} = fmha_bwd_dq_dk_dv_traits_<{F_hdim}, {F_dtype}, {F_mode}, {F_pipeline_enum}, {F_mask}, {F_bias}, {F_dbias}, {F_dropout}, {F_spad0}, {F_skpad}, {F_dpad}, {F_dvpad}>;
+using dot_do_o_trait_{F_idx} = fmha_bwd_dot_do_o_traits_<{F_hdim}, {F_dtype}, {F_mode}, {F_spad1}, {F_dvpad}>;
 """
 
-FMHA_BWD_API_INNER_DISPATCH="""            {F_if}((t.is_group_mode == {F_mode}) && ({F_mask_check}) && (t.bias_type == {F_bias_check}) && (t.has_dbias == {F_dbias}) && (t.has_dropout == {F_dropout}) &&
-                        ({F_scheck}) && ({F_skcheck}) && ({F_dcheck}) && ({F_dvcheck})) {{
-                using dq_dk_dv_trait_ = fmha_bwd_dq_dk_dv_traits_<{F_hdim}, {F_dtype}, {F_mode}, {F_pipeline_enum}, {F_mask}, {F_bias}, {F_dbias}, {F_dropout}, {F_spad0}, {F_skpad}, {F_dpad}, {F_dvpad}>;
-                using dot_do_o_trait_ = fmha_bwd_dot_do_o_traits_<{F_hdim}, {F_dtype}, {F_mode}, {F_spad1}, {F_dvpad}>;
-                r = fmha_bwd_<dot_do_o_trait_, dq_dk_dv_trait_>(s, a);
-                return r;
-            }}
-"""
+FMHA_BWD_API_KEY="fmha_bwd_key({F_bucket}, {F_mode}, {F_mask_enum}, {F_bias_check}, {F_dbias}, {F_dropout})"
 
 @dataclass
 class FmhaBwdDQDKDVApiTrait:
@@ -206,34 +209,42 @@ class FmhaBwdDQDKDVApiTrait:
     def name(self) -> str:
         return f'{self.pipeline}-{self.hdim}-{self.dtype}-{self.mode}-{self.mask}-{self.bias}-{self.dbias}-{self.dropout}-{self.spad}-{self.skpad}-{self.dpad}-{self.dvpad}'
 
-    def scheck(self, spad1 : str) -> str:
+    def scheck(self, spad1 : str) -> SizeCheck:
         if self.mode == 'group':
-            return 'true' # always support
+            return SIZE_ANY # always support
         elif self.spad == 't' and spad1 == 't':
-            return f'a.seqlen_q % {self.bm0} != 0'
+            return size_not_multiple_of(self.bm0)
         elif self.spad == 'f' and spad1 == 't':
-            return f'a.seqlen_q % {self.bm0} == 0 and a.seqlen_q % 256 != 0' # BlockSize
+            return SizeCheck(multiple=self.bm0, not_multiple=256, zero=False) # BlockSize
         else: # self.skpad == 'f' and skpad1 == 'f'
-            return f'a.seqlen_q % 256 == 0' # BlockSize
+            return size_multiple_of(256) # BlockSize
 
     @property
-    def skcheck(self) -> str:
+    def skcheck(self) -> SizeCheck:
         if self.mode == 'group':
-            return 'true' # always support
+            return SIZE_ANY # always support
         elif self.skpad == 't':
-            return f'a.seqlen_k % {self.bn0} != 0'
+            return size_not_multiple_of(self.bn0)
         else:
-            return f'a.seqlen_k % {self.bn0} == 0'
+            return size_multiple_of(self.bn0)
 
     @property
-    def dcheck(self) -> str:
-        if self.dpad == 't': return f'a.hdim_q % {self.bhdq} != 0'
-        else :               return f'a.hdim_q % {self.bhdq} == 0'
+    def dcheck(self) -> SizeCheck:
+        if self.dpad == 't': return size_not_multiple_of(self.bhdq)
+        else :               return size_multiple_of(self.bhdq)
 
     @property
-    def dvcheck(self) -> str:
-        if self.dvpad == 't': return f'a.hdim_v % {self.bhdv} != 0'
-        else :                return f'a.hdim_v % {self.bhdv} == 0'
+    def dvcheck(self) -> SizeCheck:
+        if self.dvpad == 't': return size_not_multiple_of(self.bhdv)
+        else :                return size_multiple_of(self.bhdv)
+
+    def size_checks(self, spad1 : str) -> Tuple[SizeCheck, SizeCheck, SizeCheck, SizeCheck]:
+        return (self.scheck(spad1), self.skcheck, self.dcheck, self.dvcheck)
+
+    def key_fields(self, bucket : int, mask_enum : str) -> tuple:
+        # python version of the key, sync with field order of fmha_bwd_key()
+        return (bucket, self.mode == 'group', MASK_ENUM_LIST.index(mask_enum), BIAS_ENUM_LIST.index(BIAS_CHECK_MAP[self.bias]),
+                self.dbias == 't', self.dropout == 't')
 
 class FmhaBwdApiPool:
     def __init__(self, mask_impl):
@@ -251,30 +262,27 @@ class FmhaBwdApiPool:
 
     @property
     def api(self) -> str:
-        per_dtypes=str()
-        for i, dtype in enumerate(self.dq_dk_dv_pool.keys()):
-            per_hdim_case=str()
-            for j, hdim in enumerate(self.dq_dk_dv_pool[dtype].keys()):
-                traits=self.dq_dk_dv_pool[dtype][hdim]
-                inners=str()
-                for k, trait in enumerate(traits):
-                    if_k = 'if' if k == 0 else 'else if'
+        table = DispatchTable('fmha_bwd', 'fmha_bwd_args')
+        traits_str = str()
+        idx = 0
+        for dtype in self.dq_dk_dv_pool.keys():
+            for hdim in self.dq_dk_dv_pool[dtype].keys():
+                bucket = table.add_bucket(dtype, hdim)
+                for trait in self.dq_dk_dv_pool[dtype][hdim]:
                     for spad1 in ["t", "f"]:
                         if ((spad1 == "f" and trait.spad == "t") or (trait.mode == "group" and spad1 == "f")):
                             continue
-                        inners = inners + FMHA_BWD_API_INNER_DISPATCH.format(F_if=if_k, F_mode=MODE_MAP[trait.mode], F_mask=get_mask_map(self.mask_impl)[trait.mask], F_pipeline_enum=BWD_DQDKDV_PIPELINE_ENUM_MAP[trait.pipeline],
-                                    F_mask_check=get_mask_check_map(self.mask_impl)[trait.mask], F_bias_check=BIAS_CHECK_MAP[trait.bias], F_bias=BIAS_MAP[trait.bias], F_dbias=BOOL_MAP[trait.dbias], F_dropout=BOOL_MAP[trait.dropout],
-                                    F_scheck=trait.scheck(spad1=spad1), F_skcheck=trait.skcheck, F_dcheck=trait.dcheck, F_dvcheck=trait.dvcheck, F_hdim=hdim, F_dtype=DTYPE_MAP[dtype],
+                        traits_str = traits_str + FMHA_BWD_API_TRAIT.format(F_idx=idx, F_mode=MODE_MAP[trait.mode], F_mask=get_mask_map(self.mask_impl)[trait.mask],
+                                    F_pipeline_enum=BWD_DQDKDV_PIPELINE_ENUM_MAP[trait.pipeline], F_bias=BIAS_MAP[trait.bias], F_dbias=BOOL_MAP[trait.dbias],
+                                    F_dropout=BOOL_MAP[trait.dropout], F_hdim=hdim, F_dtype=DTYPE_MAP[dtype],
                                     F_spad0=BOOL_MAP[trait.spad], F_spad1=BOOL_MAP[spad1], F_skpad=BOOL_MAP[trait.skpad], F_dpad=BOOL_MAP[trait.dpad], F_dvpad=BOOL_MAP[trait.dvpad])
-
-                if_j = 'if' if j == 0 else 'else if'
-                per_hdim_case = per_hdim_case + FMHA_BWD_API_PER_HDIM_CASE.format(F_if=if_j, F_hdim=hdim, F_inner_dispatch=inners)
-            if_i = 'if' if i == 0 else 'else if'
-            per_dtypes = per_dtypes + FMHA_BWD_API_PER_DTYPE.format(F_if=if_i, F_dtype=dtype, F_hdim_case=per_hdim_case)
-        if not per_dtypes:
-            # empty string we add some ignore to suppress warning in api
-            per_dtypes += '    (void)t ; (void)s ; (void)a;'
-        return FMHA_BWD_KERNEL_HEADER + FMHA_BWD_API.format(F_dispatch = per_dtypes)
+                        for mask_enum in get_mask_enum_map(self.mask_impl)[trait.mask]:
+                            key = FMHA_BWD_API_KEY.format(F_bucket=bucket, F_mode=MODE_MAP[trait.mode], F_mask_enum=mask_enum,
+                                    F_bias_check=BIAS_CHECK_MAP[trait.bias], F_dbias=BOOL_MAP[trait.dbias], F_dropout=BOOL_MAP[trait.dropout])
+                            table.add_entry(trait.key_fields(bucket, mask_enum), key, trait.size_checks(spad1),
+                                            f'fmha_bwd_<dot_do_o_trait_{idx}, dq_dk_dv_trait_{idx}>')
+                        idx = idx + 1
+        return FMHA_BWD_KERNEL_HEADER + FMHA_BWD_API.format(F_traits=traits_str, F_table=table.body)
 
 # GEMM0: Q@K=S^T
 # GEMM1: P^T@dO^T=dV(This was chosen as G1 to match fwd, but N1 must be equal to headdim_v)
@@ -11,6 +11,7 @@ from typing import List, Optional, Tuple
 
 from codegen.cmake_config import *
 from codegen.cpp_symbol_map import *
+from codegen.dispatch_table import *
 
 
 DTYPE_BITS = {
@@ -108,28 +109,33 @@ float fmha_fwd_<trait_{F_idx}>(const ck_tile::stream_config& s, fmha_fwd_args a)
 
 FMHA_FWD_API_FILENAME="fmha_fwd_api.cpp"
 FMHA_FWD_API="""
+namespace {{
+constexpr uint64_t fmha_fwd_key(int bucket, bool is_group_mode, bool is_v_rowmajor, mask_enum mask_type, bias_enum bias_type,
+                                bool has_lse, bool has_dropout, bool do_fp8_static_quant)
+{{
+    return fmha_dispatch_key{{}}.field(bucket, 8).field(is_group_mode, 1).field(is_v_rowmajor, 1).field(mask_type, 2).field(bias_type, 2)
+                                .field(has_lse, 1).field(has_dropout, 1).field(do_fp8_static_quant, 1).value;
+}}
+{F_traits}{F_table}
+}} // namespace
+
+fmha_fwd_handle fmha_fwd_resolve(const fmha_fwd_traits& t){{
+    const int bucket = fmha_dispatch_find_bucket(fmha_fwd_buckets, t.data_type, t.hdim_q, t.hdim_v);
+    if(bucket < 0)
+        return {{}};
+    return fmha_dispatch_find(fmha_fwd_table, fmha_fwd_key(bucket, t.is_group_mode, t.is_v_rowmajor, t.mask_type, t.bias_type,
+                                                           t.has_lse, t.has_dropout, t.do_fp8_static_quant));
+}}
+
 float fmha_fwd(fmha_fwd_traits t, fmha_fwd_args a, const ck_tile::stream_config& s){{
-    float r = -1;
-{F_dispatch}
-    return r;
+    return fmha_fwd_resolve(t)(s, a);
 }}
 """
 
-FMHA_FWD_API_PER_DTYPE="""    {F_if}(t.data_type.compare(\"{F_dtype}\") == 0){{
-{F_hdim_case}
-    }}
-"""
-FMHA_FWD_API_PER_HDIM_CASE="""        {F_if} (t.hdim_q <= {F_hdim} && t.hdim_v <= {F_hdim}) {{
-{F_inner_dispatch}
-        }}
+FMHA_FWD_API_TRAIT="""using trait_{F_idx} = fmha_fwd_traits_<{F_hdim}, {F_dtype}, {F_mode}, {F_bm0}, {F_bn0}, {F_bk0}, {F_bn1}, {F_bk1}, {F_bk0blen}, {F_vlayout}, {F_pipeline_enum}, {F_mask}, {F_bias}, {F_lse}, {F_dropout}, {F_squant}, {F_spad}, {F_skpad}, {F_dpad}, {F_dvpad}>;
 """
 
-FMHA_FWD_API_INNER_DISPATCH="""            {F_if}((t.is_group_mode == {F_mode}) && (t.is_v_rowmajor == {F_vlayout}) && ({F_mask_check}) && (t.bias_type == {F_bias_check}) && (t.has_lse == {F_lse})  && (t.has_dropout == {F_dropout}) && (t.do_fp8_static_quant == {F_squant}) &&
-                        ({F_scheck}) && ({F_skcheck}) && ({F_dcheck}) && ({F_dvcheck})) {{
-                using trait_ = fmha_fwd_traits_<{F_hdim}, {F_dtype}, {F_mode}, {F_bm0}, {F_bn0}, {F_bk0}, {F_bn1}, {F_bk1}, {F_bk0blen}, {F_vlayout}, {F_pipeline_enum}, {F_mask}, {F_bias}, {F_lse}, {F_dropout}, {F_squant}, {F_spad}, {F_skpad}, {F_dpad}, {F_dvpad}>;
-                return fmha_fwd_<trait_>(s, a);
-            }}
-"""
+FMHA_FWD_API_KEY="fmha_fwd_key({F_bucket}, {F_mode}, {F_vlayout}, {F_mask_enum}, {F_bias_check}, {F_lse}, {F_dropout}, {F_squant})"
 
 @dataclass
 class FmhaFwdApiTrait:
@@ -161,49 +167,58 @@ class FmhaFwdApiTrait:
                     f'{self.vlayout}-{self.mask}-{self.bias}-{self.lse}-{self.dropout}-{self.squant}-{self.spad}-{self.skpad}-{self.dpad}-{self.dvpad}'
 
     @property
-    def scheck(self) -> str:
-        if self.mode == 'group': return 'true/*group mode spad always true*/'                  # group mode only generate spad/skpad == true
+    def scheck(self) -> SizeCheck:
+        if self.mode == 'group': return SIZE_ANY   # group mode only generate spad/skpad == true
         if self.pipeline_tag == 'qr_async':
-            if self.spad == 't' : return 'true' # always support
-            else :                return 'true'
+            if self.spad == 't' : return SIZE_ANY # always support
+            else :                return SIZE_ANY
         elif self.pipeline_tag in ['qr']:
-            if self.spad == 't' : return f'true /*a.seqlen_q % {self.bm0} != 0*/'  # TODO: order of get_pipelines() matters! (ugly)
-            else :                return f'a.seqlen_q % {self.bm0} == 0'
+            if self.spad == 't' : return SIZE_ANY # a.seqlen_q % bm0 != 0, TODO: order of get_pipelines() matters! (ugly)
+            else :                return size_multiple_of(self.bm0)
         else: assert False
 
     @property
-    def skcheck(self) -> str:
-        if self.mode == 'group': return 'true/*group mode skpad always true*/'                  # group mode only generate spad/skpad == true
+    def skcheck(self) -> SizeCheck:
+        if self.mode == 'group': return SIZE_ANY   # group mode only generate spad/skpad == true
         if self.pipeline_tag == 'qr_async':
-            if self.skpad == 't' : return f'a.seqlen_k == 0 || a.seqlen_k % {self.bn0} != 0'
-            else :                 return f'a.seqlen_k != 0 && a.seqlen_k % {self.bn0} == 0'
+            if self.skpad == 't' : return size_not_multiple_of(self.bn0, zero=True)
+            else :                 return size_multiple_of(self.bn0, zero=False)
         elif self.pipeline_tag in ['qr', 'qr_fp8']:
-            if self.skpad == 't' : return f'true /*a.seqlen_k % {self.bn0} != 0*/' # TODO: order of get_pipelines() matters! (ugly)
-            else :                return f'a.seqlen_k % {self.bn0} == 0'
+            if self.skpad == 't' : return SIZE_ANY # a.seqlen_k % bn0 != 0, TODO: order of get_pipelines() matters! (ugly)
+            else :                return size_multiple_of(self.bn0)
         else: assert False
 
     @property
-    def dcheck(self) -> str:
+    def dcheck(self) -> SizeCheck:
         if self.pipeline_tag == 'qr_async':
             vec = int((32 * 4) / DTYPE_BITS[self.dtype])
-            if self.dpad == 't': return f'a.hdim_q % {vec} == 0'
+            if self.dpad == 't': return size_multiple_of(vec)
             else :               assert False
         elif self.pipeline_tag in ['qr']:
-            if self.dpad == 't': return f'true /*a.hdim_q % {self.bk0blen} != 0*/' # TODO: order of get_pipelines() matters! (ugly)
-            else :               return f'a.hdim_q % {self.bk0blen} == 0'
+            if self.dpad == 't': return SIZE_ANY # a.hdim_q % bk0blen != 0, TODO: order of get_pipelines() matters! (ugly)
+            else :               return size_multiple_of(self.bk0blen)
         else:   assert False
 
     @property
-    def dvcheck(self) -> str:
+    def dvcheck(self) -> SizeCheck:
         if self.pipeline_tag == 'qr_async':
             vec = int((32 * 4) / DTYPE_BITS[self.dtype])
-            if self.dvpad == 't': return f'a.hdim_v % {vec} == 0'
+            if self.dvpad == 't': return size_multiple_of(vec)
             else :                assert False
         elif self.pipeline_tag in ['qr']:
-            if self.dvpad == 't': return f'true /*a.hdim_v % {self.bk0blen} != 0*/' # TODO: order of get_pipelines() matters! (ugly)
-            else :                return f'a.hdim_v % {self.bk0blen} == 0'
+            if self.dvpad == 't': return SIZE_ANY # a.hdim_v % bk0blen != 0, TODO: order of get_pipelines() matters! (ugly)
+            else :                return size_multiple_of(self.bk0blen)
         else:   assert False
 
+    @property
+    def size_checks(self) -> Tuple[SizeCheck, SizeCheck, SizeCheck, SizeCheck]:
+        return (self.scheck, self.skcheck, self.dcheck, self.dvcheck)
+
+    def key_fields(self, bucket : int, mask_enum : str) -> tuple:
+        # python version of the key, sync with field order of fmha_fwd_key()
+        return (bucket, self.mode == 'group', self.vlayout == 'row', MASK_ENUM_LIST.index(mask_enum), BIAS_ENUM_LIST.index(BIAS_CHECK_MAP[self.bias]),
+                self.lse == 't', self.dropout == 't', self.squant == 't')
+
 @dataclass
 class FmhaFwdPipeline:
     tag : str
@@ -258,30 +273,26 @@ class FmhaFwdApiPool:
 
     @property
     def api(self) -> str:
-        per_dtypes=str()
-        for i, dtype in enumerate(self.pool.keys()):
-            per_hdim_case=str()
-            for j, hdim in enumerate(self.pool[dtype].keys()):
-                traits=self.pool[dtype][hdim]
-                inners=str()
-                for k, trait in enumerate(traits):
-                    if_k = 'if' if k == 0 else 'else if'
-                    inners = inners + FMHA_FWD_API_INNER_DISPATCH.format(F_if=if_k, F_mode=MODE_MAP[trait.mode], F_vlayout=LAYOUT_MAP[trait.vlayout],
+        table = DispatchTable('fmha_fwd', 'fmha_fwd_args')
+        traits_str = str()
+        idx = 0
+        for dtype in self.pool.keys():
+            for hdim in self.pool[dtype].keys():
+                bucket = table.add_bucket(dtype, hdim)
+                for trait in self.pool[dtype][hdim]:
+                    traits_str = traits_str + FMHA_FWD_API_TRAIT.format(F_idx=idx, F_mode=MODE_MAP[trait.mode], F_vlayout=LAYOUT_MAP[trait.vlayout],
                                    F_pipeline_enum=PIPELINE_ENUM_MAP[trait.pipeline_tag], F_mask=get_mask_map(self.mask_impl)[trait.mask],
-                                   F_mask_check=get_mask_check_map(self.mask_impl)[trait.mask], F_bias_check=BIAS_CHECK_MAP[trait.bias], F_bias=BIAS_MAP[trait.bias],
-                                   F_lse=BOOL_MAP[trait.lse], F_dropout=BOOL_MAP[trait.dropout] ,
-                                   F_squant=BOOL_MAP[trait.squant], F_scheck=trait.scheck, F_skcheck=trait.skcheck, F_dcheck=trait.dcheck, F_dvcheck=trait.dvcheck,
+                                   F_bias=BIAS_MAP[trait.bias], F_lse=BOOL_MAP[trait.lse], F_dropout=BOOL_MAP[trait.dropout], F_squant=BOOL_MAP[trait.squant],
                                    F_spad=BOOL_MAP[trait.spad], F_skpad=BOOL_MAP[trait.skpad], F_dpad=BOOL_MAP[trait.dpad], F_dvpad=BOOL_MAP[trait.dvpad],
                                    F_bm0=trait.bm0, F_bn0=trait.bn0, F_bk0=trait.bk0, F_bn1=trait.bn1, F_bk1=trait.bk1, F_bk0blen=trait.bk0blen,
                                    F_hdim=hdim, F_dtype=DTYPE_MAP[dtype])
-                if_j = 'if' if j == 0 else 'else if'
-                per_hdim_case = per_hdim_case + FMHA_FWD_API_PER_HDIM_CASE.format(F_if=if_j, F_hdim=hdim, F_inner_dispatch=inners)
-            if_i = 'if' if i == 0 else 'else if'
-            per_dtypes = per_dtypes + FMHA_FWD_API_PER_DTYPE.format(F_if=if_i, F_dtype=dtype, F_hdim_case=per_hdim_case)
-        if not per_dtypes:
-            # empty string we add some ignore to suppress warning in api
-            per_dtypes += '    (void)t ; (void)s ; (void)a;'
-        return FMHA_FWD_KERNEL_HEADER + FMHA_FWD_API.format(F_dispatch = per_dtypes)
+                    for mask_enum in get_mask_enum_map(self.mask_impl)[trait.mask]:
+                        key = FMHA_FWD_API_KEY.format(F_bucket=bucket, F_mode=MODE_MAP[trait.mode], F_vlayout=LAYOUT_MAP[trait.vlayout],
+                                   F_mask_enum=mask_enum, F_bias_check=BIAS_CHECK_MAP[trait.bias], F_lse=BOOL_MAP[trait.lse],
+                                   F_dropout=BOOL_MAP[trait.dropout], F_squant=BOOL_MAP[trait.squant])
+                        table.add_entry(trait.key_fields(bucket, mask_enum), key, trait.size_checks, f'fmha_fwd_<trait_{idx}>')
+                    idx = idx + 1
+        return FMHA_FWD_KERNEL_HEADER + FMHA_FWD_API.format(F_traits=traits_str, F_table=table.body)
 
 @dataclass
 class FmhaFwdTileSize:
@@ -580,12 +580,56 @@ bool run(const ck_tile::ArgParser& arg_parser)
         else       v_host_ref.ForEach([&](auto& self, auto i) { self(i) = v_host(b, i[2] + key_offset, i[0] / nr, i[1]); });
         // clang-format on
 
+        // unmasked columns of every row of S, the only ones the reference computes
+        const auto s_row_ranges = [&]() {
+            if(mask.type == mask_enum::no_mask)
+            {
+                return ck_tile::make_masking_row_ranges(
+                    FmhaMasks::NoMask{real_seqlen_q, real_seqlen_k}, real_seqlen_q, real_seqlen_k);
+            }
+            else if(mask.type == mask_enum::window_generic)
+            {
+                return ck_tile::make_masking_row_ranges(
+                    ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::GenericMask>(
+                        mask.left, mask.right, real_seqlen_q, real_seqlen_k),
+                    real_seqlen_q,
+                    real_seqlen_k);
+            }
+            // if left window size is negative, means causal
+            // else means generic (for current batch)
+            else if(mask.left < 0)
+            {
+                return ck_tile::make_masking_row_ranges(
+                    ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::CausalMask>(
+                        mask.left,
+                        mask.right,
+                        real_seqlen_q,
+                        real_seqlen_k,
+                        mask.type == mask_enum::mask_top_left),
+                    real_seqlen_q,
+                    real_seqlen_k);
+            }
+            else
+            {
+                return ck_tile::make_masking_row_ranges(
+                    ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::GenericMask>(
+                        mask.left,
+                        mask.right,
+                        real_seqlen_q,
+                        real_seqlen_k,
+                        mask.type == mask_enum::mask_top_left),
+                    real_seqlen_q,
+                    real_seqlen_k);
+            }
+        }();
+
         // reference
-        // S = scale * Q * K^T
-        ck_tile::reference_batched_gemm<QDataType, KDataType, AccDataType, AccDataType>(
+        // S = scale * Q * K^T, masked S = -inf
+        ck_tile::reference_batched_masked_gemm<QDataType, KDataType, AccDataType, AccDataType>(
             q_host_ref,
             k_host_ref,
             s_host_ref,
+            s_row_ranges,
             ck_tile::identity{},
             ck_tile::identity{},
             ck_tile::scales(scale)); // s_g_m_n = scale * q_g_m_k@k_g_n_k
@@ -652,43 +696,8 @@ bool run(const ck_tile::ArgParser& arg_parser)
                     s_host_ref, alibi_bias_host_ref, s_host_ref);
         }
 
-        if(mask.type == mask_enum::no_mask)
-        {
-            ck_tile::reference_batched_masking<AccDataType>(
-                s_host_ref, FmhaMasks::NoMask{real_seqlen_q, real_seqlen_k});
-        }
-        else if(mask.type == mask_enum::window_generic)
-        {
-            ck_tile::reference_batched_masking<AccDataType>(
-                s_host_ref,
-                ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::GenericMask>(
-                    mask.left, mask.right, real_seqlen_q, real_seqlen_k));
-        }
-        else
-        {
-            // if left window size is negative, means causal
-            // else means generic (for current batch)
-            if(mask.left < 0)
-                ck_tile::reference_batched_masking<AccDataType>(
-                    s_host_ref,
-                    ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::CausalMask>(
-                        mask.left,
-                        mask.right,
-                        real_seqlen_q,
-                        real_seqlen_k,
-                        mask.type == mask_enum::mask_top_left));
-            else
-                ck_tile::reference_batched_masking<AccDataType>(
-                    s_host_ref,
-                    ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::GenericMask>(
-                        mask.left,
-                        mask.right,
-                        real_seqlen_q,
-                        real_seqlen_k,
-                        mask.type == mask_enum::mask_top_left));
-        }
-        ck_tile::reference_batched_softmax<AccDataType, LSEDataType, AccDataType>(
-            s_host_ref, p_hp_host_ref, ck_tile::identity{}, lse_host_ref);
+        ck_tile::reference_batched_masked_softmax<AccDataType, LSEDataType, AccDataType>(
+            s_host_ref, p_hp_host_ref, s_row_ranges, ck_tile::identity{}, lse_host_ref);
 
         if(p_drop > 0)
         {
@@ -710,9 +719,12 @@ bool run(const ck_tile::ArgParser& arg_parser)
             });
         }
 
-        // O = P * V
-        ck_tile::reference_batched_gemm<GemmDataType, VDataType, AccDataType, ODataType>(
-            p_lp_host_ref, v_host_ref, o_host_ref); // o_g_m_o = p_lp_g_m_n@v_g_o_n
+        // O = P * V, P is zero outside the row ranges of S
+        ck_tile::reference_batched_gemm_with_masked_a<GemmDataType,
+                                                      VDataType,
+                                                      AccDataType,
+                                                      ODataType>(
+            p_lp_host_ref, v_host_ref, o_host_ref, s_row_ranges); // o_g_m_o = p_lp_g_m_n@v_g_o_n
 
         // clang-format off
         // permute
@@ -9,6 +9,7 @@
 #include "ck_tile/ops/epilogue.hpp"
 #include "mask.hpp"
 #include "bias.hpp"
+#include "fmha_dispatch.hpp"
 #include <type_traits>
 
 template <typename DataType>
@@ -357,3 +358,7 @@ struct fmha_bwd_traits
     // TODO: padding check is inside this api
 };
 float fmha_bwd(fmha_bwd_traits, fmha_bwd_args, const ck_tile::stream_config&);
+
+// resolve traits once, then launch with handle(stream_config, args) without trait dispatch
+using fmha_bwd_handle = fmha_dispatch_handle<fmha_bwd_args>;
+fmha_bwd_handle fmha_bwd_resolve(const fmha_bwd_traits&);
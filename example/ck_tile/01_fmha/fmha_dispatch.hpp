@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include "ck_tile/core.hpp"
+#include "ck_tile/host/stream_config.hpp"
+
+// Table driven dispatch of the generated fmha APIs (fmha_fwd, fmha_fwd_splitkv, fmha_bwd).
+//
+// The generator encodes the traits of every kernel instance into an integer key and emits a table
+// of instances sorted by key. Traits are looked up once by binary search (fmha_*_resolve()), the
+// resulting handle only has to pick the first instance of the key whose size requirements are
+// met by the problem. Instances of the same key keep the order of generation.
+
+// Requirement of a kernel instance on one problem size (seqlen_q, seqlen_k, hdim_q or hdim_v):
+//   size == 0 ? zero : size % multiple == 0 && (not_multiple == 0 || size % not_multiple != 0)
+struct fmha_size_check
+{
+    ck_tile::index_t multiple;
+    ck_tile::index_t not_multiple;
+    bool zero;
+
+    constexpr bool operator()(ck_tile::index_t size) const
+    {
+        if(size == 0)
+            return zero;
+        return size % multiple == 0 && (not_multiple == 0 || size % not_multiple != 0);
+    }
+};
+
+template <typename Args>
+struct fmha_dispatch_entry
+{
+    using launcher = float (*)(const ck_tile::stream_config&, Args);
+
+    uint64_t key;
+    fmha_size_check seqlen_q;
+    fmha_size_check seqlen_k;
+    fmha_size_check hdim_q;
+    fmha_size_check hdim_v;
+    launcher launch;
+
+    constexpr bool is_applicable(const Args& a) const
+    {
+        return seqlen_q(a.seqlen_q) && seqlen_k(a.seqlen_k) && hdim_q(a.hdim_q) && hdim_v(a.hdim_v);
+    }
+};
+
+// All kernel instances generated for one set of traits. Resolve it once and reuse it for every
+// problem with the same traits, e.g. in a decode loop. An empty handle means there is no instance.
+template <typename Args>
+struct fmha_dispatch_handle
+{
+    const fmha_dispatch_entry<Args>* first = nullptr;
+    const fmha_dispatch_entry<Args>* last  = nullptr;
+
+    explicit operator bool() const { return first != last; }
+
+    // launch the first instance supporting the problem sizes of a, return -1 if there is none
+    float operator()(const ck_tile::stream_config& s, Args a) const
+    {
+        for(auto entry = first; entry != last; ++entry)
+        {
+            if(entry->is_applicable(a))
+                return entry->launch(s, a);
+        }
+        return -1;
+    }
+};
+
+// Packs trait fields into a key, most significant field first. Keys therefore compare like the
+// tuple of their fields.
+struct fmha_dispatch_key
+{
+    uint64_t value = 0;
+
+    template <typename T>
+    constexpr fmha_dispatch_key field(T v, int bits) const
+    {
+        return {(value << bits) | static_cast<uint64_t>(v)};
+    }
+};
+
+// (data type, hdim) case of the generated APIs, traits go to the first case they fit in
+struct fmha_dispatch_bucket
+{
+    const char* data_type;
+    int hdim;
+};
+
+template <std::size_t N>
+int fmha_dispatch_find_bucket(const std::array<fmha_dispatch_bucket, N>& buckets,
+                              const std::string& data_type,
+                              int hdim_q,
+                              int hdim_v)
+{
+    for(std::size_t i = 0; i < N; ++i)
+    {
+        if(data_type == buckets[i].data_type && hdim_q <= buckets[i].hdim &&
+           hdim_v <= buckets[i].hdim)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+template <typename Args, std::size_t N>
+constexpr bool fmha_dispatch_is_sorted(const std::array<fmha_dispatch_entry<Args>, N>& table)
+{
+    for(std::size_t i = 1; i < N; ++i)
+    {
+        if(table[i].key < table[i - 1].key)
+            return false;
+    }
+    return true;
+}
+
+template <typename Args, std::size_t N>
+fmha_dispatch_handle<Args> fmha_dispatch_find(const std::array<fmha_dispatch_entry<Args>, N>& table,
+                                              uint64_t key)
+{
+    const auto first =
+        std::lower_bound(table.begin(), table.end(), key, [](const auto& e, uint64_t k) {
+            return e.key < k;
+        });
+    const auto last = std::upper_bound(
+        first, table.end(), key, [](uint64_t k, const auto& e) { return k < e.key; });
+    return {table.data() + (first - table.begin()), table.data() + (last - table.begin())};
+}
@@ -831,14 +831,60 @@ bool run(const ck_tile::ArgParser& arg_parser)
         }
         // clang-format on
 
-        // reference
-        ck_tile::reference_batched_gemm<QDataType, KDataType, SaccDataType, SMPLComputeDataType>(
-            q_host_ref,
-            k_host_ref,
-            s_host_ref,
-            ck_tile::identity{},
-            ck_tile::identity{},
-            ck_tile::scales(scale_s));
+        // unmasked columns of every row of S, the only ones the reference computes
+        const auto s_row_ranges = [&]() {
+            if(mask.type == mask_enum::no_mask)
+            {
+                return ck_tile::make_masking_row_ranges(
+                    FmhaMasks::NoMask{real_seqlen_q, real_seqlen_k}, real_seqlen_q, real_seqlen_k);
+            }
+            else if(mask.type == mask_enum::window_generic)
+            {
+                return ck_tile::make_masking_row_ranges(
+                    ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::GenericMask>(
+                        mask.left, mask.right, real_seqlen_q, real_seqlen_k),
+                    real_seqlen_q,
+                    real_seqlen_k);
+            }
+            // if left window size is negative, means causal
+            // else means generic (for current batch)
+            else if(mask.left < 0)
+            {
+                return ck_tile::make_masking_row_ranges(
+                    ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::CausalMask>(
+                        mask.left,
+                        mask.right,
+                        real_seqlen_q,
+                        real_seqlen_k,
+                        mask.type == mask_enum::mask_top_left),
+                    real_seqlen_q,
+                    real_seqlen_k);
+            }
+            else
+            {
+                return ck_tile::make_masking_row_ranges(
+                    ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::GenericMask>(
+                        mask.left,
+                        mask.right,
+                        real_seqlen_q,
+                        real_seqlen_k,
+                        mask.type == mask_enum::mask_top_left),
+                    real_seqlen_q,
+                    real_seqlen_k);
+            }
+        }();
+
+        // reference, masked S = -inf
+        ck_tile::reference_batched_masked_gemm<QDataType,
+                                               KDataType,
+                                               SaccDataType,
+                                               SMPLComputeDataType>(q_host_ref,
+                                                                    k_host_ref,
+                                                                    s_host_ref,
+                                                                    s_row_ranges,
+                                                                    ck_tile::identity{},
+                                                                    ck_tile::identity{},
+                                                                    ck_tile::scales(scale_s));
 
         if(bias.type == bias_enum::elementwise_bias)
         {
@@ -906,50 +952,19 @@ bool run(const ck_tile::ArgParser& arg_parser)
                 s_host_ref, alibi_bias_host_ref, s_host_ref);
         }
 
-        if(mask.type == mask_enum::no_mask)
-        {
-            ck_tile::reference_batched_masking<SaccDataType>(
-                s_host_ref, FmhaMasks::NoMask{real_seqlen_q, real_seqlen_k});
-        }
-        else if(mask.type == mask_enum::window_generic)
-        {
-            ck_tile::reference_batched_masking<SaccDataType>(
-                s_host_ref,
-                ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::GenericMask>(
-                    mask.left, mask.right, real_seqlen_q, real_seqlen_k));
-        }
-        else
-        {
-            // if left window size is negative, means causal
-            // else means generic (for current batch)
-            if(mask.left < 0)
-                ck_tile::reference_batched_masking<SaccDataType>(
-                    s_host_ref,
-                    ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::CausalMask>(
-                        mask.left,
-                        mask.right,
-                        real_seqlen_q,
-                        real_seqlen_k,
-                        mask.type == mask_enum::mask_top_left));
-            else
-                ck_tile::reference_batched_masking<SaccDataType>(
-                    s_host_ref,
-                    ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::GenericMask>(
-                        mask.left,
-                        mask.right,
-                        real_seqlen_q,
-                        real_seqlen_k,
-                        mask.type == mask_enum::mask_top_left));
-        }
         if(lse)
         {
-            ck_tile::reference_batched_softmax<SMPLComputeDataType, SMPLComputeDataType, PDataType>(
-                s_host_ref, p_host_ref, p_compute_element_func, lse_host_ref);
+            ck_tile::reference_batched_masked_softmax<SMPLComputeDataType,
+                                                      SMPLComputeDataType,
+                                                      PDataType>(
+                s_host_ref, p_host_ref, s_row_ranges, p_compute_element_func, lse_host_ref);
         }
         else
         {
-            ck_tile::reference_batched_softmax<SMPLComputeDataType, SMPLComputeDataType, PDataType>(
-                s_host_ref, p_host_ref, p_compute_element_func);
+            ck_tile::reference_batched_masked_softmax<SMPLComputeDataType,
+                                                      SMPLComputeDataType,
+                                                      PDataType>(
+                s_host_ref, p_host_ref, s_row_ranges, p_compute_element_func);
         }
 
         if(p_drop > 0)
@@ -963,13 +978,17 @@ bool run(const ck_tile::ArgParser& arg_parser)
                 p_host_ref, randval_host_ref, p_undrop_in_uint8_t, rp_undrop);
         }
 
-        ck_tile::reference_batched_gemm<PDataType, VDataType, OaccDataType, ODataType>(
-            p_host_ref,
-            v_host_ref,
-            o_host_ref,
-            ck_tile::identity{},
-            ck_tile::identity{},
-            oacc_element_func);
+        // P is zero outside the row ranges of S
+        ck_tile::reference_batched_gemm_with_masked_a<PDataType,
+                                                      VDataType,
+                                                      OaccDataType,
+                                                      ODataType>(p_host_ref,
+                                                                 v_host_ref,
+                                                                 o_host_ref,
+                                                                 s_row_ranges,
+                                                                 ck_tile::identity{},
+                                                                 ck_tile::identity{},
+                                                                 oacc_element_func);
 
         ck_tile::HostTensor<ODataType> o_host_result({nhead, real_seqlen_q, hdim_v});
         // clang-format off
@@ -9,6 +9,7 @@
 #include "ck_tile/ops/epilogue.hpp"
 #include "mask.hpp"
 #include "bias.hpp"
+#include "fmha_dispatch.hpp"
 #include <type_traits>
 
 template <typename DataType>
@@ -513,3 +514,8 @@ struct fmha_fwd_traits
 };
 float fmha_fwd(fmha_fwd_traits, fmha_fwd_args, const ck_tile::stream_config&);
 float fmha_fwd_splitkv(fmha_fwd_traits, fmha_fwd_args, const ck_tile::stream_config&);
+
+// resolve traits once, then launch with handle(stream_config, args) without trait dispatch
+using fmha_fwd_handle = fmha_dispatch_handle<fmha_fwd_args>;
+fmha_fwd_handle fmha_fwd_resolve(const fmha_fwd_traits&);
+fmha_fwd_handle fmha_fwd_splitkv_resolve(const fmha_fwd_traits&);
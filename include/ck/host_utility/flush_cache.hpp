@@ -10,6 +10,7 @@
 #include "ck/ck.hpp"
 #include "ck/stream_config.hpp"
 #include "ck/host_utility/hip_check_error.hpp"
+#include "ck/host_utility/kernel_launch.hpp"
 #include "ck/utility/flush_icache.hpp"
 namespace ck {
 namespace utility {
@@ -260,6 +261,29 @@ float launch_and_time_kernel_with_preprocess(const StreamConfig& stream_config,
             hip_check_error(hipGetLastError());
         }
 
+        // one run per sample, preprocess() (e.g. the rotation of the buffers) is done for each run
+        if(stream_config.adaptive_timing_)
+        {
+            return time_kernel_adaptively(
+                stream_config,
+                [&]() {
+                    if constexpr(TimePreprocess)
+                    {
+                        preprocess();
+                    }
+                    kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(gemm_args,
+                                                                                        args...);
+                    hip_check_error(hipGetLastError());
+                },
+                [&]() {
+                    if constexpr(!TimePreprocess)
+                    {
+                        preprocess();
+                    }
+                },
+                1);
+        }
+
         const int nrepeat = stream_config.nrepeat_;
         if(nrepeat == 0)
         {
@@ -0,0 +1,330 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <hip/hip_runtime.h>
+
+#include "ck/host_utility/hip_check_error.hpp"
+
+namespace ck {
+
+// Copies of KernelArgArena done by the HIP runtime: pinned host buffers, asynchronous host to
+// device copies and an event per host buffer to know when its copies are done.
+struct HipKernelArgCopier
+{
+    HipKernelArgCopier() = default;
+
+    HipKernelArgCopier(const HipKernelArgCopier&) = delete;
+    HipKernelArgCopier& operator=(const HipKernelArgCopier&) = delete;
+
+    ~HipKernelArgCopier()
+    {
+        for(auto event : events_)
+        {
+            if(event != nullptr)
+            {
+                (void)hipEventDestroy(event);
+            }
+        }
+    }
+
+    void* AllocateHost(std::size_t size)
+    {
+        void* p = nullptr;
+        hip_check_error(hipHostMalloc(&p, size, hipHostMallocDefault));
+        return p;
+    }
+
+    void FreeHost(void* p) { (void)hipHostFree(p); }
+
+    void CopyToDevice(void* p_dst, const void* p_src, std::size_t size, hipStream_t stream)
+    {
+        hip_check_error(hipMemcpyAsync(p_dst, p_src, size, hipMemcpyHostToDevice, stream));
+    }
+
+    // mark the end of the copies from host buffer `slot` issued so far
+    void RecordCopies(int slot, hipStream_t stream)
+    {
+        if(events_[slot] == nullptr)
+        {
+            hip_check_error(hipEventCreateWithFlags(&events_[slot], hipEventDisableTiming));
+        }
+        hip_check_error(hipEventRecord(events_[slot], stream));
+    }
+
+    // wait until the recorded copies from host buffer `slot` are done
+    void WaitCopies(int slot)
+    {
+        if(events_[slot] != nullptr)
+        {
+            hip_check_error(hipEventSynchronize(events_[slot]));
+        }
+    }
+
+    hipEvent_t events_[2] = {nullptr, nullptr};
+};
+
+// Last KernelArgArena that uploaded to every device buffer, shared by all the arenas of the
+// process. Arguments of different device operations can be given the same workspace, an arena
+// only skips unchanged arguments if no other arena uploaded to (a part of) its buffer since its
+// own last upload.
+class KernelArgArenaOwners
+{
+    public:
+    static KernelArgArenaOwners& Get()
+    {
+        static KernelArgArenaOwners owners;
+        return owners;
+    }
+
+    // unique id of an arena, ids are not reused so that a new arena is never taken for the
+    // owner of the buffers of a destroyed one
+    static std::uint64_t MakeArenaId()
+    {
+        static std::atomic<std::uint64_t> next_id{1};
+        return next_id++;
+    }
+
+    // Make arena_id the owner of [p_device, p_device + size). Returns whether it already was the
+    // owner of the buffer starting at p_device, i.e. made its last upload there.
+    bool Acquire(const void* p_device, std::size_t size, std::uint64_t arena_id)
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+
+        const auto begin = reinterpret_cast<std::uintptr_t>(p_device);
+        const auto end   = begin + size;
+
+        auto it = buffers_.find(begin);
+
+        const bool is_owner = it != buffers_.end() && it->second.arena_id == arena_id;
+
+        // buffers overlapping [begin, end) are now written by arena_id
+        it = buffers_.upper_bound(begin);
+        if(it != buffers_.begin() && std::prev(it)->second.end > begin)
+        {
+            --it;
+        }
+        while(it != buffers_.end() && it->first < end)
+        {
+            it = buffers_.erase(it);
+        }
+
+        buffers_[begin] = Buffer{end, arena_id};
+
+        return is_owner;
+    }
+
+    // forget the buffer at p_device if arena_id owns it
+    void Release(const void* p_device, std::uint64_t arena_id)
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+
+        const auto it = buffers_.find(reinterpret_cast<std::uintptr_t>(p_device));
+
+        if(it != buffers_.end() && it->second.arena_id == arena_id)
+        {
+            buffers_.erase(it);
+        }
+    }
+
+    private:
+    struct Buffer
+    {
+        std::uintptr_t end;
+        std::uint64_t arena_id;
+    };
+
+    std::mutex mutex_;
+    std::map<std::uintptr_t, Buffer> buffers_;
+};
+
+// Persistent upload of an array of kernel arguments to a device buffer.
+//
+// The arguments are staged in two host buffers used in turn, the buffer of the previous upload
+// holds the arguments currently in the device buffer. A host buffer is only written again after
+// its copies are done, so the copies can be asynchronous.
+//
+// By default an upload copies all arguments. With EnableDeltaUploads(true) an upload only copies
+// the arguments that differ (bytewise) from the previous upload to the same device buffer,
+// adjacent changed ranges separated by at most max_gap_bytes unchanged bytes are copied at once.
+// This is only correct if nothing else than arenas writes the device buffer: only an arena which
+// made the last upload to the buffer skips the unchanged arguments, uploads of other arenas are
+// tracked by KernelArgArenaOwners, but other writes (e.g. hipMemcpy) are not seen. Call
+// Invalidate() after them, the next upload then copies all arguments.
+//
+// KernelArg is copied and compared bytewise, like the kernel arguments of a launch.
+//
+// Copier does the allocations and copies, see HipKernelArgCopier. A host stand-in can be used to
+// check the uploads without a device.
+template <typename KernelArg, typename Copier = HipKernelArgCopier>
+class KernelArgArena
+{
+    public:
+    explicit KernelArgArena(std::size_t max_gap_bytes = 64 * 1024)
+        : max_gap_bytes_{max_gap_bytes}, id_{KernelArgArenaOwners::MakeArenaId()}
+    {
+    }
+
+    KernelArgArena(const KernelArgArena&) = delete;
+    KernelArgArena& operator=(const KernelArgArena&) = delete;
+
+    ~KernelArgArena()
+    {
+        if(p_device_ != nullptr)
+        {
+            KernelArgArenaOwners::Get().Release(p_device_, id_);
+        }
+
+        for(int slot = 0; slot < 2; ++slot)
+        {
+            if(host_args_[slot] != nullptr)
+            {
+                copier_.WaitCopies(slot);
+                copier_.FreeHost(host_args_[slot]);
+            }
+        }
+    }
+
+    // Upload count arguments to p_device, which has space for at least count arguments.
+    // Returns the number of copied bytes.
+    std::size_t
+    Upload(const KernelArg* p_args, std::size_t count, void* p_device, hipStream_t stream)
+    {
+        const int slot = 1 - current_;
+
+        copier_.WaitCopies(slot);
+        Reserve(slot, count);
+
+        std::memcpy(static_cast<void*>(host_args_[slot]), p_args, count * sizeof(KernelArg));
+
+        const bool is_owner =
+            KernelArgArenaOwners::Get().Acquire(p_device, count * sizeof(KernelArg), id_);
+
+        // arguments [0, num_uploaded) of the previous upload are in the device buffer
+        const std::size_t num_uploaded = (is_delta_upload_enabled_ && is_owner &&
+                                          p_device == p_device_ && host_args_[current_] != nullptr)
+                                             ? std::min(count, count_)
+                                             : 0;
+
+        const auto is_changed = [&](std::size_t i) {
+            return i >= num_uploaded ||
+                   std::memcmp(static_cast<const void*>(host_args_[slot] + i),
+                               static_cast<const void*>(host_args_[current_] + i),
+                               sizeof(KernelArg)) != 0;
+        };
+
+        const std::size_t max_gap = max_gap_bytes_ / sizeof(KernelArg);
+
+        num_copied_bytes_ = 0;
+        num_copies_       = 0;
+
+        std::size_t i = 0;
+        while(i < count)
+        {
+            if(!is_changed(i))
+            {
+                ++i;
+                continue;
+            }
+
+            // extend the range over gaps of at most max_gap unchanged arguments
+            const std::size_t begin = i;
+            std::size_t end         = ++i;
+            while(i < count && i - end <= max_gap)
+            {
+                if(is_changed(i))
+                {
+                    end = i + 1;
+                }
+                ++i;
+            }
+            i = end;
+
+            const std::size_t size = (end - begin) * sizeof(KernelArg);
+
+            copier_.CopyToDevice(static_cast<char*>(p_device) + begin * sizeof(KernelArg),
+                                 host_args_[slot] + begin,
+                                 size,
+                                 stream);
+
+            num_copied_bytes_ += size;
+            num_copies_++;
+        }
+
+        copier_.RecordCopies(slot, stream);
+
+        current_  = slot;
+        count_    = count;
+        p_device_ = p_device;
+
+        return num_copied_bytes_;
+    }
+
+    // Only copy the arguments changed since the last upload of this arena. The caller guarantees
+    // that the device buffer is not written by anything else than arenas, or calls Invalidate().
+    void EnableDeltaUploads(bool enable) { is_delta_upload_enabled_ = enable; }
+
+    bool IsDeltaUploadEnabled() const { return is_delta_upload_enabled_; }
+
+    void Invalidate()
+    {
+        if(p_device_ != nullptr)
+        {
+            KernelArgArenaOwners::Get().Release(p_device_, id_);
+        }
+        p_device_ = nullptr;
+    }
+
+    // statistics of the last upload
+    std::size_t GetNumCopiedBytes() const { return num_copied_bytes_; }
+    std::size_t GetNumCopies() const { return num_copies_; }
+
+    Copier& GetCopier() { return copier_; }
+
+    private:
+    void Reserve(int slot, std::size_t count)
+    {
+        if(host_args_[slot] != nullptr && capacity_[slot] >= count)
+        {
+            return;
+        }
+
+        const std::size_t capacity = std::max({count, 2 * capacity_[slot], std::size_t{1}});
+
+        if(host_args_[slot] != nullptr)
+        {
+            copier_.FreeHost(host_args_[slot]);
+            host_args_[slot] = nullptr;
+            capacity_[slot]  = 0;
+        }
+
+        host_args_[slot] =
+            static_cast<KernelArg*>(copier_.AllocateHost(capacity * sizeof(KernelArg)));
+        capacity_[slot] = capacity;
+    }
+
+    Copier copier_;
+    std::size_t max_gap_bytes_;
+    std::uint64_t id_;
+    bool is_delta_upload_enabled_ = false;
+
+    KernelArg* host_args_[2] = {nullptr, nullptr};
+    std::size_t capacity_[2] = {0, 0};
+    int current_             = 0;
+    std::size_t count_       = 0;
+    void* p_device_          = nullptr;
+
+    std::size_t num_copied_bytes_ = 0;
+    std::size_t num_copies_       = 0;
+};
+
+} // namespace ck
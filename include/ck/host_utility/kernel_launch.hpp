@@ -3,12 +3,90 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <hip/hip_runtime.h>
 
 #include "ck/ck.hpp"
 #include "ck/stream_config.hpp"
 #include "ck/host_utility/hip_check_error.hpp"
 
+#if CK_TIME_KERNEL
+// Time run() for StreamConfig::adaptive_timing_ after the warm-up runs: samples are taken until
+// the confidence interval of the median converges or the time budget is spent. A sample times a
+// batch of up to max_batch runs between two events, long enough compared to the resolution of the
+// events. before_sample() is called before each sample, outside of the timed region.
+template <typename F, typename BeforeSample>
+float time_kernel_adaptively(const StreamConfig& stream_config,
+                             F run,
+                             BeforeSample before_sample,
+                             int max_batch = 1024)
+{
+    // shortest time of a sample
+    constexpr float min_sample_ms = 0.1f;
+
+    hipEvent_t start, stop;
+
+    hip_check_error(hipEventCreate(&start));
+    hip_check_error(hipEventCreate(&stop));
+
+    const auto time_batch = [&](int batch) {
+        before_sample();
+
+        hip_check_error(hipDeviceSynchronize());
+        hip_check_error(hipEventRecord(start, stream_config.stream_id_));
+        for(int i = 0; i < batch; ++i)
+        {
+            run();
+        }
+        hip_check_error(hipEventRecord(stop, stream_config.stream_id_));
+        hip_check_error(hipEventSynchronize(stop));
+
+        float elapsed = 0;
+        hip_check_error(hipEventElapsedTime(&elapsed, start, stop));
+        return elapsed;
+    };
+
+    const float first_time = time_batch(1);
+    const int batch        = std::clamp(
+        static_cast<int>(std::ceil(min_sample_ms / std::max(first_time, 1e-6f))), 1, max_batch);
+
+    ck::AdaptiveTimingSampler sampler(stream_config.timing_rel_ci_,
+                                      stream_config.timing_budget_ms_);
+    while(!sampler.IsDone())
+    {
+        const float elapsed = time_batch(batch);
+        sampler.AddSample(elapsed / batch, elapsed);
+    }
+
+    hip_check_error(hipEventDestroy(start));
+    hip_check_error(hipEventDestroy(stop));
+
+    const ck::TimingStatistics statistics = sampler.GetStatistics();
+
+    if(ck::EnvIsEnabled(CK_ENV(CK_LOGGING)))
+    {
+        printf("%d samples of %d runs (%d outliers), median %f ms, p90 %f ms, "
+               "95%% CI [%f, %f] ms%s\n",
+               statistics.num_samples + statistics.num_outliers,
+               batch,
+               statistics.num_outliers,
+               statistics.median_ms,
+               statistics.p90_ms,
+               statistics.ci_low_ms,
+               statistics.ci_high_ms,
+               sampler.IsConverged() ? "" : ", not converged");
+    }
+
+    if(stream_config.timing_statistics_ != nullptr)
+    {
+        *stream_config.timing_statistics_ = statistics;
+    }
+
+    return statistics.median_ms;
+}
+#endif
+
 template <typename... Args, typename F>
 float launch_and_time_kernel(const StreamConfig& stream_config,
                              F kernel,
@@ -40,6 +118,17 @@ float launch_and_time_kernel(const StreamConfig& stream_config,
             hip_check_error(hipGetLastError());
         }
 
+        if(stream_config.adaptive_timing_)
+        {
+            return time_kernel_adaptively(
+                stream_config,
+                [&]() {
+                    kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
+                    hip_check_error(hipGetLastError());
+                },
+                []() {});
+        }
+
         const int nrepeat = stream_config.nrepeat_;
         if(ck::EnvIsEnabled(CK_ENV(CK_LOGGING)))
         {
@@ -116,6 +205,18 @@ float launch_and_time_kernel_with_preprocess(const StreamConfig& stream_config,
             hip_check_error(hipGetLastError());
         }
 
+        if(stream_config.adaptive_timing_)
+        {
+            return time_kernel_adaptively(
+                stream_config,
+                [&]() {
+                    preprocess();
+                    kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
+                    hip_check_error(hipGetLastError());
+                },
+                []() {});
+        }
+
         const int nrepeat = stream_config.nrepeat_;
         if(ck::EnvIsEnabled(CK_ENV(CK_LOGGING)))
         {
@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace ck {
+
+// Robust statistics of the kernel times of an instance. ci_low_ms and ci_high_ms bound the 95%
+// confidence interval of the median, computed without assuming a distribution of the times.
+struct TimingStatistics
+{
+    float median_ms  = 0;
+    float p90_ms     = 0;
+    float ci_low_ms  = 0;
+    float ci_high_ms = 0;
+    float mean_ms    = 0;
+    int num_samples  = 0;
+    int num_outliers = 0;
+
+    // the medians cannot be told apart if the confidence intervals overlap
+    bool IsTiedWith(const TimingStatistics& other) const
+    {
+        return ci_low_ms <= other.ci_high_ms && other.ci_low_ms <= ci_high_ms;
+    }
+};
+
+namespace detail {
+
+// value of rank q * (n - 1) of sorted, interpolated between the neighbouring ranks
+inline float get_quantile(const std::vector<float>& sorted, float q)
+{
+    const float rank = q * static_cast<float>(sorted.size() - 1);
+    const auto lo    = static_cast<std::size_t>(std::floor(rank));
+    const auto hi    = std::min(lo + 1, sorted.size() - 1);
+
+    return sorted[lo] + (rank - static_cast<float>(lo)) * (sorted[hi] - sorted[lo]);
+}
+
+} // namespace detail
+
+// Statistics of samples after the rejection of the outliers, i.e. the samples further than
+// outlier_mads scaled median absolute deviations from the median (preempted or throttled runs).
+inline TimingStatistics compute_timing_statistics(std::vector<float> samples,
+                                                  float outlier_mads = 5.f)
+{
+    TimingStatistics statistics;
+
+    if(samples.empty())
+    {
+        return statistics;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    const float median = detail::get_quantile(samples, 0.5f);
+
+    std::vector<float> deviations(samples.size());
+    std::transform(samples.begin(), samples.end(), deviations.begin(), [&](float x) {
+        return std::abs(x - median);
+    });
+    std::sort(deviations.begin(), deviations.end());
+
+    // 1.4826 * MAD estimates the standard deviation of normally distributed times, the small
+    // floor keeps the samples of a timer that only returns a few different values
+    const float max_deviation =
+        std::max(outlier_mads * 1.4826f * detail::get_quantile(deviations, 0.5f), 1e-3f * median);
+
+    const auto first = std::lower_bound(samples.begin(), samples.end(), median - max_deviation);
+    const auto last  = std::upper_bound(first, samples.end(), median + max_deviation);
+
+    const std::vector<float> kept(first, last);
+    const std::size_t n = kept.size();
+    const float sum     = std::accumulate(kept.begin(), kept.end(), 0.f);
+
+    statistics.num_samples  = static_cast<int>(n);
+    statistics.num_outliers = static_cast<int>(samples.size() - n);
+    statistics.median_ms    = detail::get_quantile(kept, 0.5f);
+    statistics.p90_ms       = detail::get_quantile(kept, 0.9f);
+    statistics.mean_ms      = sum / static_cast<float>(n);
+
+    // the number of samples below the median is binomial(n, 1/2), ranks n / 2 -+ 1.96 sqrt(n) / 2
+    // bound the median with a probability of 95%
+    const float half_width = 0.98f * std::sqrt(static_cast<float>(n));
+    const float center     = 0.5f * static_cast<float>(n);
+
+    const auto ci_lo = static_cast<long>(std::floor(center - half_width)) - 1;
+    const auto ci_hi = static_cast<long>(std::ceil(center + half_width));
+
+    statistics.ci_low_ms  = kept[std::max(ci_lo, 0l)];
+    statistics.ci_high_ms = kept[std::min(ci_hi, static_cast<long>(n) - 1)];
+
+    return statistics;
+}
+
+// Collects kernel times until the half width of the confidence interval of their median is less
+// than rel_ci * median, or until budget_ms of kernel time or max_samples samples are spent.
+struct AdaptiveTimingSampler
+{
+    AdaptiveTimingSampler(float rel_ci    = 0.01f,
+                          float budget_ms = 1000.f,
+                          int min_samples = 10,
+                          int max_samples = 10000)
+        : rel_ci_(rel_ci),
+          budget_ms_(budget_ms),
+          min_samples_(min_samples),
+          max_samples_(max_samples),
+          next_check_(min_samples)
+    {
+    }
+
+    // time_ms is the time of a kernel, elapsed_ms the time taken by the sample (e.g. for a batch
+    // of several kernels timed together)
+    void AddSample(float time_ms, float elapsed_ms)
+    {
+        samples_.push_back(time_ms);
+        elapsed_ms_ += elapsed_ms;
+
+        // the statistics are updated after every 1/8 more samples, not after each of them
+        const int n = static_cast<int>(samples_.size());
+        if(n >= next_check_)
+        {
+            statistics_   = compute_timing_statistics(samples_);
+            next_check_   = n + std::max(1, n / 8);
+            is_converged_ = statistics_.ci_high_ms - statistics_.ci_low_ms <=
+                            2.f * rel_ci_ * statistics_.median_ms;
+        }
+    }
+
+    void AddSample(float time_ms) { AddSample(time_ms, time_ms); }
+
+    bool IsConverged() const { return is_converged_; }
+
+    bool IsDone() const
+    {
+        const int n = static_cast<int>(samples_.size());
+        return n >= max_samples_ || (n >= min_samples_ && elapsed_ms_ >= budget_ms_) ||
+               is_converged_;
+    }
+
+    TimingStatistics GetStatistics() const { return compute_timing_statistics(samples_); }
+
+    const std::vector<float>& GetSamples() const { return samples_; }
+
+    float GetElapsedTime() const { return elapsed_ms_; }
+
+    private:
+    float rel_ci_;
+    float budget_ms_;
+    int min_samples_;
+    int max_samples_;
+
+    std::vector<float> samples_;
+    float elapsed_ms_ = 0;
+
+    int next_check_;
+    TimingStatistics statistics_;
+    bool is_converged_ = false;
+};
+
+// Rank of each instance by median time, 1 for the fastest. Instances tied with the fastest one of
+// a rank (overlapping confidence intervals) get the same rank.
+inline std::vector<int> rank_timing_statistics(const std::vector<TimingStatistics>& statistics)
+{
+    std::vector<std::size_t> order(statistics.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t i, std::size_t j) {
+        return statistics[i].median_ms < statistics[j].median_ms;
+    });
+
+    std::vector<int> ranks(statistics.size());
+
+    int rank           = 0;
+    std::size_t leader = 0;
+    for(std::size_t i = 0; i < order.size(); ++i)
+    {
+        if(i == 0 || !statistics[order[i]].IsTiedWith(statistics[leader]))
+        {
+            rank   = static_cast<int>(i) + 1;
+            leader = order[i];
+        }
+        ranks[order[i]] = rank;
+    }
+
+    return ranks;
+}
+
+} // namespace ck
@@ -6,6 +6,8 @@
 #include <hip/hip_runtime.h>
 #include <hip/hip_fp16.h>
 
+#include "ck/host_utility/timing_statistics.hpp"
+
 struct StreamConfig
 {
     hipStream_t stream_id_ = nullptr;
@@ -16,4 +18,12 @@ struct StreamConfig
 
     bool flush_cache   = false;
     int rotating_count = 1;
+
+    // instead of nrepeat_ runs, time until the confidence interval of the median time is within
+    // timing_rel_ci_ of the median or timing_budget_ms_ is spent (see AdaptiveTimingSampler), the
+    // median is returned and the statistics are written to *timing_statistics_ if not null
+    bool adaptive_timing_                    = false;
+    float timing_rel_ci_                     = 0.01f;
+    float timing_budget_ms_                  = 1000.f;
+    ck::TimingStatistics* timing_statistics_ = nullptr;
 };
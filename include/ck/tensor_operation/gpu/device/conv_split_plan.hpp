@@ -0,0 +1,604 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/stream_config.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+enum struct ConvSplitDirection
+{
+    Forward,
+    BackwardData,
+    BackwardWeight
+};
+
+// One part of a split convolution. Lengths are in [G, N, C, Wis...], [G, K, C, Xs...] and
+// [G, N, K, Wos...] order like the arguments of the grouped conv device ops, strides are the
+// strides of the whole tensors. The views start at the element offsets in the whole tensors.
+template <index_t NDimSpatial>
+struct ConvSubProblem
+{
+    std::array<index_t, NDimSpatial + 3> in_g_n_c_wis_lengths;
+    std::array<index_t, NDimSpatial + 3> in_g_n_c_wis_strides;
+    std::array<index_t, NDimSpatial + 3> wei_g_k_c_xs_lengths;
+    std::array<index_t, NDimSpatial + 3> wei_g_k_c_xs_strides;
+    std::array<index_t, NDimSpatial + 3> out_g_n_k_wos_lengths;
+    std::array<index_t, NDimSpatial + 3> out_g_n_k_wos_strides;
+    std::array<index_t, NDimSpatial> conv_filter_strides;
+    std::array<index_t, NDimSpatial> conv_filter_dilations;
+    std::array<index_t, NDimSpatial> input_left_pads;
+    std::array<index_t, NDimSpatial> input_right_pads;
+
+    long_index_t in_offset;
+    long_index_t wei_offset;
+    long_index_t out_offset;
+};
+
+// Sub-problems computing a convolution together, empty if the problem can not be split.
+template <index_t NDimSpatial>
+struct ConvSplitPlan
+{
+    std::vector<ConvSubProblem<NDimSpatial>> sub_problems_;
+
+    bool IsValid() const { return !sub_problems_.empty(); }
+    std::size_t GetNumSubProblems() const { return sub_problems_.size(); }
+};
+
+namespace detail {
+
+template <std::size_t N>
+long_index_t conv_split_element_space_size(const std::array<index_t, N>& lengths,
+                                           const std::array<index_t, N>& strides)
+{
+    long_index_t size = 1;
+    for(std::size_t i = 0; i < N; ++i)
+    {
+        if(lengths[i] == 0)
+        {
+            return 0;
+        }
+        size += static_cast<long_index_t>(lengths[i] - 1) * strides[i];
+    }
+    return size;
+}
+
+// Ranges [begin, end) of G, N, K, C and of the spatial dimensions, which are the output
+// dimensions, except for backward data where they are the (gradient) input dimensions.
+template <index_t NDimSpatial>
+struct ConvSplitRanges
+{
+    static constexpr index_t G = 0;
+    static constexpr index_t N = 1;
+    static constexpr index_t K = 2;
+    static constexpr index_t C = 3;
+
+    static constexpr index_t NumDim = NDimSpatial + 4;
+
+    std::array<long_index_t, NumDim> begin_;
+    std::array<long_index_t, NumDim> end_;
+};
+
+template <index_t NDimSpatial>
+struct ConvSplitProblem
+{
+    using Ranges = ConvSplitRanges<NDimSpatial>;
+
+    ConvSplitDirection direction_;
+    ConvSubProblem<NDimSpatial> whole_;
+    std::array<std::size_t, 3> element_sizes_; // in, wei, out
+    long_index_t max_bytes_;
+
+    Ranges GetWholeRanges() const
+    {
+        Ranges ranges;
+        ranges.begin_.fill(0);
+
+        ranges.end_[Ranges::G] = whole_.in_g_n_c_wis_lengths[0];
+        ranges.end_[Ranges::N] = whole_.in_g_n_c_wis_lengths[1];
+        ranges.end_[Ranges::K] = whole_.wei_g_k_c_xs_lengths[1];
+        ranges.end_[Ranges::C] = whole_.in_g_n_c_wis_lengths[2];
+
+        for(index_t d = 0; d < NDimSpatial; ++d)
+        {
+            ranges.end_[4 + d] = direction_ == ConvSplitDirection::BackwardData
+                                     ? whole_.in_g_n_c_wis_lengths[3 + d]
+                                     : whole_.out_g_n_k_wos_lengths[3 + d];
+        }
+
+        return ranges;
+    }
+
+    long_index_t GetEffectiveFilterLength(index_t d) const
+    {
+        return static_cast<long_index_t>(whole_.wei_g_k_c_xs_lengths[3 + d] - 1) *
+                   whole_.conv_filter_dilations[d] +
+               1;
+    }
+
+    // Input range and paddings of spatial dimension d computing outputs [o0, o1). The input range
+    // includes the halo of the filter.
+    bool GetForwardSpatial(index_t d,
+                           long_index_t o0,
+                           long_index_t o1,
+                           long_index_t& i0,
+                           long_index_t& i1,
+                           long_index_t& left_pad,
+                           long_index_t& right_pad) const
+    {
+        const long_index_t s   = whole_.conv_filter_strides[d];
+        const long_index_t eff = GetEffectiveFilterLength(d);
+        const long_index_t pad = whole_.input_left_pads[d];
+        const long_index_t wi  = whole_.in_g_n_c_wis_lengths[3 + d];
+
+        const long_index_t window_begin = o0 * s - pad;
+        const long_index_t window_end   = (o1 - 1) * s - pad + eff;
+
+        i0 = std::max(long_index_t{0}, window_begin);
+        i1 = std::min(wi, window_end);
+
+        left_pad  = i0 - window_begin;
+        right_pad = window_end - i1;
+
+        return i0 < i1;
+    }
+
+    // Output range and paddings of spatial dimension d contributing to inputs [i0, i1) of
+    // backward data.
+    bool GetBackwardDataSpatial(index_t d,
+                                long_index_t i0,
+                                long_index_t i1,
+                                long_index_t& o0,
+                                long_index_t& o1,
+                                long_index_t& left_pad,
+                                long_index_t& right_pad) const
+    {
+        const long_index_t s   = whole_.conv_filter_strides[d];
+        const long_index_t eff = GetEffectiveFilterLength(d);
+        const long_index_t pad = whole_.input_left_pads[d];
+        const long_index_t wo  = whole_.out_g_n_k_wos_lengths[3 + d];
+
+        // first output whose window ends after i0, but not after the last window starting at or
+        // before i0 (the left padding of the sub-problem can not be negative)
+        const long_index_t first = (std::max(long_index_t{0}, i0 + pad - eff + 1) + s - 1) / s;
+
+        o0 = std::min(first, (i0 + pad) / s);
+        o1 = std::min(wo, (i1 - 1 + pad) / s + 1);
+
+        if(o0 >= o1)
+        {
+            return false;
+        }
+
+        left_pad  = i0 + pad - o0 * s;
+        right_pad = std::max(long_index_t{0}, (o1 - o0 - 1) * s + eff - (i1 - i0) - left_pad);
+
+        return true;
+    }
+
+    bool MakeSubProblem(const Ranges& ranges, ConvSubProblem<NDimSpatial>& sub) const
+    {
+        sub = whole_;
+
+        const auto g0 = ranges.begin_[Ranges::G];
+        const auto n0 = ranges.begin_[Ranges::N];
+        const auto k0 = ranges.begin_[Ranges::K];
+        const auto c0 = ranges.begin_[Ranges::C];
+
+        const auto g = ranges.end_[Ranges::G] - g0;
+        const auto n = ranges.end_[Ranges::N] - n0;
+        const auto k = ranges.end_[Ranges::K] - k0;
+        const auto c = ranges.end_[Ranges::C] - c0;
+
+        sub.in_g_n_c_wis_lengths[0]  = g;
+        sub.in_g_n_c_wis_lengths[1]  = n;
+        sub.in_g_n_c_wis_lengths[2]  = c;
+        sub.wei_g_k_c_xs_lengths[0]  = g;
+        sub.wei_g_k_c_xs_lengths[1]  = k;
+        sub.wei_g_k_c_xs_lengths[2]  = c;
+        sub.out_g_n_k_wos_lengths[0] = g;
+        sub.out_g_n_k_wos_lengths[1] = n;
+        sub.out_g_n_k_wos_lengths[2] = k;
+
+        sub.in_offset = g0 * whole_.in_g_n_c_wis_strides[0] +
+                        n0 * whole_.in_g_n_c_wis_strides[1] + c0 * whole_.in_g_n_c_wis_strides[2];
+        sub.wei_offset = g0 * whole_.wei_g_k_c_xs_strides[0] +
+                         k0 * whole_.wei_g_k_c_xs_strides[1] + c0 * whole_.wei_g_k_c_xs_strides[2];
+        sub.out_offset = g0 * whole_.out_g_n_k_wos_strides[0] +
+                         n0 * whole_.out_g_n_k_wos_strides[1] +
+                         k0 * whole_.out_g_n_k_wos_strides[2];
+
+        const Ranges whole_ranges = GetWholeRanges();
+
+        for(index_t d = 0; d < NDimSpatial; ++d)
+        {
+            const auto begin = ranges.begin_[4 + d];
+            const auto end   = ranges.end_[4 + d];
+
+            // the whole dimension keeps the original paddings
+            if(begin == 0 && end == whole_ranges.end_[4 + d])
+            {
+                continue;
+            }
+
+            long_index_t i0, i1, o0, o1, left_pad, right_pad;
+
+            if(direction_ == ConvSplitDirection::BackwardData)
+            {
+                i0 = begin;
+                i1 = end;
+                if(!GetBackwardDataSpatial(d, i0, i1, o0, o1, left_pad, right_pad))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                o0 = begin;
+                o1 = end;
+                if(!GetForwardSpatial(d, o0, o1, i0, i1, left_pad, right_pad))
+                {
+                    return false;
+                }
+            }
+
+            sub.in_g_n_c_wis_lengths[3 + d]  = i1 - i0;
+            sub.out_g_n_k_wos_lengths[3 + d] = o1 - o0;
+            sub.input_left_pads[d]           = left_pad;
+            sub.input_right_pads[d]          = right_pad;
+
+            sub.in_offset += i0 * whole_.in_g_n_c_wis_strides[3 + d];
+            sub.out_offset += o0 * whole_.out_g_n_k_wos_strides[3 + d];
+        }
+
+        return true;
+    }
+
+    // bytes beyond max_bytes_ of all tensors
+    long_index_t GetExcessBytes(const ConvSubProblem<NDimSpatial>& sub) const
+    {
+        const long_index_t bytes[3] = {
+            conv_split_element_space_size(sub.in_g_n_c_wis_lengths, sub.in_g_n_c_wis_strides) *
+                static_cast<long_index_t>(element_sizes_[0]),
+            conv_split_element_space_size(sub.wei_g_k_c_xs_lengths, sub.wei_g_k_c_xs_strides) *
+                static_cast<long_index_t>(element_sizes_[1]),
+            conv_split_element_space_size(sub.out_g_n_k_wos_lengths, sub.out_g_n_k_wos_strides) *
+                static_cast<long_index_t>(element_sizes_[2])};
+
+        long_index_t excess = 0;
+        for(auto b : bytes)
+        {
+            excess += std::max(long_index_t{0}, b - max_bytes_);
+        }
+        return excess;
+    }
+
+    // Dimensions which can be split without accumulating partial results, in order of
+    // preference: splitting C sums partial outputs of forward, K partial input gradients of
+    // backward data, N and the spatial dimensions partial weight gradients of backward weight.
+    std::vector<index_t> GetSplitDims() const
+    {
+        std::vector<index_t> dims;
+
+        if(direction_ != ConvSplitDirection::BackwardWeight)
+        {
+            dims.push_back(Ranges::N);
+        }
+
+        dims.push_back(Ranges::G);
+
+        if(direction_ != ConvSplitDirection::BackwardWeight)
+        {
+            for(index_t d = 0; d < NDimSpatial; ++d)
+            {
+                dims.push_back(4 + d);
+            }
+        }
+
+        if(direction_ != ConvSplitDirection::BackwardData)
+        {
+            dims.push_back(Ranges::K);
+        }
+
+        if(direction_ != ConvSplitDirection::Forward)
+        {
+            dims.push_back(Ranges::C);
+        }
+
+        return dims;
+    }
+
+    // Excess bytes of the largest sub-problem if all dimensions which can be split are split
+    // into single elements. The element space sizes are sums over the dimensions, so the largest
+    // views of the spatial dimensions are found one dimension at a time.
+    long_index_t GetFinestExcessBytes() const
+    {
+        const Ranges whole_ranges = GetWholeRanges();
+        const auto dims           = GetSplitDims();
+
+        const auto is_split = [&](index_t dim) {
+            return std::find(dims.begin(), dims.end(), dim) != dims.end();
+        };
+
+        ConvSubProblem<NDimSpatial> sub = whole_;
+
+        if(is_split(Ranges::G))
+        {
+            sub.in_g_n_c_wis_lengths[0]  = 1;
+            sub.wei_g_k_c_xs_lengths[0]  = 1;
+            sub.out_g_n_k_wos_lengths[0] = 1;
+        }
+        if(is_split(Ranges::N))
+        {
+            sub.in_g_n_c_wis_lengths[1]  = 1;
+            sub.out_g_n_k_wos_lengths[1] = 1;
+        }
+        if(is_split(Ranges::K))
+        {
+            sub.wei_g_k_c_xs_lengths[1]  = 1;
+            sub.out_g_n_k_wos_lengths[2] = 1;
+        }
+        if(is_split(Ranges::C))
+        {
+            sub.in_g_n_c_wis_lengths[2] = 1;
+            sub.wei_g_k_c_xs_lengths[2] = 1;
+        }
+
+        for(index_t d = 0; d < NDimSpatial; ++d)
+        {
+            if(!is_split(4 + d))
+            {
+                continue;
+            }
+
+            long_index_t max_in_length  = 0;
+            long_index_t max_out_length = 0;
+
+            for(long_index_t x = 0; x < whole_ranges.end_[4 + d]; ++x)
+            {
+                long_index_t i0, i1, o0, o1, left_pad, right_pad;
+
+                if(direction_ == ConvSplitDirection::BackwardData)
+                {
+                    i0 = x;
+                    i1 = x + 1;
+                    if(!GetBackwardDataSpatial(d, i0, i1, o0, o1, left_pad, right_pad))
+                    {
+                        continue;
+                    }
+                }
+                else
+                {
+                    o0 = x;
+                    o1 = x + 1;
+                    if(!GetForwardSpatial(d, o0, o1, i0, i1, left_pad, right_pad))
+                    {
+                        continue;
+                    }
+                }
+
+                max_in_length  = std::max(max_in_length, i1 - i0);
+                max_out_length = std::max(max_out_length, o1 - o0);
+            }
+
+            sub.in_g_n_c_wis_lengths[3 + d]  = max_in_length;
+            sub.out_g_n_k_wos_lengths[3 + d] = max_out_length;
+        }
+
+        return GetExcessBytes(sub);
+    }
+
+    // Halve the dimension reducing the excess bytes the most (the first of equally good ones)
+    // until all parts fit. A split not reducing them can be needed before one which does, e.g.
+    // the halves of a short spatial dimension may need the same input halo.
+    bool Split(const Ranges& ranges, std::vector<ConvSubProblem<NDimSpatial>>& sub_problems) const
+    {
+        ConvSubProblem<NDimSpatial> sub;
+
+        if(!MakeSubProblem(ranges, sub))
+        {
+            return false;
+        }
+
+        const long_index_t excess = GetExcessBytes(sub);
+
+        if(excess == 0)
+        {
+            sub_problems.push_back(sub);
+            return true;
+        }
+
+        bool found               = false;
+        long_index_t best_excess = excess;
+        Ranges best_lo, best_hi;
+
+        for(const auto dim : GetSplitDims())
+        {
+            const auto length = ranges.end_[dim] - ranges.begin_[dim];
+
+            if(length < 2)
+            {
+                continue;
+            }
+
+            Ranges lo = ranges;
+            Ranges hi = ranges;
+
+            lo.end_[dim]   = ranges.begin_[dim] + length / 2;
+            hi.begin_[dim] = lo.end_[dim];
+
+            ConvSubProblem<NDimSpatial> sub_lo, sub_hi;
+
+            if(!MakeSubProblem(lo, sub_lo) || !MakeSubProblem(hi, sub_hi))
+            {
+                continue;
+            }
+
+            const long_index_t split_excess =
+                std::max(GetExcessBytes(sub_lo), GetExcessBytes(sub_hi));
+
+            if(!found || split_excess < best_excess)
+            {
+                found       = true;
+                best_excess = split_excess;
+                best_lo     = lo;
+                best_hi     = hi;
+            }
+        }
+
+        if(!found)
+        {
+            return false;
+        }
+
+        return Split(best_lo, sub_problems) && Split(best_hi, sub_problems);
+    }
+};
+
+} // namespace detail
+
+// Split a grouped convolution whose tensors do not fit max_bytes (the 2GB limit of the 32 bit
+// offsets of the device ops by default) into sub-problems which do. The arguments are the ones
+// of the grouped conv device ops, element_sizes are the sizes of the in, wei and out elements.
+//
+// Forward splits N, G, the output spatial dimensions (the input views include the halo of the
+// filter) and K. Backward data splits N, G, the input spatial dimensions (the output views
+// include all outputs contributing to them) and C. Backward weight splits G, K and C. The
+// paddings of the sub-problems are adjusted to the borders of their views. The parts write
+// disjoint parts of the result, so they can be run one after another without accumulation.
+//
+// D tensors are not split, the plan is for convolutions without them.
+template <index_t NDimSpatial>
+ConvSplitPlan<NDimSpatial>
+MakeConvSplitPlan(ConvSplitDirection direction,
+                  const std::array<index_t, NDimSpatial + 3>& in_g_n_c_wis_lengths,
+                  const std::array<index_t, NDimSpatial + 3>& in_g_n_c_wis_strides,
+                  const std::array<index_t, NDimSpatial + 3>& wei_g_k_c_xs_lengths,
+                  const std::array<index_t, NDimSpatial + 3>& wei_g_k_c_xs_strides,
+                  const std::array<index_t, NDimSpatial + 3>& out_g_n_k_wos_lengths,
+                  const std::array<index_t, NDimSpatial + 3>& out_g_n_k_wos_strides,
+                  const std::array<index_t, NDimSpatial>& conv_filter_strides,
+                  const std::array<index_t, NDimSpatial>& conv_filter_dilations,
+                  const std::array<index_t, NDimSpatial>& input_left_pads,
+                  const std::array<index_t, NDimSpatial>& input_right_pads,
+                  const std::array<std::size_t, 3>& element_sizes,
+                  long_index_t max_bytes = long_index_t{1} << 31)
+{
+    detail::ConvSplitProblem<NDimSpatial> problem{direction,
+                                                  {in_g_n_c_wis_lengths,
+                                                   in_g_n_c_wis_strides,
+                                                   wei_g_k_c_xs_lengths,
+                                                   wei_g_k_c_xs_strides,
+                                                   out_g_n_k_wos_lengths,
+                                                   out_g_n_k_wos_strides,
+                                                   conv_filter_strides,
+                                                   conv_filter_dilations,
+                                                   input_left_pads,
+                                                   input_right_pads,
+                                                   0,
+                                                   0,
+                                                   0},
+                                                  element_sizes,
+                                                  max_bytes};
+
+    ConvSplitPlan<NDimSpatial> plan;
+
+    // the parts of the finest split do not fit either, do not split at all
+    if(problem.GetFinestExcessBytes() > 0)
+    {
+        return plan;
+    }
+
+    if(!problem.Split(problem.GetWholeRanges(), plan.sub_problems_))
+    {
+        plan.sub_problems_.clear();
+    }
+
+    return plan;
+}
+
+// Arguments of all sub-problems of a plan, run one after another on the same stream.
+//
+// Usage:
+//   auto plan = MakeConvSplitPlan<NDimSpatial>(ConvSplitDirection::Forward, ...);
+//   auto args = MakeConvSplitArguments(plan, [&](const ConvSubProblem<NDimSpatial>& sub) {
+//       return op.MakeArgumentPointer(p_in + sub.in_offset, p_wei + sub.wei_offset, {},
+//                                     p_out + sub.out_offset, sub.in_g_n_c_wis_lengths, ...);
+//   });
+//   if(IsConvSplitSupported(op, args)) RunConvSplit(*invoker, args, stream_config);
+template <index_t NDimSpatial, typename MakeArgument>
+std::vector<std::unique_ptr<BaseArgument>>
+MakeConvSplitArguments(const ConvSplitPlan<NDimSpatial>& plan, MakeArgument&& make_argument)
+{
+    std::vector<std::unique_ptr<BaseArgument>> arguments;
+    arguments.reserve(plan.sub_problems_.size());
+
+    for(const auto& sub : plan.sub_problems_)
+    {
+        arguments.push_back(make_argument(sub));
+    }
+
+    return arguments;
+}
+
+inline bool IsConvSplitSupported(BaseOperator& op,
+                                 const std::vector<std::unique_ptr<BaseArgument>>& arguments)
+{
+    return !arguments.empty() &&
+           std::all_of(arguments.begin(), arguments.end(), [&](const auto& argument) {
+               return op.IsSupportedArgument(argument.get());
+           });
+}
+
+// the sub-problems run one after another, so they share one workspace
+inline std::size_t
+GetConvSplitWorkSpaceSize(const BaseOperator& op,
+                          const std::vector<std::unique_ptr<BaseArgument>>& arguments)
+{
+    std::size_t size = 0;
+    for(const auto& argument : arguments)
+    {
+        size = std::max(size, op.GetWorkSpaceSize(argument.get()));
+    }
+    return size;
+}
+
+inline void
+SetConvSplitWorkSpacePointer(const BaseOperator& op,
+                             const std::vector<std::unique_ptr<BaseArgument>>& arguments,
+                             void* p_workspace,
+                             const StreamConfig& stream_config = StreamConfig{})
+{
+    for(const auto& argument : arguments)
+    {
+        op.SetWorkSpacePointer(argument.get(), p_workspace, stream_config);
+    }
+}
+
+// total time of the sub-problems
+inline float RunConvSplit(BaseInvoker& invoker,
+                          const std::vector<std::unique_ptr<BaseArgument>>& arguments,
+                          const StreamConfig& stream_config = StreamConfig{})
+{
+    float time = 0;
+    for(const auto& argument : arguments)
+    {
+        time += invoker.Run(argument.get(), stream_config);
+    }
+    return time;
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -149,6 +149,32 @@ struct DeviceGroupedConvFwdMultipleABD : public BaseOperator
                         const BElementwiseOperation& b_element_op,
                         const CDEElementwiseOperation& cde_element_op) = 0;
 
+    /**
+     * \brief Rebind the tensor pointers of an argument made by MakeArgumentPointer.
+     *
+     * \details
+     * Descriptors of an argument depend on lengths and strides only, an argument can be
+     * reused as plan for all problems which differ in the tensor pointers. The argument has to
+     * be made by this operation.
+     *
+     * \param p_arg Argument to update.
+     * \param p_a A pointer to the input (std::array<const void*, NumA> with
+                  pointers for multiple A).
+     * \param p_b A pointer to the weight (std::array<const void*, NumA> with
+                  pointers for multiple B).
+     * \param p_ds A pointers to the Ds.
+     * \param p_e A pointers to the output.
+     * \return False if the operation does not support rebinding, the argument is not changed.
+     */
+    virtual bool UpdatePointers(BaseArgument* /*p_arg*/,
+                                APointers /*p_a*/,
+                                BPointers /*p_b*/,
+                                const std::array<const void*, NumDTensor>& /*p_ds*/,
+                                void* /*p_e*/) const
+    {
+        return false;
+    }
+
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
 };
 
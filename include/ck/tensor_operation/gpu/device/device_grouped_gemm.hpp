@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -47,6 +47,44 @@ struct DeviceGroupedGemm : public BaseOperator
                         BElementwiseOperation b_element_op,
                         CElementwiseOperation c_element_op) = 0;
 
+    // Rebind the tensor pointers of an argument made by MakeArgumentPointer, so that it can be
+    // reused for groups with the same sizes and strides. Returns false if the operation does not
+    // support it or the number of pointers is not the group count of the argument, the argument is
+    // not changed then.
+    virtual bool UpdatePointers(BaseArgument* /*p_arg*/,
+                                std::vector<const void*>& /*p_a*/,
+                                std::vector<const void*>& /*p_b*/,
+                                std::vector<std::array<const void*, NumDTensor>>& /*p_ds*/,
+                                std::vector<void*>& /*p_e*/) const
+    {
+        return false;
+    }
+
+    // Rebind the tensor pointers and change the problems of the groups of an argument made by
+    // MakeArgumentPointer. Only groups whose GemmDesc changed have to be set up again, e.g. if a
+    // few group sizes change between steps. Returns false if the operation does not support it,
+    // the numbers of pointers and of GemmDesc differ or there are more groups than the workspace
+    // set by SetWorkSpacePointer was sized for, the argument is not changed then. Make a new
+    // argument for more groups.
+    virtual bool UpdateArgument(BaseArgument* /*p_arg*/,
+                                std::vector<const void*>& /*p_a*/,
+                                std::vector<const void*>& /*p_b*/,
+                                std::vector<std::array<const void*, NumDTensor>>& /*p_ds*/,
+                                std::vector<void*>& /*p_e*/,
+                                std::vector<GemmDesc>& /*gemm_desc*/) const
+    {
+        return false;
+    }
+
+    // Let the runs of an argument only copy the kernel arguments changed since its last run to the
+    // workspace, instead of all of them. Only enable it if the workspace is not written by anything
+    // else than runs of grouped GEMM arguments, or set the workspace again after such writes.
+    // Returns false if the operation does not support it.
+    virtual bool SetKernelArgDeltaUpload(BaseArgument* /*p_arg*/, bool /*enable*/) const
+    {
+        return false;
+    }
+
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
 };
 
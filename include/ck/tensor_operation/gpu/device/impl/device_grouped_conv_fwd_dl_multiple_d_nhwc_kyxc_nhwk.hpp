@@ -1026,6 +1026,25 @@ struct DeviceGroupedConvFwdDlMultipleD_NHWC_KYXC_NHWK
                                           cde_element_op);
     }
 
+    bool UpdatePointers(BaseArgument* p_arg,
+                        const void* p_a,
+                        const void* p_b,
+                        const std::array<const void*, NumDTensor>& p_ds,
+                        void* p_e) const override
+    {
+        auto arg = dynamic_cast<Argument*>(p_arg);
+
+        arg->p_a_grid_ = static_cast<const ADataType*>(p_a);
+        arg->p_b_grid_ = static_cast<const BDataType*>(p_b);
+        static_for<0, NumDTensor, 1>{}([&](auto i) {
+            using DDataType = remove_cvref_t<tuple_element_t<i.value, DsDataType>>;
+
+            arg->p_ds_grid_(i) = static_cast<const DDataType*>(p_ds[i]);
+        });
+        arg->p_e_grid_ = static_cast<EDataType*>(p_e);
+        return true;
+    }
+
     std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
     {
         return std::make_unique<Invoker>(Invoker{});
@@ -467,7 +467,7 @@ struct DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle
             : p_as_grid_{},
               p_bs_grid_{},
               p_ds_grid_{},
-              p_e_grid_{static_cast<EDataType*>(p_e)},
+              p_e_grid_{nullptr},
               num_group_{a_g_n_c_wis_lengths[0]},
               conv_to_gemm_transformer_{a_g_n_c_wis_lengths,
                                         a_g_n_c_wis_strides,
@@ -519,16 +519,8 @@ struct DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle
                     // Init compute_ptr_offset_of_groups_ for multiple AB
                     compute_ptr_offset_of_groups_.BatchStrideA_(i) = a_g_n_c_wis_strides[0];
 
-                    // Use GemmADataType/GemmBDataType to iterate over tuple (even if passed data
-                    // type is not tuple)
-                    using DataType = remove_cvref_t<tuple_element_t<i.value, GemmADataType>>;
-                    // It is possible that one of the AB is a pointer and one is a tuple.
-                    // Then also use multiAB but we have to cast single pointer instead of tuple of
-                    // pointer.
                     if constexpr(isMultiA)
                     {
-                        // p_as is tuple
-                        p_as_grid_(i) = static_cast<const DataType*>(p_as[i.value]);
                         // compute_ptr_offset_of_n_ not need BatchStrideB so
                         // in case of MultiA is false but isMultiB is true
                         // BatchStrideA_ is not tuple.
@@ -537,8 +529,6 @@ struct DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle
                     }
                     else
                     {
-                        // if MultiB and not MultiA then p_as is single pointer
-                        p_as_grid_(i) = static_cast<const DataType*>(p_as);
                         compute_ptr_offset_of_n_.BatchStrideA_ =
                             a_g_n_c_wis_strides[1] * conv_N_per_block_;
                     }
@@ -546,21 +536,6 @@ struct DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle
                 static_for<0, NumBTensor, 1>{}([&](auto i) {
                     // Init compute_ptr_offset_of_groups_ for multiple AB
                     compute_ptr_offset_of_groups_.BatchStrideB_(i) = b_g_k_c_xs_strides[0];
-
-                    using DataType = remove_cvref_t<tuple_element_t<i.value, GemmBDataType>>;
-                    // It is possible that one of the AB is a pointer and one is a tuple.
-                    // Then also use multiAB but we have to cast single pointer instead of tuple of
-                    // pointer.
-                    if constexpr(isMultiB)
-                    {
-                        // p_bs is tuple
-                        p_bs_grid_(i) = static_cast<const DataType*>(p_bs[i.value]);
-                    }
-                    else
-                    {
-                        // if MultiA and not MultiB then p_bs is single pointer
-                        p_bs_grid_(i) = static_cast<const DataType*>(p_bs);
-                    }
                 });
             }
             else
@@ -568,19 +543,13 @@ struct DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle
                 compute_ptr_offset_of_groups_.BatchStrideA_ = a_g_n_c_wis_strides[0];
                 compute_ptr_offset_of_groups_.BatchStrideB_ = b_g_k_c_xs_strides[0];
                 compute_ptr_offset_of_n_.BatchStrideA_ = a_g_n_c_wis_strides[1] * conv_N_per_block_;
-
-                // p_as and p_bs are pointers
-                p_as_grid_(I0) = static_cast<const ADataType*>(p_as);
-                p_bs_grid_(I0) = static_cast<const BDataType*>(p_bs);
             }
 
-            // populate pointer, batch stride, desc for Ds
-            static_for<0, NumDTensor, 1>{}([&](auto i) {
-                using DLayout   = remove_cvref_t<tuple_element_t<i.value, DsLayout>>;
-                using DDataType = remove_cvref_t<tuple_element_t<i.value, DsDataType>>;
+            SetPointers(p_as, p_bs, p_ds, p_e);
 
-                // D pointer
-                p_ds_grid_(i) = static_cast<const DDataType*>(p_ds[i]);
+            // populate batch stride, desc for Ds
+            static_for<0, NumDTensor, 1>{}([&](auto i) {
+                using DLayout = remove_cvref_t<tuple_element_t<i.value, DsLayout>>;
 
                 // D batch stride
                 compute_ptr_offset_of_groups_.BatchStrideDs_(i) = ds_g_n_k_wos_strides[i][0];
@@ -647,6 +616,62 @@ struct DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle
             }
         }
 
+        // pointers are not used by the descriptors, they can be changed for every launch
+        void SetPointers(APointers p_as,
+                         BPointers p_bs,
+                         const std::array<const void*, NumDTensor>& p_ds,
+                         void* p_e)
+        {
+            if constexpr(isMultiA || isMultiB)
+            {
+                static_for<0, NumATensor, 1>{}([&](auto i) {
+                    // Use GemmADataType/GemmBDataType to iterate over tuple (even if passed data
+                    // type is not tuple)
+                    using DataType = remove_cvref_t<tuple_element_t<i.value, GemmADataType>>;
+                    // It is possible that one of the AB is a pointer and one is a tuple.
+                    // Then also use multiAB but we have to cast single pointer instead of tuple of
+                    // pointer.
+                    if constexpr(isMultiA)
+                    {
+                        // p_as is tuple
+                        p_as_grid_(i) = static_cast<const DataType*>(p_as[i.value]);
+                    }
+                    else
+                    {
+                        // if MultiB and not MultiA then p_as is single pointer
+                        p_as_grid_(i) = static_cast<const DataType*>(p_as);
+                    }
+                });
+                static_for<0, NumBTensor, 1>{}([&](auto i) {
+                    using DataType = remove_cvref_t<tuple_element_t<i.value, GemmBDataType>>;
+                    if constexpr(isMultiB)
+                    {
+                        // p_bs is tuple
+                        p_bs_grid_(i) = static_cast<const DataType*>(p_bs[i.value]);
+                    }
+                    else
+                    {
+                        // if MultiA and not MultiB then p_bs is single pointer
+                        p_bs_grid_(i) = static_cast<const DataType*>(p_bs);
+                    }
+                });
+            }
+            else
+            {
+                // p_as and p_bs are pointers
+                p_as_grid_(I0) = static_cast<const ADataType*>(p_as);
+                p_bs_grid_(I0) = static_cast<const BDataType*>(p_bs);
+            }
+
+            static_for<0, NumDTensor, 1>{}([&](auto i) {
+                using DDataType = remove_cvref_t<tuple_element_t<i.value, DsDataType>>;
+
+                p_ds_grid_(i) = static_cast<const DDataType*>(p_ds[i]);
+            });
+
+            p_e_grid_ = static_cast<EDataType*>(p_e);
+        }
+
         void Print() const
         {
             std::cout << "A[M, K]: " << a_grid_desc_m_k_ << std::endl;
@@ -1273,6 +1298,16 @@ struct DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle
                                           cde_element_op);
     }
 
+    bool UpdatePointers(BaseArgument* p_arg,
+                        APointers p_as,
+                        BPointers p_bs,
+                        const std::array<const void*, NumDTensor>& p_ds,
+                        void* p_e) const override
+    {
+        dynamic_cast<Argument*>(p_arg)->SetPointers(p_as, p_bs, p_ds, p_e);
+        return true;
+    }
+
     std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
     {
         return std::make_unique<Invoker>(Invoker{});
@@ -1233,6 +1233,20 @@ struct DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle_V3
                                           cde_element_op);
     }
 
+    bool UpdatePointers(BaseArgument* p_arg,
+                        const void* p_a,
+                        const void* p_b,
+                        const std::array<const void*, NumDTensor>& /*p_ds*/,
+                        void* p_e) const override
+    {
+        auto arg = dynamic_cast<Argument*>(p_arg);
+
+        arg->p_a_grid_ = static_cast<const ADataType*>(p_a);
+        arg->p_b_grid_ = static_cast<const BDataType*>(p_b);
+        arg->p_e_grid_ = static_cast<EDataType*>(p_e);
+        return true;
+    }
+
     std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
     {
         return std::make_unique<Invoker>(Invoker{});
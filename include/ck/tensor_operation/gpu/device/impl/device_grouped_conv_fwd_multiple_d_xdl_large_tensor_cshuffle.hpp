@@ -424,7 +424,9 @@ struct DeviceGroupedConvFwdMultipleD_Xdl_CShuffle_Large_Tensor
                  const AElementwiseOperation& a_element_op,
                  const BElementwiseOperation& b_element_op,
                  const CDEElementwiseOperation& cde_element_op)
-            : num_group_{static_cast<index_t>(a_g_n_c_wis_lengths[0])},
+            : p_a_grid_{static_cast<const ADataType*>(p_a)},
+              p_e_grid_{static_cast<EDataType*>(p_e)},
+              num_group_{static_cast<index_t>(a_g_n_c_wis_lengths[0])},
               compute_ptr_offset_of_groups_{},
               compute_ptr_offset_of_n_{},
               a_element_op_{a_element_op},
@@ -541,6 +543,10 @@ struct DeviceGroupedConvFwdMultipleD_Xdl_CShuffle_Large_Tensor
             }
         }
 
+        // base pointers of the split tensors, the gemm pointers are offsets of them
+        const ADataType* p_a_grid_;
+        EDataType* p_e_grid_;
+
         index_t num_group_;
         index_t conv_N_per_block_;
 
@@ -1016,6 +1022,31 @@ struct DeviceGroupedConvFwdMultipleD_Xdl_CShuffle_Large_Tensor
                                           cde_element_op);
     }
 
+    bool UpdatePointers(BaseArgument* p_arg,
+                        const void* p_a,
+                        const void* p_b,
+                        const std::array<const void*, NumDTensor>& /*p_ds*/,
+                        void* p_e) const override
+    {
+        auto arg = dynamic_cast<Argument*>(p_arg);
+
+        const auto p_a_grid = static_cast<const ADataType*>(p_a);
+        const auto p_e_grid = static_cast<EDataType*>(p_e);
+
+        // the split into gemms does not depend on the pointers, only move them
+        for(index_t i = 0; i < arg->valid_gemms_count_; i++)
+        {
+            auto& gemm_arg  = arg->gemm_desc_kernel_args_(i);
+            gemm_arg.a_ptr_ = p_a_grid + (gemm_arg.a_ptr_ - arg->p_a_grid_);
+            gemm_arg.b_ptr_ = static_cast<const BDataType*>(p_b);
+            gemm_arg.e_ptr_ = p_e_grid + (gemm_arg.e_ptr_ - arg->p_e_grid_);
+        }
+
+        arg->p_a_grid_ = p_a_grid;
+        arg->p_e_grid_ = p_e_grid;
+        return true;
+    }
+
     std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
     {
         return std::make_unique<Invoker>(Invoker{});
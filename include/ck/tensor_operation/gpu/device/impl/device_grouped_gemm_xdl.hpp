@@ -1,10 +1,11 @@
 #pragma once
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
 #include <iostream>
+#include <memory>
 #include <sstream>
 
 #include "ck/utility/common_header.hpp"
@@ -16,6 +17,7 @@
 #include "ck/tensor_operation/gpu/device/matrix_padder.hpp"
 #include "ck/tensor_operation/gpu/grid/gridwise_gemm_multiple_d_xdl_cshuffle.hpp"
 #include "ck/host_utility/device_prop.hpp"
+#include "ck/host_utility/kernel_arg_arena.hpp"
 #include "ck/host_utility/kernel_launch.hpp"
 
 namespace ck {
@@ -367,7 +369,29 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
                  AElementwiseOperation a_element_op,
                  BElementwiseOperation b_element_op,
                  CDEElementwiseOperation c_element_op)
-            : a_element_op_{a_element_op}, b_element_op_{b_element_op}, c_element_op_{c_element_op}
+            : a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              c_element_op_{c_element_op},
+              kernel_arg_arena_{std::make_shared<KernelArgArena<GemmBiasTransKernelArg>>()}
+        {
+            SetGroups(p_As, p_Bs, p_Ds, p_Es, gemm_descs);
+        }
+
+        static bool IsSameGemmDesc(const GemmDesc& x, const GemmDesc& y)
+        {
+            return x.M_ == y.M_ && x.N_ == y.N_ && x.K_ == y.K_ && x.stride_A_ == y.stride_A_ &&
+                   x.stride_B_ == y.stride_B_ && x.stride_C_ == y.stride_C_ &&
+                   x.stride_Ds_ == y.stride_Ds_;
+        }
+
+        // Make the kernel arguments of all groups. Descriptors are only made for groups whose
+        // GemmDesc differs from the previous call, the kernel arguments of the other groups are
+        // moved to the new first block of the group.
+        void SetGroups(std::vector<const void*>& p_As,
+                       std::vector<const void*>& p_Bs,
+                       std::vector<std::array<const void*, NumDTensor>>& p_Ds,
+                       std::vector<void*>& p_Es,
+                       const std::vector<GemmDesc>& gemm_descs)
         {
             grid_size_ = 0;
 
@@ -380,7 +404,13 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
                 throw std::runtime_error("wrong! group_count_ != p_As/b/c.size");
             }
 
-            gemm_desc_kernel_arg_.reserve(group_count_);
+            std::vector<GemmBiasTransKernelArg> gemm_desc_kernel_arg;
+            std::vector<index_t> group_kernel_arg(group_count_, -1);
+
+            gemm_desc_kernel_arg.reserve(group_count_);
+
+            a_mtx_mraw_kraw_.clear();
+            b_mtx_nraw_kraw_.clear();
 
             skipped_group_count_ = 0;
 
@@ -412,6 +442,30 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
                     p_ds_grid(j) = static_cast<const DDataType*>(p_Ds[i][j]);
                 });
 
+                // unchanged group, only the pointers and the first block are updated
+                if(i < gemm_descs_.size() && group_kernel_arg_[i] >= 0 &&
+                   IsSameGemmDesc(gemm_descs_[i], gemm_descs[i]))
+                {
+                    auto kernel_arg = gemm_desc_kernel_arg_[group_kernel_arg_[i]];
+
+                    const index_t grid_size_grp = kernel_arg.BlockEnd_ - kernel_arg.BlockStart_;
+
+                    kernel_arg.a_ptr_  = static_cast<const ADataType*>(p_As[i]);
+                    kernel_arg.b_ptr_  = static_cast<const BDataType*>(p_Bs[i]);
+                    kernel_arg.ds_ptr_ = p_ds_grid;
+                    kernel_arg.e_ptr_  = static_cast<EDataType*>(p_Es[i]);
+
+                    kernel_arg.BlockStart_                    = grid_size_;
+                    kernel_arg.BlockEnd_                      = grid_size_ + grid_size_grp;
+                    kernel_arg.block_2_etile_map_.BlockStart_ = grid_size_;
+
+                    grid_size_ += grid_size_grp;
+
+                    group_kernel_arg[i] = gemm_desc_kernel_arg.size();
+                    gemm_desc_kernel_arg.push_back(kernel_arg);
+                    continue;
+                }
+
                 // tensor descriptors for problem definiton
                 const auto a_grid_desc_m_k = DeviceOp::MakeAGridDescriptor_M_K(M, K, StrideA);
                 const auto b_grid_desc_n_k = DeviceOp::MakeBGridDescriptor_N_K(K, N, StrideB);
@@ -468,7 +522,8 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
                         GridwiseGemm::MakeEGridDescriptor_MBlock_MPerBlock_NBlock_NPerBlock(
                             e_grid_desc_m_n);
 
-                    gemm_desc_kernel_arg_.push_back(
+                    group_kernel_arg[i] = gemm_desc_kernel_arg.size();
+                    gemm_desc_kernel_arg.push_back(
                         GemmBiasTransKernelArg{static_cast<const ADataType*>(p_As[i]),
                                                static_cast<const BDataType*>(p_Bs[i]),
                                                p_ds_grid,
@@ -486,6 +541,10 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
                                                BlockEnd});
                 }
             }
+
+            gemm_desc_kernel_arg_ = std::move(gemm_desc_kernel_arg);
+            group_kernel_arg_     = std::move(group_kernel_arg);
+            gemm_descs_           = gemm_descs;
         }
 
         //  private:
@@ -500,7 +559,17 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
         std::vector<Tuple<index_t, index_t>> a_mtx_mraw_kraw_;
         std::vector<Tuple<index_t, index_t>> b_mtx_nraw_kraw_;
 
+        // problems of the groups and index of their kernel argument, -1 if there is none
+        std::vector<GemmDesc> gemm_descs_;
+        std::vector<index_t> group_kernel_arg_;
+
         index_t grid_size_;
+
+        // group count p_workspace_ was sized for (GetWorkSpaceSize when it was set)
+        index_t workspace_group_count_ = 0;
+
+        // uploads gemm_desc_kernel_arg_ to p_workspace_, shared by copies of the argument
+        std::shared_ptr<KernelArgArena<GemmBiasTransKernelArg>> kernel_arg_arena_;
     };
 
     // Invoker
@@ -557,12 +626,17 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
                 }
             }
 
-            hipGetErrorString(hipMemcpyWithStream(arg.p_workspace_,
-                                                  arg.gemm_desc_kernel_arg_.data(),
-                                                  arg.gemm_desc_kernel_arg_.size() *
-                                                      sizeof(GemmBiasTransKernelArg),
-                                                  hipMemcpyHostToDevice,
-                                                  stream_config.stream_id_));
+            if(arg.group_count_ > arg.workspace_group_count_)
+            {
+                throw std::runtime_error("wrong! workspace is too small for the group count");
+            }
+
+            // all kernel arguments are copied, unless delta uploads were enabled by
+            // SetKernelArgDeltaUpload
+            arg.kernel_arg_arena_->Upload(arg.gemm_desc_kernel_arg_.data(),
+                                          arg.gemm_desc_kernel_arg_.size(),
+                                          arg.p_workspace_,
+                                          stream_config.stream_id_);
 
             float ave_time = 0;
 
@@ -680,6 +754,86 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
             p_As, p_Bs, p_Ds, p_Es, gemm_descs, a_element_op, b_element_op, c_element_op);
     }
 
+    // polymorphic
+    bool UpdatePointers(BaseArgument* p_arg,
+                        std::vector<const void*>& p_As,
+                        std::vector<const void*>& p_Bs,
+                        std::vector<std::array<const void*, NumDTensor>>& p_Ds,
+                        std::vector<void*>& p_Es) const override
+    {
+        auto arg = dynamic_cast<Argument*>(p_arg);
+
+        // the argument is not changed if the pointers do not match its groups
+        if(arg == nullptr || !(arg->group_count_ == ck::type_convert<ck::index_t>(p_As.size()) &&
+                               arg->group_count_ == ck::type_convert<ck::index_t>(p_Bs.size()) &&
+                               arg->group_count_ == ck::type_convert<ck::index_t>(p_Ds.size()) &&
+                               arg->group_count_ == ck::type_convert<ck::index_t>(p_Es.size()) &&
+                               arg->group_count_ ==
+                                   ck::type_convert<ck::index_t>(arg->group_kernel_arg_.size())))
+        {
+            return false;
+        }
+
+        const auto num_kernel_arg =
+            ck::type_convert<ck::index_t>(arg->gemm_desc_kernel_arg_.size());
+
+        for(index_t i = 0; i < arg->group_count_; i++)
+        {
+            if(arg->group_kernel_arg_[i] >= num_kernel_arg)
+            {
+                return false;
+            }
+        }
+
+        for(index_t i = 0; i < arg->group_count_; i++)
+        {
+            if(arg->group_kernel_arg_[i] < 0)
+            {
+                continue;
+            }
+
+            auto& kernel_arg  = arg->gemm_desc_kernel_arg_[arg->group_kernel_arg_[i]];
+            kernel_arg.a_ptr_ = static_cast<const ADataType*>(p_As[i]);
+            kernel_arg.b_ptr_ = static_cast<const BDataType*>(p_Bs[i]);
+            static_for<0, NumDTensor, 1>{}([&](auto j) {
+                using DDataType = remove_cvref_t<tuple_element_t<j.value, DsDataType>>;
+
+                kernel_arg.ds_ptr_(j) = static_cast<const DDataType*>(p_Ds[i][j]);
+            });
+            kernel_arg.e_ptr_ = static_cast<EDataType*>(p_Es[i]);
+        }
+        return true;
+    }
+
+    // polymorphic
+    bool UpdateArgument(BaseArgument* p_arg,
+                        std::vector<const void*>& p_As,
+                        std::vector<const void*>& p_Bs,
+                        std::vector<std::array<const void*, NumDTensor>>& p_Ds,
+                        std::vector<void*>& p_Es,
+                        std::vector<GemmDesc>& gemm_descs) const override
+    {
+        auto arg = dynamic_cast<Argument*>(p_arg);
+
+        // the argument is not changed if the pointers do not match the groups
+        if(arg == nullptr ||
+           !(gemm_descs.size() == p_As.size() && gemm_descs.size() == p_Bs.size() &&
+             gemm_descs.size() == p_Ds.size() && gemm_descs.size() == p_Es.size()))
+        {
+            return false;
+        }
+
+        // nor if the kernel arguments of the groups do not fit into the workspace set
+        if(arg->p_workspace_ != nullptr &&
+           ck::type_convert<ck::index_t>(gemm_descs.size()) > arg->workspace_group_count_)
+        {
+            return false;
+        }
+
+        arg->SetGroups(p_As, p_Bs, p_Ds, p_Es, gemm_descs);
+        return true;
+    }
+
     // polymorphic
     std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
     {
@@ -719,6 +873,32 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
     {
         return dynamic_cast<const Argument*>(p_arg)->group_count_ * sizeof(GemmBiasTransKernelArg);
     }
+
+    void SetWorkSpacePointer(BaseArgument* p_arg,
+                             void* p_workspace,
+                             const StreamConfig& = StreamConfig{}) const override
+    {
+        auto p_arg_                    = dynamic_cast<Argument*>(p_arg);
+        p_arg_->p_workspace_           = p_workspace;
+        p_arg_->workspace_group_count_ = p_workspace != nullptr ? p_arg_->group_count_ : 0;
+
+        // the next run uploads all kernel arguments, also with delta uploads enabled
+        p_arg_->kernel_arg_arena_->Invalidate();
+    }
+
+    // polymorphic
+    bool SetKernelArgDeltaUpload(BaseArgument* p_arg, bool enable) const override
+    {
+        auto arg = dynamic_cast<Argument*>(p_arg);
+
+        if(arg == nullptr)
+        {
+            return false;
+        }
+
+        arg->kernel_arg_arena_->EnableDeltaUploads(enable);
+        return true;
+    }
 };
 
 } // namespace device
@@ -13,6 +13,13 @@ using int4_t  = _BitInt(4);
 using f8_t    = _BitInt(8);
 using bf8_t   = unsigned _BitInt(8);
 
+// two signed 4-bit integers in a byte, the one with the lower index in the low nibble
+struct pk_int4_t
+{
+    using type = int8_t;
+    type data;
+};
+
 // vector_type
 template <typename T, index_t N>
 struct vector_type;
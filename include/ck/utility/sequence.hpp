@@ -182,6 +182,63 @@ struct Sequence
     }
 };
 
+namespace detail {
+template <typename T, T... Ints>
+struct index_sequence_impl;
+
+template <index_t... Ints>
+struct index_sequence_impl<index_t, Ints...>
+{
+    using type = Sequence<Ints...>;
+};
+} // namespace detail
+
+// Sequence<0, 1, ..., N - 1>, generated by compiler builtin without recursive instantiations
+template <index_t N>
+using make_index_sequence =
+    typename __make_integer_seq<detail::index_sequence_impl, index_t, N>::type;
+
+namespace detail {
+// Sequence metafunctions below are computed by constexpr loops on this buffer instead of
+// recursive template instantiations, so the instantiation depth does not grow with the
+// sequence size. mSize may be less than NMax for the results of filtering.
+template <index_t NMax>
+struct sequence_buffer
+{
+    // the last dummy element is to prevent compiler complain about empty array, when NMax = 0
+    index_t mData[NMax + 1] = {};
+    index_t mSize           = NMax;
+
+    __host__ __device__ constexpr index_t& operator()(index_t i) { return mData[i]; }
+
+    __host__ __device__ constexpr index_t operator[](index_t i) const { return mData[i]; }
+};
+
+template <index_t... Is>
+__host__ __device__ constexpr auto make_sequence_buffer(Sequence<Is...>)
+{
+    return sequence_buffer<sizeof...(Is)>{{Is...}, sizeof...(Is)};
+}
+
+// Impl::Compute() returns sequence_buffer, which is converted to Sequence by one pack expansion
+template <typename Impl>
+struct sequence_from_buffer
+{
+    static constexpr auto buffer = Impl::Compute();
+
+    template <typename Ids>
+    struct convert;
+
+    template <index_t... Ids>
+    struct convert<Sequence<Ids...>>
+    {
+        using type = Sequence<buffer[Ids]...>;
+    };
+
+    using type = typename convert<make_index_sequence<buffer.mSize>>::type;
+};
+} // namespace detail
+
 // merge sequence
 template <typename Seq, typename... Seqs>
 struct sequence_merge
@@ -205,32 +262,16 @@ struct sequence_merge<Seq>
 template <index_t NSize, typename F>
 struct sequence_gen
 {
-    template <index_t IBegin, index_t NRemain, typename G>
-    struct sequence_gen_impl
-    {
-        static constexpr index_t NRemainLeft  = NRemain / 2;
-        static constexpr index_t NRemainRight = NRemain - NRemainLeft;
-        static constexpr index_t IMiddle      = IBegin + NRemainLeft;
-
-        using type = typename sequence_merge<
-            typename sequence_gen_impl<IBegin, NRemainLeft, G>::type,
-            typename sequence_gen_impl<IMiddle, NRemainRight, G>::type>::type;
-    };
-
-    template <index_t I, typename G>
-    struct sequence_gen_impl<I, 1, G>
-    {
-        static constexpr index_t Is = G{}(Number<I>{});
-        using type                  = Sequence<Is>;
-    };
+    template <typename Ids, typename G>
+    struct sequence_gen_impl;
 
-    template <index_t I, typename G>
-    struct sequence_gen_impl<I, 0, G>
+    template <index_t... Ids, typename G>
+    struct sequence_gen_impl<Sequence<Ids...>, G>
     {
-        using type = Sequence<>;
+        using type = Sequence<G{}(Number<Ids>{})...>;
     };
 
-    using type = typename sequence_gen_impl<0, NSize, F>::type;
+    using type = typename sequence_gen_impl<make_index_sequence<NSize>, F>::type;
 };
 
 // arithmetic sequence
@@ -245,13 +286,16 @@ struct arithmetic_sequence_gen
         }
     };
 
-    using type0 = typename sequence_gen<(IEnd - IBegin) / Increment, F>::type;
-    using type1 = Sequence<>;
-
     static constexpr bool kHasContent =
         (Increment > 0 && IBegin < IEnd) || (Increment < 0 && IBegin > IEnd);
 
-    using type = typename conditional<kHasContent, type0, type1>::type;
+    using type = typename sequence_gen<kHasContent ? (IEnd - IBegin) / Increment : 0, F>::type;
+};
+
+template <index_t IEnd>
+struct arithmetic_sequence_gen<0, IEnd, 1>
+{
+    using type = make_index_sequence<IEnd>;
 };
 
 // uniform sequence
@@ -267,29 +311,31 @@ struct uniform_sequence_gen
 };
 
 // reverse inclusive scan (with init) sequence
-template <typename, typename, index_t>
-struct sequence_reverse_inclusive_scan;
-
-template <index_t I, index_t... Is, typename Reduce, index_t Init>
-struct sequence_reverse_inclusive_scan<Sequence<I, Is...>, Reduce, Init>
+namespace detail {
+template <typename Seq, typename Reduce, index_t Init>
+struct sequence_reverse_inclusive_scan_impl
 {
-    using old_scan = typename sequence_reverse_inclusive_scan<Sequence<Is...>, Reduce, Init>::type;
-
-    static constexpr index_t new_reduce = Reduce{}(I, old_scan{}.Front());
+    __host__ __device__ static constexpr auto Compute()
+    {
+        auto buffer    = make_sequence_buffer(Seq{});
+        index_t result = Init;
 
-    using type = typename sequence_merge<Sequence<new_reduce>, old_scan>::type;
-};
+        for(index_t i = buffer.mSize - 1; i >= 0; --i)
+        {
+            result    = Reduce{}(buffer[i], result);
+            buffer(i) = result;
+        }
 
-template <index_t I, typename Reduce, index_t Init>
-struct sequence_reverse_inclusive_scan<Sequence<I>, Reduce, Init>
-{
-    using type = Sequence<Reduce{}(I, Init)>;
+        return buffer;
+    }
 };
+} // namespace detail
 
-template <typename Reduce, index_t Init>
-struct sequence_reverse_inclusive_scan<Sequence<>, Reduce, Init>
+template <typename Seq, typename Reduce, index_t Init>
+struct sequence_reverse_inclusive_scan
 {
-    using type = Sequence<>;
+    using type = typename detail::sequence_from_buffer<
+        detail::sequence_reverse_inclusive_scan_impl<Seq, Reduce, Init>>::type;
 };
 
 // split sequence
@@ -306,36 +352,48 @@ struct sequence_split
 };
 
 // reverse sequence
-template <typename Seq>
-struct sequence_reverse
+template <index_t... Is>
+struct sequence_reverse<Sequence<Is...>>
 {
-    static constexpr index_t NSize = Seq{}.Size();
-
-    using seq_split = sequence_split<Seq, NSize / 2>;
-    using type      = typename sequence_merge<
-        typename sequence_reverse<typename seq_split::right_type>::type,
-        typename sequence_reverse<typename seq_split::left_type>::type>::type;
+    using type = decltype(Sequence<Is...>::Extract(
+        typename arithmetic_sequence_gen<index_t{sizeof...(Is)} - 1, -1, -1>::type{}));
 };
 
-template <index_t I>
-struct sequence_reverse<Sequence<I>>
+#if 1
+namespace detail {
+template <typename Reduce, typename Seq, typename... Seqs>
+struct sequence_reduce_impl
 {
-    using type = Sequence<I>;
-};
+    __host__ __device__ static constexpr auto Compute()
+    {
+        static_assert(((Seqs::Size() == Seq::Size()) && ...), "wrong! inconsistent size");
 
-template <index_t I0, index_t I1>
-struct sequence_reverse<Sequence<I0, I1>>
-{
-    using type = Sequence<I1, I0>;
+        constexpr index_t nseq = 1 + sizeof...(Seqs);
+
+        const decltype(make_sequence_buffer(Seq{})) inputs[nseq] = {
+            make_sequence_buffer(Seq{}), make_sequence_buffer(Seqs{})...};
+
+        // right fold: Reduce(x0, Reduce(x1, ... Reduce(xn-2, xn-1)))
+        auto result = inputs[nseq - 1];
+        for(index_t i = 0; i < result.mSize; ++i)
+        {
+            for(index_t k = nseq - 2; k >= 0; --k)
+            {
+                result(i) = Reduce{}(inputs[k][i], result[i]);
+            }
+        }
+
+        return result;
+    }
 };
+} // namespace detail
 
-#if 1
 template <typename Reduce, typename Seq, typename... Seqs>
 struct sequence_reduce
 {
-    using type = typename sequence_reduce<Reduce,
-                                          Seq,
-                                          typename sequence_reduce<Reduce, Seqs...>::type>::type;
+    using type =
+        typename detail::sequence_from_buffer<detail::sequence_reduce_impl<Reduce, Seq, Seqs...>>::
+            type;
 };
 
 template <typename Reduce, index_t... Xs, index_t... Ys>
@@ -351,269 +409,200 @@ struct sequence_reduce<Reduce, Seq>
 };
 #endif
 
-template <typename Values, typename Ids, typename Compare>
-struct sequence_sort_impl
+namespace detail {
+// Merge sort of ids (positions) by values. Splitting and tie-breaking are the same as in the
+// original recursive template implementation: length 2 ranges are ordered by Compare, merging
+// takes the left element only if its value is strictly less than the right one.
+template <typename Compare, index_t N>
+__host__ __device__ constexpr void sequence_merge_sort(const sequence_buffer<N>& values,
+                                                       sequence_buffer<N>& ids,
+                                                       sequence_buffer<N>& work,
+                                                       index_t begin,
+                                                       index_t end)
 {
-    template <typename LeftValues,
-              typename LeftIds,
-              typename RightValues,
-              typename RightIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl
-    {
-        static constexpr bool choose_left = LeftValues::Front() < RightValues::Front();
-
-        static constexpr index_t chosen_value =
-            choose_left ? LeftValues::Front() : RightValues::Front();
-        static constexpr index_t chosen_id = choose_left ? LeftIds::Front() : RightIds::Front();
-
-        using new_merged_values = decltype(MergedValues::PushBack(Number<chosen_value>{}));
-        using new_merged_ids    = decltype(MergedIds::PushBack(Number<chosen_id>{}));
-
-        using new_left_values =
-            typename conditional<choose_left, decltype(LeftValues::PopFront()), LeftValues>::type;
-        using new_left_ids =
-            typename conditional<choose_left, decltype(LeftIds::PopFront()), LeftIds>::type;
-
-        using new_right_values =
-            typename conditional<choose_left, RightValues, decltype(RightValues::PopFront())>::type;
-        using new_right_ids =
-            typename conditional<choose_left, RightIds, decltype(RightIds::PopFront())>::type;
-
-        using merge = sorted_sequence_merge_impl<new_left_values,
-                                                 new_left_ids,
-                                                 new_right_values,
-                                                 new_right_ids,
-                                                 new_merged_values,
-                                                 new_merged_ids,
-                                                 Comp>;
-        // this is output
-        using merged_values = typename merge::merged_values;
-        using merged_ids    = typename merge::merged_ids;
-    };
+    const index_t n = end - begin;
 
-    template <typename LeftValues,
-              typename LeftIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl<LeftValues,
-                                      LeftIds,
-                                      Sequence<>,
-                                      Sequence<>,
-                                      MergedValues,
-                                      MergedIds,
-                                      Comp>
-    {
-        using merged_values = typename sequence_merge<MergedValues, LeftValues>::type;
-        using merged_ids    = typename sequence_merge<MergedIds, LeftIds>::type;
-    };
+    if(n == 2)
+    {
+        if(!Compare{}(values[ids[begin]], values[ids[begin + 1]]))
+        {
+            const index_t tmp = ids[begin];
+            ids(begin)        = ids[begin + 1];
+            ids(begin + 1)    = tmp;
+        }
+    }
 
-    template <typename RightValues,
-              typename RightIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl<Sequence<>,
-                                      Sequence<>,
-                                      RightValues,
-                                      RightIds,
-                                      MergedValues,
-                                      MergedIds,
-                                      Comp>
-    {
-        using merged_values = typename sequence_merge<MergedValues, RightValues>::type;
-        using merged_ids    = typename sequence_merge<MergedIds, RightIds>::type;
-    };
+    if(n <= 2)
+    {
+        return;
+    }
 
-    template <typename LeftValues,
-              typename LeftIds,
-              typename RightValues,
-              typename RightIds,
-              typename Comp>
-    struct sorted_sequence_merge
-    {
-        using merge = sorted_sequence_merge_impl<LeftValues,
-                                                 LeftIds,
-                                                 RightValues,
-                                                 RightIds,
-                                                 Sequence<>,
-                                                 Sequence<>,
-                                                 Comp>;
-
-        using merged_values = typename merge::merged_values;
-        using merged_ids    = typename merge::merged_ids;
-    };
+    const index_t middle = begin + n / 2;
+
+    sequence_merge_sort<Compare>(values, ids, work, begin, middle);
+    sequence_merge_sort<Compare>(values, ids, work, middle, end);
 
-    static constexpr index_t nsize = Values::Size();
+    index_t left  = begin;
+    index_t right = middle;
+    index_t out   = begin;
 
-    using split_unsorted_values = sequence_split<Values, nsize / 2>;
-    using split_unsorted_ids    = sequence_split<Ids, nsize / 2>;
+    while(left < middle && right < end)
+    {
+        work(out++) = values[ids[left]] < values[ids[right]] ? ids[left++] : ids[right++];
+    }
+    while(left < middle)
+    {
+        work(out++) = ids[left++];
+    }
+    while(right < end)
+    {
+        work(out++) = ids[right++];
+    }
 
-    using left_unsorted_values = typename split_unsorted_values::left_type;
-    using left_unsorted_ids    = typename split_unsorted_ids::left_type;
-    using left_sort          = sequence_sort_impl<left_unsorted_values, left_unsorted_ids, Compare>;
-    using left_sorted_values = typename left_sort::sorted_values;
-    using left_sorted_ids    = typename left_sort::sorted_ids;
+    for(index_t i = begin; i < end; ++i)
+    {
+        ids(i) = work[i];
+    }
+}
 
-    using right_unsorted_values = typename split_unsorted_values::right_type;
-    using right_unsorted_ids    = typename split_unsorted_ids::right_type;
-    using right_sort = sequence_sort_impl<right_unsorted_values, right_unsorted_ids, Compare>;
-    using right_sorted_values = typename right_sort::sorted_values;
-    using right_sorted_ids    = typename right_sort::sorted_ids;
+// positions of Values elements in sorted order
+template <typename Values, typename Compare>
+__host__ __device__ constexpr auto sequence_sort_positions()
+{
+    const auto values = make_sequence_buffer(Values{});
 
-    using merged_sorted = sorted_sequence_merge<left_sorted_values,
-                                                left_sorted_ids,
-                                                right_sorted_values,
-                                                right_sorted_ids,
-                                                Compare>;
+    auto ids  = values;
+    auto work = values;
+    for(index_t i = 0; i < ids.mSize; ++i)
+    {
+        ids(i) = i;
+    }
 
-    using sorted_values = typename merged_sorted::merged_values;
-    using sorted_ids    = typename merged_sorted::merged_ids;
-};
+    sequence_merge_sort<Compare>(values, ids, work, 0, ids.mSize);
 
-template <index_t ValueX, index_t ValueY, index_t IdX, index_t IdY, typename Compare>
-struct sequence_sort_impl<Sequence<ValueX, ValueY>, Sequence<IdX, IdY>, Compare>
-{
-    static constexpr bool choose_x = Compare{}(ValueX, ValueY);
+    return ids;
+}
 
-    using sorted_values =
-        typename conditional<choose_x, Sequence<ValueX, ValueY>, Sequence<ValueY, ValueX>>::type;
-    using sorted_ids = typename conditional<choose_x, Sequence<IdX, IdY>, Sequence<IdY, IdX>>::type;
+template <typename Values, typename Compare>
+struct sequence_sort_positions_impl
+{
+    __host__ __device__ static constexpr auto Compute()
+    {
+        return sequence_sort_positions<Values, Compare>();
+    }
 };
 
-template <index_t Value, index_t Id, typename Compare>
-struct sequence_sort_impl<Sequence<Value>, Sequence<Id>, Compare>
+template <typename Values, typename Less>
+struct sequence_unique_sort_positions_impl
 {
-    using sorted_values = Sequence<Value>;
-    using sorted_ids    = Sequence<Id>;
+    __host__ __device__ static constexpr auto Compute()
+    {
+        const auto values = make_sequence_buffer(Values{});
+        const auto ids    = sequence_sort_positions<Values, Less>();
+
+        auto unique_ids  = ids;
+        unique_ids.mSize = 0;
+        for(index_t i = 0; i < ids.mSize; ++i)
+        {
+            if(i == 0 || values[ids[i]] != values[unique_ids[unique_ids.mSize - 1]])
+            {
+                unique_ids(unique_ids.mSize++) = ids[i];
+            }
+        }
+
+        return unique_ids;
+    }
 };
+} // namespace detail
 
-template <typename Compare>
-struct sequence_sort_impl<Sequence<>, Sequence<>, Compare>
+template <typename Values, typename Ids, typename Compare>
+struct sequence_sort_impl
 {
-    using sorted_values = Sequence<>;
-    using sorted_ids    = Sequence<>;
+    static_assert(Values::Size() == Ids::Size(), "wrong! inconsistent size");
+
+    using positions = typename detail::sequence_from_buffer<
+        detail::sequence_sort_positions_impl<Values, Compare>>::type;
+
+    using sorted_values = decltype(Values::Extract(positions{}));
+    using sorted_ids    = decltype(Ids::Extract(positions{}));
 };
 
 template <typename Values, typename Compare>
 struct sequence_sort
 {
-    using unsorted_ids = typename arithmetic_sequence_gen<0, Values::Size(), 1>::type;
-    using sort         = sequence_sort_impl<Values, unsorted_ids, Compare>;
+    using sort = typename detail::sequence_from_buffer<
+        detail::sequence_sort_positions_impl<Values, Compare>>::type;
 
     // this is output
-    using type                = typename sort::sorted_values;
-    using sorted2unsorted_map = typename sort::sorted_ids;
+    using type                = decltype(Values::Extract(sort{}));
+    using sorted2unsorted_map = sort;
 };
 
 template <typename Values, typename Less, typename Equal>
 struct sequence_unique_sort
 {
-    template <typename RemainValues,
-              typename RemainIds,
-              typename UniquifiedValues,
-              typename UniquifiedIds,
-              typename Eq>
-    struct sorted_sequence_uniquify_impl
-    {
-        static constexpr index_t current_value = RemainValues::Front();
-        static constexpr index_t current_id    = RemainIds::Front();
-
-        static constexpr bool is_unique_value = (current_value != UniquifiedValues::Back());
-
-        using new_remain_values = decltype(RemainValues::PopFront());
-        using new_remain_ids    = decltype(RemainIds::PopFront());
-
-        using new_uniquified_values =
-            typename conditional<is_unique_value,
-                                 decltype(UniquifiedValues::PushBack(Number<current_value>{})),
-                                 UniquifiedValues>::type;
-
-        using new_uniquified_ids =
-            typename conditional<is_unique_value,
-                                 decltype(UniquifiedIds::PushBack(Number<current_id>{})),
-                                 UniquifiedIds>::type;
+    using uniquify = typename detail::sequence_from_buffer<
+        detail::sequence_unique_sort_positions_impl<Values, Less>>::type;
 
-        using uniquify = sorted_sequence_uniquify_impl<new_remain_values,
-                                                       new_remain_ids,
-                                                       new_uniquified_values,
-                                                       new_uniquified_ids,
-                                                       Eq>;
+    // this is output
+    using type                = decltype(Values::Extract(uniquify{}));
+    using sorted2unsorted_map = uniquify;
+};
 
-        // this is output
-        using uniquified_values = typename uniquify::uniquified_values;
-        using uniquified_ids    = typename uniquify::uniquified_ids;
-    };
+namespace detail {
+template <typename SeqMap>
+__host__ __device__ constexpr bool is_valid_sequence_map_impl()
+{
+    const auto x2y = make_sequence_buffer(SeqMap{});
 
-    template <typename UniquifiedValues, typename UniquifiedIds, typename Eq>
-    struct sorted_sequence_uniquify_impl<Sequence<>,
-                                         Sequence<>,
-                                         UniquifiedValues,
-                                         UniquifiedIds,
-                                         Eq>
+    auto is_mapped = x2y;
+    for(index_t y = 0; y < is_mapped.mSize; ++y)
     {
-        using uniquified_values = UniquifiedValues;
-        using uniquified_ids    = UniquifiedIds;
-    };
+        is_mapped(y) = 0;
+    }
 
-    template <typename SortedValues, typename SortedIds, typename Eq>
-    struct sorted_sequence_uniquify
+    for(index_t x = 0; x < x2y.mSize; ++x)
     {
-        using uniquify = sorted_sequence_uniquify_impl<decltype(SortedValues::PopFront()),
-                                                       decltype(SortedIds::PopFront()),
-                                                       Sequence<SortedValues::Front()>,
-                                                       Sequence<SortedIds::Front()>,
-                                                       Eq>;
+        const index_t y = x2y[x];
+        if(y < 0 || y >= x2y.mSize || is_mapped[y])
+        {
+            return false;
+        }
+        is_mapped(y) = 1;
+    }
 
-        using uniquified_values = typename uniquify::uniquified_values;
-        using uniquified_ids    = typename uniquify::uniquified_ids;
-    };
+    return true;
+}
 
-    using sort          = sequence_sort<Values, Less>;
-    using sorted_values = typename sort::type;
-    using sorted_ids    = typename sort::sorted2unsorted_map;
+template <typename SeqMap>
+struct sequence_map_inverse_impl
+{
+    __host__ __device__ static constexpr auto Compute()
+    {
+        const auto x2y = make_sequence_buffer(SeqMap{});
 
-    using uniquify = sorted_sequence_uniquify<sorted_values, sorted_ids, Equal>;
+        auto y2x = x2y;
+        for(index_t x = 0; x < x2y.mSize; ++x)
+        {
+            y2x(x2y[x]) = x;
+        }
 
-    // this is output
-    using type                = typename uniquify::uniquified_values;
-    using sorted2unsorted_map = typename uniquify::uniquified_ids;
+        return y2x;
+    }
 };
+} // namespace detail
 
 template <typename SeqMap>
-struct is_valid_sequence_map : is_same<typename arithmetic_sequence_gen<0, SeqMap::Size(), 1>::type,
-                                       typename sequence_sort<SeqMap, math::less<index_t>>::type>
+struct is_valid_sequence_map
+    : integral_constant<bool, detail::is_valid_sequence_map_impl<SeqMap>()>
 {
 };
 
 template <typename SeqMap>
 struct sequence_map_inverse
 {
-    template <typename X2Y, typename WorkingY2X, index_t XBegin, index_t XRemain>
-    struct sequence_map_inverse_impl
-    {
-        static constexpr auto new_y2x =
-            WorkingY2X::Modify(X2Y::At(Number<XBegin>{}), Number<XBegin>{});
-
-        using type =
-            typename sequence_map_inverse_impl<X2Y, decltype(new_y2x), XBegin + 1, XRemain - 1>::
-                type;
-    };
-
-    template <typename X2Y, typename WorkingY2X, index_t XBegin>
-    struct sequence_map_inverse_impl<X2Y, WorkingY2X, XBegin, 0>
-    {
-        using type = WorkingY2X;
-    };
-
     using type =
-        typename sequence_map_inverse_impl<SeqMap,
-                                           typename uniform_sequence_gen<SeqMap::Size(), 0>::type,
-                                           0,
-                                           SeqMap::Size()>::type;
+        typename detail::sequence_from_buffer<detail::sequence_map_inverse_impl<SeqMap>>::type;
 };
 
 template <index_t... Xs, index_t... Ys>
@@ -793,25 +782,26 @@ __host__ __device__ constexpr auto pick_sequence_elements_by_ids(Seq, Sequence<I
 
 #if 1
 namespace detail {
-template <typename WorkSeq, typename RemainSeq, typename RemainMask>
+template <typename Mask>
 struct pick_sequence_elements_by_mask_impl
 {
-    using new_work_seq = typename conditional<RemainMask::Front(),
-                                              decltype(WorkSeq::PushBack(RemainSeq::Front())),
-                                              WorkSeq>::type;
+    __host__ __device__ static constexpr auto Compute()
+    {
+        const auto mask = make_sequence_buffer(Mask{});
 
-    using type =
-        typename pick_sequence_elements_by_mask_impl<new_work_seq,
-                                                     decltype(RemainSeq::PopFront()),
-                                                     decltype(RemainMask::PopFront())>::type;
-};
+        auto ids  = mask;
+        ids.mSize = 0;
+        for(index_t i = 0; i < mask.mSize; ++i)
+        {
+            if(mask[i])
+            {
+                ids(ids.mSize++) = i;
+            }
+        }
 
-template <typename WorkSeq>
-struct pick_sequence_elements_by_mask_impl<WorkSeq, Sequence<>, Sequence<>>
-{
-    using type = WorkSeq;
+        return ids;
+    }
 };
-
 } // namespace detail
 
 template <typename Seq, typename Mask>
@@ -819,25 +809,30 @@ __host__ __device__ constexpr auto pick_sequence_elements_by_mask(Seq, Mask)
 {
     static_assert(Seq::Size() == Mask::Size(), "wrong!");
 
-    return typename detail::pick_sequence_elements_by_mask_impl<Sequence<>, Seq, Mask>::type{};
+    using ids =
+        typename detail::sequence_from_buffer<detail::pick_sequence_elements_by_mask_impl<Mask>>::
+            type;
+
+    return Seq::Extract(ids{});
 }
 
 namespace detail {
-template <typename WorkSeq, typename RemainValues, typename RemainIds>
+template <typename Seq, typename Values, typename Ids>
 struct modify_sequence_elements_by_ids_impl
 {
-    using new_work_seq = decltype(WorkSeq::Modify(RemainIds::Front(), RemainValues::Front()));
+    __host__ __device__ static constexpr auto Compute()
+    {
+        const auto values = make_sequence_buffer(Values{});
+        const auto ids    = make_sequence_buffer(Ids{});
 
-    using type =
-        typename modify_sequence_elements_by_ids_impl<new_work_seq,
-                                                      decltype(RemainValues::PopFront()),
-                                                      decltype(RemainIds::PopFront())>::type;
-};
+        auto result = make_sequence_buffer(Seq{});
+        for(index_t i = 0; i < ids.mSize; ++i)
+        {
+            result(ids[i]) = values[i];
+        }
 
-template <typename WorkSeq>
-struct modify_sequence_elements_by_ids_impl<WorkSeq, Sequence<>, Sequence<>>
-{
-    using type = WorkSeq;
+        return result;
+    }
 };
 } // namespace detail
 
@@ -846,7 +841,8 @@ __host__ __device__ constexpr auto modify_sequence_elements_by_ids(Seq, Values,
 {
     static_assert(Values::Size() == Ids::Size() && Seq::Size() >= Values::Size(), "wrong!");
 
-    return typename detail::modify_sequence_elements_by_ids_impl<Seq, Values, Ids>::type{};
+    return typename detail::sequence_from_buffer<
+        detail::modify_sequence_elements_by_ids_impl<Seq, Values, Ids>>::type{};
 }
 #endif
 
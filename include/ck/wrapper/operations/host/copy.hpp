@@ -0,0 +1,320 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <cstring>
+
+#include "ck/wrapper/utils/tensor_utils.hpp"
+
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/utility/type_convert.hpp"
+
+// Disable from doxygen docs generation
+/// @cond INTERNAL
+namespace ck {
+namespace wrapper {
+namespace host {
+/// @endcond
+
+// Disable from doxygen docs generation
+/// @cond INTERNAL
+namespace detail {
+
+template <typename Transform>
+using is_linear_transform = decltype(Transform::IsLinearTransform());
+
+/**
+ * \brief Check if transform computes lower index as an affine function of
+ * upper index (e.g. Embed, Slice, Freeze). Transforms without the trait
+ * (e.g. Xor) are treated as non-linear.
+ *
+ * \return True if transform is linear.
+ */
+template <typename Transform>
+constexpr bool IsLinearTransform()
+{
+    if constexpr(is_detected<is_linear_transform, Transform>::value)
+    {
+        return Transform::IsLinearTransform();
+    }
+    else
+    {
+        return false;
+    }
+}
+
+template <typename Transforms>
+struct AreLinearTransforms;
+
+// Transforms which can map to invalid elements (e.g. Pad) are excluded, since
+// strided copy does not check element validity.
+template <typename... Transforms>
+struct AreLinearTransforms<Tuple<Transforms...>>
+{
+    static constexpr bool value =
+        ((IsLinearTransform<remove_cvref_t<Transforms>>() &&
+          remove_cvref_t<Transforms>::IsValidUpperIndexAlwaysMappedToValidLowerIndex()) &&
+         ...);
+};
+
+/**
+ * \brief Check if tensor offset is an affine function of the unrolled
+ * multi index. Then offset can be described by per dimension strides.
+ *
+ * \return True if tensor is strided.
+ */
+template <typename TensorType>
+constexpr bool IsStridedTensor()
+{
+    using LayoutType     = remove_cvref_t<decltype(layout(std::declval<const TensorType&>()))>;
+    using DescriptorType = typename LayoutType::LayoutUnrolledDescriptorType;
+    using Transforms = remove_cvref_t<decltype(std::declval<DescriptorType>().GetTransforms())>;
+    return TensorType::IsDynamicBuffer && AreLinearTransforms<Transforms>::value;
+}
+
+/**
+ * \brief Get lengths of the unrolled (flatten) tensor shape.
+ *
+ * \param tensor Tensor to get lengths.
+ * \return Array of lengths.
+ */
+template <typename TensorType>
+auto GetUnrolledLengths(const TensorType& tensor)
+{
+    const auto unrolled_shape = UnrollNestedTuple(shape(tensor));
+    constexpr index_t num_dims = decltype(unrolled_shape)::Size();
+
+    std::array<index_t, num_dims> lengths;
+    static_for<0, num_dims, 1>{}(
+        [&](auto d) { lengths[d] = static_cast<index_t>(size(unrolled_shape.At(d))); });
+    return lengths;
+}
+
+/**
+ * \brief Get strides of the strided tensor by probing the unrolled
+ * descriptor with unit multi indices.
+ *
+ * \param tensor Strided tensor.
+ * \return Array of strides.
+ */
+template <typename TensorType>
+auto GetUnrolledStrides(const TensorType& tensor)
+{
+    const auto& desc           = layout(tensor).GetUnrolledDescriptor();
+    constexpr index_t num_dims = remove_cvref_t<decltype(desc)>::GetNumOfDimension();
+
+    const auto zero_idx = make_zero_multi_index<num_dims>();
+    const long_index_t origin_offset = desc.CalculateOffset(zero_idx);
+
+    std::array<long_index_t, num_dims> strides;
+    static_for<0, num_dims, 1>{}([&](auto d) {
+        auto unit_idx = make_zero_multi_index<num_dims>();
+        unit_idx(d)   = 1;
+        strides[d]    = desc.CalculateOffset(unit_idx) - origin_offset;
+    });
+    return strides;
+}
+
+/**
+ * \brief Get pointer to the element of the not nested tensor. As on device, the
+ * offset is calculated from the unrolled descriptor shifted by the tensor
+ * multi index offset, and the element validity (e.g. padding) is checked.
+ *
+ * \param tensor Tensor to get element from.
+ * \param flat_idx 1d index of the element (column-major).
+ * \return Pointer to the element or nullptr if the element is not valid.
+ */
+template <typename TensorType>
+auto GetValidElementPointer(const TensorType& tensor, index_t flat_idx)
+{
+    const auto& desc           = layout(tensor).GetUnrolledDescriptor();
+    constexpr index_t num_dims = remove_cvref_t<decltype(desc)>::GetNumOfDimension();
+
+    const auto lengths = GetUnrolledLengths(tensor);
+    auto idx           = tensor.GetMultiIdxOffsets();
+    static_for<0, num_dims, 1>{}([&](auto d) {
+        idx(d) += flat_idx % lengths[d];
+        flat_idx /= lengths[d];
+    });
+
+    const auto coord = make_tensor_coordinate(desc, idx);
+    using Pointer    = decltype(tensor.GetPointer());
+    return coordinate_has_valid_offset_assuming_visible_index_is_valid(desc, coord)
+               ? tensor.GetPointer() + coord.GetOffset()
+               : Pointer{nullptr};
+}
+
+/**
+ * \brief Copy strided n-dimensional block. The innermost loop is performed
+ * over the dimension which is contiguous for both tensors (lowered to
+ * memcpy), otherwise over the dimension contiguous in destination
+ * (gather).
+ */
+template <typename SrcDataType, typename DstDataType, std::size_t NumDims>
+void StridedCopy(const SrcDataType* p_src,
+                 DstDataType* p_dst,
+                 const std::array<index_t, NumDims>& lengths,
+                 const std::array<long_index_t, NumDims>& src_strides,
+                 const std::array<long_index_t, NumDims>& dst_strides)
+{
+    for(std::size_t d = 0; d < NumDims; ++d)
+    {
+        if(lengths[d] == 0)
+        {
+            return;
+        }
+    }
+
+    // Prefer dimension contiguous in both tensors, then contiguous in destination
+    std::size_t inner_dim = 0;
+    index_t best_score    = -1;
+    for(std::size_t d = 0; d < NumDims; ++d)
+    {
+        const bool is_long = lengths[d] > 1;
+        const index_t score =
+            2 * (is_long && dst_strides[d] == 1) + (is_long && src_strides[d] == 1);
+        if(score > best_score)
+        {
+            inner_dim  = d;
+            best_score = score;
+        }
+    }
+
+    const index_t inner_length      = lengths[inner_dim];
+    const long_index_t src_inner_st = src_strides[inner_dim];
+    const long_index_t dst_inner_st = dst_strides[inner_dim];
+    const bool use_memcpy =
+        is_same_v<remove_cv_t<SrcDataType>, DstDataType> && src_inner_st == 1 && dst_inner_st == 1;
+
+    std::array<index_t, NumDims> idx{};
+    long_index_t src_offset = 0;
+    long_index_t dst_offset = 0;
+    while(true)
+    {
+        if(use_memcpy)
+        {
+            std::memcpy(
+                p_dst + dst_offset, p_src + src_offset, sizeof(DstDataType) * inner_length);
+        }
+        else
+        {
+            for(index_t i = 0; i < inner_length; ++i)
+            {
+                p_dst[dst_offset + i * dst_inner_st] =
+                    type_convert<DstDataType>(p_src[src_offset + i * src_inner_st]);
+            }
+        }
+
+        // Increment outer dims (odometer), offsets are updated incrementally
+        std::size_t d = 0;
+        for(; d < NumDims; ++d)
+        {
+            if(d == inner_dim)
+            {
+                continue;
+            }
+            ++idx[d];
+            src_offset += src_strides[d];
+            dst_offset += dst_strides[d];
+            if(idx[d] < lengths[d])
+            {
+                break;
+            }
+            src_offset -= src_strides[d] * lengths[d];
+            dst_offset -= dst_strides[d] * lengths[d];
+            idx[d] = 0;
+        }
+        if(d == NumDims)
+        {
+            return;
+        }
+    }
+}
+
+} // namespace detail
+/// @endcond
+
+/**
+ * \brief Perform copy between two tensors on the host. Tensors must have the
+ * same size. Host counterpart of ck::wrapper::copy.
+ *
+ * \note If both tensors are dynamic (pointer based) and their layouts are
+ * built from linear transforms only (make_layout, slices, partitions, tiles
+ * of not nested tensors), copy is performed on strides with incremental
+ * offsets and the contiguous dimension is lowered to memcpy (or to a strided
+ * gather when types or strides differ). Otherwise element-wise copy is
+ * performed.
+ *
+ * \param src_tensor Source tensor.
+ * \param dst_tensor Destination tensor.
+ */
+template <typename SrcTensorType, typename DstTensorType>
+void copy(const SrcTensorType& src_tensor, DstTensorType& dst_tensor)
+{
+    using DstDataType = std::remove_const_t<typename DstTensorType::TensorElementType>;
+
+    using SrcShapeType = remove_cvref_t<decltype(UnrollNestedTuple(shape(src_tensor)))>;
+    using DstShapeType = remove_cvref_t<decltype(UnrollNestedTuple(shape(dst_tensor)))>;
+
+    if constexpr(SrcTensorType::IsDynamicBuffer && DstTensorType::IsDynamicBuffer)
+    {
+        if constexpr(detail::IsStridedTensor<SrcTensorType>() &&
+                     detail::IsStridedTensor<DstTensorType>() &&
+                     SrcShapeType::Size() == DstShapeType::Size())
+        {
+            const auto lengths = detail::GetUnrolledLengths(src_tensor);
+            if(lengths == detail::GetUnrolledLengths(dst_tensor))
+            {
+                // Element (0, ..., 0) includes slice and tile offsets
+                detail::StridedCopy(&src_tensor(index_t{0}),
+                                    &dst_tensor(index_t{0}),
+                                    lengths,
+                                    detail::GetUnrolledStrides(src_tensor),
+                                    detail::GetUnrolledStrides(dst_tensor));
+                return;
+            }
+        }
+
+        const index_t num_elements = size(src_tensor);
+        if constexpr(!IsNestedTuple(remove_cvref_t<decltype(shape(src_tensor))>{}) &&
+                     !IsNestedTuple(remove_cvref_t<decltype(shape(dst_tensor))>{}))
+        {
+            // Generic path, offsets are calculated for each element. Invalid
+            // source elements are read as zero, invalid destination elements
+            // are skipped (as in device copy).
+            for(index_t i = 0; i < num_elements; ++i)
+            {
+                auto* p_dst = detail::GetValidElementPointer(dst_tensor, i);
+                if(p_dst == nullptr)
+                {
+                    continue;
+                }
+                const auto* p_src = detail::GetValidElementPointer(src_tensor, i);
+                *p_dst            = p_src == nullptr ? type_convert<DstDataType>(0.f)
+                                                     : type_convert<DstDataType>(*p_src);
+            }
+        }
+        else
+        {
+            // Nested shapes, use tensor element access
+            for(index_t i = 0; i < num_elements; ++i)
+            {
+                dst_tensor(i) = type_convert<DstDataType>(src_tensor(i));
+            }
+        }
+    }
+    else
+    {
+        // At least one of the tensors is a register tensor (size known at compile time)
+        using StaticShapeType =
+            conditional_t<SrcTensorType::IsDynamicBuffer, DstShapeType, SrcShapeType>;
+        static_for<0, size(StaticShapeType{}), 1>{}(
+            [&](auto i) { dst_tensor(i) = type_convert<DstDataType>(src_tensor(i)); });
+    }
+}
+
+} // namespace host
+} // namespace wrapper
+} // namespace ck
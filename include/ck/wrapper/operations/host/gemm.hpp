@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "ck/wrapper/layout.hpp"
+#include "ck/wrapper/tensor.hpp"
+#include "ck/wrapper/operations/host/copy.hpp"
+
+// Disable from doxygen docs generation
+/// @cond INTERNAL
+namespace ck {
+namespace wrapper {
+namespace host {
+/// @endcond
+
+// Disable from doxygen docs generation
+/// @cond INTERNAL
+namespace detail {
+
+/**
+ * \brief Gemm microkernel on packed buffers: C[M, N] += A[M, K] * B[K, N]
+ * (all row-major). MRepeat x NRepeat accumulators are kept in registers and
+ * the N loop is contiguous, so it can be vectorized without reassociation.
+ */
+template <typename AccDataType, index_t MRepeat = 4, index_t NRepeat = 16>
+void GemmMicroKernel(const AccDataType* p_a,
+                     const AccDataType* p_b,
+                     AccDataType* p_c,
+                     const index_t M,
+                     const index_t N,
+                     const index_t K)
+{
+    for(index_t m0 = 0; m0 < M; m0 += MRepeat)
+    {
+        const index_t m_repeat = std::min(MRepeat, M - m0);
+        for(index_t n0 = 0; n0 < N; n0 += NRepeat)
+        {
+            const index_t n_repeat = std::min(NRepeat, N - n0);
+
+            AccDataType acc[MRepeat][NRepeat] = {};
+            if(m_repeat == MRepeat && n_repeat == NRepeat)
+            {
+                for(index_t k = 0; k < K; ++k)
+                {
+                    const AccDataType* p_b_k = p_b + k * N + n0;
+                    for(index_t m = 0; m < MRepeat; ++m)
+                    {
+                        const AccDataType a_m_k = p_a[(m0 + m) * K + k];
+                        for(index_t n = 0; n < NRepeat; ++n)
+                        {
+                            acc[m][n] += a_m_k * p_b_k[n];
+                        }
+                    }
+                }
+            }
+            else
+            {
+                // M, N tails
+                for(index_t k = 0; k < K; ++k)
+                {
+                    const AccDataType* p_b_k = p_b + k * N + n0;
+                    for(index_t m = 0; m < m_repeat; ++m)
+                    {
+                        const AccDataType a_m_k = p_a[(m0 + m) * K + k];
+                        for(index_t n = 0; n < n_repeat; ++n)
+                        {
+                            acc[m][n] += a_m_k * p_b_k[n];
+                        }
+                    }
+                }
+            }
+
+            for(index_t m = 0; m < m_repeat; ++m)
+            {
+                for(index_t n = 0; n < n_repeat; ++n)
+                {
+                    p_c[(m0 + m) * N + n0 + n] += acc[m][n];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * \brief Get M (or N) and K lengths of the gemm tile in (MPerBlock,
+ * KPerBlock) or (K0PerBlock, MPerBlock, K1) layout.
+ *
+ * \param tile_tensor Gemm tile tensor.
+ * \return Pair of lengths (MN, K).
+ */
+template <typename TensorType>
+auto GetGemmTileLengths(const TensorType& tile_tensor)
+{
+    constexpr index_t num_dims = remove_cvref_t<decltype(shape(tile_tensor))>::Size();
+    static_assert(num_dims == 2 || num_dims == 3, "Gemm tile must be 2d or 3d.");
+    if constexpr(num_dims == 2)
+    {
+        return std::make_pair(static_cast<index_t>(size<0>(tile_tensor)),
+                              static_cast<index_t>(size<1>(tile_tensor)));
+    }
+    else
+    {
+        return std::make_pair(static_cast<index_t>(size<1>(tile_tensor)),
+                              static_cast<index_t>(size<0>(tile_tensor) * size<2>(tile_tensor)));
+    }
+}
+
+/**
+ * \brief Create packed tensor view on the buffer for gemm tile. Elements are
+ * stored as MN x K (row-major) or K x MN (row-major) if TransposeMNK.
+ *
+ * \param p_data Pointer to the buffer.
+ * \param tile_tensor Gemm tile tensor to take shape from.
+ * \return Packed tensor with the same shape as tile tensor.
+ */
+template <bool TransposeMNK, typename DataType, typename TensorType>
+auto MakePackedGemmTileTensor(DataType* p_data, const TensorType& tile_tensor)
+{
+    const auto [MN, K]         = GetGemmTileLengths(tile_tensor);
+    const index_t mn_stride    = TransposeMNK ? 1 : K;
+    const index_t k_stride     = TransposeMNK ? MN : 1;
+    constexpr index_t num_dims = remove_cvref_t<decltype(shape(tile_tensor))>::Size();
+    if constexpr(num_dims == 2)
+    {
+        const auto packed_layout = make_layout(make_tuple(MN, K), make_tuple(mn_stride, k_stride));
+        return make_tensor<MemoryTypeEnum::Generic>(p_data, packed_layout);
+    }
+    else
+    {
+        const index_t K0         = size<0>(tile_tensor);
+        const index_t K1         = size<2>(tile_tensor);
+        const auto packed_layout = make_layout(make_tuple(K0, MN, K1),
+                                               make_tuple(K1 * k_stride, mn_stride, k_stride));
+        return make_tensor<MemoryTypeEnum::Generic>(p_data, packed_layout);
+    }
+}
+
+} // namespace detail
+/// @endcond
+
+/**
+ * \brief Perform blockwise gemm on the host: C += A * B^T. Host counterpart
+ * of ck::wrapper::blockwise_gemm_xdl. A data layout must be (MPerBlock,
+ * KPerBlock) or (K0PerBlock, MPerBlock, K1) and B data layout must be
+ * (NPerBlock, KPerBlock) or (K0PerBlock, NPerBlock, K1) (as on device).
+ * In contrast to the device version, C is a plain (MPerBlock, NPerBlock)
+ * tensor.
+ *
+ * \note Tiles are packed into AccDataType buffers (A as M x K, B as K x N)
+ * using host copy and multiplied by the register blocked microkernel.
+ *
+ * \tparam AccDataType Accumulation data type.
+ * \param a_tile_tensor A tile tensor.
+ * \param b_tile_tensor B tile tensor.
+ * \param c_tile_tensor C tile tensor (MPerBlock, NPerBlock).
+ */
+template <typename AccDataType = float,
+          typename ATensorType,
+          typename BTensorType,
+          typename CTensorType>
+void blockwise_gemm(const ATensorType& a_tile_tensor,
+                    const BTensorType& b_tile_tensor,
+                    CTensorType& c_tile_tensor)
+{
+    static_assert(remove_cvref_t<decltype(shape(a_tile_tensor))>::Size() ==
+                  remove_cvref_t<decltype(shape(b_tile_tensor))>::Size());
+    static_assert(remove_cvref_t<decltype(shape(c_tile_tensor))>::Size() == 2);
+
+    const auto [M, K]   = detail::GetGemmTileLengths(a_tile_tensor);
+    const auto [N, K_b] = detail::GetGemmTileLengths(b_tile_tensor);
+    const index_t M_c   = size<0>(c_tile_tensor);
+    const index_t N_c   = size<1>(c_tile_tensor);
+    if(K != K_b || M != M_c || N != N_c)
+    {
+        throw std::runtime_error("Inconsistent gemm tile lengths.");
+    }
+
+    // Thread local buffers are reused between calls from the same CPU thread
+    thread_local std::vector<AccDataType> a_buf, b_buf, c_buf;
+    a_buf.resize(static_cast<std::size_t>(M) * K);
+    b_buf.resize(static_cast<std::size_t>(K) * N);
+    c_buf.resize(static_cast<std::size_t>(M) * N);
+
+    auto a_packed_tensor = detail::MakePackedGemmTileTensor<false>(a_buf.data(), a_tile_tensor);
+    auto b_packed_tensor = detail::MakePackedGemmTileTensor<true>(b_buf.data(), b_tile_tensor);
+    auto c_packed_tensor = make_tensor<MemoryTypeEnum::Generic>(
+        c_buf.data(), make_layout(make_tuple(M, N), make_tuple(N, index_t{1})));
+
+    copy(a_tile_tensor, a_packed_tensor);
+    copy(b_tile_tensor, b_packed_tensor);
+    copy(c_tile_tensor, c_packed_tensor);
+
+    detail::GemmMicroKernel(a_buf.data(), b_buf.data(), c_buf.data(), M, N, K);
+
+    copy(c_packed_tensor, c_tile_tensor);
+}
+
+} // namespace host
+} // namespace wrapper
+} // namespace ck
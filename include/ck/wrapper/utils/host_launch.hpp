@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/stream_config.hpp"
+
+// Disable from doxygen docs generation
+/// @cond INTERNAL
+namespace ck {
+namespace wrapper {
+namespace host {
+/// @endcond
+
+/**
+ * \brief Execute block functor for each block of the 2d grid on CPU threads.
+ * Blocks are independent (as on device), so the grid is split into
+ * contiguous ranges of 1d block ids, one range per CPU thread.
+ *
+ * \param grid_size_x Number of blocks in x dimension.
+ * \param grid_size_y Number of blocks in y dimension.
+ * \param f Block functor called as f(block_idx_x, block_idx_y).
+ * \param num_thread Number of CPU threads (hardware concurrency if 0).
+ */
+template <typename F>
+void parallel_for_blocks(const index_t grid_size_x,
+                         const index_t grid_size_y,
+                         F&& f,
+                         std::size_t num_thread = 0)
+{
+    const std::size_t num_blocks = static_cast<std::size_t>(grid_size_x) * grid_size_y;
+    if(num_thread == 0)
+    {
+        num_thread = std::max(1u, std::thread::hardware_concurrency());
+    }
+    num_thread = std::max<std::size_t>(1, std::min(num_thread, num_blocks));
+
+    const std::size_t blocks_per_thread = (num_blocks + num_thread - 1) / num_thread;
+    auto run_range                      = [&](std::size_t begin, std::size_t end) {
+        for(std::size_t block_id = begin; block_id < end; ++block_id)
+        {
+            // x is the fastest changing block dimension (as for blockIdx)
+            f(static_cast<index_t>(block_id % grid_size_x),
+              static_cast<index_t>(block_id / grid_size_x));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_thread - 1);
+    for(std::size_t it = 1; it < num_thread; ++it)
+    {
+        const std::size_t begin = it * blocks_per_thread;
+        const std::size_t end   = std::min(begin + blocks_per_thread, num_blocks);
+        if(begin < end)
+        {
+            threads.emplace_back(run_range, begin, end);
+        }
+    }
+    // Calling thread processes the first range
+    run_range(0, std::min(blocks_per_thread, num_blocks));
+
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+/**
+ * \brief Execute thread functor for each thread of the block sequentially.
+ * Host replacement for the implicit threadIdx.x parallelism. Since threads
+ * are executed one after another, all of the block's work issued before
+ * a call is visible after it (no barrier needed).
+ *
+ * \param block_size Number of threads in block.
+ * \param f Thread functor called as f(thread_id).
+ */
+template <typename F>
+void for_each_thread(const index_t block_size, F&& f)
+{
+    for(index_t thread_id = 0; thread_id < block_size; ++thread_id)
+    {
+        f(thread_id);
+    }
+}
+
+/**
+ * \brief Launch host kernel on the 2d grid and measure average time.
+ * Host counterpart of launch_and_time_kernel. Kernel is called per block as
+ * kernel(block_idx_x, block_idx_y, args...).
+ *
+ * \param stream_config Stream config (time_kernel_, cold_niters_ and nrepeat_
+ * are used).
+ * \param kernel Host kernel functor.
+ * \param grid_size_x Number of blocks in x dimension.
+ * \param grid_size_y Number of blocks in y dimension.
+ * \param args Kernel arguments.
+ * \return Average time in ms (0 if time_kernel_ is disabled).
+ */
+template <typename F, typename... Args>
+float launch_and_time_kernel(const StreamConfig& stream_config,
+                             F kernel,
+                             const index_t grid_size_x,
+                             const index_t grid_size_y,
+                             Args... args)
+{
+    auto run_block = [&](index_t block_idx_x, index_t block_idx_y) {
+        kernel(block_idx_x, block_idx_y, args...);
+    };
+    auto run = [&]() { parallel_for_blocks(grid_size_x, grid_size_y, run_block); };
+
+    if(!stream_config.time_kernel_)
+    {
+        run();
+        return 0;
+    }
+
+    for(int i = 0; i < stream_config.cold_niters_; ++i)
+    {
+        run();
+    }
+
+    const int nrepeat = std::max(1, stream_config.nrepeat_);
+    const auto start  = std::chrono::high_resolution_clock::now();
+    for(int i = 0; i < nrepeat; ++i)
+    {
+        run();
+    }
+    const auto stop = std::chrono::high_resolution_clock::now();
+
+    return std::chrono::duration<float, std::milli>(stop - start).count() / nrepeat;
+}
+
+} // namespace host
+} // namespace wrapper
+} // namespace ck
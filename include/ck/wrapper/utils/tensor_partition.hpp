@@ -387,10 +387,16 @@ __host__ __device__ constexpr auto make_local_tile(const TensorType& tensor,
                                             remove_cvref_t<decltype(m_n_desc)>>(m_n_desc);
         const auto block_work_idx =
             block_2_tile_map.CalculateBottomIndex(make_multi_index(block_id_1d));
+#if defined(__HIP_DEVICE_COMPILE__)
         const index_t m_block_data_idx_on_grid =
             __builtin_amdgcn_readfirstlane(block_work_idx[I0] * MPerBlock);
         const index_t n_block_data_idx_on_grid =
             __builtin_amdgcn_readfirstlane(block_work_idx[I1] * NPerBlock);
+#else
+        // Host execution (see ck/wrapper/utils/host_launch.hpp)
+        const index_t m_block_data_idx_on_grid = block_work_idx[I0] * MPerBlock;
+        const index_t n_block_data_idx_on_grid = block_work_idx[I1] * NPerBlock;
+#endif
         // Apply 0 for non partitioned dims
         const auto offset_multi_idxs = generate_tuple(
             [&](auto i) {
@@ -221,6 +221,47 @@ template <index_t N>
 using make_index_sequence =
     typename __make_integer_seq<impl::__integer_sequence, index_t, N>::seq_type;
 
+namespace impl {
+// Sequence metafunctions below are computed by constexpr loops on this buffer instead of
+// recursive template instantiations, so the instantiation depth does not grow with the
+// sequence size. size may be less than NMax for the results of filtering.
+template <index_t NMax>
+struct sequence_buffer
+{
+    // the last dummy element is to prevent compiler complain about empty array, when NMax = 0
+    index_t data[NMax + 1] = {};
+    index_t size           = NMax;
+
+    CK_TILE_HOST_DEVICE constexpr index_t& operator()(index_t i) { return data[i]; }
+
+    CK_TILE_HOST_DEVICE constexpr index_t operator[](index_t i) const { return data[i]; }
+};
+
+template <index_t... Is>
+CK_TILE_HOST_DEVICE constexpr auto make_sequence_buffer(sequence<Is...>)
+{
+    return sequence_buffer<sizeof...(Is)>{{Is...}, sizeof...(Is)};
+}
+
+// Impl::compute() returns sequence_buffer, which is converted to sequence by one pack expansion
+template <typename Impl>
+struct sequence_from_buffer
+{
+    static constexpr auto buffer = Impl::compute();
+
+    template <typename Ids>
+    struct convert;
+
+    template <index_t... Ids>
+    struct convert<sequence<Ids...>>
+    {
+        using type = sequence<buffer[Ids]...>;
+    };
+
+    using type = typename convert<make_index_sequence<buffer.size>>::type;
+};
+} // namespace impl
+
 // merge sequence
 template <typename Seq, typename... Seqs>
 struct sequence_merge
@@ -244,32 +285,16 @@ struct sequence_merge<Seq>
 template <index_t NSize, typename F>
 struct sequence_gen
 {
-    template <index_t IBegin, index_t NRemain, typename G>
-    struct sequence_gen_impl
-    {
-        static constexpr index_t NRemainLeft  = NRemain / 2;
-        static constexpr index_t NRemainRight = NRemain - NRemainLeft;
-        static constexpr index_t IMiddle      = IBegin + NRemainLeft;
+    template <typename Ids, typename G>
+    struct sequence_gen_impl;
 
-        using type = typename sequence_merge<
-            typename sequence_gen_impl<IBegin, NRemainLeft, G>::type,
-            typename sequence_gen_impl<IMiddle, NRemainRight, G>::type>::type;
-    };
-
-    template <index_t I, typename G>
-    struct sequence_gen_impl<I, 1, G>
-    {
-        static constexpr index_t Is = G{}(number<I>{});
-        using type                  = sequence<Is>;
-    };
-
-    template <index_t I, typename G>
-    struct sequence_gen_impl<I, 0, G>
+    template <index_t... Ids, typename G>
+    struct sequence_gen_impl<sequence<Ids...>, G>
     {
-        using type = sequence<>;
+        using type = sequence<G{}(number<Ids>{})...>;
     };
 
-    using type = typename sequence_gen_impl<0, NSize, F>::type;
+    using type = typename sequence_gen_impl<make_index_sequence<NSize>, F>::type;
 };
 
 // arithmetic sequence
@@ -284,13 +309,10 @@ struct arithmetic_sequence_gen
         }
     };
 
-    using type0 = typename sequence_gen<(IEnd - IBegin) / Increment, F>::type;
-    using type1 = sequence<>;
-
     static constexpr bool kHasContent =
         (Increment > 0 && IBegin < IEnd) || (Increment < 0 && IBegin > IEnd);
 
-    using type = typename std::conditional<kHasContent, type0, type1>::type;
+    using type = typename sequence_gen<kHasContent ? (IEnd - IBegin) / Increment : 0, F>::type;
 };
 
 template <index_t IEnd>
@@ -312,29 +334,31 @@ struct uniform_sequence_gen
 };
 
 // reverse inclusive scan (with init) sequence
-template <typename, typename, index_t>
-struct sequence_reverse_inclusive_scan;
-
-template <index_t I, index_t... Is, typename Reduce, index_t Init>
-struct sequence_reverse_inclusive_scan<sequence<I, Is...>, Reduce, Init>
+namespace impl {
+template <typename Seq, typename Reduce, index_t Init>
+struct sequence_reverse_inclusive_scan_impl
 {
-    using old_scan = typename sequence_reverse_inclusive_scan<sequence<Is...>, Reduce, Init>::type;
-
-    static constexpr index_t new_reduce = Reduce{}(I, old_scan{}.front());
+    CK_TILE_HOST_DEVICE static constexpr auto compute()
+    {
+        auto buffer    = make_sequence_buffer(Seq{});
+        index_t result = Init;
 
-    using type = typename sequence_merge<sequence<new_reduce>, old_scan>::type;
-};
+        for(index_t i = buffer.size - 1; i >= 0; --i)
+        {
+            result    = Reduce{}(buffer[i], result);
+            buffer(i) = result;
+        }
 
-template <index_t I, typename Reduce, index_t Init>
-struct sequence_reverse_inclusive_scan<sequence<I>, Reduce, Init>
-{
-    using type = sequence<Reduce{}(I, Init)>;
+        return buffer;
+    }
 };
+} // namespace impl
 
-template <typename Reduce, index_t Init>
-struct sequence_reverse_inclusive_scan<sequence<>, Reduce, Init>
+template <typename Seq, typename Reduce, index_t Init>
+struct sequence_reverse_inclusive_scan
 {
-    using type = sequence<>;
+    using type = typename impl::sequence_from_buffer<
+        impl::sequence_reverse_inclusive_scan_impl<Seq, Reduce, Init>>::type;
 };
 
 // split sequence
@@ -399,12 +423,40 @@ struct sequence_reverse<sequence<Ns...>>
 // using sequence_reverse_t = typename sequence_reverse<Ns...>::type;
 
 #if 1
+namespace impl {
+template <typename Reduce, typename Seq, typename... Seqs>
+struct sequence_reduce_impl
+{
+    CK_TILE_HOST_DEVICE static constexpr auto compute()
+    {
+        static_assert(((Seqs::size() == Seq::size()) && ...), "wrong! inconsistent size");
+
+        constexpr index_t nseq = 1 + sizeof...(Seqs);
+
+        const decltype(make_sequence_buffer(Seq{})) inputs[nseq] = {
+            make_sequence_buffer(Seq{}), make_sequence_buffer(Seqs{})...};
+
+        // right fold: Reduce(x0, Reduce(x1, ... Reduce(xn-2, xn-1)))
+        auto result = inputs[nseq - 1];
+        for(index_t i = 0; i < result.size; ++i)
+        {
+            for(index_t k = nseq - 2; k >= 0; --k)
+            {
+                result(i) = Reduce{}(inputs[k][i], result[i]);
+            }
+        }
+
+        return result;
+    }
+};
+} // namespace impl
+
 template <typename Reduce, typename Seq, typename... Seqs>
 struct sequence_reduce
 {
-    using type = typename sequence_reduce<Reduce,
-                                          Seq,
-                                          typename sequence_reduce<Reduce, Seqs...>::type>::type;
+    using type =
+        typename impl::sequence_from_buffer<impl::sequence_reduce_impl<Reduce, Seq, Seqs...>>::
+            type;
 };
 
 template <typename Reduce, index_t... Xs, index_t... Ys>
@@ -420,272 +472,200 @@ struct sequence_reduce<Reduce, Seq>
 };
 #endif
 
-template <typename Values, typename Ids, typename Compare>
-struct sequence_sort_impl
-{
-    template <typename LeftValues,
-              typename LeftIds,
-              typename RightValues,
-              typename RightIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl
+namespace impl {
+// Merge sort of ids (positions) by values. Splitting and tie-breaking are the same as in the
+// original recursive template implementation: length 2 ranges are ordered by Compare, merging
+// takes the left element only if its value is strictly less than the right one.
+template <typename Compare, index_t N>
+CK_TILE_HOST_DEVICE constexpr void sequence_merge_sort(const sequence_buffer<N>& values,
+                                                       sequence_buffer<N>& ids,
+                                                       sequence_buffer<N>& work,
+                                                       index_t begin,
+                                                       index_t end)
+{
+    const index_t n = end - begin;
+
+    if(n == 2)
     {
-        static constexpr bool choose_left = LeftValues::front() < RightValues::front();
-
-        static constexpr index_t chosen_value =
-            choose_left ? LeftValues::front() : RightValues::front();
-        static constexpr index_t chosen_id = choose_left ? LeftIds::front() : RightIds::front();
-
-        using new_merged_values = decltype(MergedValues::push_back(number<chosen_value>{}));
-        using new_merged_ids    = decltype(MergedIds::push_back(number<chosen_id>{}));
-
-        using new_left_values = typename std::
-            conditional<choose_left, decltype(LeftValues::pop_front()), LeftValues>::type;
-        using new_left_ids =
-            typename std::conditional<choose_left, decltype(LeftIds::pop_front()), LeftIds>::type;
-
-        using new_right_values = typename std::
-            conditional<choose_left, RightValues, decltype(RightValues::pop_front())>::type;
-        using new_right_ids =
-            typename std::conditional<choose_left, RightIds, decltype(RightIds::pop_front())>::type;
-
-        using merge = sorted_sequence_merge_impl<new_left_values,
-                                                 new_left_ids,
-                                                 new_right_values,
-                                                 new_right_ids,
-                                                 new_merged_values,
-                                                 new_merged_ids,
-                                                 Comp>;
-        // this is output
-        using merged_values = typename merge::merged_values;
-        using merged_ids    = typename merge::merged_ids;
-    };
+        if(!Compare{}(values[ids[begin]], values[ids[begin + 1]]))
+        {
+            const index_t tmp = ids[begin];
+            ids(begin)        = ids[begin + 1];
+            ids(begin + 1)    = tmp;
+        }
+    }
 
-    template <typename LeftValues,
-              typename LeftIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl<LeftValues,
-                                      LeftIds,
-                                      sequence<>,
-                                      sequence<>,
-                                      MergedValues,
-                                      MergedIds,
-                                      Comp>
+    if(n <= 2)
     {
-        using merged_values = typename sequence_merge<MergedValues, LeftValues>::type;
-        using merged_ids    = typename sequence_merge<MergedIds, LeftIds>::type;
-    };
+        return;
+    }
 
-    template <typename RightValues,
-              typename RightIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl<sequence<>,
-                                      sequence<>,
-                                      RightValues,
-                                      RightIds,
-                                      MergedValues,
-                                      MergedIds,
-                                      Comp>
-    {
-        using merged_values = typename sequence_merge<MergedValues, RightValues>::type;
-        using merged_ids    = typename sequence_merge<MergedIds, RightIds>::type;
-    };
+    const index_t middle = begin + n / 2;
 
-    template <typename LeftValues,
-              typename LeftIds,
-              typename RightValues,
-              typename RightIds,
-              typename Comp>
-    struct sorted_sequence_merge
+    sequence_merge_sort<Compare>(values, ids, work, begin, middle);
+    sequence_merge_sort<Compare>(values, ids, work, middle, end);
+
+    index_t left  = begin;
+    index_t right = middle;
+    index_t out   = begin;
+
+    while(left < middle && right < end)
     {
-        using merge = sorted_sequence_merge_impl<LeftValues,
-                                                 LeftIds,
-                                                 RightValues,
-                                                 RightIds,
-                                                 sequence<>,
-                                                 sequence<>,
-                                                 Comp>;
-
-        using merged_values = typename merge::merged_values;
-        using merged_ids    = typename merge::merged_ids;
-    };
+        work(out++) = values[ids[left]] < values[ids[right]] ? ids[left++] : ids[right++];
+    }
+    while(left < middle)
+    {
+        work(out++) = ids[left++];
+    }
+    while(right < end)
+    {
+        work(out++) = ids[right++];
+    }
 
-    static constexpr index_t nsize = Values::size();
+    for(index_t i = begin; i < end; ++i)
+    {
+        ids(i) = work[i];
+    }
+}
 
-    using split_unsorted_values = sequence_split<Values, nsize / 2>;
-    using split_unsorted_ids    = sequence_split<Ids, nsize / 2>;
+// positions of Values elements in sorted order
+template <typename Values, typename Compare>
+CK_TILE_HOST_DEVICE constexpr auto sequence_sort_positions()
+{
+    const auto values = make_sequence_buffer(Values{});
 
-    using left_unsorted_values = typename split_unsorted_values::left_type;
-    using left_unsorted_ids    = typename split_unsorted_ids::left_type;
-    using left_sort          = sequence_sort_impl<left_unsorted_values, left_unsorted_ids, Compare>;
-    using left_sorted_values = typename left_sort::sorted_values;
-    using left_sorted_ids    = typename left_sort::sorted_ids;
+    auto ids  = values;
+    auto work = values;
+    for(index_t i = 0; i < ids.size; ++i)
+    {
+        ids(i) = i;
+    }
 
-    using right_unsorted_values = typename split_unsorted_values::right_type;
-    using right_unsorted_ids    = typename split_unsorted_ids::right_type;
-    using right_sort = sequence_sort_impl<right_unsorted_values, right_unsorted_ids, Compare>;
-    using right_sorted_values = typename right_sort::sorted_values;
-    using right_sorted_ids    = typename right_sort::sorted_ids;
+    sequence_merge_sort<Compare>(values, ids, work, 0, ids.size);
 
-    using merged_sorted = sorted_sequence_merge<left_sorted_values,
-                                                left_sorted_ids,
-                                                right_sorted_values,
-                                                right_sorted_ids,
-                                                Compare>;
+    return ids;
+}
 
-    using sorted_values = typename merged_sorted::merged_values;
-    using sorted_ids    = typename merged_sorted::merged_ids;
+template <typename Values, typename Compare>
+struct sequence_sort_positions_impl
+{
+    CK_TILE_HOST_DEVICE static constexpr auto compute()
+    {
+        return sequence_sort_positions<Values, Compare>();
+    }
 };
 
-template <index_t ValueX, index_t ValueY, index_t IdX, index_t IdY, typename Compare>
-struct sequence_sort_impl<sequence<ValueX, ValueY>, sequence<IdX, IdY>, Compare>
+template <typename Values, typename Less>
+struct sequence_unique_sort_positions_impl
 {
-    static constexpr bool choose_x = Compare{}(ValueX, ValueY);
+    CK_TILE_HOST_DEVICE static constexpr auto compute()
+    {
+        const auto values = make_sequence_buffer(Values{});
+        const auto ids    = sequence_sort_positions<Values, Less>();
 
-    using sorted_values = typename std::
-        conditional<choose_x, sequence<ValueX, ValueY>, sequence<ValueY, ValueX>>::type;
-    using sorted_ids =
-        typename std::conditional<choose_x, sequence<IdX, IdY>, sequence<IdY, IdX>>::type;
-};
+        auto unique_ids = ids;
+        unique_ids.size = 0;
+        for(index_t i = 0; i < ids.size; ++i)
+        {
+            if(i == 0 || values[ids[i]] != values[unique_ids[unique_ids.size - 1]])
+            {
+                unique_ids(unique_ids.size++) = ids[i];
+            }
+        }
 
-template <index_t Value, index_t Id, typename Compare>
-struct sequence_sort_impl<sequence<Value>, sequence<Id>, Compare>
-{
-    using sorted_values = sequence<Value>;
-    using sorted_ids    = sequence<Id>;
+        return unique_ids;
+    }
 };
+} // namespace impl
 
-template <typename Compare>
-struct sequence_sort_impl<sequence<>, sequence<>, Compare>
+template <typename Values, typename Ids, typename Compare>
+struct sequence_sort_impl
 {
-    using sorted_values = sequence<>;
-    using sorted_ids    = sequence<>;
+    static_assert(Values::size() == Ids::size(), "wrong! inconsistent size");
+
+    using positions = typename impl::sequence_from_buffer<
+        impl::sequence_sort_positions_impl<Values, Compare>>::type;
+
+    using sorted_values = decltype(Values::extract(positions{}));
+    using sorted_ids    = decltype(Ids::extract(positions{}));
 };
 
 template <typename Values, typename Compare>
 struct sequence_sort
 {
-    using unsorted_ids = typename arithmetic_sequence_gen<0, Values::size(), 1>::type;
-    using sort         = sequence_sort_impl<Values, unsorted_ids, Compare>;
+    using sort = typename impl::sequence_from_buffer<
+        impl::sequence_sort_positions_impl<Values, Compare>>::type;
 
     // this is output
-    using type                = typename sort::sorted_values;
-    using sorted2unsorted_map = typename sort::sorted_ids;
+    using type                = decltype(Values::extract(sort{}));
+    using sorted2unsorted_map = sort;
 };
 
 template <typename Values, typename Less, typename Equal>
 struct sequence_unique_sort
 {
-    template <typename RemainValues,
-              typename RemainIds,
-              typename UniquifiedValues,
-              typename UniquifiedIds,
-              typename Eq>
-    struct sorted_sequence_uniquify_impl
-    {
-        static constexpr index_t current_value = RemainValues::front();
-        static constexpr index_t current_id    = RemainIds::front();
-
-        static constexpr bool is_unique_value = (current_value != UniquifiedValues::back());
-
-        using new_remain_values = decltype(RemainValues::pop_front());
-        using new_remain_ids    = decltype(RemainIds::pop_front());
-
-        using new_uniquified_values =
-            typename std::conditional<is_unique_value,
-                                      decltype(UniquifiedValues::push_back(
-                                          number<current_value>{})),
-                                      UniquifiedValues>::type;
-
-        using new_uniquified_ids =
-            typename std::conditional<is_unique_value,
-                                      decltype(UniquifiedIds::push_back(number<current_id>{})),
-                                      UniquifiedIds>::type;
-
-        using uniquify = sorted_sequence_uniquify_impl<new_remain_values,
-                                                       new_remain_ids,
-                                                       new_uniquified_values,
-                                                       new_uniquified_ids,
-                                                       Eq>;
-
-        // this is output
-        using uniquified_values = typename uniquify::uniquified_values;
-        using uniquified_ids    = typename uniquify::uniquified_ids;
-    };
+    using uniquify = typename impl::sequence_from_buffer<
+        impl::sequence_unique_sort_positions_impl<Values, Less>>::type;
+
+    // this is output
+    using type                = decltype(Values::extract(uniquify{}));
+    using sorted2unsorted_map = uniquify;
+};
+
+namespace impl {
+template <typename SeqMap>
+CK_TILE_HOST_DEVICE constexpr bool is_valid_sequence_map_impl()
+{
+    const auto x2y = make_sequence_buffer(SeqMap{});
 
-    template <typename UniquifiedValues, typename UniquifiedIds, typename Eq>
-    struct sorted_sequence_uniquify_impl<sequence<>,
-                                         sequence<>,
-                                         UniquifiedValues,
-                                         UniquifiedIds,
-                                         Eq>
+    auto is_mapped = x2y;
+    for(index_t y = 0; y < is_mapped.size; ++y)
     {
-        using uniquified_values = UniquifiedValues;
-        using uniquified_ids    = UniquifiedIds;
-    };
+        is_mapped(y) = 0;
+    }
 
-    template <typename SortedValues, typename SortedIds, typename Eq>
-    struct sorted_sequence_uniquify
+    for(index_t x = 0; x < x2y.size; ++x)
     {
-        using uniquify = sorted_sequence_uniquify_impl<decltype(SortedValues::pop_front()),
-                                                       decltype(SortedIds::pop_front()),
-                                                       sequence<SortedValues::front()>,
-                                                       sequence<SortedIds::front()>,
-                                                       Eq>;
-
-        using uniquified_values = typename uniquify::uniquified_values;
-        using uniquified_ids    = typename uniquify::uniquified_ids;
-    };
+        const index_t y = x2y[x];
+        if(y < 0 || y >= x2y.size || is_mapped[y])
+        {
+            return false;
+        }
+        is_mapped(y) = 1;
+    }
 
-    using sort          = sequence_sort<Values, Less>;
-    using sorted_values = typename sort::type;
-    using sorted_ids    = typename sort::sorted2unsorted_map;
+    return true;
+}
 
-    using uniquify = sorted_sequence_uniquify<sorted_values, sorted_ids, Equal>;
+template <typename SeqMap>
+struct sequence_map_inverse_impl
+{
+    CK_TILE_HOST_DEVICE static constexpr auto compute()
+    {
+        const auto x2y = make_sequence_buffer(SeqMap{});
 
-    // this is output
-    using type                = typename uniquify::uniquified_values;
-    using sorted2unsorted_map = typename uniquify::uniquified_ids;
+        auto y2x = x2y;
+        for(index_t x = 0; x < x2y.size; ++x)
+        {
+            y2x(x2y[x]) = x;
+        }
+
+        return y2x;
+    }
 };
+} // namespace impl
 
 template <typename SeqMap>
 struct is_valid_sequence_map
-    : std::is_same<typename arithmetic_sequence_gen<0, SeqMap::size(), 1>::type,
-                   typename sequence_sort<SeqMap, less<index_t>>::type>
+    : bool_constant<impl::is_valid_sequence_map_impl<SeqMap>()>
 {
 };
 
 template <typename SeqMap>
 struct sequence_map_inverse
 {
-    template <typename X2Y, typename WorkingY2X, index_t XBegin, index_t XRemain>
-    struct sequence_map_inverse_impl
-    {
-        static constexpr auto new_y2x =
-            WorkingY2X::modify(X2Y::get(number<XBegin>{}), number<XBegin>{});
-
-        using type =
-            typename sequence_map_inverse_impl<X2Y, decltype(new_y2x), XBegin + 1, XRemain - 1>::
-                type;
-    };
-
-    template <typename X2Y, typename WorkingY2X, index_t XBegin>
-    struct sequence_map_inverse_impl<X2Y, WorkingY2X, XBegin, 0>
-    {
-        using type = WorkingY2X;
-    };
-
     using type =
-        typename sequence_map_inverse_impl<SeqMap,
-                                           typename uniform_sequence_gen<SeqMap::size(), 0>::type,
-                                           0,
-                                           SeqMap::size()>::type;
+        typename impl::sequence_from_buffer<impl::sequence_map_inverse_impl<SeqMap>>::type;
 };
 
 template <index_t... Xs, index_t... Ys>
@@ -865,27 +845,39 @@ CK_TILE_HOST_DEVICE constexpr auto inclusive_scan_sequence(Seq, Reduce, number<I
 
 // e.g. Seq<2, 3, 4> --> Seq<0, 2, 5>, Init=0, Reduce=Add
 //      ResultSeq  TargetSeq  Reduce
-template <typename, typename, typename>
-struct sequence_exclusive_scan;
-
-template <index_t... Xs, index_t Y, index_t... Ys, typename Reduce>
-struct sequence_exclusive_scan<sequence<Xs...>, sequence<Y, Ys...>, Reduce>
+namespace impl {
+template <typename ResultSeq, typename TargetSeq, typename Reduce>
+struct sequence_exclusive_scan_impl
 {
-    using old_scan = typename sequence_merge<sequence<Xs...>,
-                                             sequence<Reduce{}(Y, sequence<Xs...>{}.back())>>::type;
-    using type     = typename sequence_exclusive_scan<old_scan, sequence<Ys...>, Reduce>::type;
-};
+    CK_TILE_HOST_DEVICE static constexpr auto compute()
+    {
+        constexpr index_t nresult = ResultSeq::size();
+        constexpr index_t ntarget = TargetSeq::size();
 
-template <index_t... Xs, index_t Y, typename Reduce>
-struct sequence_exclusive_scan<sequence<Xs...>, sequence<Y>, Reduce>
-{
-    using type = sequence<Xs...>;
+        const auto result_init = make_sequence_buffer(ResultSeq{});
+        const auto target      = make_sequence_buffer(TargetSeq{});
+
+        // the last element of TargetSeq is not used
+        sequence_buffer<nresult + (ntarget > 0 ? ntarget - 1 : 0)> result{};
+        for(index_t i = 0; i < nresult; ++i)
+        {
+            result(i) = result_init[i];
+        }
+        for(index_t i = nresult; i < result.size; ++i)
+        {
+            result(i) = Reduce{}(target[i - nresult], result[i - 1]);
+        }
+
+        return result;
+    }
 };
+} // namespace impl
 
-template <index_t... Xs, typename Reduce>
-struct sequence_exclusive_scan<sequence<Xs...>, sequence<>, Reduce>
+template <typename ResultSeq, typename TargetSeq, typename Reduce>
+struct sequence_exclusive_scan
 {
-    using type = sequence<Xs...>;
+    using type = typename impl::sequence_from_buffer<
+        impl::sequence_exclusive_scan_impl<ResultSeq, TargetSeq, Reduce>>::type;
 };
 
 template <typename Seq, typename Reduce, index_t Init>
@@ -910,61 +902,68 @@ CK_TILE_HOST_DEVICE constexpr auto pick_sequence_elements_by_ids(Seq, sequence<I
 }
 
 #if 1
-namespace detail {
-template <typename WorkSeq, typename RemainSeq, typename RemainMask>
+namespace impl {
+template <typename Mask>
 struct pick_sequence_elements_by_mask_impl
 {
-    using new_work_seq = typename std::conditional<RemainMask::front(),
-                                                   decltype(WorkSeq::push_back(RemainSeq::front())),
-                                                   WorkSeq>::type;
+    CK_TILE_HOST_DEVICE static constexpr auto compute()
+    {
+        const auto mask = make_sequence_buffer(Mask{});
 
-    using type =
-        typename pick_sequence_elements_by_mask_impl<new_work_seq,
-                                                     decltype(RemainSeq::pop_front()),
-                                                     decltype(RemainMask::pop_front())>::type;
-};
+        auto ids = mask;
+        ids.size = 0;
+        for(index_t i = 0; i < mask.size; ++i)
+        {
+            if(mask[i])
+            {
+                ids(ids.size++) = i;
+            }
+        }
 
-template <typename WorkSeq>
-struct pick_sequence_elements_by_mask_impl<WorkSeq, sequence<>, sequence<>>
-{
-    using type = WorkSeq;
+        return ids;
+    }
 };
-
-} // namespace detail
+} // namespace impl
 
 template <typename Seq, typename Mask>
 CK_TILE_HOST_DEVICE constexpr auto pick_sequence_elements_by_mask(Seq, Mask)
 {
     static_assert(Seq::size() == Mask::size(), "wrong!");
 
-    return typename detail::pick_sequence_elements_by_mask_impl<sequence<>, Seq, Mask>::type{};
+    using ids =
+        typename impl::sequence_from_buffer<impl::pick_sequence_elements_by_mask_impl<Mask>>::
+            type;
+
+    return Seq::extract(ids{});
 }
 
-namespace detail {
-template <typename WorkSeq, typename RemainValues, typename RemainIds>
+namespace impl {
+template <typename Seq, typename Values, typename Ids>
 struct modify_sequence_elements_by_ids_impl
 {
-    using new_work_seq = decltype(WorkSeq::modify(RemainIds::front(), RemainValues::front()));
+    CK_TILE_HOST_DEVICE static constexpr auto compute()
+    {
+        const auto values = make_sequence_buffer(Values{});
+        const auto ids    = make_sequence_buffer(Ids{});
 
-    using type =
-        typename modify_sequence_elements_by_ids_impl<new_work_seq,
-                                                      decltype(RemainValues::pop_front()),
-                                                      decltype(RemainIds::pop_front())>::type;
-};
+        auto result = make_sequence_buffer(Seq{});
+        for(index_t i = 0; i < ids.size; ++i)
+        {
+            result(ids[i]) = values[i];
+        }
 
-template <typename WorkSeq>
-struct modify_sequence_elements_by_ids_impl<WorkSeq, sequence<>, sequence<>>
-{
-    using type = WorkSeq;
+        return result;
+    }
 };
-} // namespace detail
+} // namespace impl
 
 template <typename Seq, typename Values, typename Ids>
 CK_TILE_HOST_DEVICE constexpr auto modify_sequence_elements_by_ids(Seq, Values, Ids)
 {
     static_assert(Values::size() == Ids::size() && Seq::size() >= Values::size(), "wrong!");
 
-    return typename detail::modify_sequence_elements_by_ids_impl<Seq, Values, Ids>::type{};
+    return typename impl::sequence_from_buffer<
+        impl::modify_sequence_elements_by_ids_impl<Seq, Values, Ids>>::type{};
 }
 #endif
 
@@ -1,11 +1,13 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
 #include "ck_tile/core.hpp"
 #include "ck_tile/host/host_tensor.hpp"
+#include "ck_tile/host/reference/reference_batched_masking.hpp"
 #include <thread>
+#include <vector>
 
 namespace ck_tile {
 
@@ -47,4 +49,95 @@ CK_TILE_HOST void reference_batched_gemm(const HostTensor<ADataType>& a_b_m_k,
     make_ParallelTensorFunctor(f, c_b_m_n.mDesc.get_lengths()[0], c_b_m_n.mDesc.get_lengths()[1])(
         std::thread::hardware_concurrency());
 }
+
+// c = a * b^T on the positions of c in its row ranges (e.g. S = Q * K^T on the unmasked positions
+// of an attention mask), the others are set to -inf without being computed
+template <typename ADataType,
+          typename BDataType,
+          typename AccDataType,
+          typename CDataType,
+          typename AElementOp   = ck_tile::identity,
+          typename BElementOp   = ck_tile::identity,
+          typename ACCElementOp = ck_tile::identity>
+CK_TILE_HOST void reference_batched_masked_gemm(const HostTensor<ADataType>& a_b_m_k,
+                                                const HostTensor<BDataType>& b_b_n_k,
+                                                HostTensor<CDataType>& c_b_m_n,
+                                                const std::vector<masking_row_range>& c_row_ranges,
+                                                const AElementOp& a_element_op     = {},
+                                                const BElementOp& b_element_op     = {},
+                                                const ACCElementOp& acc_element_op = {})
+{
+    const int N = b_b_n_k.mDesc.get_lengths()[1];
+    const int K = b_b_n_k.mDesc.get_lengths()[2];
+
+    auto f = [&](auto batch, auto m) {
+        for(int n = 0; n < N; ++n)
+        {
+            if(n < c_row_ranges[m].begin || n >= c_row_ranges[m].end)
+            {
+                c_b_m_n(batch, m, n) = -ck_tile::numeric<CDataType>::infinity();
+            }
+            else
+            {
+                AccDataType v_acc = 0;
+
+                for(int k = 0; k < K; ++k)
+                {
+                    ADataType v_a = a_element_op(a_b_m_k(batch, m, k));
+                    BDataType v_b = b_element_op(b_b_n_k(batch, n, k));
+
+                    v_acc += ck_tile::type_convert<AccDataType>(v_a) *
+                             ck_tile::type_convert<AccDataType>(v_b);
+                }
+
+                c_b_m_n(batch, m, n) = ck_tile::type_convert<CDataType>(acc_element_op(v_acc));
+            }
+        }
+    };
+
+    make_ParallelTensorFunctor(f, c_b_m_n.mDesc.get_lengths()[0], c_b_m_n.mDesc.get_lengths()[1])(
+        std::thread::hardware_concurrency());
+}
+
+// c = a * b^T with a zero outside its row ranges (e.g. O = P * V with the P of an attention mask),
+// only the k of the row ranges are accumulated
+template <typename ADataType,
+          typename BDataType,
+          typename AccDataType,
+          typename CDataType,
+          typename AElementOp   = ck_tile::identity,
+          typename BElementOp   = ck_tile::identity,
+          typename ACCElementOp = ck_tile::identity>
+CK_TILE_HOST void
+reference_batched_gemm_with_masked_a(const HostTensor<ADataType>& a_b_m_k,
+                                     const HostTensor<BDataType>& b_b_n_k,
+                                     HostTensor<CDataType>& c_b_m_n,
+                                     const std::vector<masking_row_range>& a_row_ranges,
+                                     const AElementOp& a_element_op     = {},
+                                     const BElementOp& b_element_op     = {},
+                                     const ACCElementOp& acc_element_op = {})
+{
+    const int N = b_b_n_k.mDesc.get_lengths()[1];
+
+    auto f = [&](auto batch, auto m) {
+        for(int n = 0; n < N; ++n)
+        {
+            AccDataType v_acc = 0;
+
+            for(int k = a_row_ranges[m].begin; k < a_row_ranges[m].end; ++k)
+            {
+                ADataType v_a = a_element_op(a_b_m_k(batch, m, k));
+                BDataType v_b = b_element_op(b_b_n_k(batch, n, k));
+
+                v_acc += ck_tile::type_convert<AccDataType>(v_a) *
+                         ck_tile::type_convert<AccDataType>(v_b);
+            }
+
+            c_b_m_n(batch, m, n) = ck_tile::type_convert<CDataType>(acc_element_op(v_acc));
+        }
+    };
+
+    make_ParallelTensorFunctor(f, c_b_m_n.mDesc.get_lengths()[0], c_b_m_n.mDesc.get_lengths()[1])(
+        std::thread::hardware_concurrency());
+}
 } // namespace ck_tile
@@ -1,32 +1,69 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
 #include "ck_tile/core.hpp"
 #include "ck_tile/host/host_tensor.hpp"
 #include <thread>
+#include <vector>
 
 namespace ck_tile {
 
-template <typename CDataType, typename MaskingType>
-CK_TILE_HOST void reference_batched_masking(HostTensor<CDataType>& c_b_m_n, const MaskingType& mask)
+// columns [begin, end) of a row of a masked matrix which are not masked out
+struct masking_row_range
+{
+    index_t begin;
+    index_t end;
+};
+
+// the unmasked columns of every row of a [M, N] matrix masked by mask (e.g. GenericAttentionMask),
+// with which the masked references skip the masked-out positions instead of computing them
+template <typename MaskingType>
+CK_TILE_HOST std::vector<masking_row_range>
+make_masking_row_ranges(const MaskingType& mask, index_t M, index_t N)
+{
+    std::vector<masking_row_range> row_ranges(M);
+
+    for(index_t m = 0; m < M; ++m)
+    {
+        // tiles of 1x1 are the exact range of the row
+        const auto [begin, end] = mask.GetTileRangeAlongX(m, number<1>{}, number<1>{});
+
+        row_ranges[m].begin = min(max(begin, 0), N);
+        row_ranges[m].end   = max(min(end, N), row_ranges[m].begin);
+    }
+
+    return row_ranges;
+}
+
+template <typename CDataType>
+CK_TILE_HOST void reference_batched_masking(HostTensor<CDataType>& c_b_m_n,
+                                            const std::vector<masking_row_range>& row_ranges)
 {
-    const int M = c_b_m_n.mDesc.get_lengths()[1];
     const int N = c_b_m_n.mDesc.get_lengths()[2];
 
-    auto f = [&](auto batch) {
-        for(int n = 0; n < N; ++n)
+    auto f = [&](auto batch, auto m) {
+        for(int n = 0; n < row_ranges[m].begin; ++n)
         {
-            for(int m = 0; m < M; ++m)
-            {
-                if(mask.IsOutOfBound(m, n))
-                    c_b_m_n(batch, m, n) = -ck_tile::numeric<CDataType>::infinity();
-            }
+            c_b_m_n(batch, m, n) = -ck_tile::numeric<CDataType>::infinity();
+        }
+        for(int n = row_ranges[m].end; n < N; ++n)
+        {
+            c_b_m_n(batch, m, n) = -ck_tile::numeric<CDataType>::infinity();
         }
     };
 
-    make_ParallelTensorFunctor(f,
-                               c_b_m_n.mDesc.get_lengths()[0])(std::thread::hardware_concurrency());
+    make_ParallelTensorFunctor(f, c_b_m_n.mDesc.get_lengths()[0], c_b_m_n.mDesc.get_lengths()[1])(
+        std::thread::hardware_concurrency());
+}
+
+template <typename CDataType, typename MaskingType>
+CK_TILE_HOST void reference_batched_masking(HostTensor<CDataType>& c_b_m_n, const MaskingType& mask)
+{
+    const int M = c_b_m_n.mDesc.get_lengths()[1];
+    const int N = c_b_m_n.mDesc.get_lengths()[2];
+
+    reference_batched_masking(c_b_m_n, make_masking_row_ranges(mask, M, N));
 }
 } // namespace ck_tile
@@ -1,13 +1,23 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
 #include "ck_tile/core.hpp"
 #include "ck_tile/host/host_tensor.hpp"
+#include <thread>
+#include <vector>
 
 namespace ck_tile {
 
+// y = (x - mean) * inv_std * gamma + beta over the rows of x, with the mean and variance of each
+// row computed in a single Welford pass.
+//
+// Every row is converted to ComputeDataType once and read by both passes, gamma and beta once for
+// all the rows. The Welford pass runs NumLane interleaved (independent, so the loop vectorizes)
+// Welford states sharing the count, merged with Chan's formula at the end of the row, like the
+// lanes of ck_tile/ops/welford. The rows, which all have the same length, are processed on all CPU
+// threads.
 template <typename XDataType,
           typename GammaDataType,
           typename BetaDataType,
@@ -15,35 +25,89 @@ template <typename XDataType,
           typename YDataType,
           typename MeanDataType,
           typename InvStdDataType>
-void reference_layernorm2d_fwd(const HostTensor<XDataType>& x_m_n,
-                               const HostTensor<GammaDataType>& gamma_n,
-                               const HostTensor<BetaDataType>& beta_n,
-                               HostTensor<YDataType>& y_m_n,
-                               HostTensor<MeanDataType>& mean_m,
-                               HostTensor<InvStdDataType>& invStd_m,
-                               ComputeDataType epsilon)
+CK_TILE_HOST void reference_layernorm2d_fwd(const HostTensor<XDataType>& x_m_n,
+                                            const HostTensor<GammaDataType>& gamma_n,
+                                            const HostTensor<BetaDataType>& beta_n,
+                                            HostTensor<YDataType>& y_m_n,
+                                            HostTensor<MeanDataType>& mean_m,
+                                            HostTensor<InvStdDataType>& invStd_m,
+                                            ComputeDataType epsilon)
 {
-    auto layernorm2d_fwd_func = [&](auto m) {
-        const int N = x_m_n.mDesc.get_lengths()[1];
+    constexpr int NumLane = 8;
+
+    const int M = x_m_n.mDesc.get_lengths()[0];
+    const int N = x_m_n.mDesc.get_lengths()[1];
 
-        int count                = 0;
-        ComputeDataType mean     = 0;
-        ComputeDataType variance = 0;
-        ComputeDataType divisor  = 0;
+    std::vector<ComputeDataType> gamma(N);
+    std::vector<ComputeDataType> beta(N);
+    for(int n = 0; n < N; ++n)
+    {
+        gamma[n] = ck_tile::type_convert<ComputeDataType>(gamma_n(n));
+        beta[n]  = ck_tile::type_convert<ComputeDataType>(beta_n(n));
+    }
 
+    auto layernorm2d_fwd_func = [&](auto m) {
+        std::vector<ComputeDataType> x(N);
         for(int n = 0; n < N; ++n)
         {
-            ++count;
-            ComputeDataType x     = ck_tile::type_convert<ComputeDataType>(x_m_n(m, n));
-            ComputeDataType delta = x - mean;
-            mean += delta / count;
-            ComputeDataType delta2 = x - mean;
-            variance += delta * delta2;
+            x[n] = ck_tile::type_convert<ComputeDataType>(x_m_n(m, n));
+        }
+
+        // mean and M2 (sum of squared differences to the mean) of the elements seen so far
+        int count            = 0;
+        ComputeDataType mean = 0;
+        ComputeDataType m2   = 0;
+
+        auto merge = [&](ComputeDataType other_mean, ComputeDataType other_m2, int other_count) {
+            const int new_count = count + other_count;
+            if(new_count == 0)
+            {
+                return;
+            }
+
+            const ComputeDataType nb_over_n = ck_tile::type_convert<ComputeDataType>(other_count) /
+                                              ck_tile::type_convert<ComputeDataType>(new_count);
+            const ComputeDataType delta = other_mean - mean;
+
+            mean += delta * nb_over_n;
+            m2 += other_m2 + delta * delta * ck_tile::type_convert<ComputeDataType>(count) *
+                                 nb_over_n;
+            count = new_count;
+        };
+
+        const int num_step = N / NumLane;
+
+        ComputeDataType lane_mean[NumLane] = {};
+        ComputeDataType lane_m2[NumLane]   = {};
+
+        for(int step = 0; step < num_step; ++step)
+        {
+            const ComputeDataType step_count = ck_tile::type_convert<ComputeDataType>(step + 1);
+
+            for(int lane = 0; lane < NumLane; ++lane)
+            {
+                const ComputeDataType v     = x[step * NumLane + lane];
+                const ComputeDataType delta = v - lane_mean[lane];
+                lane_mean[lane] += delta / step_count;
+                lane_m2[lane] += delta * (v - lane_mean[lane]);
+            }
+        }
+
+        for(int lane = 0; lane < NumLane; ++lane)
+        {
+            merge(lane_mean[lane], lane_m2[lane], num_step);
+        }
+
+        // tail
+        for(int n = num_step * NumLane; n < N; ++n)
+        {
+            merge(x[n], 0, 1);
         }
 
         // actual variance
-        variance = variance / count;
-        divisor  = ck_tile::type_convert<ComputeDataType>(1) / ck_tile::sqrt(variance + epsilon);
+        const ComputeDataType variance = m2 / ck_tile::type_convert<ComputeDataType>(N);
+        const ComputeDataType divisor =
+            ck_tile::type_convert<ComputeDataType>(1) / ck_tile::sqrt(variance + epsilon);
 
         if constexpr(!std::is_same_v<MeanDataType, ck_tile::null_type>)
             mean_m(m) = ck_tile::type_convert<MeanDataType>(mean);
@@ -53,17 +117,13 @@ void reference_layernorm2d_fwd(const HostTensor<XDataType>& x_m_n,
 
         for(int n = 0; n < N; ++n)
         {
-            ComputeDataType x     = ck_tile::type_convert<ComputeDataType>(x_m_n(m, n));
-            ComputeDataType gamma = ck_tile::type_convert<ComputeDataType>(gamma_n(n));
-            ComputeDataType beta  = ck_tile::type_convert<ComputeDataType>(beta_n(n));
-            auto y                = (x - mean) * divisor;
-            y                     = y * gamma + beta;
+            auto y = (x[n] - mean) * divisor;
+            y      = y * gamma[n] + beta[n];
 
             y_m_n(m, n) = ck_tile::type_convert<YDataType>(y);
         }
     };
 
-    make_ParallelTensorFunctor(layernorm2d_fwd_func,
-                               mean_m.mDesc.get_lengths()[0])(std::thread::hardware_concurrency());
+    make_ParallelTensorFunctor(layernorm2d_fwd_func, M)(std::thread::hardware_concurrency());
 }
 } // namespace ck_tile
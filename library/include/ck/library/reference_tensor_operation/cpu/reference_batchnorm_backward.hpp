@@ -10,7 +10,7 @@
 
 #include "ck/utility/math_v2.hpp"
 #include "ck/utility/ignore.hpp"
-#include "ck/library/utility/host_common_util.hpp"
+#include "ck/library/utility/host_normalization.hpp"
 #include "ck/tensor_operation/gpu/device/device_batchnorm_backward.hpp"
 
 namespace ck {
@@ -63,7 +63,11 @@ struct ReferenceBatchNormBwd : public device::DeviceBatchNormBwd<XDataType,
                  DxDataType* p_dx,
                  DscaleDbiasDataType* p_dscale,
                  DscaleDbiasDataType* p_dbias)
-            : reduceDims_(reduceDims),
+            : xyLengths_(xyLengths),
+              xStrides_(xStrides),
+              dxStrides_(dxStrides),
+              dyStrides_(dyStrides),
+              reduceDims_(reduceDims),
               bnScaleBiasMeanVarLengths_(bnScaleBiasMeanVarLengths),
               bnScaleStrides_(bnScaleStrides),
               bnDscaleDbiasStrides_(bnDscaleDbiasStrides),
@@ -78,79 +82,33 @@ struct ReferenceBatchNormBwd : public device::DeviceBatchNormBwd<XDataType,
               p_dscale_(p_dscale),
               p_dbias_(p_dbias)
         {
-            using ck::host_common::get_index_set;
-
             if(std::any_of(
                    reduceDims.begin(), reduceDims.end(), [](int d) { return d < 0 || d >= Rank; }))
                 throw std::runtime_error("Invalid reduce dimensions!");
 
-            // get invariant_dims[] and invariant_lengths[]
-            for(int dim = 0, i = 0; dim < Rank; dim++)
-                if(std::none_of(
-                       reduceDims.begin(), reduceDims.end(), [&](int d) { return d == dim; }))
-                {
-                    invariantDims_[i]     = dim;
-                    invariant_lengths_[i] = xyLengths[dim];
-                    i++;
-                };
-
-            // get reduce_lengths_[]
-            for(int j = 0, i = 0; j < NumBatchNormReduceDim; j++)
-            {
-                int dim              = reduceDims[j];
-                reduce_lengths_[i++] = xyLengths[dim];
-            };
+            invariantDims_ = ck::host_normalization::get_invariant_dims(Rank, reduceDims);
 
             for(int i = 0; i < NumInvariantDim; i++)
-                if(invariant_lengths_[i] != bnScaleBiasMeanVarLengths_[i])
+                if(xyLengths[invariantDims_[i]] != bnScaleBiasMeanVarLengths_[i])
                     throw std::runtime_error("Invalid lengths parameters!");
 
-            for(int j = 0, i = 0; j < NumInvariantDim; j++)
-            {
-                int dim                  = invariantDims_[j];
-                x_invariant_strides_[i]  = xStrides[dim];
-                dy_invariant_strides_[i] = dyStrides[dim];
-                dx_invariant_strides_[i] = dxStrides[dim];
-                i++;
-            };
-
-            for(int j = 0, i = 0; j < NumBatchNormReduceDim; j++)
-            {
-                int dim               = reduceDims_[j];
-                x_reduce_strides_[i]  = xStrides[dim];
-                dy_reduce_strides_[i] = dyStrides[dim];
-                dx_reduce_strides_[i] = dxStrides[dim];
-                i++;
-            };
-
-            reduceSize_ = std::accumulate(
-                reduce_lengths_.begin(), reduce_lengths_.end(), 1, std::multiplies<size_t>{});
-
-            invariant_index_set_ = get_index_set<NumInvariantDim>(invariant_lengths_);
-            reduce_index_set_    = get_index_set<NumBatchNormReduceDim>(reduce_lengths_);
-
             epsilon_ = type_convert<AccDataType>(epsilon);
 
             haveSavedMeanInvVar_ = (p_savedMean != nullptr && p_savedInvVar != nullptr);
         }
 
-        std::array<int, NumBatchNormReduceDim> reduceDims_;
-        std::array<int, NumInvariantDim> invariantDims_;
-        std::array<index_t, NumInvariantDim> invariant_lengths_;
-        std::array<index_t, NumBatchNormReduceDim> reduce_lengths_;
+        const std::array<index_t, Rank> xyLengths_;
+        const std::array<index_t, Rank> xStrides_;
+        const std::array<index_t, Rank> dxStrides_;
+        const std::array<index_t, Rank> dyStrides_;
+        const std::array<int, NumBatchNormReduceDim> reduceDims_;
+        std::vector<int> invariantDims_;
 
         const std::array<index_t, NumInvariantDim> bnScaleBiasMeanVarLengths_;
         const std::array<index_t, NumInvariantDim> bnScaleStrides_;
         const std::array<index_t, NumInvariantDim> bnDscaleDbiasStrides_;
         const std::array<index_t, NumInvariantDim> bnMeanVarStrides_;
 
-        std::array<index_t, NumInvariantDim> x_invariant_strides_;
-        std::array<index_t, NumInvariantDim> dy_invariant_strides_;
-        std::array<index_t, NumInvariantDim> dx_invariant_strides_;
-        std::array<index_t, NumBatchNormReduceDim> x_reduce_strides_;
-        std::array<index_t, NumBatchNormReduceDim> dy_reduce_strides_;
-        std::array<index_t, NumBatchNormReduceDim> dx_reduce_strides_;
-
         const XDataType* p_x_;
         const DyDataType* p_dy_;
         const ScaleDataType* p_scale_;
@@ -164,172 +122,128 @@ struct ReferenceBatchNormBwd : public device::DeviceBatchNormBwd<XDataType,
 
         bool haveSavedMeanInvVar_;
 
-        std::vector<std::array<index_t, NumInvariantDim>> invariant_index_set_;
-        std::vector<std::array<index_t, NumBatchNormReduceDim>> reduce_index_set_;
-
         AccDataType epsilon_;
-        size_t reduceSize_;
     };
 
     struct Invoker : public device::BaseInvoker
     {
         float Run(const Argument& arg)
         {
-            using ck::host_common::get_offset_from_index;
-
-            auto thread_reduce_func = [&](auto invariant_index) {
-                size_t x_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.x_invariant_strides_, invariant_index);
-                size_t dy_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.dy_invariant_strides_, invariant_index);
-                size_t dx_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.dx_invariant_strides_, invariant_index);
-
-                AccDataType mean     = type_convert<AccDataType>(0.0f);
-                AccDataType variance = type_convert<AccDataType>(0.0f);
-                AccDataType invVar;
-                int32_t curr_count = 0;
-
-                if(arg.haveSavedMeanInvVar_)
+            using ck::host_normalization::expand_strides;
+
+            // x, dy, dx, scale, dscale/dbias, mean/inv-variance
+            const auto space = ck::host_normalization::make_normalization_space<6>(
+                arg.xyLengths_,
+                arg.reduceDims_,
+                {std::vector<std::size_t>(arg.xStrides_.begin(), arg.xStrides_.end()),
+                 std::vector<std::size_t>(arg.dyStrides_.begin(), arg.dyStrides_.end()),
+                 std::vector<std::size_t>(arg.dxStrides_.begin(), arg.dxStrides_.end()),
+                 expand_strides(Rank, arg.invariantDims_, arg.bnScaleStrides_),
+                 expand_strides(Rank, arg.invariantDims_, arg.bnDscaleDbiasStrides_),
+                 expand_strides(Rank, arg.invariantDims_, arg.bnMeanVarStrides_)});
+
+            const std::size_t num_row    = space.rows.GetSize();
+            const std::size_t reduceSize = space.reduce.GetSize();
+
+            std::vector<AccDataType> mean(num_row);
+            std::vector<AccDataType> invVar(num_row);
+
+            if(arg.haveSavedMeanInvVar_)
+            {
+                for(std::size_t row = 0; row < num_row; ++row)
                 {
-                    size_t mean_invVar_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                        arg.bnMeanVarStrides_, invariant_index);
+                    const size_t offset = space.rows.GetOffsets(row)[5];
 
-                    mean =
-                        type_convert<AccDataType>(arg.p_savedMean_[mean_invVar_invariant_offset]);
-                    invVar =
-                        type_convert<AccDataType>(arg.p_savedInvVar_[mean_invVar_invariant_offset]);
+                    mean[row]   = type_convert<AccDataType>(arg.p_savedMean_[offset]);
+                    invVar[row] = type_convert<AccDataType>(arg.p_savedInvVar_[offset]);
                 }
-                else
-                {
-                    // compute mean, variance using welford method
-                    for(const auto& reduce_index : arg.reduce_index_set_)
-                    {
-                        size_t x_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                            arg.x_reduce_strides_, reduce_index);
-
-                        auto x_offset = x_invariant_offset + x_reduce_offset;
-
-                        curr_count++;
-
-                        AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
-
-                        AccDataType delta = x - mean;
-
-                        mean += delta / curr_count;
-
-                        AccDataType delta2 = x - mean;
-
-                        variance += delta * delta2;
-                    };
-
-                    // actual variance
-                    variance = variance / curr_count;
+            }
+            else
+            {
+                // compute mean, variance using welford method
+                const auto welford =
+                    ck::host_normalization::welford_rows<AccDataType>(space, arg.p_x_);
 
-                    // inv-variance defined as 1/sqrt(epsilon+variance)
-                    invVar =
-                        type_convert<AccDataType>(1.0f) / ck::math::sqrt(arg.epsilon_ + variance);
-                };
-
-                AccDataType dbias =
-                    type_convert<AccDataType>(0.0f); // Sum on reduced dimensions of dy
-                AccDataType dscale =
-                    type_convert<AccDataType>(0.0f); // Sum on reduced dimensions of dy * norm_x
-
-                // 1) calculate dy * (x - mean) * inv-variance
-                // 2) calculate sum(dy) on reduced dimensions
-                // 3) calculate sum(dy * norm_x) on reduced dimensions
-                for(const auto& reduce_index : arg.reduce_index_set_)
+                for(std::size_t row = 0; row < num_row; ++row)
                 {
-                    size_t x_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.x_reduce_strides_, reduce_index);
-                    size_t dy_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.dy_reduce_strides_, reduce_index);
-
-                    auto x_offset  = x_invariant_offset + x_reduce_offset;
-                    auto dy_offset = dy_invariant_offset + dy_reduce_offset;
-
-                    AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
-
-                    AccDataType norm_x = (x - mean) * invVar;
-                    AccDataType dy     = type_convert<AccDataType>(arg.p_dy_[dy_offset]);
-
-                    arg.dy_elementwise_op_(dy, dy);
+                    mean[row] = welford[row].mean;
 
-                    dbias += dy;
-                    dscale += norm_x * dy;
-                };
-
-                size_t dscale_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.bnDscaleDbiasStrides_, invariant_index);
-                size_t dbias_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.bnDscaleDbiasStrides_, invariant_index);
-
-                arg.p_dscale_[dscale_offset] = type_convert<DscaleDbiasDataType>(dscale);
-                arg.p_dbias_[dbias_offset]   = type_convert<DscaleDbiasDataType>(dbias);
-
-                size_t scale_offset =
-                    get_offset_from_index<NumInvariantDim>(arg.bnScaleStrides_, invariant_index);
-
-                AccDataType scale = type_convert<AccDataType>(arg.p_scale_[scale_offset]);
-
-                AccDataType multiplier = type_convert<AccDataType>(1.0f) /
-                                         type_convert<AccDataType>(arg.reduceSize_) * invVar *
-                                         scale;
-
-                // 1) calculate tmp = dscale * (x - mean) * inv-variance
-                // 2) calculate dx = 1/reduceSize * inv-variance * scale * (reduceSize * dy - dbias
-                // - tmp)
-                for(const auto& reduce_index : arg.reduce_index_set_)
-                {
-                    size_t x_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.x_reduce_strides_, reduce_index);
-                    size_t dy_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.dy_reduce_strides_, reduce_index);
-                    size_t dx_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.dx_reduce_strides_, reduce_index);
+                    // inv-variance defined as 1/sqrt(epsilon+variance)
+                    invVar[row] = type_convert<AccDataType>(1.0f) /
+                                  ck::math::sqrt(arg.epsilon_ + welford[row].GetVariance());
+                }
+            };
 
-                    auto x_offset  = x_invariant_offset + x_reduce_offset;
-                    auto dy_offset = dy_invariant_offset + dy_reduce_offset;
-                    auto dx_offset = dx_invariant_offset + dx_reduce_offset;
+            // 1) calculate dy * (x - mean) * inv-variance
+            // 2) calculate sum(dy) on reduced dimensions
+            // 3) calculate sum(dy * norm_x) on reduced dimensions
+            using SumState = ck::host_normalization::SumState<AccDataType, 2>;
+
+            const auto sums = ck::host_normalization::reduce_rows<SumState>(
+                space,
+                [&](std::size_t row,
+                    SumState& state,
+                    const auto& offsets,
+                    const auto& strides,
+                    std::size_t length) {
+                    for(std::size_t i = 0; i < length; ++i)
+                    {
+                        AccDataType x =
+                            type_convert<AccDataType>(arg.p_x_[offsets[0] + i * strides[0]]);
 
-                    AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
+                        AccDataType norm_x = (x - mean[row]) * invVar[row];
+                        AccDataType dy =
+                            type_convert<AccDataType>(arg.p_dy_[offsets[1] + i * strides[1]]);
 
-                    AccDataType norm_x = (x - mean) * invVar;
-                    AccDataType dy     = type_convert<AccDataType>(arg.p_dy_[dy_offset]);
+                        arg.dy_elementwise_op_(dy, dy);
 
-                    arg.dy_elementwise_op_(dy, dy);
+                        state.sums[0] += dy;
+                        state.sums[1] += norm_x * dy;
+                    };
+                });
 
-                    AccDataType tmpVal = norm_x * dscale;
+            for(std::size_t row = 0; row < num_row; ++row)
+            {
+                const size_t offset = space.rows.GetOffsets(row)[4];
 
-                    AccDataType dx = multiplier * (type_convert<AccDataType>(arg.reduceSize_) * dy -
-                                                   dbias - tmpVal);
+                arg.p_dbias_[offset]  = type_convert<DscaleDbiasDataType>(sums[row].sums[0]);
+                arg.p_dscale_[offset] = type_convert<DscaleDbiasDataType>(sums[row].sums[1]);
+            }
 
-                    arg.p_dx_[dx_offset] = type_convert<DxDataType>(dx);
-                };
-            };
+            // 1) calculate tmp = dscale * (x - mean) * inv-variance
+            // 2) calculate dx = 1/reduceSize * inv-variance * scale * (reduceSize * dy - dbias -
+            // tmp)
+            ck::host_normalization::for_each_row_run(
+                space,
+                [&](std::size_t row, const auto& offsets, const auto& strides, std::size_t length) {
+                    AccDataType dbias  = sums[row].sums[0];
+                    AccDataType dscale = sums[row].sums[1];
+                    AccDataType scale  = type_convert<AccDataType>(arg.p_scale_[offsets[3]]);
+
+                    AccDataType multiplier = type_convert<AccDataType>(1.0f) /
+                                             type_convert<AccDataType>(reduceSize) * invVar[row] *
+                                             scale;
+
+                    for(std::size_t i = 0; i < length; ++i)
+                    {
+                        AccDataType x =
+                            type_convert<AccDataType>(arg.p_x_[offsets[0] + i * strides[0]]);
 
-            std::size_t num_thread = std::thread::hardware_concurrency();
-            std::size_t work_per_thread =
-                (arg.invariant_index_set_.size() + num_thread - 1) / num_thread;
+                        AccDataType norm_x = (x - mean[row]) * invVar[row];
+                        AccDataType dy =
+                            type_convert<AccDataType>(arg.p_dy_[offsets[1] + i * strides[1]]);
 
-            std::vector<joinable_thread> threads(num_thread);
+                        arg.dy_elementwise_op_(dy, dy);
 
-            for(std::size_t it = 0; it < num_thread; ++it)
-            {
-                std::size_t i_begin = it * work_per_thread;
-                std::size_t i_end   = std::min(static_cast<size_t>((it + 1) * work_per_thread),
-                                             arg.invariant_index_set_.size());
+                        AccDataType tmpVal = norm_x * dscale;
 
-                auto f = [=] {
-                    for(std::size_t i = i_begin; i < i_end; ++i)
-                    {
-                        thread_reduce_func(arg.invariant_index_set_[i]);
-                    }
-                };
+                        AccDataType dx =
+                            multiplier *
+                            (type_convert<AccDataType>(reduceSize) * dy - dbias - tmpVal);
 
-                threads[it] = joinable_thread(f);
-            }
+                        arg.p_dx_[offsets[2] + i * strides[2]] = type_convert<DxDataType>(dx);
+                    };
+                });
 
             return (0.0f);
         };
@@ -8,7 +8,7 @@
 #include <array>
 #include <algorithm>
 
-#include "ck/library/utility/host_common_util.hpp"
+#include "ck/library/utility/host_normalization.hpp"
 #include "ck/tensor_operation/gpu/device/device_batchnorm_infer.hpp"
 
 namespace ck {
@@ -56,7 +56,10 @@ struct ReferenceBatchNormInfer : public device::DeviceBatchNormInfer<XDataType,
                  const MeanVarDataType* estimatedMean,
                  const MeanVarDataType* estimatedVariance,
                  YDataType* p_y)
-            : reduceDims_(reduceDims),
+            : xyLengths_(xyLengths),
+              xStrides_(xStrides),
+              yStrides_(yStrides),
+              reduceDims_(reduceDims),
               bnScaleBiasMeanVarLengths_(bnScaleBiasMeanVarLengths),
               bnScaleStrides_(bnScaleStrides),
               bnBiasStrides_(bnBiasStrides),
@@ -69,71 +72,31 @@ struct ReferenceBatchNormInfer : public device::DeviceBatchNormInfer<XDataType,
               estimatedVariance_(estimatedVariance),
               p_y_(p_y)
         {
-            using ck::host_common::get_index_set;
-
             if(std::any_of(
                    reduceDims.begin(), reduceDims.end(), [](int d) { return d < 0 || d >= Rank; }))
                 throw std::runtime_error("Invalid reduce dimensions!");
 
-            // get invariant_dims[] and invariant_lengths[]
-            for(int dim = 0, i = 0; dim < Rank; dim++)
-                if(std::none_of(
-                       reduceDims.begin(), reduceDims.end(), [&](int d) { return d == dim; }))
-                {
-                    invariantDims_[i]     = dim;
-                    invariant_lengths_[i] = xyLengths[dim];
-                    i++;
-                };
-
-            // get reduce_lengths_[]
-            for(int j = 0, i = 0; j < NumBatchNormReduceDim; j++)
-            {
-                int dim              = reduceDims[j];
-                reduce_lengths_[i++] = xyLengths[dim];
-            };
+            invariantDims_ = ck::host_normalization::get_invariant_dims(Rank, reduceDims);
 
-            // check invariant_lengths_ and bnScaleBiasMeanVarLengths
+            // check invariant lengths and bnScaleBiasMeanVarLengths
             for(int i = 0; i < NumInvariantDim; i++)
-                if(invariant_lengths_[i] != bnScaleBiasMeanVarLengths_[i])
+                if(xyLengths[invariantDims_[i]] != bnScaleBiasMeanVarLengths_[i])
                     throw std::runtime_error("Invalid lengths parameters!");
 
-            for(int j = 0, i = 0; j < NumInvariantDim; j++)
-            {
-                int dim                 = invariantDims_[j];
-                x_invariant_strides_[i] = xStrides[dim];
-                y_invariant_strides_[i] = yStrides[dim];
-                i++;
-            };
-
-            for(int j = 0, i = 0; j < NumBatchNormReduceDim; j++)
-            {
-                int dim              = reduceDims_[j];
-                x_reduce_strides_[i] = xStrides[dim];
-                y_reduce_strides_[i] = yStrides[dim];
-                i++;
-            };
-
-            invariant_index_set_ = get_index_set<NumInvariantDim>(invariant_lengths_);
-            reduce_index_set_    = get_index_set<NumBatchNormReduceDim>(reduce_lengths_);
-
             epsilon_ = type_convert<AccDataType>(epsilon);
         }
 
-        std::array<int, NumBatchNormReduceDim> reduceDims_;
-        std::array<int, NumInvariantDim> invariantDims_;
-        std::array<index_t, NumInvariantDim> invariant_lengths_;
-        std::array<index_t, NumBatchNormReduceDim> reduce_lengths_;
+        const std::array<index_t, Rank> xyLengths_;
+        const std::array<index_t, Rank> xStrides_;
+        const std::array<index_t, Rank> yStrides_;
+        const std::array<int, NumBatchNormReduceDim> reduceDims_;
+        std::vector<int> invariantDims_;
 
         const std::array<index_t, NumInvariantDim> bnScaleBiasMeanVarLengths_;
         const std::array<index_t, NumInvariantDim> bnScaleStrides_;
         const std::array<index_t, NumInvariantDim> bnBiasStrides_;
         const std::array<index_t, NumInvariantDim> bnMeanVarStrides_;
 
-        std::array<index_t, NumInvariantDim> x_invariant_strides_;
-        std::array<index_t, NumInvariantDim> y_invariant_strides_;
-        std::array<index_t, NumBatchNormReduceDim> x_reduce_strides_;
-        std::array<index_t, NumBatchNormReduceDim> y_reduce_strides_;
-
         const XDataType* p_x_;
         const ScaleDataType* bnScale_;
         const BiasDataType* bnBias_;
@@ -144,9 +107,6 @@ struct ReferenceBatchNormInfer : public device::DeviceBatchNormInfer<XDataType,
 
         YDataType* p_y_;
 
-        std::vector<std::array<index_t, NumInvariantDim>> invariant_index_set_;
-        std::vector<std::array<index_t, NumBatchNormReduceDim>> reduce_index_set_;
-
         AccDataType epsilon_;
     };
 
@@ -154,77 +114,46 @@ struct ReferenceBatchNormInfer : public device::DeviceBatchNormInfer<XDataType,
     {
         float Run(const Argument& arg)
         {
-            using ck::host_common::get_offset_from_index;
-
-            auto thread_reduce_func = [&](auto invariant_index) {
-                size_t x_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.x_invariant_strides_, invariant_index);
-                size_t y_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                    arg.y_invariant_strides_, invariant_index);
+            using ck::host_normalization::expand_strides;
 
-                size_t mean_variance_offset =
-                    get_offset_from_index<NumInvariantDim>(arg.bnMeanVarStrides_, invariant_index);
+            // x, y, scale, bias, mean/variance
+            const auto space = ck::host_normalization::make_normalization_space<5>(
+                arg.xyLengths_,
+                arg.reduceDims_,
+                {std::vector<std::size_t>(arg.xStrides_.begin(), arg.xStrides_.end()),
+                 std::vector<std::size_t>(arg.yStrides_.begin(), arg.yStrides_.end()),
+                 expand_strides(Rank, arg.invariantDims_, arg.bnScaleStrides_),
+                 expand_strides(Rank, arg.invariantDims_, arg.bnBiasStrides_),
+                 expand_strides(Rank, arg.invariantDims_, arg.bnMeanVarStrides_)});
 
-                AccDataType mean     = arg.estimatedMean_[mean_variance_offset];
-                AccDataType variance = arg.estimatedVariance_[mean_variance_offset];
-
-                // inv-variance defined as 1/sqrt(epsilon+variance)
-                AccDataType invVariance =
-                    type_convert<AccDataType>(1.0f) / std::sqrt(arg.epsilon_ + variance);
+            const std::size_t num_row = space.rows.GetSize();
 
-                size_t scale_offset =
-                    get_offset_from_index<NumInvariantDim>(arg.bnScaleStrides_, invariant_index);
-                size_t bias_offset =
-                    get_offset_from_index<NumInvariantDim>(arg.bnBiasStrides_, invariant_index);
+            std::vector<AccDataType> mean(num_row);
+            std::vector<AccDataType> invVariance(num_row);
 
-                AccDataType scale = type_convert<AccDataType>(arg.bnScale_[scale_offset]);
-                AccDataType bias  = type_convert<AccDataType>(arg.bnBias_[bias_offset]);
-
-                // normalization
-                for(const auto& reduce_index : arg.reduce_index_set_)
-                {
-                    size_t x_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.x_reduce_strides_, reduce_index);
-                    size_t y_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.y_reduce_strides_, reduce_index);
-
-                    auto x_offset = x_invariant_offset + x_reduce_offset;
-                    auto y_offset = y_invariant_offset + y_reduce_offset;
-
-                    AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
-
-                    AccDataType norm_x = (x - mean) * invVariance;
-
-                    AccDataType y = scale * norm_x + bias;
-
-                    arg.y_elementwise_op_(y, y);
-
-                    arg.p_y_[y_offset] = type_convert<YDataType>(y);
-                };
-            };
+            for(std::size_t row = 0; row < num_row; ++row)
+            {
+                const size_t offset = space.rows.GetOffsets(row)[4];
 
-            std::size_t num_thread = std::thread::hardware_concurrency();
-            std::size_t work_per_thread =
-                (arg.invariant_index_set_.size() + num_thread - 1) / num_thread;
+                AccDataType variance = type_convert<AccDataType>(arg.estimatedVariance_[offset]);
 
-            std::vector<joinable_thread> threads(num_thread);
+                mean[row] = type_convert<AccDataType>(arg.estimatedMean_[offset]);
 
-            for(std::size_t it = 0; it < num_thread; ++it)
-            {
-                std::size_t i_begin = it * work_per_thread;
-                std::size_t i_end   = std::min(static_cast<size_t>((it + 1) * work_per_thread),
-                                             arg.invariant_index_set_.size());
-
-                auto f = [=] {
-                    for(std::size_t i = i_begin; i < i_end; ++i)
-                    {
-                        thread_reduce_func(arg.invariant_index_set_[i]);
-                    }
-                };
-
-                threads[it] = joinable_thread(f);
+                // inv-variance defined as 1/sqrt(epsilon+variance)
+                invVariance[row] =
+                    type_convert<AccDataType>(1.0f) / std::sqrt(arg.epsilon_ + variance);
             }
 
+            // normalization
+            ck::host_normalization::normalize_rows(space,
+                                                   mean,
+                                                   invVariance,
+                                                   arg.p_x_,
+                                                   arg.bnScale_,
+                                                   arg.bnBias_,
+                                                   arg.p_y_,
+                                                   arg.y_elementwise_op_);
+
             return (0.0f);
         };
 
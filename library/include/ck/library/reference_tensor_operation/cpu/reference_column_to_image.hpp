@@ -3,13 +3,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iostream>
 #include <type_traits>
 #include <sstream>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/library/utility/host_conv_gather.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/numeric.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -21,6 +25,9 @@ namespace host {
  * Input tensor descriptor has [N * Do * Ho * Wo, Z * Y * X * C] data layout.
  * Output tensor descriptor has [G, N, C, Di, Hi, Wi] data layout.
  *
+ * The input is added to the output: every output element gathers its terms from the input in fp32
+ * and is written once, by the CPU thread owning its tile of image positions.
+ *
  * \tparam NDimSpatial Number of spatial dimensions.
  * \tparam ImageLayout Image Layout.
  * \tparam InDataType Input Data Type.
@@ -91,6 +98,9 @@ struct ReferenceColumnToImage : public device::BaseOperator
     {
         using Argument = ReferenceColumnToImage::Argument;
 
+        // Image positions computed by a task
+        static constexpr long_index_t TileSize = 64;
+
         float Run(const Argument& arg)
         {
             if(!(arg.output_.GetNumOfDimension() == NDimSpatial + 3 &&
@@ -99,176 +109,71 @@ struct ReferenceColumnToImage : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
-            const long_index_t G = arg.output_.GetLengths()[0];
-            const long_index_t N = arg.output_.GetLengths()[1];
-            const long_index_t C = arg.output_.GetLengths()[2];
+            const auto& image_lengths = arg.output_.GetLengths();
 
-            if constexpr(NDimSpatial == 1)
-            {
-                const long_index_t Wo = arg.output_spatial_lengths_[0];
-                auto func             = [&](auto g, auto n) {
-                    for(long_index_t wo = 0; wo < Wo; ++wo)
-                    {
-                        long_index_t row    = n * Wo + wo;
-                        long_index_t column = 0;
+            const long_index_t G = image_lengths[0];
+            const long_index_t N = image_lengths[1];
+            const long_index_t C = image_lengths[2];
 
-                        for(long_index_t x = 0; x < arg.filter_spatial_lengths_[0]; ++x)
-                        {
-                            auto wi = static_cast<ck::long_index_t>(wo * arg.conv_strides_[0]) +
-                                      static_cast<ck::long_index_t>(x * arg.conv_dilations_[0]) -
-                                      static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
-
-                            for(long_index_t c = 0; c < C; ++c)
-                            {
-                                if(wi >= 0 &&
-                                   ck::type_convert<std::size_t>(wi) < arg.output_.GetLengths()[3])
-                                {
-                                    float v_in =
-                                        ck::type_convert<float>(arg.input_(g, row, column));
-                                    float v_out = ck::type_convert<float>(arg.output_(g, n, c, wi));
-                                    arg.output_(g, n, c, wi) =
-                                        ck::type_convert<OutDataType>(v_in + v_out);
-                                }
-                                column++;
-                            }
-                        }
-                    }
-                };
+            // image elements gather their terms from the columns, in fp32, and are converted once
+            const host_conv_gather::Gather<NDimSpatial> gather(
+                std::vector<long_index_t>(image_lengths.begin() + 3, image_lengths.end()),
+                arg.filter_spatial_lengths_,
+                arg.output_spatial_lengths_,
+                arg.conv_strides_,
+                arg.conv_dilations_,
+                arg.in_left_pads_);
 
-                make_ParallelTensorFunctor(func, G, N)(std::thread::hardware_concurrency());
+            const long_index_t image_size = gather.GetInputSize();
+            const long_index_t DoHoWo     = ck::accumulate_n<long_index_t>(
+                arg.output_spatial_lengths_.begin(), NDimSpatial, 1, std::multiplies<>());
 
-                return 0;
-            }
-            else if constexpr(NDimSpatial == 2)
-            {
-                const long_index_t Ho = arg.output_spatial_lengths_[0];
-                const long_index_t Wo = arg.output_spatial_lengths_[1];
+            const std::size_t column_stride = arg.input_.GetStrides()[2];
+            const std::size_t c_stride      = arg.output_.GetStrides()[2];
 
-                auto func = [&](auto g, auto n) {
-                    for(long_index_t ho = 0; ho < Ho; ++ho)
-                    {
-                        for(long_index_t wo = 0; wo < Wo; ++wo)
-                        {
-                            long_index_t row    = n * Ho * Wo + ho * Wo + wo;
-                            long_index_t column = 0;
-
-                            for(long_index_t y = 0; y < arg.filter_spatial_lengths_[0]; ++y)
-                            {
-                                auto hi =
-                                    static_cast<ck::long_index_t>(ho * arg.conv_strides_[0]) +
-                                    static_cast<ck::long_index_t>(y * arg.conv_dilations_[0]) -
-                                    static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
-
-                                for(long_index_t x = 0; x < arg.filter_spatial_lengths_[1]; ++x)
-                                {
-                                    auto wi =
-                                        static_cast<ck::long_index_t>(wo * arg.conv_strides_[1]) +
-                                        static_cast<ck::long_index_t>(x * arg.conv_dilations_[1]) -
-                                        static_cast<ck::long_index_t>(arg.in_left_pads_[1]);
-
-                                    for(long_index_t c = 0; c < C; ++c)
-                                    {
-
-                                        if(hi >= 0 &&
-                                           ck::type_convert<std::size_t>(hi) <
-                                               arg.output_.GetLengths()[3] &&
-                                           wi >= 0 &&
-                                           ck::type_convert<std::size_t>(wi) <
-                                               arg.output_.GetLengths()[4])
-                                        {
-                                            float v_in =
-                                                ck::type_convert<float>(arg.input_(g, row, column));
-                                            float v_out = ck::type_convert<float>(
-                                                arg.output_(g, n, c, hi, wi));
-                                            arg.output_(g, n, c, hi, wi) =
-                                                ck::type_convert<OutDataType>(v_in + v_out);
-                                        }
-                                        column++;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                };
+            auto f_tile = [&](auto g, auto n, auto tile) {
+                const long_index_t begin = static_cast<long_index_t>(tile) * TileSize;
+                const long_index_t end   = std::min(begin + TileSize, image_size);
 
-                make_ParallelTensorFunctor(func, G, N)(std::thread::hardware_concurrency());
+                std::vector<float> acc(C);
+                std::vector<std::size_t> idx(NDimSpatial + 3);
+                idx[0] = g;
+                idx[1] = n;
 
-                return 0;
-            }
-            else if constexpr(NDimSpatial == 3)
-            {
-                const long_index_t Do = arg.output_spatial_lengths_[0];
-                const long_index_t Ho = arg.output_spatial_lengths_[1];
-                const long_index_t Wo = arg.output_spatial_lengths_[2];
+                for(long_index_t wi = begin; wi < end; ++wi)
+                {
+                    const auto spatial_idx = gather.GetInputIndex(wi);
+                    std::copy(spatial_idx.begin(), spatial_idx.end(), idx.begin() + 3);
+
+                    OutDataType* p_out =
+                        arg.output_.mData.data() + arg.output_.mDesc.GetOffsetFromMultiIndex(idx);
 
-                auto func = [&](auto g, auto n) {
-                    for(long_index_t d_o = 0; d_o < Do; ++d_o)
+                    for(long_index_t c = 0; c < C; ++c)
                     {
-                        for(long_index_t ho = 0; ho < Ho; ++ho)
+                        acc[c] = ck::type_convert<float>(p_out[c * c_stride]);
+                    }
+
+                    gather.ForEachTerm(wi, [&](long_index_t tap, long_index_t wo) {
+                        const long_index_t row = n * DoHoWo + wo;
+                        const InDataType* p_in = &arg.input_(g, row, tap * C);
+
+                        for(long_index_t c = 0; c < C; ++c)
                         {
-                            for(long_index_t wo = 0; wo < Wo; ++wo)
-                            {
-                                long_index_t row = n * Do * Ho * Wo + d_o * Ho * Wo + ho * Wo + wo;
-                                long_index_t column = 0;
-
-                                for(long_index_t z = 0; z < arg.filter_spatial_lengths_[0]; ++z)
-                                {
-                                    auto di =
-                                        static_cast<ck::long_index_t>(d_o * arg.conv_strides_[0]) +
-                                        static_cast<ck::long_index_t>(z * arg.conv_dilations_[0]) -
-                                        static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
-                                    for(long_index_t y = 0; y < arg.filter_spatial_lengths_[1]; ++y)
-                                    {
-                                        auto hi =
-                                            static_cast<ck::long_index_t>(ho *
-                                                                          arg.conv_strides_[1]) +
-                                            static_cast<ck::long_index_t>(y *
-                                                                          arg.conv_dilations_[1]) -
-                                            static_cast<ck::long_index_t>(arg.in_left_pads_[1]);
-                                        for(long_index_t x = 0; x < arg.filter_spatial_lengths_[2];
-                                            ++x)
-                                        {
-                                            auto wi =
-                                                static_cast<ck::long_index_t>(
-                                                    wo * arg.conv_strides_[2]) +
-                                                static_cast<ck::long_index_t>(
-                                                    x * arg.conv_dilations_[2]) -
-                                                static_cast<ck::long_index_t>(arg.in_left_pads_[2]);
-                                            for(long_index_t c = 0; c < C; ++c)
-                                            {
-                                                if(di >= 0 &&
-                                                   ck::type_convert<std::size_t>(di) <
-                                                       arg.output_.GetLengths()[3] &&
-                                                   hi >= 0 &&
-                                                   ck::type_convert<std::size_t>(hi) <
-                                                       arg.output_.GetLengths()[4] &&
-                                                   wi >= 0 &&
-                                                   ck::type_convert<std::size_t>(wi) <
-                                                       arg.output_.GetLengths()[5])
-                                                {
-                                                    float v_in = ck::type_convert<float>(
-                                                        arg.input_(g, row, column));
-                                                    float v_out = ck::type_convert<float>(
-                                                        arg.output_(g, n, c, di, hi, wi));
-                                                    arg.output_(g, n, c, di, hi, wi) =
-                                                        ck::type_convert<OutDataType>(v_in + v_out);
-                                                }
-                                                column++;
-                                            }
-                                        }
-                                    }
-                                }
-                            }
+                            acc[c] += ck::type_convert<float>(p_in[c * column_stride]);
                         }
+                    });
+
+                    for(long_index_t c = 0; c < C; ++c)
+                    {
+                        p_out[c * c_stride] = ck::type_convert<OutDataType>(acc[c]);
                     }
-                };
+                }
+            };
 
-                make_ParallelTensorFunctor(func, G, N)(std::thread::hardware_concurrency());
+            make_ParallelTensorFunctor(f_tile, G, N, (image_size + TileSize - 1) / TileSize)(
+                std::thread::hardware_concurrency());
 
-                return 0;
-            }
-            throw std::runtime_error("Col2Img: number of dimensions should be between 1 and 3.");
-            return 1;
+            return 0;
         }
 
         float Run(const device::BaseArgument* p_arg,
@@ -3,12 +3,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 
+#include "ck/library/utility/host_conv_gather.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/numeric.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -18,6 +22,8 @@ namespace host {
 // weight descriptor in [G, K, C, Z, Y, X] order
 // output descriptor in [G, N, K, Di, Hi, Wi] order
 // phyiscal layout is irrelavent
+// every input element gathers the terms of the output positions and filter taps reading it, in
+// fp32, on the CPU thread owning its tile of input positions
 template <ck::index_t NDimSpatial,
           typename InDataType,
           typename WeiDataType,
@@ -87,6 +93,29 @@ struct ReferenceConvBwdData : public device::BaseOperator
     {
         using Argument = ReferenceConvBwdData::Argument;
 
+        // Input positions computed by a task
+        static constexpr std::size_t TileSize = 64;
+
+        // Index [i0, i1, i2, spatial...] of a tensor of lengths, with the spatial coordinates of
+        // the row-major spatial offset
+        static std::vector<std::size_t> GetIndex(std::size_t i0,
+                                                 std::size_t i1,
+                                                 std::size_t i2,
+                                                 std::size_t spatial_offset,
+                                                 const std::vector<std::size_t>& lengths)
+        {
+            std::vector<std::size_t> idx(lengths.size());
+            idx[0] = i0;
+            idx[1] = i1;
+            idx[2] = i2;
+            for(std::size_t d = lengths.size() - 1; d >= 3; --d)
+            {
+                idx[d] = spatial_offset % lengths[d];
+                spatial_offset /= lengths[d];
+            }
+            return idx;
+        }
+
         float Run(const Argument& arg)
         {
             if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
@@ -96,306 +125,126 @@ struct ReferenceConvBwdData : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
-            if constexpr(NDimSpatial == 1)
-            {
-                auto f_ncw = [&](auto g, auto n, auto c, auto wi) {
-                    std::size_t K  = arg.weight_.GetLengths()[1];
-                    std::size_t X  = arg.weight_.GetLengths()[3];
-                    std::size_t Wo = arg.output_.GetLengths()[3];
-
-                    float v_acc = 0;
-
-                    for(std::size_t x = 0; x < X; ++x)
+            const auto& in_lengths  = arg.input_.GetLengths();
+            const auto& wei_lengths = arg.weight_.GetLengths();
+            const auto& out_lengths = arg.output_.GetLengths();
+
+            const auto& in_strides  = arg.input_.GetStrides();
+            const auto& wei_strides = arg.weight_.GetStrides();
+            const auto& out_strides = arg.output_.GetStrides();
+
+            const std::size_t G = in_lengths[0];
+            const std::size_t N = in_lengths[1];
+            const std::size_t C = in_lengths[2];
+            const std::size_t K = wei_lengths[1];
+
+            // every input element gathers its terms and is computed by a single thread
+            const host_conv_gather::Gather<NDimSpatial> gather(
+                std::vector<long_index_t>(in_lengths.begin() + 3, in_lengths.end()),
+                std::vector<long_index_t>(wei_lengths.begin() + 3, wei_lengths.end()),
+                std::vector<long_index_t>(out_lengths.begin() + 3, out_lengths.end()),
+                arg.conv_strides_,
+                arg.conv_dilations_,
+                arg.in_left_pads_);
+
+            const std::size_t in_size     = gather.GetInputSize();
+            const std::size_t filter_size = ck::accumulate_n<std::size_t>(
+                wei_lengths.begin() + 3, NDimSpatial, 1, std::multiplies<>());
+            const std::size_t out_size    = ck::accumulate_n<std::size_t>(
+                out_lengths.begin() + 3, NDimSpatial, 1, std::multiplies<>());
+
+            // output and weight after their element-wise operations, in fp32 and with contiguous
+            // K: out_k[g, n, o, k] and wei_k[g, c, t, k]
+            std::vector<float> out_k(G * N * out_size * K);
+            std::vector<float> wei_k(G * C * filter_size * K);
+
+            auto f_out = [&](auto g, auto n, auto o) {
+                auto idx                 = GetIndex(g, n, 0, o, out_lengths);
+                const std::size_t offset = arg.output_.mDesc.GetOffsetFromMultiIndex(idx);
+                float* p_out             = &out_k[((g * N + n) * out_size + o) * K];
+
+                for(std::size_t k = 0; k < K; ++k)
+                {
+                    idx[2] = k;
+
+                    OutDataType v_out;
+                    ExecuteElementwiseOp(arg.out_element_op_,
+                                         arg.elementwise_a_tensors_,
+                                         Number<NumAElementwiseTensor>{},
+                                         v_out,
+                                         arg.output_.mData[offset + k * out_strides[2]],
+                                         idx);
+                    p_out[k] = ck::type_convert<float>(v_out);
+                }
+            };
+
+            auto f_wei = [&](auto g, auto c, auto t) {
+                auto idx                 = GetIndex(g, 0, c, t, wei_lengths);
+                const std::size_t offset = arg.weight_.mDesc.GetOffsetFromMultiIndex(idx);
+                float* p_wei             = &wei_k[((g * C + c) * filter_size + t) * K];
+
+                for(std::size_t k = 0; k < K; ++k)
+                {
+                    idx[1] = k;
+
+                    WeiDataType v_wei;
+                    ExecuteElementwiseOp(arg.wei_element_op_,
+                                         arg.elementwise_b_tensors_,
+                                         Number<NumBElementwiseTensor>{},
+                                         v_wei,
+                                         arg.weight_.mData[offset + k * wei_strides[1]],
+                                         idx);
+                    p_wei[k] = ck::type_convert<float>(v_wei);
+                }
+            };
+
+            auto f_tile = [&](auto g, auto n, auto tile) {
+                const std::size_t begin = tile * TileSize;
+                const std::size_t end   = std::min<std::size_t>(begin + TileSize, in_size);
+
+                for(std::size_t i = begin; i < end; ++i)
+                {
+                    auto idx                 = GetIndex(g, n, 0, i, in_lengths);
+                    const std::size_t offset = arg.input_.mDesc.GetOffsetFromMultiIndex(idx);
+
+                    for(std::size_t c = 0; c < C; ++c)
                     {
-                        auto w_tmp = static_cast<ck::long_index_t>(wi) +
-                                     static_cast<ck::long_index_t>(arg.in_left_pads_[0]) -
-                                     static_cast<ck::long_index_t>(x * arg.conv_dilations_[0]);
+                        const float* p_wei_c = &wei_k[(g * C + c) * filter_size * K];
 
-                        if(w_tmp % arg.conv_strides_[0] == 0)
-                        {
-                            auto wo = static_cast<ck::long_index_t>(w_tmp) /
-                                      static_cast<ck::long_index_t>(arg.conv_strides_[0]);
+                        float v_acc = 0;
 
-                            if(wo >= 0 && ck::type_convert<std::size_t>(wo) < Wo)
-                            {
-                                for(std::size_t k = 0; k < K; ++k)
-                                {
-                                    OutDataType v_out;
-                                    WeiDataType v_wei;
-
-                                    ExecuteElementwiseOp(arg.out_element_op_,
-                                                         arg.elementwise_a_tensors_,
-                                                         Number<NumAElementwiseTensor>{},
-                                                         v_out,
-                                                         arg.output_(g, n, k, wo),
-                                                         g,
-                                                         n,
-                                                         k,
-                                                         wo);
-                                    ExecuteElementwiseOp(arg.wei_element_op_,
-                                                         arg.elementwise_b_tensors_,
-                                                         Number<NumBElementwiseTensor>{},
-                                                         v_wei,
-                                                         arg.weight_(g, k, c, x),
-                                                         g,
-                                                         k,
-                                                         c,
-                                                         x);
-
-                                    v_acc += ck::type_convert<float>(v_out) *
-                                             ck::type_convert<float>(v_wei);
-                                }
-                            }
-                        }
-                    }
+                        gather.ForEachTerm(i, [&](long_index_t t, long_index_t o) {
+                            const float* p_out = &out_k[((g * N + n) * out_size + o) * K];
+                            const float* p_wei = p_wei_c + t * K;
 
-                    InDataType v_acc_converted = ck::type_convert<InDataType>(v_acc);
-                    InDataType& v_in           = arg.input_(g, n, c, wi);
-                    ExecuteElementwiseOp(arg.in_element_op_,
-                                         arg.elementwise_d_tensors_,
-                                         Number<NumDElementwiseTensor>{},
-                                         v_in,
-                                         v_acc_converted,
-                                         g,
-                                         n,
-                                         c,
-                                         wi);
-                };
-
-                make_ParallelTensorFunctor(f_ncw,
-                                           arg.input_.GetLengths()[0],
-                                           arg.input_.GetLengths()[1],
-                                           arg.input_.GetLengths()[2],
-                                           arg.input_.GetLengths()[3])(
-                    std::thread::hardware_concurrency());
-
-                return 0;
-            }
-            else if constexpr(NDimSpatial == 2)
-            {
-                auto f_nchw = [&](auto g, auto n, auto c, auto hi, auto wi) {
-                    std::size_t K = arg.weight_.GetLengths()[1];
-                    std::size_t Y = arg.weight_.GetLengths()[3];
-                    std::size_t X = arg.weight_.GetLengths()[4];
-
-                    std::size_t Ho = arg.output_.GetLengths()[3];
-                    std::size_t Wo = arg.output_.GetLengths()[4];
-
-                    float v_acc = 0;
-
-                    for(std::size_t y = 0; y < Y; ++y)
-                    {
-                        auto h_tmp = static_cast<ck::long_index_t>(hi) +
-                                     static_cast<ck::long_index_t>(arg.in_left_pads_[0]) -
-                                     static_cast<ck::long_index_t>(y * arg.conv_dilations_[0]);
-                        if(h_tmp % arg.conv_strides_[0] == 0)
-                        {
-                            auto ho = static_cast<ck::long_index_t>(h_tmp) /
-                                      static_cast<ck::long_index_t>(arg.conv_strides_[0]);
-                            if(ho >= 0 && ck::type_convert<std::size_t>(ho) < Ho)
+                            for(std::size_t k = 0; k < K; ++k)
                             {
-                                for(std::size_t x = 0; x < X; ++x)
-                                {
-                                    auto w_tmp =
-                                        static_cast<ck::long_index_t>(wi) +
-                                        static_cast<ck::long_index_t>(arg.in_left_pads_[1]) -
-                                        static_cast<ck::long_index_t>(x * arg.conv_dilations_[1]);
-                                    if(w_tmp % arg.conv_strides_[1] == 0)
-                                    {
-                                        auto wo =
-                                            static_cast<ck::long_index_t>(w_tmp) /
-                                            static_cast<ck::long_index_t>(arg.conv_strides_[1]);
-                                        if(wo >= 0 && ck::type_convert<std::size_t>(wo) < Wo)
-                                        {
-                                            for(std::size_t k = 0; k < K; ++k)
-                                            {
-                                                OutDataType v_out;
-                                                WeiDataType v_wei;
-
-                                                ExecuteElementwiseOp(
-                                                    arg.out_element_op_,
-                                                    arg.elementwise_a_tensors_,
-                                                    Number<NumAElementwiseTensor>{},
-                                                    v_out,
-                                                    arg.output_(g, n, k, ho, wo),
-                                                    g,
-                                                    n,
-                                                    k,
-                                                    ho,
-                                                    wo);
-                                                ExecuteElementwiseOp(
-                                                    arg.wei_element_op_,
-                                                    arg.elementwise_b_tensors_,
-                                                    Number<NumBElementwiseTensor>{},
-                                                    v_wei,
-                                                    arg.weight_(g, k, c, y, x),
-                                                    g,
-                                                    k,
-                                                    c,
-                                                    y,
-                                                    x);
-
-                                                v_acc += ck::type_convert<float>(v_out) *
-                                                         ck::type_convert<float>(v_wei);
-                                            }
-                                        }
-                                    }
-                                }
+                                v_acc += p_out[k] * p_wei[k];
                             }
-                        }
+                        });
+
+                        idx[2] = c;
+
+                        InDataType v_acc_converted = ck::type_convert<InDataType>(v_acc);
+                        InDataType& v_in           = arg.input_.mData[offset + c * in_strides[2]];
+                        ExecuteElementwiseOp(arg.in_element_op_,
+                                             arg.elementwise_d_tensors_,
+                                             Number<NumDElementwiseTensor>{},
+                                             v_in,
+                                             v_acc_converted,
+                                             idx);
                     }
+                }
+            };
 
-                    InDataType v_acc_converted = ck::type_convert<InDataType>(v_acc);
-                    InDataType& v_in           = arg.input_(g, n, c, hi, wi);
-                    ExecuteElementwiseOp(arg.in_element_op_,
-                                         arg.elementwise_d_tensors_,
-                                         Number<NumDElementwiseTensor>{},
-                                         v_in,
-                                         v_acc_converted,
-                                         g,
-                                         n,
-                                         c,
-                                         hi,
-                                         wi);
-                };
-
-                make_ParallelTensorFunctor(f_nchw,
-                                           arg.input_.GetLengths()[0],
-                                           arg.input_.GetLengths()[1],
-                                           arg.input_.GetLengths()[2],
-                                           arg.input_.GetLengths()[3],
-                                           arg.input_.GetLengths()[4])(
-                    std::thread::hardware_concurrency());
-
-                return 0;
-            }
-            else if constexpr(NDimSpatial == 3)
-            {
-                auto f_ncdhw = [&](auto g, auto n, auto c, auto di, auto hi, auto wi) {
-                    std::size_t K = arg.weight_.GetLengths()[1];
-                    std::size_t Z = arg.weight_.GetLengths()[3];
-                    std::size_t Y = arg.weight_.GetLengths()[4];
-                    std::size_t X = arg.weight_.GetLengths()[5];
-
-                    std::size_t Do = arg.output_.GetLengths()[3];
-                    std::size_t Ho = arg.output_.GetLengths()[4];
-                    std::size_t Wo = arg.output_.GetLengths()[5];
+            const std::size_t num_thread = std::thread::hardware_concurrency();
 
-                    float v_acc = 0;
+            make_ParallelTensorFunctor(f_out, G, N, out_size)(num_thread);
+            make_ParallelTensorFunctor(f_wei, G, C, filter_size)(num_thread);
+            make_ParallelTensorFunctor(f_tile, G, N, (in_size + TileSize - 1) / TileSize)(
+                num_thread);
 
-                    for(std::size_t z = 0; z < Z; ++z)
-                    {
-                        auto d_tmp = static_cast<ck::long_index_t>(di) +
-                                     static_cast<ck::long_index_t>(arg.in_left_pads_[0]) -
-                                     static_cast<ck::long_index_t>(z * arg.conv_dilations_[0]);
-                        if(d_tmp % arg.conv_strides_[0] == 0)
-                        {
-                            auto do_ = static_cast<ck::long_index_t>(d_tmp) /
-                                       static_cast<ck::long_index_t>(arg.conv_strides_[0]);
-                            if(do_ >= 0 && ck::type_convert<std::size_t>(do_) < Do)
-                            {
-                                for(std::size_t y = 0; y < Y; ++y)
-                                {
-                                    auto h_tmp =
-                                        static_cast<ck::long_index_t>(hi) +
-                                        static_cast<ck::long_index_t>(arg.in_left_pads_[1]) -
-                                        static_cast<ck::long_index_t>(y * arg.conv_dilations_[1]);
-                                    if(h_tmp % arg.conv_strides_[1] == 0)
-                                    {
-                                        auto ho =
-                                            static_cast<ck::long_index_t>(h_tmp) /
-                                            static_cast<ck::long_index_t>(arg.conv_strides_[1]);
-                                        if(ho >= 0 && ck::type_convert<std::size_t>(ho) < Ho)
-                                        {
-                                            for(std::size_t x = 0; x < X; ++x)
-                                            {
-                                                auto w_tmp = static_cast<ck::long_index_t>(wi) +
-                                                             static_cast<ck::long_index_t>(
-                                                                 arg.in_left_pads_[2]) -
-                                                             static_cast<ck::long_index_t>(
-                                                                 x * arg.conv_dilations_[2]);
-
-                                                if(w_tmp % arg.conv_strides_[2] == 0)
-                                                {
-                                                    auto wo = static_cast<ck::long_index_t>(w_tmp) /
-                                                              static_cast<ck::long_index_t>(
-                                                                  arg.conv_strides_[2]);
-                                                    if(wo >= 0 &&
-                                                       ck::type_convert<std::size_t>(wo) < Wo)
-                                                    {
-                                                        for(std::size_t k = 0; k < K; ++k)
-                                                        {
-                                                            OutDataType v_out;
-                                                            WeiDataType v_wei;
-
-                                                            ExecuteElementwiseOp(
-                                                                arg.out_element_op_,
-                                                                arg.elementwise_a_tensors_,
-                                                                Number<NumAElementwiseTensor>{},
-                                                                v_out,
-                                                                arg.output_(g, n, k, do_, ho, wo),
-                                                                g,
-                                                                n,
-                                                                k,
-                                                                do_,
-                                                                ho,
-                                                                wo);
-                                                            ExecuteElementwiseOp(
-                                                                arg.wei_element_op_,
-                                                                arg.elementwise_b_tensors_,
-                                                                Number<NumBElementwiseTensor>{},
-                                                                v_wei,
-                                                                arg.weight_(g, k, c, z, y, x),
-                                                                g,
-                                                                k,
-                                                                c,
-                                                                z,
-                                                                y,
-                                                                x);
-
-                                                            v_acc +=
-                                                                ck::type_convert<float>(v_out) *
-                                                                ck::type_convert<float>(v_wei);
-                                                        }
-                                                    }
-                                                }
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-
-                    InDataType v_acc_converted = ck::type_convert<InDataType>(v_acc);
-                    InDataType& v_in           = arg.input_(g, n, c, di, hi, wi);
-                    ExecuteElementwiseOp(arg.in_element_op_,
-                                         arg.elementwise_d_tensors_,
-                                         Number<NumDElementwiseTensor>{},
-                                         v_in,
-                                         v_acc_converted,
-                                         g,
-                                         n,
-                                         c,
-                                         di,
-                                         hi,
-                                         wi);
-                };
-
-                make_ParallelTensorFunctor(f_ncdhw,
-                                           arg.input_.GetLengths()[0],
-                                           arg.input_.GetLengths()[1],
-                                           arg.input_.GetLengths()[2],
-                                           arg.input_.GetLengths()[3],
-                                           arg.input_.GetLengths()[4],
-                                           arg.input_.GetLengths()[5])(
-                    std::thread::hardware_concurrency());
-
-                return 0;
-            }
-            throw std::runtime_error(
-                "Conv_bwd_data: number of dimensions must be between 1 and 3.");
-            return 1;
+            return 0;
         }
 
         float Run(const device::BaseArgument* p_arg,
@@ -415,7 +264,7 @@ struct ReferenceConvBwdData : public device::BaseOperator
                                      NumTensor,
                                      T& y,
                                      const T& x,
-                                     Args... dims)
+                                     const Args&... dims)
     {
         if constexpr(NumTensor::value == 0)
         {
@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdlib>
 #include <numeric>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "ck/ck.hpp"
@@ -17,6 +20,7 @@
 #include "ck/library/utility/algorithm.hpp"
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_int8_gemm.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/convolution_parameter.hpp"
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
@@ -113,23 +117,30 @@ struct ReferenceConvFwd : public device::BaseOperator
         OutElementwiseOperation out_element_op_;
     };
 
+    // int8 convolutions with int32 output (quantization, the requantization being done on the
+    // output) accumulate exactly in int32 and run on the int8 GEMM engine
+    static constexpr bool IsInt8Conv = host_int8_gemm::IsInt8Gemm<InDataType,
+                                                                  WeiDataType,
+                                                                  OutDataType,
+                                                                  InElementwiseOperation,
+                                                                  WeiElementwiseOperation> &&
+                                       NumAElementwiseTensor == 0 && NumBElementwiseTensor == 0;
+
+    using AccDataType = std::conditional_t<IsInt8Conv, int32_t, float>;
+
     struct Invoker : public device::BaseInvoker
     {
         using Argument = ReferenceConvFwd::Argument;
 
-        float Run(const Argument& arg)
+        // Computes the output element (g, n, k, [do, [ho,]] wo), Run computes all of them. Also
+        // used alone to evaluate the reference at a few elements only (see check_err_sampled).
+        template <typename... Is>
+        static void RunElement(const Argument& arg, Is... is)
         {
-            if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
-                 arg.weight_.GetNumOfDimension() == NDimSpatial + 3 &&
-                 arg.output_.GetNumOfDimension() == NDimSpatial + 3))
-            {
-                throw std::runtime_error("wrong! inconsistent dimension");
-            }
-
             if constexpr(NDimSpatial == 1)
             {
                 auto func = [&](auto g, auto n, auto k, auto wo) {
-                    float v_acc = 0;
+                    AccDataType v_acc = 0;
 
                     for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
                     {
@@ -163,8 +174,8 @@ struct ReferenceConvFwd : public device::BaseOperator
                                                      k,
                                                      c,
                                                      x);
-                                v_acc +=
-                                    ck::type_convert<float>(v_in) * ck::type_convert<float>(v_wei);
+                                v_acc += ck::type_convert<AccDataType>(v_in) *
+                                         ck::type_convert<AccDataType>(v_wei);
                             }
                         }
                     }
@@ -181,19 +192,12 @@ struct ReferenceConvFwd : public device::BaseOperator
                                          wo);
                 };
 
-                make_ParallelTensorFunctor(func,
-                                           arg.output_.GetLengths()[0],
-                                           arg.output_.GetLengths()[1],
-                                           arg.output_.GetLengths()[2],
-                                           arg.output_.GetLengths()[3])(
-                    std::thread::hardware_concurrency());
-
-                return 0;
+                func(is...);
             }
             else if constexpr(NDimSpatial == 2)
             {
                 auto func = [&](auto g, auto n, auto k, auto ho, auto wo) {
-                    float v_acc = 0;
+                    AccDataType v_acc = 0;
 
                     for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
                     {
@@ -238,8 +242,8 @@ struct ReferenceConvFwd : public device::BaseOperator
                                                          c,
                                                          y,
                                                          x);
-                                    v_acc += ck::type_convert<float>(v_in) *
-                                             ck::type_convert<float>(v_wei);
+                                    v_acc += ck::type_convert<AccDataType>(v_in) *
+                                             ck::type_convert<AccDataType>(v_wei);
                                 }
                             }
                         }
@@ -258,20 +262,12 @@ struct ReferenceConvFwd : public device::BaseOperator
                                          wo);
                 };
 
-                make_ParallelTensorFunctor(func,
-                                           arg.output_.GetLengths()[0],
-                                           arg.output_.GetLengths()[1],
-                                           arg.output_.GetLengths()[2],
-                                           arg.output_.GetLengths()[3],
-                                           arg.output_.GetLengths()[4])(
-                    std::thread::hardware_concurrency());
-
-                return 0;
+                func(is...);
             }
             else if constexpr(NDimSpatial == 3)
             {
                 auto func = [&](auto g, auto n, auto k, auto d_o, auto ho, auto wo) {
-                    float v_acc = 0;
+                    AccDataType v_acc = 0;
 
                     for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
                     {
@@ -327,8 +323,8 @@ struct ReferenceConvFwd : public device::BaseOperator
                                                              z,
                                                              y,
                                                              x);
-                                        v_acc += ck::type_convert<float>(v_in) *
-                                                 ck::type_convert<float>(v_wei);
+                                        v_acc += ck::type_convert<AccDataType>(v_in) *
+                                                 ck::type_convert<AccDataType>(v_wei);
                                     }
                                 }
                             }
@@ -349,6 +345,95 @@ struct ReferenceConvFwd : public device::BaseOperator
                                          wo);
                 };
 
+                func(is...);
+            }
+        }
+
+        template <std::size_t... Ds>
+        static void RunOutputElementwiseOp(const Argument& arg,
+                                           OutDataType v_acc,
+                                           std::size_t g,
+                                           std::size_t n,
+                                           std::size_t k,
+                                           const std::array<std::size_t, NDimSpatial>& o,
+                                           std::index_sequence<Ds...>)
+        {
+            OutDataType& v_out = arg.output_(g, n, k, o[Ds]...);
+            ExecuteElementwiseOp(arg.out_element_op_,
+                                 arg.elementwise_d_tensors_,
+                                 Number<NumDElementwiseTensor>{},
+                                 v_out,
+                                 v_acc,
+                                 g,
+                                 n,
+                                 k,
+                                 o[Ds]...);
+        }
+
+        // Same result as RunElement for all the elements, see host_int8_gemm::Conv
+        static void RunInt8(const Argument& arg)
+        {
+            host_int8_gemm::Conv<NDimSpatial>(
+                arg.input_,
+                arg.weight_,
+                arg.output_.GetLengths(),
+                arg.conv_strides_,
+                arg.conv_dilations_,
+                arg.in_left_pads_,
+                [&](std::size_t g,
+                    std::size_t n,
+                    const std::array<std::size_t, NDimSpatial>& o,
+                    const int32_t* p_acc_row) {
+                    for(std::size_t k = 0; k < arg.output_.GetLengths()[2]; ++k)
+                    {
+                        RunOutputElementwiseOp(
+                            arg, p_acc_row[k], g, n, k, o, std::make_index_sequence<NDimSpatial>{});
+                    }
+                });
+        }
+
+        float Run(const Argument& arg)
+        {
+            if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
+                 arg.weight_.GetNumOfDimension() == NDimSpatial + 3 &&
+                 arg.output_.GetNumOfDimension() == NDimSpatial + 3))
+            {
+                throw std::runtime_error("wrong! inconsistent dimension");
+            }
+
+            if constexpr(IsInt8Conv)
+            {
+                RunInt8(arg);
+                return 0;
+            }
+
+            auto func = [&](auto... is) { RunElement(arg, is...); };
+
+            if constexpr(NDimSpatial == 1)
+            {
+                make_ParallelTensorFunctor(func,
+                                           arg.output_.GetLengths()[0],
+                                           arg.output_.GetLengths()[1],
+                                           arg.output_.GetLengths()[2],
+                                           arg.output_.GetLengths()[3])(
+                    std::thread::hardware_concurrency());
+
+                return 0;
+            }
+            else if constexpr(NDimSpatial == 2)
+            {
+                make_ParallelTensorFunctor(func,
+                                           arg.output_.GetLengths()[0],
+                                           arg.output_.GetLengths()[1],
+                                           arg.output_.GetLengths()[2],
+                                           arg.output_.GetLengths()[3],
+                                           arg.output_.GetLengths()[4])(
+                    std::thread::hardware_concurrency());
+
+                return 0;
+            }
+            else if constexpr(NDimSpatial == 3)
+            {
                 make_ParallelTensorFunctor(func,
                                            arg.output_.GetLengths()[0],
                                            arg.output_.GetLengths()[1],
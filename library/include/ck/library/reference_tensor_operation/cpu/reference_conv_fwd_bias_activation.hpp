@@ -5,8 +5,10 @@
 
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_element_wise.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 
 namespace ck {
@@ -73,56 +75,70 @@ struct ReferenceConvFwd_Bias_Activation : public device::BaseOperator
 
         float Run(const Argument& arg)
         {
-            auto f_nchw = [&](auto n, auto k, auto ho, auto wo) {
-                float v_acc = 0;
+            const std::size_t Wo = arg.out_n_k_ho_wo_.mDesc.GetLengths()[3];
 
-                for(std::size_t c = 0; c < arg.wei_k_c_y_x_.mDesc.GetLengths()[1]; ++c)
+            auto f_nkh = [&](auto n, auto k, auto ho) {
+                std::vector<float> acc_row(Wo);
+                for(std::size_t wo = 0; wo < Wo; ++wo)
                 {
-                    for(std::size_t y = 0; y < arg.wei_k_c_y_x_.mDesc.GetLengths()[2]; ++y)
+                    float v_acc = 0;
+
+                    for(std::size_t c = 0; c < arg.wei_k_c_y_x_.mDesc.GetLengths()[1]; ++c)
                     {
-                        auto hi = ck::type_convert<ck::long_index_t>(ho * arg.conv_strides_[0]) +
-                                  ck::type_convert<ck::long_index_t>(y * arg.conv_dilations_[0]) -
-                                  ck::type_convert<ck::long_index_t>(arg.in_left_pads_[0]);
-                        for(std::size_t x = 0; x < arg.wei_k_c_y_x_.mDesc.GetLengths()[3]; ++x)
+                        for(std::size_t y = 0; y < arg.wei_k_c_y_x_.mDesc.GetLengths()[2]; ++y)
                         {
-                            auto wi =
-                                ck::type_convert<ck::long_index_t>(wo * arg.conv_strides_[1]) +
-                                ck::type_convert<ck::long_index_t>(x * arg.conv_dilations_[1]) -
-                                ck::type_convert<ck::long_index_t>(arg.in_left_pads_[1]);
-                            if(hi >= 0 &&
-                               ck::type_convert<std::size_t>(hi) <
-                                   arg.in_n_c_hi_wi_.mDesc.GetLengths()[2] &&
-                               wi >= 0 &&
-                               ck::type_convert<std::size_t>(wi) <
-                                   arg.in_n_c_hi_wi_.mDesc.GetLengths()[3])
+                            auto hi =
+                                ck::type_convert<ck::long_index_t>(ho * arg.conv_strides_[0]) +
+                                ck::type_convert<ck::long_index_t>(y * arg.conv_dilations_[0]) -
+                                ck::type_convert<ck::long_index_t>(arg.in_left_pads_[0]);
+                            for(std::size_t x = 0; x < arg.wei_k_c_y_x_.mDesc.GetLengths()[3]; ++x)
                             {
-                                float v_in;
-                                float v_wei;
-
-                                arg.in_element_op_(
-                                    v_in,
-                                    static_cast<const float>(arg.in_n_c_hi_wi_(n, c, hi, wi)));
-                                arg.wei_element_op_(
-                                    v_wei, static_cast<const float>(arg.wei_k_c_y_x_(k, c, y, x)));
-
-                                v_acc += v_in * v_wei;
+                                auto wi =
+                                    ck::type_convert<ck::long_index_t>(wo * arg.conv_strides_[1]) +
+                                    ck::type_convert<ck::long_index_t>(x * arg.conv_dilations_[1]) -
+                                    ck::type_convert<ck::long_index_t>(arg.in_left_pads_[1]);
+                                if(hi >= 0 &&
+                                   ck::type_convert<std::size_t>(hi) <
+                                       arg.in_n_c_hi_wi_.mDesc.GetLengths()[2] &&
+                                   wi >= 0 &&
+                                   ck::type_convert<std::size_t>(wi) <
+                                       arg.in_n_c_hi_wi_.mDesc.GetLengths()[3])
+                                {
+                                    float v_in;
+                                    float v_wei;
+
+                                    arg.in_element_op_(
+                                        v_in,
+                                        static_cast<const float>(arg.in_n_c_hi_wi_(n, c, hi, wi)));
+                                    arg.wei_element_op_(
+                                        v_wei,
+                                        static_cast<const float>(arg.wei_k_c_y_x_(k, c, y, x)));
+
+                                    v_acc += v_in * v_wei;
+                                }
                             }
                         }
                     }
-                }
 
-                float v_out;
+                    acc_row[wo] = v_acc;
+                }
 
-                arg.out_element_op_(v_out, v_acc, static_cast<float>(arg.bias_k_(k)));
+                // the bias and the activation are applied to the whole row
+                const std::vector<float> bias_row(Wo, static_cast<float>(arg.bias_k_(k)));
+                std::vector<float> out_row(Wo);
+                host_element_wise::apply_element_wise(
+                    arg.out_element_op_, Wo, out_row.data(), acc_row.data(), bias_row.data());
 
-                arg.out_n_k_ho_wo_(n, k, ho, wo) = v_out;
+                for(std::size_t wo = 0; wo < Wo; ++wo)
+                {
+                    arg.out_n_k_ho_wo_(n, k, ho, wo) = out_row[wo];
+                }
             };
 
-            make_ParallelTensorFunctor(f_nchw,
+            make_ParallelTensorFunctor(f_nkh,
                                        arg.out_n_k_ho_wo_.mDesc.GetLengths()[0],
                                        arg.out_n_k_ho_wo_.mDesc.GetLengths()[1],
-                                       arg.out_n_k_ho_wo_.mDesc.GetLengths()[2],
-                                       arg.out_n_k_ho_wo_.mDesc.GetLengths()[3])(
+                                       arg.out_n_k_ho_wo_.mDesc.GetLengths()[2])(
                 std::thread::hardware_concurrency());
             return 0;
         }
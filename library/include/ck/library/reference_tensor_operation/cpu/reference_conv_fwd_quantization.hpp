@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_int8_gemm.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// Reference of the int8 forward convolutions with a requantized output:
+//     out[g, n, k, wos] = out_element_op(acc[g, n, k, wos], ds[g, n, k, wos]...)
+// acc is the int32 convolution of in and wei, computed exactly by host_int8_gemm::Conv. The
+// output operation (e.g. Add_Activation_Mul2_Clamp with the bias and requantization scales as
+// ds) is applied to every row of K outputs as soon as it is computed, the int32 convolution is
+// not stored.
+//
+// input descriptor in [G, N, C, Di, Hi, Wi] order
+// weight descriptor in [G, K, C, Z, Y, X] order
+// output and ds descriptors in [G, N, K, Do, Ho, Wo] order
+template <ck::index_t NDimSpatial,
+          typename OutDataType,
+          typename OutElementwiseOperation,
+          typename... DsDataType>
+struct ReferenceConvFwdQuantization : public device::BaseOperator
+{
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<int8_t>& input,
+                 const Tensor<int8_t>& weight,
+                 Tensor<OutDataType>& output,
+                 std::vector<ck::long_index_t> conv_filter_strides,
+                 std::vector<ck::long_index_t> conv_filter_dilations,
+                 std::vector<ck::long_index_t> input_left_pads,
+                 std::vector<ck::long_index_t> input_right_pads,
+                 OutElementwiseOperation out_element_op,
+                 const Tensor<DsDataType>&... ds)
+            : input_{input},
+              weight_{weight},
+              output_{output},
+              ds_{ds...},
+              conv_strides_{conv_filter_strides},
+              conv_dilations_{conv_filter_dilations},
+              in_left_pads_{input_left_pads},
+              in_right_pads_{input_right_pads},
+              out_element_op_{out_element_op}
+        {
+        }
+
+        const Tensor<int8_t>& input_;
+        const Tensor<int8_t>& weight_;
+        Tensor<OutDataType>& output_;
+        std::tuple<const Tensor<DsDataType>&...> ds_;
+
+        std::vector<ck::long_index_t> conv_strides_;
+        std::vector<ck::long_index_t> conv_dilations_;
+        std::vector<ck::long_index_t> in_left_pads_;
+        std::vector<ck::long_index_t> in_right_pads_;
+
+        OutElementwiseOperation out_element_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceConvFwdQuantization::Argument;
+
+        template <std::size_t... Os, std::size_t... Is>
+        static void RunOutputElementwiseOp(const Argument& arg,
+                                           int32_t v_acc,
+                                           std::size_t g,
+                                           std::size_t n,
+                                           std::size_t k,
+                                           const std::array<std::size_t, NDimSpatial>& o,
+                                           std::index_sequence<Os...>,
+                                           std::index_sequence<Is...>)
+        {
+            arg.out_element_op_(
+                arg.output_(g, n, k, o[Os]...), v_acc, std::get<Is>(arg.ds_)(g, n, k, o[Os]...)...);
+        }
+
+        float Run(const Argument& arg)
+        {
+            if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
+                 arg.weight_.GetNumOfDimension() == NDimSpatial + 3 &&
+                 arg.output_.GetNumOfDimension() == NDimSpatial + 3))
+            {
+                throw std::runtime_error("wrong! inconsistent dimension");
+            }
+
+            host_int8_gemm::Conv<NDimSpatial>(
+                arg.input_,
+                arg.weight_,
+                arg.output_.GetLengths(),
+                arg.conv_strides_,
+                arg.conv_dilations_,
+                arg.in_left_pads_,
+                [&](std::size_t g,
+                    std::size_t n,
+                    const std::array<std::size_t, NDimSpatial>& o,
+                    const int32_t* p_acc_row) {
+                    for(std::size_t k = 0; k < arg.output_.GetLengths()[2]; ++k)
+                    {
+                        RunOutputElementwiseOp(arg,
+                                               p_acc_row[k],
+                                               g,
+                                               n,
+                                               k,
+                                               o,
+                                               std::make_index_sequence<NDimSpatial>{},
+                                               std::index_sequence_for<DsDataType...>{});
+                    }
+                });
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /*stream_config*/ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override
+    {
+        return NDimSpatial >= 1 && NDimSpatial <= 3;
+    }
+
+    static auto MakeArgument(const Tensor<int8_t>& input,
+                             const Tensor<int8_t>& weight,
+                             Tensor<OutDataType>& output,
+                             std::vector<ck::long_index_t> conv_filter_strides,
+                             std::vector<ck::long_index_t> conv_filter_dilations,
+                             std::vector<ck::long_index_t> input_left_pads,
+                             std::vector<ck::long_index_t> input_right_pads,
+                             OutElementwiseOperation out_element_op,
+                             const Tensor<DsDataType>&... ds)
+    {
+        return Argument{input,
+                        weight,
+                        output,
+                        conv_filter_strides,
+                        conv_filter_dilations,
+                        input_left_pads,
+                        input_right_pads,
+                        out_element_op,
+                        ds...};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceConvFwdQuantization"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -3,11 +3,18 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/element/combined_element_wise_operation.hpp"
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_element_wise.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 
 namespace ck {
@@ -37,29 +44,186 @@ struct ReferenceElementwise : public device::BaseOperator
     {
         using Argument = ReferenceElementwise::Argument;
 
+        // operand 0 is the output, operand 1 + i is the input i
+        static constexpr index_t NumOperands = NumATensors + 1;
+
+        // Side of the square tiles of a transposition
+        static constexpr std::size_t TileSize = 32;
+
+        // Elements of a row computed by a thread at once, when there is no transposition
+        static constexpr std::size_t RowChunkSize = 1 << 14;
+
+        struct Dim
+        {
+            std::size_t length;
+            std::array<std::size_t, NumOperands> strides;
+        };
+
+        // Dimensions of the output with the strides of every operand, stride 0 for a broadcast
+        // input (of length 1 or of stride 0). Dimensions of length 1 are dropped, the others
+        // are sorted by decreasing output stride and merged when contiguous in every operand
+        static std::vector<Dim> GetCoalescedDims(const Argument& arg)
+        {
+            const auto& lengths = arg.b_tensor_.mDesc.GetLengths();
+
+            std::vector<Dim> dims;
+            for(std::size_t d = 0; d < lengths.size(); ++d)
+            {
+                Dim dim{lengths[d], {}};
+                dim.strides[0] = arg.b_tensor_.mDesc.GetStrides()[d];
+                for(index_t i = 0; i < NumATensors; ++i)
+                {
+                    const auto& a_desc = arg.a_tensors_[i].mDesc;
+                    if(a_desc.GetNumOfDimension() != lengths.size() ||
+                       (a_desc.GetLengths()[d] != lengths[d] && a_desc.GetLengths()[d] != 1))
+                    {
+                        throw std::runtime_error("wrong! inconsistent lengths");
+                    }
+                    dim.strides[i + 1] =
+                        a_desc.GetLengths()[d] == lengths[d] ? a_desc.GetStrides()[d] : 0;
+                }
+                if(dim.length != 1)
+                {
+                    dims.push_back(dim);
+                }
+            }
+
+            std::stable_sort(dims.begin(), dims.end(), [](const Dim& x, const Dim& y) {
+                return x.strides[0] > y.strides[0];
+            });
+
+            std::vector<Dim> coalesced_dims;
+            for(const auto& dim : dims)
+            {
+                if(!coalesced_dims.empty())
+                {
+                    auto& prev = coalesced_dims.back();
+
+                    bool contiguous = true;
+                    for(index_t k = 0; k < NumOperands; ++k)
+                    {
+                        contiguous = contiguous && prev.strides[k] == dim.strides[k] * dim.length;
+                    }
+                    if(contiguous)
+                    {
+                        prev.length *= dim.length;
+                        prev.strides = dim.strides;
+                        continue;
+                    }
+                }
+                coalesced_dims.push_back(dim);
+            }
+
+            if(coalesced_dims.empty())
+            {
+                coalesced_dims.push_back(Dim{1, {}});
+            }
+
+            return coalesced_dims;
+        }
+
+        // Elements [begin, end) of a row starting at the given offsets
+        template <std::size_t... Is>
+        static void RunRow(const Argument& arg,
+                           const std::array<std::size_t, NumOperands>& offsets,
+                           const std::array<std::size_t, NumOperands>& strides,
+                           std::size_t begin,
+                           std::size_t end,
+                           std::index_sequence<Is...>)
+        {
+            BDataType* p_b = arg.b_tensor_.mData.data() + offsets[0];
+            const std::array<const ADataType*, NumATensors> p_as{
+                {(arg.a_tensors_[Is].mData.data() + offsets[Is + 1])...}};
+
+            if(strides[0] == 1 && ((strides[Is + 1] == 1) && ...))
+            {
+                host_element_wise::apply_element_wise(
+                    arg.element_op_, end - begin, p_b + begin, (p_as[Is] + begin)...);
+            }
+            else
+            {
+                for(std::size_t i = begin; i < end; ++i)
+                {
+                    arg.element_op_(p_b[i * strides[0]], p_as[Is][i * strides[Is + 1]]...);
+                }
+            }
+        }
+
         float Run(const Argument& arg)
         {
-            if constexpr(NumATensors == 1)
+            if(arg.b_tensor_.mDesc.GetElementSize() == 0)
             {
-                arg.b_tensor_.ForEach([&](auto& self, auto idx) {
-                    arg.element_op_(self(idx), arg.a_tensors_[0](idx));
-                });
+                return 0;
             }
-            else if constexpr(NumATensors == 2)
+
+            auto dims       = GetCoalescedDims(arg);
+            const Dim inner = dims.back();
+            dims.pop_back();
+
+            // when the first input is contiguous along another dimension than the output, both
+            // are walked by tiles of that dimension and of the inner one
+            Dim tiled{1, {}};
+            if constexpr(NumATensors > 0)
             {
-                arg.b_tensor_.ForEach([&](auto& self, auto idx) {
-                    arg.element_op_(self(idx), arg.a_tensors_[0](idx), arg.a_tensors_[1](idx));
-                });
+                const auto it = std::find_if(
+                    dims.begin(), dims.end(), [](const Dim& dim) { return dim.strides[1] == 1; });
+                if(inner.strides[1] != 1 && it != dims.end())
+                {
+                    tiled = *it;
+                    dims.erase(it);
+                }
             }
-            else if constexpr(NumATensors == 3)
+
+            const std::size_t inner_size      = inner.length;
+            const std::size_t inner_tile_size = tiled.length == 1 ? RowChunkSize : TileSize;
+            const std::size_t num_inner_tiles = (inner_size - 1) / inner_tile_size + 1;
+            const std::size_t num_tiled_tiles = (tiled.length - 1) / TileSize + 1;
+
+            std::size_t num_outer = 1;
+            for(const auto& dim : dims)
             {
-                arg.b_tensor_.ForEach([&](auto& self, auto idx) {
-                    arg.element_op_(self(idx),
-                                    arg.a_tensors_[0](idx),
-                                    arg.a_tensors_[1](idx),
-                                    arg.a_tensors_[2](idx));
-                });
+                num_outer *= dim.length;
             }
+
+            auto f = [&](std::size_t iw) {
+                const std::size_t inner_tile  = iw % num_inner_tiles;
+                const std::size_t tiled_tile  = iw / num_inner_tiles % num_tiled_tiles;
+                const std::size_t inner_begin = inner_tile * inner_tile_size;
+                const std::size_t inner_end   = std::min(inner_begin + inner_tile_size, inner_size);
+                const std::size_t tiled_begin = tiled_tile * TileSize;
+                const std::size_t tiled_end   = std::min(tiled_begin + TileSize, tiled.length);
+
+                std::array<std::size_t, NumOperands> offsets{};
+                std::size_t outer = iw / num_inner_tiles / num_tiled_tiles;
+                for(std::size_t d = dims.size(); d-- > 0;)
+                {
+                    const std::size_t idx = outer % dims[d].length;
+                    outer /= dims[d].length;
+                    for(index_t k = 0; k < NumOperands; ++k)
+                    {
+                        offsets[k] += idx * dims[d].strides[k];
+                    }
+                }
+
+                for(std::size_t t = tiled_begin; t < tiled_end; ++t)
+                {
+                    auto row_offsets = offsets;
+                    for(index_t k = 0; k < NumOperands; ++k)
+                    {
+                        row_offsets[k] += t * tiled.strides[k];
+                    }
+                    RunRow(arg,
+                           row_offsets,
+                           inner.strides,
+                           inner_begin,
+                           inner_end,
+                           std::make_index_sequence<NumATensors>{});
+                }
+            };
+
+            make_ParallelTensorFunctor(f, num_outer * num_tiled_tiles * num_inner_tiles)(
+                std::thread::hardware_concurrency());
+
             return 0;
         }
 
@@ -1,13 +1,16 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_element_wise.hpp"
+#include "ck/library/utility/host_int8_gemm.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 
 namespace ck {
@@ -52,57 +55,100 @@ struct ReferenceGemm : public device::BaseOperator
         CElementwiseOperation c_element_op_;
     };
 
+    static constexpr bool IsInt8Gemm = host_int8_gemm::IsInt8Gemm<ADataType,
+                                                                  BDataType,
+                                                                  AccDataType,
+                                                                  AElementwiseOperation,
+                                                                  BElementwiseOperation>;
+
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
         using Argument = ReferenceGemm::Argument;
 
-        float Run(const Argument& arg)
+        // Computes c_m_n_(m, n), Run computes all the elements. Also used alone to evaluate the
+        // reference at a few elements only (see check_err_sampled).
+        static void RunElement(const Argument& arg, std::size_t m, std::size_t n)
         {
-            auto f_mk_kn_mn = [&](auto m, auto n) {
-                const int K = arg.a_m_k_.mDesc.GetLengths()[1];
+            const int K = arg.a_m_k_.mDesc.GetLengths()[1];
 
-                AccDataType v_acc = 0;
-                ComputeTypeA v_a  = 0;
-                ComputeTypeB v_b  = 0;
+            AccDataType v_acc = 0;
+            ComputeTypeA v_a  = 0;
+            ComputeTypeB v_b  = 0;
 
-                for(int k = 0; k < K; ++k)
+            for(int k = 0; k < K; ++k)
+            {
+                // use PassThrough instead of ConvertBF16RTN for reference calculation
+                if constexpr(is_same_v<AElementwiseOperation,
+                                       ck::tensor_operation::element_wise::ConvertBF16RTN>)
                 {
-                    // use PassThrough instead of ConvertBF16RTN for reference calculation
-                    if constexpr(is_same_v<AElementwiseOperation,
-                                           ck::tensor_operation::element_wise::ConvertBF16RTN>)
-                    {
-                        ck::tensor_operation::element_wise::PassThrough{}(v_a, arg.a_m_k_(m, k));
-                    }
-                    else
-                    {
-                        arg.a_element_op_(v_a, arg.a_m_k_(m, k));
-                    }
-                    // same for B matrix
-                    if constexpr(is_same_v<BElementwiseOperation,
-                                           ck::tensor_operation::element_wise::ConvertBF16RTN>)
-                    {
-                        ck::tensor_operation::element_wise::PassThrough{}(v_b, arg.b_k_n_(k, n));
-                    }
-                    else
-                    {
-                        arg.b_element_op_(v_b, arg.b_k_n_(k, n));
-                    }
-
-                    v_acc +=
-                        ck::type_convert<AccDataType>(v_a) * ck::type_convert<AccDataType>(v_b);
+                    ck::tensor_operation::element_wise::PassThrough{}(v_a, arg.a_m_k_(m, k));
+                }
+                else
+                {
+                    arg.a_element_op_(v_a, arg.a_m_k_(m, k));
+                }
+                // same for B matrix
+                if constexpr(is_same_v<BElementwiseOperation,
+                                       ck::tensor_operation::element_wise::ConvertBF16RTN>)
+                {
+                    ck::tensor_operation::element_wise::PassThrough{}(v_b, arg.b_k_n_(k, n));
+                }
+                else
+                {
+                    arg.b_element_op_(v_b, arg.b_k_n_(k, n));
                 }
 
-                CDataType v_c = 0;
+                v_acc += ck::type_convert<AccDataType>(v_a) * ck::type_convert<AccDataType>(v_b);
+            }
 
-                arg.c_element_op_(v_c, v_acc);
+            CDataType v_c = 0;
 
-                arg.c_m_n_(m, n) = v_c;
-            };
+            arg.c_element_op_(v_c, v_acc);
 
-            make_ParallelTensorFunctor(
-                f_mk_kn_mn, arg.c_m_n_.mDesc.GetLengths()[0], arg.c_m_n_.mDesc.GetLengths()[1])(
-                std::thread::hardware_concurrency());
+            arg.c_m_n_(m, n) = v_c;
+        }
+
+        // Same result as RunElement for all the elements, the epilogue is applied to rows of C
+        static void RunInt8(const Argument& arg)
+        {
+            const std::size_t M = arg.c_m_n_.mDesc.GetLengths()[0];
+            const std::size_t N = arg.c_m_n_.mDesc.GetLengths()[1];
+            const std::size_t K = arg.a_m_k_.mDesc.GetLengths()[1];
+
+            const auto a = host_int8_gemm::Pack(
+                M, K, [&](std::size_t m, std::size_t k) { return arg.a_m_k_(m, k); });
+            const auto b = host_int8_gemm::Pack(
+                N, K, [&](std::size_t n, std::size_t k) { return arg.b_k_n_(k, n); });
+
+            host_int8_gemm::Gemm(
+                a.data(), b.data(), M, N, K, [&](std::size_t m, const int32_t* p_acc_row) {
+                    std::vector<CDataType> c_row(N);
+                    host_element_wise::apply_element_wise(
+                        arg.c_element_op_, N, c_row.data(), p_acc_row);
+
+                    for(std::size_t n = 0; n < N; ++n)
+                    {
+                        arg.c_m_n_(m, n) = c_row[n];
+                    }
+                });
+        }
+
+        float Run(const Argument& arg)
+        {
+            if constexpr(IsInt8Gemm)
+            {
+                RunInt8(arg);
+            }
+            else
+            {
+                auto f_mk_kn_mn = [&](auto m, auto n) { RunElement(arg, m, n); };
+
+                make_ParallelTensorFunctor(f_mk_kn_mn,
+                                           arg.c_m_n_.mDesc.GetLengths()[0],
+                                           arg.c_m_n_.mDesc.GetLengths()[1])(
+                    std::thread::hardware_concurrency());
+            }
 
             return 0;
         }
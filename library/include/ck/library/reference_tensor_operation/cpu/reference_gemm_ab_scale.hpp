@@ -0,0 +1,318 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_element_wise.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// Reference of DeviceGemmMultipleD_ABScale (block-scaled GEMM of quantized A and B):
+//
+//   e(m, n) = cde_op(sum over the K blocks kb of
+//                    a1(m / ScaleBlockM, kb) * b1(kb, n / ScaleBlockN) *
+//                    sum over k in kb of a0(m, k) * b0(k, n))
+//
+// with blocks of scale_block_k elements along K. Row/column-wise scaling (e.g. the scales of
+// gemm_multiply_multiply) is the case scale_block_m = scale_block_n = 1, scale_block_k = K, with
+// [M, 1] and [1, N] scales.
+//
+// The scales are applied to the partial sums of the K blocks, as on the device, so that A and B
+// are never materialized scaled or in AccDataType: tiles of a0 and b0 are converted to AccDataType
+// when they are used (through tables for the 8-bit types) and reused by a block of rows or
+// columns. Blocks of RowBlockSize rows of E are computed by the CPU threads.
+template <typename A0DataType,
+          typename A1DataType,
+          typename B0DataType,
+          typename B1DataType,
+          typename EDataType,
+          typename AccDataType,
+          typename CDEElementwiseOperation>
+struct ReferenceGemmABScale : public device::BaseOperator
+{
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<A0DataType>& a0_m_k,
+                 const Tensor<A1DataType>& a1_m_k,
+                 const Tensor<B0DataType>& b0_k_n,
+                 const Tensor<B1DataType>& b1_k_n,
+                 Tensor<EDataType>& e_m_n,
+                 std::size_t scale_block_m,
+                 std::size_t scale_block_n,
+                 std::size_t scale_block_k,
+                 CDEElementwiseOperation cde_element_op)
+            : a0_m_k_{a0_m_k},
+              a1_m_k_{a1_m_k},
+              b0_k_n_{b0_k_n},
+              b1_k_n_{b1_k_n},
+              e_m_n_{e_m_n},
+              scale_block_m_{scale_block_m},
+              scale_block_n_{scale_block_n},
+              scale_block_k_{scale_block_k},
+              cde_element_op_{cde_element_op}
+        {
+        }
+
+        const Tensor<A0DataType>& a0_m_k_;
+        const Tensor<A1DataType>& a1_m_k_;
+        const Tensor<B0DataType>& b0_k_n_;
+        const Tensor<B1DataType>& b1_k_n_;
+        Tensor<EDataType>& e_m_n_;
+
+        std::size_t scale_block_m_;
+        std::size_t scale_block_n_;
+        std::size_t scale_block_k_;
+
+        CDEElementwiseOperation cde_element_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceGemmABScale::Argument;
+
+        // Rows of E computed by a thread at once
+        static constexpr std::size_t RowBlockSize = 32;
+
+        // Columns of the tiles of b0
+        static constexpr std::size_t ColumnBlockSize = 64;
+
+        // Independent accumulators of a dot product
+        static constexpr std::size_t NumLanes = 8;
+
+        // Conversion of the elements of T to AccDataType, by table for the 8-bit types
+        template <typename T>
+        struct Converter
+        {
+            Converter()
+            {
+                if constexpr(sizeof(T) == 1)
+                {
+                    for(std::size_t i = 0; i < table_.size(); ++i)
+                    {
+                        const auto bits = static_cast<uint8_t>(i);
+                        T x;
+                        std::memcpy(&x, &bits, 1);
+                        table_[i] = ck::type_convert<AccDataType>(x);
+                    }
+                }
+            }
+
+            AccDataType operator()(const T& x) const
+            {
+                if constexpr(sizeof(T) == 1)
+                {
+                    uint8_t bits;
+                    std::memcpy(&bits, &x, 1);
+                    return table_[bits];
+                }
+                else
+                {
+                    return ck::type_convert<AccDataType>(x);
+                }
+            }
+
+            std::array<AccDataType, (sizeof(T) == 1 ? 256 : 0)> table_;
+        };
+
+        static AccDataType Dot(const AccDataType* p_a, const AccDataType* p_b, std::size_t length)
+        {
+            AccDataType acc[NumLanes] = {};
+
+            std::size_t k = 0;
+            for(; k + NumLanes <= length; k += NumLanes)
+            {
+                for(std::size_t l = 0; l < NumLanes; ++l)
+                {
+                    acc[l] += p_a[k + l] * p_b[k + l];
+                }
+            }
+            for(; k < length; ++k)
+            {
+                acc[0] += p_a[k] * p_b[k];
+            }
+
+            AccDataType sum = 0;
+            for(std::size_t l = 0; l < NumLanes; ++l)
+            {
+                sum += acc[l];
+            }
+            return sum;
+        }
+
+        float Run(const Argument& arg)
+        {
+            const std::size_t M = arg.e_m_n_.mDesc.GetLengths()[0];
+            const std::size_t N = arg.e_m_n_.mDesc.GetLengths()[1];
+            const std::size_t K = arg.a0_m_k_.mDesc.GetLengths()[1];
+
+            const std::size_t block_m = arg.scale_block_m_;
+            const std::size_t block_n = arg.scale_block_n_;
+            const std::size_t block_k = arg.scale_block_k_;
+
+            if(block_m == 0 || block_n == 0 || block_k == 0 ||
+               arg.a1_m_k_.mDesc.GetLengths()[0] != (M + block_m - 1) / block_m ||
+               arg.a1_m_k_.mDesc.GetLengths()[1] != (K + block_k - 1) / block_k ||
+               arg.b1_k_n_.mDesc.GetLengths()[0] != (K + block_k - 1) / block_k ||
+               arg.b1_k_n_.mDesc.GetLengths()[1] != (N + block_n - 1) / block_n)
+            {
+                throw std::runtime_error("wrong! inconsistent scale lengths");
+            }
+
+            const Converter<A0DataType> convert_a;
+            const Converter<B0DataType> convert_b;
+
+            const auto& a_strides = arg.a0_m_k_.mDesc.GetStrides();
+            const auto& b_strides = arg.b0_k_n_.mDesc.GetStrides();
+
+            auto f_row_block = [&](std::size_t row_block) {
+                const std::size_t m_begin  = row_block * RowBlockSize;
+                const std::size_t num_rows = std::min(RowBlockSize, M - m_begin);
+
+                std::vector<AccDataType> c(num_rows * N, 0);
+                std::vector<AccDataType> a_tile(num_rows * block_k);
+                std::vector<AccDataType> b_tile(ColumnBlockSize * block_k);
+
+                for(std::size_t k_begin = 0; k_begin < K; k_begin += block_k)
+                {
+                    const std::size_t kb     = k_begin / block_k;
+                    const std::size_t length = std::min(block_k, K - k_begin);
+
+                    for(std::size_t r = 0; r < num_rows; ++r)
+                    {
+                        const A0DataType* p_a = arg.a0_m_k_.mData.data() +
+                                                (m_begin + r) * a_strides[0] +
+                                                k_begin * a_strides[1];
+                        for(std::size_t k = 0; k < length; ++k)
+                        {
+                            a_tile[r * length + k] = convert_a(p_a[k * a_strides[1]]);
+                        }
+                    }
+
+                    for(std::size_t n_begin = 0; n_begin < N; n_begin += ColumnBlockSize)
+                    {
+                        const std::size_t num_columns = std::min(ColumnBlockSize, N - n_begin);
+
+                        for(std::size_t j = 0; j < num_columns; ++j)
+                        {
+                            const B0DataType* p_b = arg.b0_k_n_.mData.data() +
+                                                    k_begin * b_strides[0] +
+                                                    (n_begin + j) * b_strides[1];
+                            for(std::size_t k = 0; k < length; ++k)
+                            {
+                                b_tile[j * length + k] = convert_b(p_b[k * b_strides[0]]);
+                            }
+                        }
+
+                        for(std::size_t r = 0; r < num_rows; ++r)
+                        {
+                            const auto a_scale = ck::type_convert<AccDataType>(
+                                arg.a1_m_k_((m_begin + r) / block_m, kb));
+
+                            for(std::size_t j = 0; j < num_columns; ++j)
+                            {
+                                const auto b_scale = ck::type_convert<AccDataType>(
+                                    arg.b1_k_n_(kb, (n_begin + j) / block_n));
+
+                                c[r * N + n_begin + j] +=
+                                    a_scale * b_scale *
+                                    Dot(&a_tile[r * length], &b_tile[j * length], length);
+                            }
+                        }
+                    }
+                }
+
+                std::vector<EDataType> e_row(N);
+                for(std::size_t r = 0; r < num_rows; ++r)
+                {
+                    host_element_wise::apply_element_wise(
+                        arg.cde_element_op_, N, e_row.data(), &c[r * N]);
+
+                    for(std::size_t n = 0; n < N; ++n)
+                    {
+                        arg.e_m_n_(m_begin + r, n) = e_row[n];
+                    }
+                }
+            };
+
+            make_ParallelTensorFunctor(f_row_block, (M + RowBlockSize - 1) / RowBlockSize)(
+                std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const Tensor<A0DataType>& a0_m_k,
+                             const Tensor<A1DataType>& a1_m_k,
+                             const Tensor<B0DataType>& b0_k_n,
+                             const Tensor<B1DataType>& b1_k_n,
+                             Tensor<EDataType>& e_m_n,
+                             std::size_t scale_block_m,
+                             std::size_t scale_block_n,
+                             std::size_t scale_block_k,
+                             CDEElementwiseOperation cde_element_op)
+    {
+        return Argument{a0_m_k,
+                        a1_m_k,
+                        b0_k_n,
+                        b1_k_n,
+                        e_m_n,
+                        scale_block_m,
+                        scale_block_n,
+                        scale_block_k,
+                        cde_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceGemmABScale"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
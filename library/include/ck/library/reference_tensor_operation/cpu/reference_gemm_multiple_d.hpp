@@ -3,11 +3,16 @@
 
 #pragma once
 
+#include <array>
 #include <iostream>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_element_wise.hpp"
+#include "ck/library/utility/host_int8_gemm.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 
 namespace ck {
@@ -58,72 +63,149 @@ struct ReferenceGemmMultipleD : public device::BaseOperator
         CDEElementwiseOperation cde_element_op_;
     };
 
+    static constexpr bool IsInt8Gemm = host_int8_gemm::IsInt8Gemm<ADataType,
+                                                                  BDataType,
+                                                                  AccDataType,
+                                                                  AElementwiseOperation,
+                                                                  BElementwiseOperation>;
+
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
         using Argument = ReferenceGemmMultipleD::Argument;
 
-        float Run(const Argument& arg)
+        // Row m of D i, as a contiguous span, gathered in d_row if needed
+        static const DDataType*
+        GetDRow(const Argument& arg, std::size_t i, std::size_t m, std::vector<DDataType>& d_row)
         {
-            auto f_mk_kn_mn = [&](auto m, auto n) {
-                const int K = arg.a_m_k_.mDesc.GetLengths()[1];
+            const auto& d_m_n = arg.ds_m_n_[i];
+            if(d_m_n.mDesc.GetStrides()[1] == 1)
+            {
+                return d_m_n.mData.data() + d_m_n.mDesc.GetOffsetFromMultiIndex(m, 0);
+            }
+
+            for(std::size_t n = 0; n < d_row.size(); ++n)
+            {
+                d_row[n] = d_m_n(m, n);
+            }
+            return d_row.data();
+        }
 
-                AccDataType v_acc = 0;
-                ComputeTypeA v_a  = 0;
-                ComputeTypeB v_b  = 0;
+        template <std::size_t... Is>
+        static float Run(const Argument& arg, std::index_sequence<Is...>)
+        {
+            const std::size_t N = arg.c_m_n_.mDesc.GetLengths()[1];
+
+            auto f_mk_kn_m = [&](auto m) {
+                const int K = arg.a_m_k_.mDesc.GetLengths()[1];
 
-                for(int k = 0; k < K; ++k)
+                std::vector<AccDataType> acc_row(N);
+                for(std::size_t n = 0; n < N; ++n)
                 {
-                    // use PassThrough instead of ConvertBF16RTN for reference calculation
-                    if constexpr(is_same_v<AElementwiseOperation,
-                                           ck::tensor_operation::element_wise::ConvertBF16RTN>)
-                    {
-                        ck::tensor_operation::element_wise::PassThrough{}(v_a, arg.a_m_k_(m, k));
-                    }
-                    else
-                    {
-                        arg.a_element_op_(v_a, arg.a_m_k_(m, k));
-                    }
-                    // same for B matrix
-                    if constexpr(is_same_v<BElementwiseOperation,
-                                           ck::tensor_operation::element_wise::ConvertBF16RTN>)
-                    {
-                        ck::tensor_operation::element_wise::PassThrough{}(v_b, arg.b_k_n_(k, n));
-                    }
-                    else
+                    AccDataType v_acc = 0;
+                    ComputeTypeA v_a  = 0;
+                    ComputeTypeB v_b  = 0;
+
+                    for(int k = 0; k < K; ++k)
                     {
-                        arg.b_element_op_(v_b, arg.b_k_n_(k, n));
+                        // use PassThrough instead of ConvertBF16RTN for reference calculation
+                        if constexpr(is_same_v<AElementwiseOperation,
+                                               ck::tensor_operation::element_wise::ConvertBF16RTN>)
+                        {
+                            ck::tensor_operation::element_wise::PassThrough{}(v_a,
+                                                                              arg.a_m_k_(m, k));
+                        }
+                        else
+                        {
+                            arg.a_element_op_(v_a, arg.a_m_k_(m, k));
+                        }
+                        // same for B matrix
+                        if constexpr(is_same_v<BElementwiseOperation,
+                                               ck::tensor_operation::element_wise::ConvertBF16RTN>)
+                        {
+                            ck::tensor_operation::element_wise::PassThrough{}(v_b,
+                                                                              arg.b_k_n_(k, n));
+                        }
+                        else
+                        {
+                            arg.b_element_op_(v_b, arg.b_k_n_(k, n));
+                        }
+
+                        v_acc +=
+                            ck::type_convert<AccDataType>(v_a) * ck::type_convert<AccDataType>(v_b);
                     }
 
-                    v_acc +=
-                        ck::type_convert<AccDataType>(v_a) * ck::type_convert<AccDataType>(v_b);
+                    acc_row[n] = v_acc;
                 }
 
-                CDataType v_c = 0;
-
-                if constexpr(DsDataType::Size() == 0)
-                {
-                    arg.cde_element_op_(v_c, v_acc);
-                }
-                else if constexpr(DsDataType::Size() == 1)
-                {
-                    arg.cde_element_op_(v_c, v_acc, arg.ds_m_n_[0](m, n));
-                }
-                else if constexpr(DsDataType::Size() == 2)
-                {
-                    arg.cde_element_op_(v_c, v_acc, arg.ds_m_n_[0](m, n), arg.ds_m_n_[1](m, n));
-                }
-
-                arg.c_m_n_(m, n) = v_c;
+                RunEpilogue(arg, m, acc_row.data(), std::index_sequence<Is...>{});
             };
 
-            make_ParallelTensorFunctor(
-                f_mk_kn_mn, arg.c_m_n_.mDesc.GetLengths()[0], arg.c_m_n_.mDesc.GetLengths()[1])(
+            make_ParallelTensorFunctor(f_mk_kn_m, arg.c_m_n_.mDesc.GetLengths()[0])(
                 std::thread::hardware_concurrency());
 
             return 0;
         }
 
+        // Applies the epilogue to the whole row m of C
+        template <std::size_t... Is>
+        static void RunEpilogue(const Argument& arg,
+                                std::size_t m,
+                                const AccDataType* p_acc_row,
+                                std::index_sequence<Is...>)
+        {
+            const std::size_t N = arg.c_m_n_.mDesc.GetLengths()[1];
+
+            std::array<std::vector<DDataType>, DsDataType::Size()> ds_row;
+            for(auto& d_row : ds_row)
+            {
+                d_row.resize(N);
+            }
+            std::vector<CDataType> c_row(N);
+
+            host_element_wise::apply_element_wise(arg.cde_element_op_,
+                                                  N,
+                                                  c_row.data(),
+                                                  p_acc_row,
+                                                  GetDRow(arg, Is, m, ds_row[Is])...);
+
+            for(std::size_t n = 0; n < N; ++n)
+            {
+                arg.c_m_n_(m, n) = c_row[n];
+            }
+        }
+
+        template <std::size_t... Is>
+        static void RunInt8(const Argument& arg, std::index_sequence<Is...>)
+        {
+            const std::size_t M = arg.c_m_n_.mDesc.GetLengths()[0];
+            const std::size_t N = arg.c_m_n_.mDesc.GetLengths()[1];
+            const std::size_t K = arg.a_m_k_.mDesc.GetLengths()[1];
+
+            const auto a = host_int8_gemm::Pack(
+                M, K, [&](std::size_t m, std::size_t k) { return arg.a_m_k_(m, k); });
+            const auto b = host_int8_gemm::Pack(
+                N, K, [&](std::size_t n, std::size_t k) { return arg.b_k_n_(k, n); });
+
+            host_int8_gemm::Gemm(
+                a.data(), b.data(), M, N, K, [&](std::size_t m, const int32_t* p_acc_row) {
+                    RunEpilogue(arg, m, p_acc_row, std::index_sequence<Is...>{});
+                });
+        }
+
+        float Run(const Argument& arg)
+        {
+            if constexpr(IsInt8Gemm)
+            {
+                RunInt8(arg, std::make_index_sequence<DsDataType::Size()>{});
+                return 0;
+            }
+            else
+            {
+                return Run(arg, std::make_index_sequence<DsDataType::Size()>{});
+            }
+        }
+
         float Run(const device::BaseArgument* p_arg,
                   const StreamConfig& /* stream_config */ = StreamConfig{}) override
         {
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -11,6 +11,7 @@
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_normalization.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -53,9 +54,9 @@ struct ReferenceGroupnorm : public device::BaseOperator
         {
         }
 
-        const Tensor<XDataType> x_;
-        const Tensor<XDataType> gamma_;
-        const Tensor<XDataType> beta_;
+        const Tensor<XDataType>& x_;
+        const Tensor<GammaDataType>& gamma_;
+        const Tensor<BetaDataType>& beta_;
         Tensor<YDataType>& y_;
         Tensor<SaveMeanInvStdDataType>& save_mean_;
         Tensor<SaveMeanInvStdDataType>& save_inv_std_;
@@ -67,87 +68,94 @@ struct ReferenceGroupnorm : public device::BaseOperator
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
+        // H, W, C
+        static std::vector<int> GetReduceDims() { return {1, 2, 4}; }
+
+        // x, y, gamma, beta, save_mean, save_inv_std
+        static auto MakeNormalizationSpace(const Argument& arg)
+        {
+            using ck::host_normalization::expand_strides;
+
+            const std::vector<int> gamma_beta_dims{3, 4};   // G, C
+            const std::vector<int> mean_inv_std_dims{0, 3}; // N, G
+
+            return ck::host_normalization::make_normalization_space<6>(
+                arg.lengths_,
+                GetReduceDims(),
+                {arg.x_.GetStrides(),
+                 arg.y_.GetStrides(),
+                 expand_strides(5, gamma_beta_dims, arg.gamma_.GetStrides()),
+                 expand_strides(5, gamma_beta_dims, arg.beta_.GetStrides()),
+                 expand_strides(5, mean_inv_std_dims, arg.save_mean_.GetStrides()),
+                 expand_strides(5, mean_inv_std_dims, arg.save_inv_std_.GetStrides())});
+        }
+
+        // Normalizes the group of the element idx (n, h, w, g, c) of y (all the elements of the
+        // group, its mean and inv_std), Run normalizes all the groups. The cost is the one of a
+        // single group, it is also used alone to evaluate the reference at a few elements (see
+        // check_err_sampled).
+        template <typename Index>
+        static void RunRow(const Argument& arg, const Index& idx)
+        {
+            const auto space = MakeNormalizationSpace(arg);
+            const std::size_t row =
+                ck::host_normalization::get_row_of_element(arg.lengths_, GetReduceDims(), idx);
+
+            const auto welford = ck::host_normalization::welford_row<ComputeDataType>(
+                space, row, arg.x_.mData.data());
+
+            const ComputeDataType mean = welford.mean;
+            const ComputeDataType inv_std =
+                static_cast<ComputeDataType>(1) /
+                ck::math::sqrt(welford.GetVariance() + arg.epsilon_);
+
+            const auto offsets                  = space.rows.GetOffsets(row);
+            arg.save_mean_.mData[offsets[4]]    = ck::type_convert<SaveMeanInvStdDataType>(mean);
+            arg.save_inv_std_.mData[offsets[5]] = ck::type_convert<SaveMeanInvStdDataType>(inv_std);
+
+            ck::host_normalization::normalize_row(space,
+                                                  row,
+                                                  mean,
+                                                  inv_std,
+                                                  arg.x_.mData.data(),
+                                                  arg.gamma_.mData.data(),
+                                                  arg.beta_.mData.data(),
+                                                  arg.y_.mData.data(),
+                                                  arg.y_elementwise_op_);
+        }
+
         float Run(const Argument& arg)
         {
-            int N = arg.lengths_[0];
-            int H = arg.lengths_[1];
-            int W = arg.lengths_[2];
-            int G = arg.lengths_[3];
-            int C = arg.lengths_[4];
-
-            Tensor<ComputeDataType> mean({N, G});
-            Tensor<ComputeDataType> var({N, G});
-
-            // Compute mean & var in [H, W, C] by Welford Algorithm
-            // TODO - parallel for each HWC
-            // TODO - address calculation
-            for(int n = 0; n < N; ++n)
-            {
-                for(int g = 0; g < G; ++g)
-                {
-                    ComputeDataType mean_val = type_convert<ComputeDataType>(0.0f);
-                    ComputeDataType var_val  = type_convert<ComputeDataType>(0.0f);
-                    int32_t curr_count       = 0;
-
-                    for(int h = 0; h < H; ++h)
-                    {
-                        for(int w = 0; w < W; ++w)
-                        {
-                            for(int c = 0; c < C; ++c)
-                            {
-                                curr_count++;
-                                ComputeDataType x =
-                                    type_convert<ComputeDataType>(arg.x_(n, h, w, g, c));
-                                ComputeDataType delta = x - mean_val;
-                                mean_val += delta / curr_count;
-                                ComputeDataType delta2 = x - mean_val;
-                                var_val += delta * delta2;
-                            }
-                        }
-                    }
-
-                    mean(n, g) = mean_val;
-                    var(n, g)  = var_val / curr_count;
-
-                    arg.save_mean_(n, g) = ck::type_convert<SaveMeanInvStdDataType>(mean(n, g));
-
-                    ComputeDataType divisor =
-                        static_cast<ComputeDataType>(1) / ck::math::sqrt(var(n, g) + arg.epsilon_);
-                    arg.save_inv_std_(n, g) = ck::type_convert<SaveMeanInvStdDataType>(divisor);
-                }
-            }
+            const auto space = MakeNormalizationSpace(arg);
 
-            // Normalization
-            for(int n = 0; n < N; ++n)
+            const auto welford =
+                ck::host_normalization::welford_rows<ComputeDataType>(space, arg.x_.mData.data());
+
+            std::vector<ComputeDataType> mean(welford.size());
+            std::vector<ComputeDataType> inv_std(welford.size());
+
+            for(std::size_t row = 0; row < welford.size(); ++row)
             {
-                for(int h = 0; h < H; ++h)
-                {
-                    for(int w = 0; w < W; ++w)
-                    {
-                        for(int g = 0; g < G; ++g)
-                        {
-                            for(int c = 0; c < C; ++c)
-                            {
-                                ComputeDataType x =
-                                    type_convert<ComputeDataType>(arg.x_(n, h, w, g, c));
-                                ComputeDataType gamma =
-                                    type_convert<ComputeDataType>(arg.gamma_(g, c));
-                                ComputeDataType beta =
-                                    type_convert<ComputeDataType>(arg.beta_(g, c));
-                                ComputeDataType mean_val =
-                                    type_convert<ComputeDataType>(mean(n, g));
-                                ComputeDataType var_val = type_convert<ComputeDataType>(var(n, g));
-                                ComputeDataType y       = gamma * (x - mean_val) /
-                                                        ck::math::sqrt(arg.epsilon_ + var_val) +
-                                                    beta;
-                                arg.y_elementwise_op_(y, y);
-                                arg.y_(n, h, w, g, c) = type_convert<YDataType>(y);
-                            }
-                        }
-                    }
-                }
+                mean[row]    = welford[row].mean;
+                inv_std[row] = static_cast<ComputeDataType>(1) /
+                               ck::math::sqrt(welford[row].GetVariance() + arg.epsilon_);
+
+                const auto offsets = space.rows.GetOffsets(row);
+                arg.save_mean_.mData[offsets[4]] =
+                    ck::type_convert<SaveMeanInvStdDataType>(mean[row]);
+                arg.save_inv_std_.mData[offsets[5]] =
+                    ck::type_convert<SaveMeanInvStdDataType>(inv_std[row]);
             }
 
+            ck::host_normalization::normalize_rows(space,
+                                                   mean,
+                                                   inv_std,
+                                                   arg.x_.mData.data(),
+                                                   arg.gamma_.mData.data(),
+                                                   arg.beta_.mData.data(),
+                                                   arg.y_.mData.data(),
+                                                   arg.y_elementwise_op_);
+
             return 0;
         }
 
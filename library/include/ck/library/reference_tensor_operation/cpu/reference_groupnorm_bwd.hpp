@@ -11,6 +11,7 @@
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_normalization.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -91,82 +92,73 @@ struct ReferenceGroupnormBwd : public device::BaseOperator
     {
         float Run(const Argument& arg)
         {
-            int N = arg.lengths_[0];
-            int H = arg.lengths_[1];
-            int W = arg.lengths_[2];
-            int G = arg.lengths_[3];
-            int C = arg.lengths_[4];
-
-            // Calculate dgamma and dbeta
-            for(int g = 0; g < G; ++g)
-                for(int c = 0; c < C; ++c)
-                {
-                    ComputeDataType dgamma = 0;
-                    ComputeDataType dbeta  = 0;
-
-                    for(int n = 0; n < N; ++n)
-                        for(int h = 0; h < H; ++h)
-                            for(int w = 0; w < W; ++w)
-                            {
-                                ComputeDataType dy =
-                                    ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
-                                ComputeDataType x =
-                                    ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
-                                ComputeDataType mean =
-                                    ck::type_convert<ComputeDataType>(arg.mean_ng_(n, g));
-                                ComputeDataType rstd =
-                                    ck::type_convert<ComputeDataType>(arg.inv_std_ng_(n, g));
-                                dgamma += dy * rstd * (x - mean);
-                                dbeta += dy;
-                            }
-                    arg.dgamma_gc_(g, c) = ck::type_convert<DGammaDataType>(dgamma);
-                    arg.dbeta_gc_(g, c)  = ck::type_convert<DBetaDataType>(dbeta);
-                }
+            using ck::host_normalization::expand_strides;
+
+            const std::vector<int> reduce_dims{1, 2, 4};       // H, W, C
+            const std::vector<int> invariant_dims{0, 3};       // N, G
+            const std::vector<int> gamma_beta_dims{3, 4};      // G, C
+            const std::vector<int> gamma_reduce_dims{0, 1, 2}; // N, H, W
+
+            // Calculate dgamma and dbeta, the rows are the dimensions of gamma
+            // dy, x, mean, rstd, dgamma, dbeta
+            const auto gamma_beta_space = ck::host_normalization::make_normalization_space<6>(
+                arg.lengths_,
+                gamma_reduce_dims,
+                {arg.dy_nhwgc_.GetStrides(),
+                 arg.x_nhwgc_.GetStrides(),
+                 expand_strides(5, invariant_dims, arg.mean_ng_.GetStrides()),
+                 expand_strides(5, invariant_dims, arg.inv_std_ng_.GetStrides()),
+                 expand_strides(5, gamma_beta_dims, arg.dgamma_gc_.GetStrides()),
+                 expand_strides(5, gamma_beta_dims, arg.dbeta_gc_.GetStrides())});
+
+            const auto dgamma_dbeta =
+                ck::host_normalization::normalization_bwd_gamma_beta<ComputeDataType>(
+                    gamma_beta_space,
+                    arg.dy_nhwgc_.mData.data(),
+                    arg.x_nhwgc_.mData.data(),
+                    arg.mean_ng_.mData.data(),
+                    arg.inv_std_ng_.mData.data());
+
+            for(std::size_t row = 0; row < dgamma_dbeta.size(); ++row)
+            {
+                const auto offsets = gamma_beta_space.rows.GetOffsets(row);
+                arg.dgamma_gc_.mData[offsets[4]] =
+                    ck::type_convert<DGammaDataType>(dgamma_dbeta[row].sums[0]);
+                arg.dbeta_gc_.mData[offsets[5]] =
+                    ck::type_convert<DBetaDataType>(dgamma_dbeta[row].sums[1]);
+            }
 
             // Calculate dx
-            int reduce_size = H * W * C;
-            for(int n = 0; n < N; ++n)
-                for(int g = 0; g < G; ++g)
-                {
-                    ComputeDataType ds = 0;
-                    ComputeDataType db = 0;
-
-                    ComputeDataType mean = ck::type_convert<ComputeDataType>(arg.mean_ng_(n, g));
-                    ComputeDataType rstd = ck::type_convert<ComputeDataType>(arg.inv_std_ng_(n, g));
-
-                    for(int h = 0; h < H; ++h)
-                        for(int w = 0; w < W; ++w)
-                            for(int c = 0; c < C; ++c)
-                            {
-                                ComputeDataType dy =
-                                    ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
-                                ComputeDataType x =
-                                    ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
-                                ComputeDataType gamma =
-                                    ck::type_convert<ComputeDataType>(arg.gamma_gc_(g, c));
-
-                                ds += dy * gamma * x;
-                                db += dy * gamma;
-                            }
-
-                    for(int h = 0; h < H; ++h)
-                        for(int w = 0; w < W; ++w)
-                            for(int c = 0; c < C; ++c)
-                            {
-                                ComputeDataType dy =
-                                    ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
-                                ComputeDataType x =
-                                    ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
-                                ComputeDataType gamma =
-                                    ck::type_convert<ComputeDataType>(arg.gamma_gc_(g, c));
-
-                                ComputeDataType b =
-                                    (db * mean - ds) * rstd * rstd * rstd / reduce_size;
-                                ComputeDataType c1 = -b * mean - db * rstd / reduce_size;
-                                arg.dx_nhwgc_(n, h, w, g, c) =
-                                    ck::type_convert<DXDataType>(dy * gamma * rstd + b * x + c1);
-                            }
-                }
+            // dy, x, gamma, dx, mean, rstd
+            const auto dx_space = ck::host_normalization::make_normalization_space<6>(
+                arg.lengths_,
+                reduce_dims,
+                {arg.dy_nhwgc_.GetStrides(),
+                 arg.x_nhwgc_.GetStrides(),
+                 expand_strides(5, gamma_beta_dims, arg.gamma_gc_.GetStrides()),
+                 arg.dx_nhwgc_.GetStrides(),
+                 expand_strides(5, invariant_dims, arg.mean_ng_.GetStrides()),
+                 expand_strides(5, invariant_dims, arg.inv_std_ng_.GetStrides())});
+
+            const std::size_t num_row = dx_space.rows.GetSize();
+
+            std::vector<ComputeDataType> mean(num_row);
+            std::vector<ComputeDataType> rstd(num_row);
+
+            for(std::size_t row = 0; row < num_row; ++row)
+            {
+                const auto offsets = dx_space.rows.GetOffsets(row);
+                mean[row] = ck::type_convert<ComputeDataType>(arg.mean_ng_.mData[offsets[4]]);
+                rstd[row] = ck::type_convert<ComputeDataType>(arg.inv_std_ng_.mData[offsets[5]]);
+            }
+
+            ck::host_normalization::normalization_bwd_data(dx_space,
+                                                           mean,
+                                                           rstd,
+                                                           arg.dy_nhwgc_.mData.data(),
+                                                           arg.x_nhwgc_.mData.data(),
+                                                           arg.gamma_gc_.mData.data(),
+                                                           arg.dx_nhwgc_.mData.data());
 
             return 0;
         }
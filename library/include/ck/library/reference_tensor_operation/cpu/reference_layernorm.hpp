@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -11,6 +11,7 @@
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_normalization.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -27,9 +28,7 @@ template <typename XDataType,
           index_t NumReduceDim>
 struct ReferenceLayernorm : public device::BaseOperator
 {
-    // TODO - support generic layernorm
-    static_assert((Rank == 2 && NumReduceDim == 1) || (Rank == 4 && NumReduceDim == 3),
-                  "Only support 2D & 4D version so far");
+    static_assert(NumReduceDim > 0 && NumReduceDim <= Rank, "Invalid NumReduceDim");
 
     // Argument
     struct Argument : public device::BaseArgument
@@ -57,9 +56,9 @@ struct ReferenceLayernorm : public device::BaseOperator
         {
         }
 
-        const Tensor<XDataType> x_m_n_;
-        const Tensor<XDataType> gamma_n_;
-        const Tensor<XDataType> beta_n_;
+        const Tensor<XDataType>& x_m_n_;
+        const Tensor<GammaDataType>& gamma_n_;
+        const Tensor<BetaDataType>& beta_n_;
         Tensor<YDataType>& y_m_n_;
         Tensor<SaveMeanInvStdDataType>& save_mean_m_;
         Tensor<SaveMeanInvStdDataType>& save_inv_std_m_;
@@ -72,113 +71,91 @@ struct ReferenceLayernorm : public device::BaseOperator
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
-        float Run2D(const Argument& arg)
+        // x, y, gamma, beta, save_mean, save_inv_std
+        static auto MakeNormalizationSpace(const Argument& arg)
         {
-            int M = arg.lengths_[0];
-            int N = arg.lengths_[1];
-
-            Tensor<ComputeDataType> mean({M});
-            Tensor<ComputeDataType> var({M});
-
-            for(int m = 0; m < M; ++m)
-            {
-                mean(m) = 0;
-                var(m)  = 0;
-
-                for(int n = 0; n < N; ++n)
-                {
-                    auto x_val = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
-                    mean(m) += x_val;
-                    var(m) += x_val * x_val;
-                }
-
-                mean(m) = mean(m) / N;
-                var(m)  = (var(m) / N) - (mean(m) * mean(m));
-            }
-
-            for(int m = 0; m < M; ++m)
-            {
-                ComputeDataType divisor =
-                    static_cast<ComputeDataType>(1) / ck::math::sqrt(var(m) + arg.epsilon_);
-
-                for(int n = 0; n < N; ++n)
-                {
-                    auto x_val     = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
-                    auto gamma_val = ck::type_convert<ComputeDataType>(arg.gamma_n_(n));
-                    auto beta_val  = ck::type_convert<ComputeDataType>(arg.beta_n_(n));
-                    auto y_val     = (x_val - mean(m)) * divisor;
-                    y_val          = (y_val * gamma_val) + beta_val;
-                    arg.y_elementwise_op_(y_val, y_val);
-                    arg.y_m_n_(m, n) = ck::type_convert<YDataType>(y_val);
-                }
-                arg.save_mean_m_(m)    = ck::type_convert<SaveMeanInvStdDataType>(mean(m));
-                arg.save_inv_std_m_(m) = ck::type_convert<SaveMeanInvStdDataType>(divisor);
-            }
-
-            return 0;
+            using ck::host_normalization::expand_strides;
+            using ck::host_normalization::get_invariant_dims;
+
+            const std::size_t rank    = arg.lengths_.size();
+            const auto invariant_dims = get_invariant_dims(rank, arg.reduceDims_);
+
+            return ck::host_normalization::make_normalization_space<6>(
+                arg.lengths_,
+                arg.reduceDims_,
+                {arg.x_m_n_.GetStrides(),
+                 arg.y_m_n_.GetStrides(),
+                 expand_strides(rank, arg.reduceDims_, arg.gamma_n_.GetStrides()),
+                 expand_strides(rank, arg.reduceDims_, arg.beta_n_.GetStrides()),
+                 expand_strides(rank, invariant_dims, arg.save_mean_m_.GetStrides()),
+                 expand_strides(rank, invariant_dims, arg.save_inv_std_m_.GetStrides())});
         }
 
-        float Run4D(const Argument& arg)
+        // Normalizes the row of the element idx of y (all the elements of the row, its mean and
+        // inv_std), Run normalizes all the rows. The cost is the one of a single row, it is also
+        // used alone to evaluate the reference at a few elements (see check_err_sampled).
+        template <typename Index>
+        static void RunRow(const Argument& arg, const Index& idx)
         {
-            int N = arg.lengths_[0];
-            int H = arg.lengths_[1];
-            int W = arg.lengths_[2];
-            int C = arg.lengths_[3];
+            const auto space = MakeNormalizationSpace(arg);
+            const std::size_t row =
+                ck::host_normalization::get_row_of_element(arg.lengths_, arg.reduceDims_, idx);
+
+            const auto welford = ck::host_normalization::welford_row<ComputeDataType>(
+                space, row, arg.x_m_n_.mData.data());
+
+            const ComputeDataType mean = welford.mean;
+            const ComputeDataType inv_std =
+                static_cast<ComputeDataType>(1) /
+                ck::math::sqrt(welford.GetVariance() + arg.epsilon_);
+
+            const auto offsets                 = space.rows.GetOffsets(row);
+            arg.save_mean_m_.mData[offsets[4]] = ck::type_convert<SaveMeanInvStdDataType>(mean);
+            arg.save_inv_std_m_.mData[offsets[5]] =
+                ck::type_convert<SaveMeanInvStdDataType>(inv_std);
+
+            ck::host_normalization::normalize_row(space,
+                                                  row,
+                                                  mean,
+                                                  inv_std,
+                                                  arg.x_m_n_.mData.data(),
+                                                  arg.gamma_n_.mData.data(),
+                                                  arg.beta_n_.mData.data(),
+                                                  arg.y_m_n_.mData.data(),
+                                                  arg.y_elementwise_op_);
+        }
 
-            Tensor<ComputeDataType> mean({N});
-            Tensor<ComputeDataType> var({N});
+        float Run(const Argument& arg)
+        {
+            const auto space = MakeNormalizationSpace(arg);
 
-            int reduce_length = H * W * C;
+            const auto welford = ck::host_normalization::welford_rows<ComputeDataType>(
+                space, arg.x_m_n_.mData.data());
 
-            for(int n = 0; n < N; ++n)
-            {
-                mean(n) = 0;
-                var(n)  = 0;
-
-                for(int h = 0; h < H; ++h)
-                    for(int w = 0; w < W; ++w)
-                        for(int c = 0; c < C; ++c)
-                        {
-                            auto x_val = ck::type_convert<ComputeDataType>(arg.x_m_n_(n, h, w, c));
-                            mean(n) += x_val;
-                            var(n) += x_val * x_val;
-                        }
-
-                mean(n) = mean(n) / reduce_length;
-                var(n)  = (var(n) / reduce_length) - (mean(n) * mean(n));
-            }
+            std::vector<ComputeDataType> mean(welford.size());
+            std::vector<ComputeDataType> inv_std(welford.size());
 
-            for(int n = 0; n < N; ++n)
+            for(std::size_t row = 0; row < welford.size(); ++row)
             {
-                ComputeDataType divisor =
-                    static_cast<ComputeDataType>(1) / ck::math::sqrt(var(n) + arg.epsilon_);
-
-                for(int h = 0; h < H; ++h)
-                    for(int w = 0; w < W; ++w)
-                        for(int c = 0; c < C; ++c)
-                        {
-                            auto x_val = ck::type_convert<ComputeDataType>(arg.x_m_n_(n, h, w, c));
-                            auto gamma_val =
-                                ck::type_convert<ComputeDataType>(arg.gamma_n_(h, w, c));
-                            auto beta_val = ck::type_convert<ComputeDataType>(arg.beta_n_(h, w, c));
-                            auto y_val    = (x_val - mean(n)) * divisor;
-                            y_val         = (y_val * gamma_val) + beta_val;
-                            arg.y_elementwise_op_(y_val, y_val);
-                            arg.y_m_n_(n, h, w, c) = ck::type_convert<YDataType>(y_val);
-                        }
-                arg.save_mean_m_(n)    = ck::type_convert<SaveMeanInvStdDataType>(mean(n));
-                arg.save_inv_std_m_(n) = ck::type_convert<SaveMeanInvStdDataType>(divisor);
+                mean[row]    = welford[row].mean;
+                inv_std[row] = static_cast<ComputeDataType>(1) /
+                               ck::math::sqrt(welford[row].GetVariance() + arg.epsilon_);
+
+                const auto offsets = space.rows.GetOffsets(row);
+                arg.save_mean_m_.mData[offsets[4]] =
+                    ck::type_convert<SaveMeanInvStdDataType>(mean[row]);
+                arg.save_inv_std_m_.mData[offsets[5]] =
+                    ck::type_convert<SaveMeanInvStdDataType>(inv_std[row]);
             }
 
-            return 0;
-        }
-
-        float Run(const Argument& arg)
-        {
-            if(arg.lengths_.size() == 2)
-                return Run2D(arg);
-            else if(arg.lengths_.size() == 4)
-                return Run4D(arg);
+            ck::host_normalization::normalize_rows(space,
+                                                   mean,
+                                                   inv_std,
+                                                   arg.x_m_n_.mData.data(),
+                                                   arg.gamma_n_.mData.data(),
+                                                   arg.beta_n_.mData.data(),
+                                                   arg.y_m_n_.mData.data(),
+                                                   arg.y_elementwise_op_);
 
             return 0;
         }
@@ -200,16 +177,17 @@ struct ReferenceLayernorm : public device::BaseOperator
     {
         const Argument* p_arg_ = dynamic_cast<const Argument*>(p_arg);
 
-        if(p_arg_->lengths_.size() == 2 && p_arg_->reduceDims_.size() == 1 &&
-           p_arg_->reduceDims_[0] == 1)
-            return true;
+        if(p_arg_->lengths_.size() != Rank || p_arg_->reduceDims_.size() != NumReduceDim)
+            return false;
 
-        else if(p_arg_->lengths_.size() == 4 && p_arg_->reduceDims_.size() == 3 &&
-                p_arg_->reduceDims_[0] == 1 && p_arg_->reduceDims_[1] == 2 &&
-                p_arg_->reduceDims_[2] == 3)
-            return true;
+        for(const auto dim : p_arg_->reduceDims_)
+        {
+            if(dim < 0 || dim >= Rank ||
+               std::count(p_arg_->reduceDims_.begin(), p_arg_->reduceDims_.end(), dim) != 1)
+                return false;
+        }
 
-        return false;
+        return true;
     }
 
     static auto MakeArgument(const Tensor<XDataType>& x_m_n,
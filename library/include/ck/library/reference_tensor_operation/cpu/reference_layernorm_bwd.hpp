@@ -11,6 +11,7 @@
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_normalization.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -90,60 +91,72 @@ struct ReferenceLayernormBwd : public device::BaseOperator
     {
         float Run(const Argument& arg)
         {
-            int M = arg.lengths_[0];
-            int N = arg.lengths_[1];
-
-            // Calculate dgamma and dbeta
-            for(int n = 0; n < N; ++n)
+            using ck::host_normalization::expand_strides;
+
+            const std::vector<int> reduce_dims{1};    // N
+            const std::vector<int> invariant_dims{0}; // M
+
+            // Calculate dgamma and dbeta, the rows are the dimensions of gamma
+            // dy, x, mean, rstd, dgamma, dbeta
+            const auto gamma_beta_space = ck::host_normalization::make_normalization_space<6>(
+                arg.lengths_,
+                invariant_dims,
+                {arg.dy_m_n_.GetStrides(),
+                 arg.x_m_n_.GetStrides(),
+                 expand_strides(2, invariant_dims, arg.mean_m_.GetStrides()),
+                 expand_strides(2, invariant_dims, arg.inv_std_m_.GetStrides()),
+                 expand_strides(2, reduce_dims, arg.dgamma_n_.GetStrides()),
+                 expand_strides(2, reduce_dims, arg.dbeta_n_.GetStrides())});
+
+            const auto dgamma_dbeta =
+                ck::host_normalization::normalization_bwd_gamma_beta<ComputeDataType>(
+                    gamma_beta_space,
+                    arg.dy_m_n_.mData.data(),
+                    arg.x_m_n_.mData.data(),
+                    arg.mean_m_.mData.data(),
+                    arg.inv_std_m_.mData.data());
+
+            for(std::size_t row = 0; row < dgamma_dbeta.size(); ++row)
             {
-                ComputeDataType dgamma = 0;
-                ComputeDataType dbeta  = 0;
-
-                for(int m = 0; m < M; ++m)
-                {
-                    ComputeDataType dy   = ck::type_convert<ComputeDataType>(arg.dy_m_n_(m, n));
-                    ComputeDataType x    = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
-                    ComputeDataType mean = ck::type_convert<ComputeDataType>(arg.mean_m_(m));
-                    ComputeDataType rstd = ck::type_convert<ComputeDataType>(arg.inv_std_m_(m));
-                    dgamma += dy * rstd * (x - mean);
-                    dbeta += dy;
-                }
-                arg.dgamma_n_(n) = ck::type_convert<DGammaDataType>(dgamma);
-                arg.dbeta_n_(n)  = ck::type_convert<DBetaDataType>(dbeta);
+                const auto offsets = gamma_beta_space.rows.GetOffsets(row);
+                arg.dgamma_n_.mData[offsets[4]] =
+                    ck::type_convert<DGammaDataType>(dgamma_dbeta[row].sums[0]);
+                arg.dbeta_n_.mData[offsets[5]] =
+                    ck::type_convert<DBetaDataType>(dgamma_dbeta[row].sums[1]);
             }
 
             // Calculate dx
-            for(int m = 0; m < M; ++m)
+            // dy, x, gamma, dx, mean, rstd
+            const auto dx_space = ck::host_normalization::make_normalization_space<6>(
+                arg.lengths_,
+                reduce_dims,
+                {arg.dy_m_n_.GetStrides(),
+                 arg.x_m_n_.GetStrides(),
+                 expand_strides(2, reduce_dims, arg.gamma_n_.GetStrides()),
+                 arg.dx_m_n_.GetStrides(),
+                 expand_strides(2, invariant_dims, arg.mean_m_.GetStrides()),
+                 expand_strides(2, invariant_dims, arg.inv_std_m_.GetStrides())});
+
+            const std::size_t num_row = dx_space.rows.GetSize();
+
+            std::vector<ComputeDataType> mean(num_row);
+            std::vector<ComputeDataType> rstd(num_row);
+
+            for(std::size_t row = 0; row < num_row; ++row)
             {
-                ComputeDataType ds = 0;
-                ComputeDataType db = 0;
-
-                ComputeDataType mean = ck::type_convert<ComputeDataType>(arg.mean_m_(m));
-                ComputeDataType rstd = ck::type_convert<ComputeDataType>(arg.inv_std_m_(m));
-
-                for(int n = 0; n < N; ++n)
-                {
-                    ComputeDataType dy    = ck::type_convert<ComputeDataType>(arg.dy_m_n_(m, n));
-                    ComputeDataType x     = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
-                    ComputeDataType gamma = ck::type_convert<ComputeDataType>(arg.gamma_n_(n));
-
-                    ds += dy * gamma * x;
-                    db += dy * gamma;
-                }
-
-                for(int n = 0; n < N; ++n)
-                {
-                    ComputeDataType dy    = ck::type_convert<ComputeDataType>(arg.dy_m_n_(m, n));
-                    ComputeDataType x     = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
-                    ComputeDataType gamma = ck::type_convert<ComputeDataType>(arg.gamma_n_(n));
-
-                    ComputeDataType b = (db * mean - ds) * rstd * rstd * rstd / N;
-                    ComputeDataType c = -b * mean - db * rstd / N;
-
-                    arg.dx_m_n_(m, n) = ck::type_convert<DXDataType>(dy * gamma * rstd + b * x + c);
-                }
+                const auto offsets = dx_space.rows.GetOffsets(row);
+                mean[row] = ck::type_convert<ComputeDataType>(arg.mean_m_.mData[offsets[4]]);
+                rstd[row] = ck::type_convert<ComputeDataType>(arg.inv_std_m_.mData[offsets[5]]);
             }
 
+            ck::host_normalization::normalization_bwd_data(dx_space,
+                                                           mean,
+                                                           rstd,
+                                                           arg.dy_m_n_.mData.data(),
+                                                           arg.x_m_n_.mData.data(),
+                                                           arg.gamma_n_.mData.data(),
+                                                           arg.dx_m_n_.mData.data());
+
             return 0;
         }
 
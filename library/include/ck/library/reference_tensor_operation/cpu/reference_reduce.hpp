@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -7,6 +7,7 @@
 #include <array>
 #include <algorithm>
 #include <thread>
+#include <type_traits>
 
 #include "ck/ck.hpp"
 #include "ck/utility/ignore.hpp"
@@ -158,6 +159,71 @@ struct ReferenceReduce : public device::DeviceReduce<InDataType,
 
     struct Invoker : public device::BaseInvoker
     {
+        // Computes the output element of the invariant index invariant_index (and its index if
+        // OutputIndex), Run computes all of them. The cost is the one of a single reduction, it is
+        // also used alone to evaluate the reference at a few elements (see check_err_sampled).
+        template <bool HasInvariantDim = (NumInvariantDim > 0)>
+        static std::enable_if_t<HasInvariantDim>
+        RunElement(const Argument& arg, const std::array<index_t, NumInvariantDim>& invariant_index)
+        {
+            using ck::float_equal_one;
+            using ck::float_equal_zero;
+            using ck::type_convert;
+            using ck::host_common::get_offset_from_index;
+
+            AccDataType accuVal     = ReduceOperation::template GetIdentityValue<AccDataType>();
+            IndexDataType accuIndex = 0;
+
+            auto in_invariant_offset =
+                get_offset_from_index<NumInvariantDim>(arg.in_invariant_strides_, invariant_index);
+
+            for(std::size_t i = 0; i < arg.reduce_index_set_.size(); i++)
+            {
+                auto in_reduce_offset = get_offset_from_index<NumReduceDim>(
+                    arg.in_reduce_strides_, arg.reduce_index_set_[i]);
+
+                auto currVal =
+                    type_convert<AccDataType>(arg.in_host_[in_invariant_offset + in_reduce_offset]);
+
+                arg.in_elementwise_op_(currVal, currVal);
+
+                if constexpr(OutputIndex)
+                {
+                    auto currIndex = static_cast<IndexDataType>(i);
+
+                    ck::detail::AccumulateWithIndexAndNanCheck<PropagateNan,
+                                                               ReduceOperation,
+                                                               AccDataType,
+                                                               IndexDataType>::
+                        Calculate(accuVal, currVal, accuIndex, currIndex);
+                }
+                else
+                {
+                    ck::detail::AccumulateWithNanCheck<PropagateNan, ReduceOperation, AccDataType>::
+                        Calculate(accuVal, currVal);
+                }
+            };
+
+            arg.acc_elementwise_op_(accuVal, accuVal);
+
+            if(!float_equal_one{}(arg.alpha_))
+                accuVal *= type_convert<AccDataType>(arg.alpha_);
+
+            auto dst_offset =
+                get_offset_from_index<NumInvariantDim>(arg.outStrides_, invariant_index);
+
+            if(!float_equal_zero{}(arg.beta_))
+                accuVal += type_convert<AccDataType>(arg.out_host_[dst_offset]) *
+                           type_convert<AccDataType>(arg.beta_);
+
+            arg.out_host_[dst_offset] = type_convert<OutDataType>(accuVal);
+
+            if constexpr(OutputIndex)
+            {
+                arg.out_index_host_[dst_offset] = accuIndex;
+            }
+        }
+
         float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
         {
             ignore = stream_config;
@@ -209,42 +275,7 @@ struct ReferenceReduce : public device::DeviceReduce<InDataType,
                 else
                 {
                     auto thread_reduce_func = [&](auto invariant_index) {
-                        AccDataType accuVal =
-                            ReduceOperation::template GetIdentityValue<AccDataType>();
-                        IndexDataType accuIndex = 0;
-
-                        auto in_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                            arg.in_invariant_strides_, invariant_index);
-
-                        for(std::size_t i = 0; i < arg.reduce_index_set_.size(); i++)
-                        {
-                            auto in_reduce_offset = get_offset_from_index<NumReduceDim>(
-                                arg.in_reduce_strides_, arg.reduce_index_set_[i]);
-
-                            auto currVal = type_convert<AccDataType>(
-                                arg.in_host_[in_invariant_offset + in_reduce_offset]);
-
-                            arg.in_elementwise_op_(currVal, currVal);
-
-                            auto currIndex = static_cast<IndexDataType>(i);
-
-                            Accumulation::Calculate(accuVal, currVal, accuIndex, currIndex);
-                        };
-
-                        arg.acc_elementwise_op_(accuVal, accuVal);
-
-                        if(!float_equal_one{}(arg.alpha_))
-                            accuVal *= type_convert<AccDataType>(arg.alpha_);
-
-                        auto dst_offset = get_offset_from_index<NumInvariantDim>(arg.outStrides_,
-                                                                                 invariant_index);
-
-                        if(!float_equal_zero{}(arg.beta_))
-                            accuVal += type_convert<AccDataType>(arg.out_host_[dst_offset]) *
-                                       type_convert<AccDataType>(arg.beta_);
-
-                        arg.out_host_[dst_offset]       = type_convert<OutDataType>(accuVal);
-                        arg.out_index_host_[dst_offset] = accuIndex;
+                        RunElement(arg, invariant_index);
                     };
 
                     std::size_t num_thread = std::thread::hardware_concurrency();
@@ -306,38 +337,7 @@ struct ReferenceReduce : public device::DeviceReduce<InDataType,
                 else
                 {
                     auto thread_reduce_func = [&](auto invariant_index) {
-                        AccDataType accuVal =
-                            ReduceOperation::template GetIdentityValue<AccDataType>();
-
-                        auto in_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                            arg.in_invariant_strides_, invariant_index);
-
-                        for(const auto& reduce_index : arg.reduce_index_set_)
-                        {
-                            auto in_reduce_offset = get_offset_from_index<NumReduceDim>(
-                                arg.in_reduce_strides_, reduce_index);
-
-                            auto currVal = type_convert<AccDataType>(
-                                arg.in_host_[in_invariant_offset + in_reduce_offset]);
-
-                            arg.in_elementwise_op_(currVal, currVal);
-
-                            Accumulation::Calculate(accuVal, currVal);
-                        };
-
-                        arg.acc_elementwise_op_(accuVal, accuVal);
-
-                        if(!float_equal_one{}(arg.alpha_))
-                            accuVal *= type_convert<AccDataType>(arg.alpha_);
-
-                        auto dst_offset = get_offset_from_index<NumInvariantDim>(arg.outStrides_,
-                                                                                 invariant_index);
-
-                        if(!float_equal_zero{}(arg.beta_))
-                            accuVal += type_convert<AccDataType>(arg.out_host_[dst_offset]) *
-                                       type_convert<AccDataType>(arg.beta_);
-
-                        arg.out_host_[dst_offset] = type_convert<OutDataType>(accuVal);
+                        RunElement(arg, invariant_index);
                     };
 
                     std::size_t num_thread = std::thread::hardware_concurrency();
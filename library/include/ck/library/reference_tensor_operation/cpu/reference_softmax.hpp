@@ -3,10 +3,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <utility>
 #include <vector>
-#include <algorithm>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
@@ -54,77 +59,186 @@ struct ReferenceSoftmax : public device::BaseOperator
     };
 
     // Invoker
+    //
+    // The dimensions are regrouped into rows (the dimensions which are not reduced) and the
+    // elements of a row (the reduced dimensions), and every row is normalized by one CPU thread.
+    // The elements of a row are read once, by chunks of ChunkSize elements: the max and the sum of
+    // the exponentials are computed online (the sum is rescaled when the max grows), and when the
+    // row fits in a chunk the output is computed from the exponentials kept in the chunk. Longer
+    // rows are read a second time to compute the output. For rows which fit in a chunk, the result
+    // is the one of the sequential max, exp, sum and scale passes.
     struct Invoker : public device::BaseInvoker
     {
+        // Elements of a row loaded at once
+        static constexpr std::size_t ChunkSize = 1 << 14;
+
+        struct Dim
+        {
+            std::size_t length;
+            std::size_t in_stride;
+            std::size_t out_stride;
+        };
+
+        // Offsets in the input and the output of the flat index i of dims
+        static std::pair<std::size_t, std::size_t> GetOffsets(std::size_t i,
+                                                              const std::vector<Dim>& dims)
+        {
+            std::size_t in_offset  = 0;
+            std::size_t out_offset = 0;
+            for(auto dim = dims.rbegin(); dim != dims.rend(); ++dim)
+            {
+                const std::size_t idx = i % dim->length;
+                i /= dim->length;
+                in_offset += idx * dim->in_stride;
+                out_offset += idx * dim->out_stride;
+            }
+            return {in_offset, out_offset};
+        }
+
         float Run(const Argument& arg)
         {
-            std::vector<size_t> scalar_lengths;
-            for(index_t dim : arg.sm_scalar_dims_)
+            const auto& lengths     = arg.in_.mDesc.GetLengths();
+            const auto& in_strides  = arg.in_.mDesc.GetStrides();
+            const auto& out_strides = arg.out_.mDesc.GetStrides();
+
+            if(arg.out_.mDesc.GetLengths() != lengths)
             {
-                scalar_lengths.push_back(arg.in_.mDesc.GetLengths()[dim]);
+                throw std::runtime_error("wrong! inconsistent lengths");
             }
-            // max and sum reduction with final reduced values of dim=0 is a scalar so give it
-            // appropriate lengths of {1}
-            if(arg.sm_scalar_dims_.size() == 0)
+
+            // the elements of a row are segments of the last reduced dimension
+            std::vector<Dim> row_dims;
+            std::vector<Dim> segment_dims;
+            for(std::size_t i = 0; i < lengths.size(); i++)
+            {
+                const Dim dim{lengths[i], in_strides[i], out_strides[i]};
+                if(std::find(arg.sm_reduce_dims_.begin(), arg.sm_reduce_dims_.end(), i) ==
+                   arg.sm_reduce_dims_.end())
+                {
+                    row_dims.push_back(dim);
+                }
+                else
+                {
+                    segment_dims.push_back(dim);
+                }
+            }
+            const Dim inner_dim = segment_dims.empty() ? Dim{1, 0, 0} : segment_dims.back();
+            if(!segment_dims.empty())
             {
-                scalar_lengths.push_back(1);
+                segment_dims.pop_back();
             }
 
-            Tensor<AccDataType> reduce_max(scalar_lengths);
-            reduce_max.GenerateTensorValue(
-                GeneratorTensor_1<AccDataType>{std::numeric_limits<AccDataType>::lowest()});
-            Tensor<AccDataType> reduce_sum(scalar_lengths);
-            reduce_sum.GenerateTensorValue(GeneratorTensor_1<AccDataType>{0});
-
-            // when final reduced values is of dim=0, the index will be transformed into empty
-            // std::vector which is actually a valid input for Tensor::operator(std::vector) and
-            // internally accesses 0'th element
-            auto to_sm_scalar_idx = [&](auto idx) {
-                std::vector<size_t> sm_scalar_idx;
-                for(index_t dim : arg.sm_scalar_dims_)
+            std::size_t num_rows     = 1;
+            std::size_t num_segments = 1;
+            for(const auto& dim : row_dims)
+            {
+                num_rows *= dim.length;
+            }
+            for(const auto& dim : segment_dims)
+            {
+                num_segments *= dim.length;
+            }
+            const std::size_t segment_length = inner_dim.length;
+
+            if(num_rows == 0 || num_segments == 0 || segment_length == 0)
+            {
+                return 0;
+            }
+
+            const std::size_t chunk_segments =
+                std::min(num_segments, std::max<std::size_t>(1, ChunkSize / segment_length));
+
+            auto f_row = [&](std::size_t row) {
+                const auto row_offsets = GetOffsets(row, row_dims);
+
+                std::vector<AccDataType> chunk(chunk_segments * segment_length);
+
+                // loads the x of the segments [begin, end) of the row in chunk
+                auto load = [&](std::size_t begin, std::size_t end) {
+                    for(std::size_t s = begin; s < end; ++s)
+                    {
+                        const InDataType* p_in = arg.in_.mData.data() + row_offsets.first +
+                                                 GetOffsets(s, segment_dims).first;
+                        AccDataType* p_x = &chunk[(s - begin) * segment_length];
+                        for(std::size_t j = 0; j < segment_length; ++j)
+                        {
+                            p_x[j] = ck::type_convert<AccDataType>(p_in[j * inner_dim.in_stride]);
+                        }
+                    }
+                };
+
+                // exp(x - max) in place, returns their sum
+                auto exp_sum = [&](std::size_t size, AccDataType max) {
+                    for(std::size_t i = 0; i < size; ++i)
+                    {
+                        chunk[i] = std::exp(chunk[i] - max);
+                    }
+                    AccDataType sum = 0;
+                    for(std::size_t i = 0; i < size; ++i)
+                    {
+                        sum += chunk[i];
+                    }
+                    return sum;
+                };
+
+                // out = alpha * exp(x - max) / sum + beta * out for the segments [begin, end)
+                auto store = [&](std::size_t begin, std::size_t end, AccDataType sum) {
+                    for(std::size_t s = begin; s < end; ++s)
+                    {
+                        OutDataType* p_out = arg.out_.mData.data() + row_offsets.second +
+                                             GetOffsets(s, segment_dims).second;
+                        const AccDataType* p_y = &chunk[(s - begin) * segment_length];
+                        for(std::size_t j = 0; j < segment_length; ++j)
+                        {
+                            OutDataType& out = p_out[j * inner_dim.out_stride];
+                            out              = ck::type_convert<OutDataType>(
+                                arg.alpha_ * p_y[j] / sum +
+                                arg.beta_ * ck::type_convert<AccDataType>(out));
+                        }
+                    }
+                };
+
+                AccDataType max = std::numeric_limits<AccDataType>::lowest();
+                AccDataType sum = 0;
+                for(std::size_t begin = 0; begin < num_segments; begin += chunk_segments)
+                {
+                    const std::size_t end  = std::min(begin + chunk_segments, num_segments);
+                    const std::size_t size = (end - begin) * segment_length;
+
+                    load(begin, end);
+
+                    AccDataType chunk_max = std::numeric_limits<AccDataType>::lowest();
+                    for(std::size_t i = 0; i < size; ++i)
+                    {
+                        chunk_max = std::max(chunk_max, chunk[i]);
+                    }
+                    if(chunk_max > max)
+                    {
+                        sum *= std::exp(max - chunk_max);
+                        max = chunk_max;
+                    }
+
+                    sum += exp_sum(size, max);
+                }
+
+                if(chunk_segments == num_segments)
                 {
-                    sm_scalar_idx.push_back(idx[dim]);
+                    store(0, num_segments, sum);
+                }
+                else
+                {
+                    for(std::size_t begin = 0; begin < num_segments; begin += chunk_segments)
+                    {
+                        const std::size_t end = std::min(begin + chunk_segments, num_segments);
+
+                        load(begin, end);
+                        exp_sum((end - begin) * segment_length, max);
+                        store(begin, end, sum);
+                    }
                 }
-                return sm_scalar_idx;
             };
 
-            arg.in_.ForEach([&](auto& self, auto idx) {
-                reduce_max(to_sm_scalar_idx(idx)) = std::max(
-                    reduce_max(to_sm_scalar_idx(idx)), ck::type_convert<AccDataType>(self(idx)));
-            });
-
-            // LogRangeAsType<float>(std::cout << "reduce_max: ", reduce_max.mData, ",") <<
-            // std::endl;
-
-            Tensor<AccDataType> in_stable(arg.in_.mDesc);
-            in_stable.ForEach([&](auto& self, auto idx) {
-                // numerator = exp(x - max(x))
-                self(idx) = std::exp(ck::type_convert<AccDataType>(arg.in_(idx)) -
-                                     reduce_max(to_sm_scalar_idx(idx)));
-            });
-
-            // LogRangeAsType<float>(std::cout << "in_stable: ", in_stable.mData, ",") << std::endl;
-
-            in_stable.ForEach([&](auto& self, auto idx) {
-                // denominator = sum(exp(x - max(x)))
-                reduce_sum(to_sm_scalar_idx(idx)) += self(idx);
-            });
-
-            // LogRangeAsType<float>(std::cout << "reduce_sum: ", reduce_sum.mData, ",") <<
-            // std::endl;
-
-            arg.out_.ForEach([&](auto& self, auto idx) {
-                AccDataType temp_result =
-                    arg.alpha_ * in_stable(idx) / reduce_sum(to_sm_scalar_idx(idx)) +
-                    arg.beta_ * self(idx);
-                self(idx) = ck::type_convert<OutDataType>(temp_result);
-            });
-
-            // LogRangeAsType<float>(std::cout << "out: ", arg.out_.mData, ",") << std::endl;
-            // reduction along reduce dims
-            // LogRangeAsType<float>(std::cout << "reduce_max: ", reduce_max.mData, ",") <<
-            // std::endl; LogRangeAsType<float>(std::cout << "reduce_sum: ", reduce_sum.mData, ",")
-            // << std::endl;
+            make_ParallelTensorFunctor(f_row, num_rows)(std::thread::hardware_concurrency());
 
             return 0;
         }
@@ -0,0 +1,221 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_normalization.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// Reference of DeviceSparseEmbeddingsForwardLayernorm: row i of the output is the layernorm of
+// emb_elementwise_op(acc, embs[0][indexes[0][i], :], ..., embs[NumEmbeddings - 1][...]), e.g.
+// AddAdd to sum (pool) 3 tables. The tables are only referenced, and each output row is gathered,
+// pooled and normalized (with a Welford mean and variance) by one CPU thread.
+template <typename EmbType,
+          typename IndexType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename AccDataType,
+          typename OutType,
+          typename EmbElementwiseOperation,
+          ck::index_t NumEmbeddings>
+struct ReferenceSparseEmbeddingsForwardLayernorm : public device::BaseOperator
+{
+    struct Argument : public device::BaseArgument
+    {
+        Argument(Tensor<OutType>& output,
+                 const std::array<const Tensor<EmbType>*, NumEmbeddings>& embs,
+                 const std::array<const Tensor<IndexType>*, NumEmbeddings>& indexes,
+                 const Tensor<GammaDataType>& gamma,
+                 const Tensor<BetaDataType>& beta,
+                 AccDataType epsilon,
+                 EmbElementwiseOperation emb_elementwise_op)
+            : output_(output),
+              embs_(embs),
+              indexes_(indexes),
+              gamma_(gamma),
+              beta_(beta),
+              epsilon_(epsilon),
+              emb_elementwise_op_(emb_elementwise_op)
+        {
+        }
+
+        Tensor<OutType>& output_;
+        std::array<const Tensor<EmbType>*, NumEmbeddings> embs_;
+        std::array<const Tensor<IndexType>*, NumEmbeddings> indexes_;
+        const Tensor<GammaDataType>& gamma_;
+        const Tensor<BetaDataType>& beta_;
+        AccDataType epsilon_;
+        EmbElementwiseOperation emb_elementwise_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        // p_acc[d] is op applied to element d of the rows of all the tables
+        template <std::size_t... Is>
+        static void PoolRows(const Argument& arg,
+                             AccDataType* p_acc,
+                             const std::array<const EmbType*, NumEmbeddings>& p_rows,
+                             const std::array<std::size_t, NumEmbeddings>& strides,
+                             std::size_t D,
+                             std::index_sequence<Is...>)
+        {
+            for(std::size_t d = 0; d < D; ++d)
+            {
+                AccDataType acc = 0;
+                arg.emb_elementwise_op_(
+                    acc, ck::type_convert<AccDataType>(p_rows[Is][d * strides[Is]])...);
+                p_acc[d] = acc;
+            }
+        }
+
+        float Run(const Argument& arg)
+        {
+            const std::size_t L = arg.output_.mDesc.GetLengths()[0];
+            const std::size_t D = arg.output_.mDesc.GetLengths()[1];
+
+            std::array<std::size_t, NumEmbeddings> num_rows;
+            std::array<std::size_t, NumEmbeddings> strides;
+            for(ck::index_t i = 0; i < NumEmbeddings; ++i)
+            {
+                num_rows[i] = arg.embs_[i]->mDesc.GetLengths()[0];
+                strides[i]  = arg.embs_[i]->mDesc.GetStrides()[1];
+
+                if(arg.embs_[i]->mDesc.GetLengths()[1] != D ||
+                   arg.indexes_[i]->mDesc.GetElementSize() < L)
+                {
+                    throw std::runtime_error("wrong! inconsistent embedding lengths");
+                }
+            }
+
+            // the indices are checked before the threads start
+            for(ck::index_t i = 0; i < NumEmbeddings; ++i)
+            {
+                for(std::size_t idx = 0; idx < L; ++idx)
+                {
+                    const auto row = static_cast<long_index_t>((*arg.indexes_[i])(idx));
+                    if(row < 0 || static_cast<std::size_t>(row) >= num_rows[i])
+                    {
+                        throw std::runtime_error("wrong! out of range");
+                    }
+                }
+            }
+
+            auto get_rows = [&](std::size_t idx) {
+                std::array<const EmbType*, NumEmbeddings> p_rows;
+                for(ck::index_t i = 0; i < NumEmbeddings; ++i)
+                {
+                    const auto& emb = *arg.embs_[i];
+                    p_rows[i]       = emb.mData.data() +
+                                emb.mDesc.GetOffsetFromMultiIndex((*arg.indexes_[i])(idx), 0);
+                }
+                return p_rows;
+            };
+
+            auto f_row = [&](auto idx) {
+                const auto p_rows = get_rows(idx);
+
+                // the rows of the next output row are loaded while this one is computed
+                if(idx + 1 < L)
+                {
+                    const auto p_next_rows = get_rows(idx + 1);
+                    for(ck::index_t i = 0; i < NumEmbeddings; ++i)
+                    {
+                        const auto* p_next = reinterpret_cast<const char*>(p_next_rows[i]);
+                        for(std::size_t byte = 0; byte < D * strides[i] * sizeof(EmbType);
+                            byte += 64)
+                        {
+                            __builtin_prefetch(p_next + byte);
+                        }
+                    }
+                }
+
+                std::vector<AccDataType> acc(D);
+                PoolRows(
+                    arg, acc.data(), p_rows, strides, D, std::make_index_sequence<NumEmbeddings>{});
+
+                host_normalization::WelfordState<AccDataType> welford;
+                host_normalization::welford_update(welford, acc.data(), 1, D);
+
+                const AccDataType mean = welford.mean;
+                const AccDataType divisor =
+                    AccDataType{1} / std::sqrt(welford.GetVariance() + arg.epsilon_);
+
+                for(std::size_t d = 0; d < D; ++d)
+                {
+                    const AccDataType y = (acc[d] - mean) * divisor *
+                                              ck::type_convert<AccDataType>(arg.gamma_(d)) +
+                                          ck::type_convert<AccDataType>(arg.beta_(d));
+                    arg.output_(idx, d) = ck::type_convert<OutType>(y);
+                }
+            };
+
+            make_ParallelTensorFunctor(f_row, L)(std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(Tensor<OutType>& output,
+                             const std::array<const Tensor<EmbType>*, NumEmbeddings>& embs,
+                             const std::array<const Tensor<IndexType>*, NumEmbeddings>& indexes,
+                             const Tensor<GammaDataType>& gamma,
+                             const Tensor<BetaDataType>& beta,
+                             AccDataType epsilon,
+                             EmbElementwiseOperation emb_elementwise_op = {})
+    {
+        return Argument(output, embs, indexes, gamma, beta, epsilon, emb_elementwise_op);
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceSparseEmbeddingsForwardLayernorm"
+            << "<" << NumEmbeddings << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
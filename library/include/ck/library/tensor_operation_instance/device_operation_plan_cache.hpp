@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <list>
+#include <map>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/stream_config.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+namespace detail {
+
+inline void append_plan_key(std::vector<long_index_t>& key, long_index_t value)
+{
+    key.push_back(value);
+}
+
+// object representation of the other trivially copyable values, e.g. the scales of element-wise
+// operations (stateless operations such as PassThrough add nothing to the key)
+template <typename T,
+          typename std::enable_if_t<std::is_trivially_copyable_v<T> && !std::is_integral_v<T> &&
+                                        !std::is_enum_v<T>,
+                                    bool> = false>
+void append_plan_key(std::vector<long_index_t>& key, const T& value)
+{
+    if constexpr(!std::is_empty_v<T>)
+    {
+        constexpr std::size_t num_words =
+            (sizeof(T) + sizeof(long_index_t) - 1) / sizeof(long_index_t);
+
+        long_index_t words[num_words] = {};
+        std::memcpy(words, &value, sizeof(T));
+
+        key.insert(key.end(), words, words + num_words);
+    }
+}
+
+template <typename T, std::size_t N>
+void append_plan_key(std::vector<long_index_t>& key, const std::array<T, N>& values)
+{
+    for(const auto& v : values)
+    {
+        append_plan_key(key, v);
+    }
+}
+
+template <typename T>
+void append_plan_key(std::vector<long_index_t>& key, const std::vector<T>& values)
+{
+    // length first, so that keys of different ranges can not collide
+    key.push_back(static_cast<long_index_t>(values.size()));
+    for(const auto& v : values)
+    {
+        append_plan_key(key, v);
+    }
+}
+
+} // namespace detail
+
+// Flatten lengths, strides and other integral problem parameters (also nested std::array /
+// std::vector of them) and the element-wise operations into a key of DeviceOperationPlanCache.
+// Data pointers are not part of the key, they are rebound by UpdatePointers(). Element-wise
+// operations are added by their object representation, so they must not hold pointers.
+template <typename... Ts>
+std::vector<long_index_t> MakePlanKey(const Ts&... values)
+{
+    std::vector<long_index_t> key;
+    (detail::append_plan_key(key, values), ...);
+    return key;
+}
+
+// LRU cache of argument plans in front of DeviceOperationInstanceFactory<DeviceOp>.
+//
+// A plan is the argument of the first instance supporting a problem, together with its invoker.
+// Creating the argument transforms all tensor descriptors of the problem. On a cache hit only the
+// data pointers of the cached argument are replaced (DeviceOp::UpdatePointers), the argument is
+// only made again if the instance does not support rebinding. Everything else in the argument,
+// including the element-wise operations and their state (e.g. scales), is the one of the call
+// which made the plan: all of it has to be part of the key, or calls with different element-wise
+// operations silently run with the cached ones.
+//
+// Usage:
+//   DeviceOperationPlanCache<DeviceOp> cache;
+//   auto plan = cache.Get(
+//       MakePlanKey(a_lengths, a_strides, ..., a_element_op, b_element_op, cde_element_op),
+//       [&](DeviceOp& op) { return op.MakeArgumentPointer(p_a, p_b, ...); },
+//       [&](DeviceOp& op, BaseArgument* arg) { return op.UpdatePointers(arg, p_a, p_b, ...); });
+//   if(plan) plan->Run(stream_config);
+//
+// The factory specialization of DeviceOp has to be included before the cache is instantiated.
+// The cache is not thread-safe.
+template <typename DeviceOp>
+class DeviceOperationPlanCache
+{
+    public:
+    using Key = std::vector<long_index_t>;
+
+    struct Plan
+    {
+        DeviceOp* op;
+        std::unique_ptr<BaseArgument> argument;
+        std::unique_ptr<BaseInvoker> invoker;
+
+        float Run(const StreamConfig& stream_config = StreamConfig{}) const
+        {
+            return invoker->Run(argument.get(), stream_config);
+        }
+    };
+
+    explicit DeviceOperationPlanCache(std::size_t capacity = 64)
+        : op_ptrs_(DeviceOperationInstanceFactory<DeviceOp>::GetInstances()),
+          capacity_(capacity > 0 ? capacity : 1)
+    {
+    }
+
+    DeviceOperationPlanCache(const DeviceOperationPlanCache&) = delete;
+    DeviceOperationPlanCache& operator=(const DeviceOperationPlanCache&) = delete;
+
+    // Plan of the problem identified by key, nullptr if no instance supports the problem. On a hit
+    // make_argument is only called if update_pointers fails, the key has to identify all of its
+    // parameters other than the data pointers.
+    //   make_argument(DeviceOp&) -> std::unique_ptr<BaseArgument>
+    //   update_pointers(DeviceOp&, BaseArgument*) -> bool
+    // The returned plan stays valid until it is evicted by later calls of Get().
+    template <typename MakeArgument, typename UpdatePointers>
+    Plan* Get(const Key& key, MakeArgument&& make_argument, UpdatePointers&& update_pointers)
+    {
+        const auto found = index_.find(key);
+
+        if(found != index_.end())
+        {
+            ++num_hits_;
+
+            // move to the front of the LRU list
+            plans_.splice(plans_.begin(), plans_, found->second);
+
+            Plan& plan = found->second->second;
+
+            if(!update_pointers(*plan.op, plan.argument.get()))
+            {
+                plan.argument = make_argument(*plan.op);
+            }
+
+            return &plan;
+        }
+
+        ++num_misses_;
+
+        for(auto& op_ptr : op_ptrs_)
+        {
+            auto argument_ptr = make_argument(*op_ptr);
+
+            if(!op_ptr->IsSupportedArgument(argument_ptr.get()))
+            {
+                continue;
+            }
+
+            if(plans_.size() >= capacity_)
+            {
+                index_.erase(plans_.back().first);
+                plans_.pop_back();
+            }
+
+            plans_.emplace_front(
+                key, Plan{op_ptr.get(), std::move(argument_ptr), op_ptr->MakeInvokerPointer()});
+            index_.emplace(key, plans_.begin());
+
+            return &plans_.front().second;
+        }
+
+        return nullptr;
+    }
+
+    void Clear()
+    {
+        index_.clear();
+        plans_.clear();
+    }
+
+    std::size_t GetNumInstances() const { return op_ptrs_.size(); }
+    std::size_t GetNumPlans() const { return plans_.size(); }
+    std::size_t GetNumHits() const { return num_hits_; }
+    std::size_t GetNumMisses() const { return num_misses_; }
+
+    private:
+    using PlanList = std::list<std::pair<Key, Plan>>;
+
+    std::vector<std::unique_ptr<DeviceOp>> op_ptrs_;
+    std::size_t capacity_;
+
+    PlanList plans_; // most recently used first
+    std::map<Key, typename PlanList::iterator> index_;
+
+    std::size_t num_hits_   = 0;
+    std::size_t num_misses_ = 0;
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "ck/ck.hpp"
+
+// Gather form of the transposed convolutions of the host references (column to image, backward
+// data): every input (image) position x accumulates the terms
+//
+//   (filter tap t, output position o) with o * stride + t * dilation - left_pad == x
+//
+// along every spatial dimension. A thread computing x reads all its terms and owns its result, so
+// that these references run on all CPU threads without atomics, races or per-term conversions
+// of the result.
+namespace ck {
+namespace host_conv_gather {
+
+// Filter tap and output coordinate of a term along a spatial dimension
+struct Term
+{
+    long_index_t tap;
+    long_index_t out;
+};
+
+template <index_t NDimSpatial>
+class Gather
+{
+    public:
+    Gather(const std::vector<long_index_t>& in_lengths,
+           const std::vector<long_index_t>& filter_lengths,
+           const std::vector<long_index_t>& out_lengths,
+           const std::vector<long_index_t>& strides,
+           const std::vector<long_index_t>& dilations,
+           const std::vector<long_index_t>& left_pads)
+    {
+        for(index_t d = 0; d < NDimSpatial; ++d)
+        {
+            in_lengths_[d]     = in_lengths[d];
+            filter_lengths_[d] = filter_lengths[d];
+            out_lengths_[d]    = out_lengths[d];
+
+            terms_[d].resize(in_lengths[d]);
+            for(long_index_t x = 0; x < in_lengths[d]; ++x)
+            {
+                for(long_index_t t = 0; t < filter_lengths[d]; ++t)
+                {
+                    const long_index_t tmp = x + left_pads[d] - t * dilations[d];
+
+                    if(tmp % strides[d] == 0 && tmp >= 0 && tmp / strides[d] < out_lengths[d])
+                    {
+                        terms_[d][x].push_back(Term{t, tmp / strides[d]});
+                    }
+                }
+            }
+        }
+    }
+
+    // Number of input positions
+    long_index_t GetInputSize() const
+    {
+        long_index_t size = 1;
+        for(index_t d = 0; d < NDimSpatial; ++d)
+        {
+            size *= in_lengths_[d];
+        }
+        return size;
+    }
+
+    // Spatial coordinates of the input position of row-major offset in_offset
+    std::array<long_index_t, NDimSpatial> GetInputIndex(long_index_t in_offset) const
+    {
+        std::array<long_index_t, NDimSpatial> idx;
+        for(index_t d = NDimSpatial - 1; d >= 0; --d)
+        {
+            idx[d] = in_offset % in_lengths_[d];
+            in_offset /= in_lengths_[d];
+        }
+        return idx;
+    }
+
+    // Calls f(tap, out) with the row-major offsets of the filter tap and of the output position of
+    // every term of the input position of row-major offset in_offset, by increasing filter tap
+    template <typename F>
+    void ForEachTerm(long_index_t in_offset, F&& f) const
+    {
+        ForEachTerm<0>(GetInputIndex(in_offset), 0, 0, f);
+    }
+
+    private:
+    template <index_t Dim, typename F>
+    void ForEachTerm(const std::array<long_index_t, NDimSpatial>& in_idx,
+                     long_index_t tap,
+                     long_index_t out,
+                     F& f) const
+    {
+        if constexpr(Dim == NDimSpatial)
+        {
+            f(tap, out);
+        }
+        else
+        {
+            for(const auto& term : terms_[Dim][in_idx[Dim]])
+            {
+                ForEachTerm<Dim + 1>(in_idx,
+                                     tap * filter_lengths_[Dim] + term.tap,
+                                     out * out_lengths_[Dim] + term.out,
+                                     f);
+            }
+        }
+    }
+
+    std::array<long_index_t, NDimSpatial> in_lengths_;
+    std::array<long_index_t, NDimSpatial> filter_lengths_;
+    std::array<long_index_t, NDimSpatial> out_lengths_;
+
+    // Terms of every input coordinate, along every spatial dimension
+    std::array<std::vector<std::vector<Term>>, NDimSpatial> terms_;
+};
+
+} // namespace host_conv_gather
+} // namespace ck
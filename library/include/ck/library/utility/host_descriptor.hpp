@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+// Host evaluation of the tensor descriptors of the device code (tensor_descriptor.hpp).
+//
+// The visible index space of a descriptor is walked in row-major order (last dimension fastest).
+// The space is split into tiles of consecutive indices processed on all CPU threads. In a tile the
+// coordinate is only made once and then moved with move_tensor_coordinate, so only the transforms
+// depending on the changed dimensions are evaluated, like in the device code.
+//
+// gather() materializes a descriptor (e.g. the im2col matrix of TransformConvFwdToGemm::
+// MakeADescriptor_M_K) into a packed tensor of its visible lengths, scatter() is the inverse.
+namespace ck {
+namespace host_descriptor {
+
+template <typename Desc>
+std::size_t get_visible_size(const Desc& desc)
+{
+    std::size_t size = 1;
+    static_for<0, Desc::GetNumOfDimension(), 1>{}([&](auto i) {
+        size *= static_cast<std::size_t>(
+            std::max(index_t{0}, static_cast<index_t>(desc.GetLength(i))));
+    });
+    return size;
+}
+
+// Call f(i, offset, is_valid) for all visible indices of desc. i is the position of the index in
+// row-major order, offset and is_valid are the ones of its coordinate (offset is meaningless if
+// the coordinate is not valid, e.g. in padding). f is called concurrently from num_thread threads
+// (0: all CPU threads), each with its own range of i.
+template <typename Desc, typename F>
+void for_each_offset(const Desc& desc, F&& f, std::size_t num_thread = 0)
+{
+    constexpr index_t NDim = Desc::GetNumOfDimension();
+
+    static_assert(NDim > 0, "wrong! descriptor without dimension");
+
+    const std::size_t size = get_visible_size(desc);
+
+    if(size == 0)
+    {
+        return;
+    }
+
+    std::array<index_t, NDim> lengths;
+    static_for<0, NDim, 1>{}([&](auto i) { lengths[i] = desc.GetLength(i); });
+
+    // steps[i] moves by 1 along dimension i and back to 0 along the faster dimensions
+    using Step = decltype(make_tensor_coordinate_step(desc, make_zero_multi_index<NDim>()));
+
+    std::array<Step, NDim> steps;
+    static_for<0, NDim, 1>{}([&](auto i) {
+        auto diff = make_zero_multi_index<NDim>();
+        diff(i)   = 1;
+        static_for<decltype(i)::value + 1, NDim, 1>{}([&](auto j) { diff(j) = 1 - lengths[j]; });
+        steps[i] = make_tensor_coordinate_step(desc, diff);
+    });
+
+    const auto walk_tile = [&](std::size_t begin, std::size_t end) {
+        if(begin >= end)
+        {
+            return;
+        }
+
+        // visible index of begin
+        std::array<index_t, NDim> idx;
+        auto idx_visible = make_zero_multi_index<NDim>();
+        std::size_t rest = begin;
+        static_for<NDim - 1, -1, -1>{}([&](auto i) {
+            idx[i]         = static_cast<index_t>(rest % lengths[i]);
+            idx_visible(i) = idx[i];
+            rest /= lengths[i];
+        });
+
+        auto coord = make_tensor_coordinate(desc, idx_visible);
+
+        for(std::size_t pos = begin;;)
+        {
+            f(pos,
+              static_cast<long_index_t>(coord.GetOffset()),
+              coordinate_has_valid_offset_assuming_visible_index_is_valid(desc, coord));
+
+            if(++pos == end)
+            {
+                break;
+            }
+
+            // the slowest dimension changed by the increment
+            index_t carry_dim = NDim - 1;
+            while(idx[carry_dim] + 1 == lengths[carry_dim])
+            {
+                idx[carry_dim] = 0;
+                --carry_dim;
+            }
+            ++idx[carry_dim];
+
+            static_for<0, NDim, 1>{}([&](auto i) {
+                if(i == carry_dim)
+                {
+                    move_tensor_coordinate(desc, coord, steps[i]);
+                }
+            });
+        }
+    };
+
+    if(num_thread == 0)
+    {
+        num_thread = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // a few tiles per thread, tiles of at least a few thousand indices
+    constexpr std::size_t min_tile_size = 4096;
+
+    const std::size_t num_tile =
+        std::max<std::size_t>(1, std::min(4 * num_thread, size / min_tile_size));
+    const std::size_t tile_size = (size + num_tile - 1) / num_tile;
+
+    num_thread = std::min(num_thread, num_tile);
+
+    const auto run_thread = [&](std::size_t it) {
+        for(std::size_t tile = it; tile < num_tile; tile += num_thread)
+        {
+            walk_tile(tile * tile_size, std::min(size, (tile + 1) * tile_size));
+        }
+    };
+
+    std::vector<joinable_thread> threads;
+    threads.reserve(num_thread);
+    for(std::size_t it = 1; it < num_thread; ++it)
+    {
+        threads.emplace_back(run_thread, it);
+    }
+    run_thread(0);
+}
+
+// p_dst[i] = p_src[offset of i], or invalid_value if the coordinate of i is not valid. p_dst is
+// packed in row-major order of the visible lengths of desc.
+template <typename Desc, typename T>
+void gather(const Desc& desc, const T* p_src, T* p_dst, T invalid_value = T{0})
+{
+    for_each_offset(desc, [&](std::size_t i, long_index_t offset, bool is_valid) {
+        p_dst[i] = is_valid ? p_src[offset] : invalid_value;
+    });
+}
+
+// p_dst[offset of i] = p_src[i] for the valid coordinates, p_src is packed like the result of
+// gather(). desc has to map different valid indices to different offsets (e.g. a layout
+// transform, not an im2col with overlapping windows), the indices are written concurrently.
+template <typename Desc, typename T>
+void scatter(const Desc& desc, const T* p_src, T* p_dst)
+{
+    for_each_offset(desc, [&](std::size_t i, long_index_t offset, bool is_valid) {
+        if(is_valid)
+        {
+            p_dst[offset] = p_src[i];
+        }
+    });
+}
+
+// Tensor of the visible lengths of desc gathered from src, which holds the element space of desc
+template <typename Desc, typename T>
+Tensor<T> gather(const Desc& desc, const Tensor<T>& src, T invalid_value = T{0})
+{
+    std::vector<std::size_t> lengths;
+    static_for<0, Desc::GetNumOfDimension(), 1>{}(
+        [&](auto i) { lengths.push_back(static_cast<std::size_t>(desc.GetLength(i))); });
+
+    Tensor<T> dst(lengths);
+    gather(desc, src.mData.data(), dst.mData.data(), invalid_value);
+    return dst;
+}
+
+} // namespace host_descriptor
+} // namespace ck
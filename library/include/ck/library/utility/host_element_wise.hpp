@@ -0,0 +1,221 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "ck/ck.hpp"
+#include "ck/utility/math.hpp"
+#include "ck/utility/type_convert.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+// Host adapter applying the element-wise operations of ck/tensor_operation/gpu/element to spans:
+// p_y[i] = op(p_xs[i]...) for i in [0, n), with the calling convention of the operations. The
+// spans are either disjoint or the same (in place, p_y == p_x), like for the scalar operations.
+//
+// SpanOperation<Op> applies an operation one element at a time, and is specialized for the
+// operations and types with a vectorizable implementation. The specializations evaluate the same
+// float expressions as the host operations, in the same order, and call the operations for their
+// transcendental part (the exp of FastGelu, ...), so the results are those of the host operations
+// (up to FMA contraction, 1 ulp). Like the host operations, they differ from the device ones by
+// the precision of __ocml_exp_f32 and rcp, a few ulp for FastGelu.
+namespace ck {
+namespace host_element_wise {
+
+// Elements of the intermediate float blocks of the vectorized implementations
+static constexpr std::size_t BlockSize = 256;
+
+template <typename Op>
+struct ScalarSpanOperation
+{
+    template <typename Y, typename... Xs>
+    static void Run(const Op& op, std::size_t n, Y* p_y, const Xs*... p_xs)
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            op(p_y[i], p_xs[i]...);
+        }
+    }
+};
+
+template <typename Op>
+struct SpanOperation : ScalarSpanOperation<Op>
+{
+};
+
+template <typename Op, typename Y, typename... Xs>
+void apply_element_wise(const Op& op, std::size_t n, Y* p_y, const Xs*... p_xs)
+{
+    SpanOperation<Op>::Run(op, n, p_y, p_xs...);
+}
+
+template <>
+struct SpanOperation<tensor_operation::element_wise::PassThrough>
+    : ScalarSpanOperation<tensor_operation::element_wise::PassThrough>
+{
+    using Op = tensor_operation::element_wise::PassThrough;
+    using ScalarSpanOperation<Op>::Run;
+
+    template <typename T, typename = std::enable_if_t<std::is_trivially_copyable_v<T>>>
+    static void Run(const Op&, std::size_t n, T* p_y, const T* p_x)
+    {
+        // nothing to do in place, copy_n does not allow overlapping ranges
+        if(p_y != p_x)
+        {
+            std::copy_n(p_x, n, p_y);
+        }
+    }
+};
+
+template <>
+struct SpanOperation<tensor_operation::element_wise::Scale>
+    : ScalarSpanOperation<tensor_operation::element_wise::Scale>
+{
+    using Op = tensor_operation::element_wise::Scale;
+    using ScalarSpanOperation<Op>::Run;
+
+    static void Run(const Op& op, std::size_t n, float* p_y, const float* p_x)
+    {
+        const float scale = op.scale_;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            p_y[i] = scale * p_x[i];
+        }
+    }
+};
+
+template <>
+struct SpanOperation<tensor_operation::element_wise::Relu>
+    : ScalarSpanOperation<tensor_operation::element_wise::Relu>
+{
+    using Op = tensor_operation::element_wise::Relu;
+    using ScalarSpanOperation<Op>::Run;
+
+    static void Run(const Op&, std::size_t n, float* p_y, const float* p_x)
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            p_y[i] = p_x[i] > 0 ? p_x[i] : 0;
+        }
+    }
+};
+
+template <>
+struct SpanOperation<tensor_operation::element_wise::Bilinear>
+    : ScalarSpanOperation<tensor_operation::element_wise::Bilinear>
+{
+    using Op = tensor_operation::element_wise::Bilinear;
+    using ScalarSpanOperation<Op>::Run;
+
+    static void Run(const Op& op, std::size_t n, float* p_y, const float* p_x0, const float* p_x1)
+    {
+        const float alpha = op.alpha_;
+        const float beta  = op.beta_;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            p_y[i] = alpha * p_x0[i] + beta * p_x1[i];
+        }
+    }
+};
+
+// The sums are vectorized, FastGelu is applied to blocks of them
+template <>
+struct SpanOperation<tensor_operation::element_wise::AddFastGelu>
+    : ScalarSpanOperation<tensor_operation::element_wise::AddFastGelu>
+{
+    using Op = tensor_operation::element_wise::AddFastGelu;
+    using ScalarSpanOperation<Op>::Run;
+
+    static void Run(const Op&, std::size_t n, float* p_e, const float* p_c, const float* p_d)
+    {
+        for(std::size_t begin = 0; begin < n; begin += BlockSize)
+        {
+            const std::size_t size = std::min(BlockSize, n - begin);
+
+            float x[BlockSize];
+            for(std::size_t i = 0; i < size; ++i)
+            {
+                x[i] = p_c[begin + i] + p_d[begin + i];
+            }
+            ScalarSpanOperation<tensor_operation::element_wise::FastGelu>::Run(
+                tensor_operation::element_wise::FastGelu{}, size, p_e + begin, &x[0]);
+        }
+    }
+};
+
+template <>
+struct SpanOperation<tensor_operation::element_wise::AddAddFastGelu>
+    : ScalarSpanOperation<tensor_operation::element_wise::AddAddFastGelu>
+{
+    using Op = tensor_operation::element_wise::AddAddFastGelu;
+    using ScalarSpanOperation<Op>::Run;
+
+    static void Run(const Op&,
+                    std::size_t n,
+                    float* p_e,
+                    const float* p_c,
+                    const float* p_d0,
+                    const float* p_d1)
+    {
+        for(std::size_t begin = 0; begin < n; begin += BlockSize)
+        {
+            const std::size_t size = std::min(BlockSize, n - begin);
+
+            float x[BlockSize];
+            for(std::size_t i = 0; i < size; ++i)
+            {
+                x[i] = p_c[begin + i] + p_d0[begin + i] + p_d1[begin + i];
+            }
+            ScalarSpanOperation<tensor_operation::element_wise::FastGelu>::Run(
+                tensor_operation::element_wise::FastGelu{}, size, p_e + begin, &x[0]);
+        }
+    }
+};
+
+// The conversions, the requantization and the clamp are vectorized, the activation is applied to
+// blocks of float values through its own SpanOperation
+template <typename Activation>
+struct SpanOperation<tensor_operation::element_wise::Activation_Mul_Clamp<Activation>>
+    : ScalarSpanOperation<tensor_operation::element_wise::Activation_Mul_Clamp<Activation>>
+{
+    using Op = tensor_operation::element_wise::Activation_Mul_Clamp<Activation>;
+    using ScalarSpanOperation<Op>::Run;
+
+    template <typename Y, typename X>
+    static void RunBlocks(const Op& op, std::size_t n, Y* p_y, const X* p_x)
+    {
+        for(std::size_t begin = 0; begin < n; begin += BlockSize)
+        {
+            const std::size_t size = std::min(BlockSize, n - begin);
+
+            float y[BlockSize];
+            for(std::size_t i = 0; i < size; ++i)
+            {
+                y[i] = ck::type_convert<float>(p_x[begin + i]);
+            }
+            SpanOperation<Activation>::Run(op.activationOp_, size, &y[0], &y[0]);
+            for(std::size_t i = 0; i < size; ++i)
+            {
+                p_y[begin + i] =
+                    ck::type_convert<Y>(math::clamp(op.requantScale_ * y[i], -128.f, 127.f));
+            }
+        }
+    }
+
+    static void Run(const Op& op, std::size_t n, int8_t* p_y, const int32_t* p_x)
+    {
+        RunBlocks(op, n, p_y, p_x);
+    }
+
+    static void Run(const Op& op, std::size_t n, float* p_y, const float* p_x)
+    {
+        RunBlocks(op, n, p_y, p_x);
+    }
+};
+
+} // namespace host_element_wise
+} // namespace ck
@@ -0,0 +1,269 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+// Host engine of the int8 references (GEMM and convolution): C = A * B with int8 A and B and int32
+// accumulation, which is exact as long as the sums fit in int32: a product is at most
+// (-128)^2 = 2^14, so K < 2^31 / 2^14 = 131072.
+//
+// A is packed as a row-major [M, K] matrix and B as a row-major [N, K] matrix, so that every
+// element of C is the dot product of 2 contiguous int8 rows. The dot products are written as
+// independent int32 lanes of sign-extended products, which compilers turn into pmaddwd (or
+// vpdpbusd-like) SIMD code. C is computed by blocks of rows on all CPU threads, B by blocks of
+// columns which stay in cache, and every finished row of C is handed to an epilogue (e.g. the
+// requantization of a quantized GEMM) while it is still in cache.
+namespace ck {
+namespace host_int8_gemm {
+
+// int8 GEMMs with int32 accumulation (quantization) run on this engine. A and B are packed as they
+// are, so their element operations must be PassThrough.
+template <typename ADataType,
+          typename BDataType,
+          typename AccDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation>
+inline constexpr bool IsInt8Gemm =
+    std::is_same_v<ADataType, int8_t> && std::is_same_v<BDataType, int8_t> &&
+    std::is_same_v<AccDataType, int32_t> &&
+    std::is_same_v<AElementwiseOperation, ck::tensor_operation::element_wise::PassThrough> &&
+    std::is_same_v<BElementwiseOperation, ck::tensor_operation::element_wise::PassThrough>;
+
+// Largest K for which the int32 accumulation is exact
+static constexpr std::size_t MaxK = 131071;
+
+// Rows of C computed by a task
+static constexpr std::size_t RowBlockSize = 16;
+
+// Size in bytes of the block of B rows (columns of C) reused by the rows of a task
+static constexpr std::size_t ColumnBlockBytes = 1 << 17;
+
+// p_c[j] = dot(p_a[0, K), p_b[j * K, j * K + K)) for the NumColumns rows of B
+template <std::size_t NumColumns>
+void DotColumns(const int8_t* p_a, const int8_t* p_b, std::size_t K, int32_t* p_c)
+{
+    constexpr std::size_t NumLanes = 16;
+
+    int32_t acc[NumColumns][NumLanes] = {};
+
+    std::size_t k = 0;
+    for(; k + NumLanes <= K; k += NumLanes)
+    {
+        for(std::size_t j = 0; j < NumColumns; ++j)
+        {
+            for(std::size_t l = 0; l < NumLanes; ++l)
+            {
+                acc[j][l] += static_cast<int32_t>(p_a[k + l]) *
+                             static_cast<int32_t>(p_b[j * K + k + l]);
+            }
+        }
+    }
+
+    for(std::size_t j = 0; j < NumColumns; ++j)
+    {
+        int32_t sum = 0;
+        for(std::size_t l = 0; l < NumLanes; ++l)
+        {
+            sum += acc[j][l];
+        }
+        for(std::size_t kk = k; kk < K; ++kk)
+        {
+            sum += static_cast<int32_t>(p_a[kk]) * static_cast<int32_t>(p_b[j * K + kk]);
+        }
+        p_c[j] = sum;
+    }
+}
+
+// Row-major [I, J] matrix of get(i, j)
+template <typename F>
+std::vector<int8_t> Pack(std::size_t I, std::size_t J, F get)
+{
+    std::vector<int8_t> packed(I * J);
+
+    auto f = [&](std::size_t i) {
+        for(std::size_t j = 0; j < J; ++j)
+        {
+            packed[i * J + j] = get(i, j);
+        }
+    };
+    make_ParallelTensorFunctor(f, I)(std::thread::hardware_concurrency());
+
+    return packed;
+}
+
+// C[M, N] = A[M, K] * B[N, K]^T, then epilogue(m, p_c_row) for every row m of C
+template <typename Epilogue>
+void Gemm(const int8_t* p_a,
+          const int8_t* p_b,
+          std::size_t M,
+          std::size_t N,
+          std::size_t K,
+          Epilogue epilogue)
+{
+    if(K > MaxK)
+    {
+        throw std::runtime_error("wrong! K is too large for exact int32 accumulation");
+    }
+
+    const std::size_t num_row_blocks    = (M + RowBlockSize - 1) / RowBlockSize;
+    const std::size_t column_block_size = std::max<std::size_t>(
+        4, ColumnBlockBytes / std::max<std::size_t>(K, 1) / 4 * 4);
+
+    auto f = [&](std::size_t row_block) {
+        const std::size_t m_begin = row_block * RowBlockSize;
+        const std::size_t m_end   = std::min(m_begin + RowBlockSize, M);
+
+        std::vector<int32_t> c((m_end - m_begin) * N);
+
+        for(std::size_t n_begin = 0; n_begin < N; n_begin += column_block_size)
+        {
+            const std::size_t n_end = std::min(n_begin + column_block_size, N);
+
+            for(std::size_t m = m_begin; m < m_end; ++m)
+            {
+                const int8_t* p_a_row = p_a + m * K;
+                int32_t* p_c_row      = c.data() + (m - m_begin) * N;
+
+                std::size_t n = n_begin;
+                for(; n + 4 <= n_end; n += 4)
+                {
+                    DotColumns<4>(p_a_row, p_b + n * K, K, p_c_row + n);
+                }
+                for(; n < n_end; ++n)
+                {
+                    DotColumns<1>(p_a_row, p_b + n * K, K, p_c_row + n);
+                }
+            }
+        }
+
+        for(std::size_t m = m_begin; m < m_end; ++m)
+        {
+            epilogue(m, c.data() + (m - m_begin) * N);
+        }
+    };
+
+    make_ParallelTensorFunctor(f, num_row_blocks)(std::thread::hardware_concurrency());
+}
+
+// Spatial multi-index of the flat index i in the spatial dimensions of lengths, a [G, N, C, ...]
+// or [G, K, C, ...] conv tensor
+template <ck::index_t NDimSpatial>
+std::array<std::size_t, NDimSpatial> GetSpatialIndex(std::size_t i,
+                                                     const std::vector<std::size_t>& lengths)
+{
+    std::array<std::size_t, NDimSpatial> idx;
+    for(ck::index_t d = NDimSpatial - 1; d >= 0; --d)
+    {
+        idx[d] = i % lengths[3 + d];
+        i /= lengths[3 + d];
+    }
+    return idx;
+}
+
+// Forward convolution of in [G, N, C, Di, Hi, Wi] by wei [G, K, C, Z, Y, X] into an output of
+// out_lengths [G, N, K, Do, Ho, Wo], then epilogue(g, n, o, p_acc_row) for every output position,
+// p_acc_row holding the K outputs at (g, n, :, o). For every (g, n), the output is the GEMM of the
+// [Do * Ho * Wo, C * Z * Y * X] patches of the input (im2col, by chunks of rows) by the
+// [K, C * Z * Y * X] weights.
+template <ck::index_t NDimSpatial, typename Epilogue>
+void Conv(const Tensor<int8_t>& input,
+          const Tensor<int8_t>& weight,
+          const std::vector<std::size_t>& out_lengths,
+          const std::vector<ck::long_index_t>& conv_strides,
+          const std::vector<ck::long_index_t>& conv_dilations,
+          const std::vector<ck::long_index_t>& in_left_pads,
+          Epilogue epilogue)
+{
+    constexpr std::size_t RowChunkSize = 1 << 12;
+
+    const auto& in_lengths  = input.GetLengths();
+    const auto& in_strides  = input.GetStrides();
+    const auto& wei_lengths = weight.GetLengths();
+    const auto& wei_strides = weight.GetStrides();
+
+    const std::size_t G = out_lengths[0];
+    const std::size_t N = out_lengths[1];
+    const std::size_t K = out_lengths[2];
+    const std::size_t C = wei_lengths[2];
+
+    std::size_t filter_size = 1;
+    std::size_t output_size = 1;
+    for(ck::index_t d = 0; d < NDimSpatial; ++d)
+    {
+        filter_size *= wei_lengths[3 + d];
+        output_size *= out_lengths[3 + d];
+    }
+    const std::size_t gemm_k = C * filter_size;
+
+    for(std::size_t g = 0; g < G; ++g)
+    {
+        const auto wei = Pack(K, gemm_k, [&](std::size_t k, std::size_t j) {
+            const auto f = GetSpatialIndex<NDimSpatial>(j % filter_size, wei_lengths);
+
+            std::size_t offset =
+                g * wei_strides[0] + k * wei_strides[1] + j / filter_size * wei_strides[2];
+            for(ck::index_t d = 0; d < NDimSpatial; ++d)
+            {
+                offset += f[d] * wei_strides[3 + d];
+            }
+            return weight.mData[offset];
+        });
+
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            for(std::size_t row_begin = 0; row_begin < output_size; row_begin += RowChunkSize)
+            {
+                const std::size_t num_rows = std::min(RowChunkSize, output_size - row_begin);
+
+                const auto in =
+                    Pack(num_rows, gemm_k, [&](std::size_t r, std::size_t j) -> int8_t {
+                        const auto o = GetSpatialIndex<NDimSpatial>(row_begin + r, out_lengths);
+                        const auto f = GetSpatialIndex<NDimSpatial>(j % filter_size, wei_lengths);
+
+                        std::size_t offset =
+                            g * in_strides[0] + n * in_strides[1] + j / filter_size * in_strides[2];
+                        for(ck::index_t d = 0; d < NDimSpatial; ++d)
+                        {
+                            const auto i = static_cast<ck::long_index_t>(o[d]) * conv_strides[d] +
+                                           static_cast<ck::long_index_t>(f[d]) * conv_dilations[d] -
+                                           in_left_pads[d];
+                            if(i < 0 || static_cast<std::size_t>(i) >= in_lengths[3 + d])
+                            {
+                                return 0;
+                            }
+                            offset += static_cast<std::size_t>(i) * in_strides[3 + d];
+                        }
+                        return input.mData[offset];
+                    });
+
+                Gemm(in.data(),
+                     wei.data(),
+                     num_rows,
+                     K,
+                     gemm_k,
+                     [&](std::size_t r, const int32_t* p_acc_row) {
+                         epilogue(g,
+                                  n,
+                                  GetSpatialIndex<NDimSpatial>(row_begin + r, out_lengths),
+                                  p_acc_row);
+                     });
+            }
+        }
+    }
+}
+
+} // namespace host_int8_gemm
+} // namespace ck
@@ -0,0 +1,673 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/type_convert.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+// Host engine shared by the normalization references (layernorm, groupnorm and batchnorm).
+//
+// The dimensions of a normalization are split into invariant dimensions (rows) and reduce
+// dimensions. Every tensor taking part in the normalization is described by its strides over all
+// dimensions (0 along broadcast dimensions), so x, y, gamma, mean, ... are addressed the same way.
+// The reduce space of a row is walked as runs along its last (fastest) dimension, and the rows are
+// processed on all CPU threads. Rows with a large reduce space are split into chunks whose partial
+// results are merged, so a few rows still use all threads.
+namespace ck {
+namespace host_normalization {
+
+// Mean and M2 (sum of squared differences to the mean) of a sequence, updated and merged as in
+// ck_tile/ops/welford: variance is M2 / count
+template <typename T>
+struct WelfordState
+{
+    T mean             = 0;
+    T m2               = 0;
+    long_index_t count = 0;
+
+    void Update(T x)
+    {
+        ++count;
+        const T delta = x - mean;
+        mean += delta / static_cast<T>(count);
+        m2 += delta * (x - mean);
+    }
+
+    // Chan's parallel merge
+    void Merge(const WelfordState& other)
+    {
+        const long_index_t new_count = count + other.count;
+        const T nb_over_n =
+            new_count == 0 ? T{0} : static_cast<T>(other.count) / static_cast<T>(new_count);
+        const T delta = other.mean - mean;
+
+        mean += delta * nb_over_n;
+        m2 += other.m2 + delta * delta * static_cast<T>(count) * nb_over_n;
+        count = new_count;
+    }
+
+    T GetVariance() const { return count == 0 ? T{0} : m2 / static_cast<T>(count); }
+};
+
+// Accumulate the run p_x[0], p_x[stride], ... of length elements into state. The run is processed
+// by NumLane interleaved Welford states sharing the count, so that the lanes are independent and
+// the loop vectorizes, the lanes are merged into state at the end.
+template <index_t NumLane = 8, typename T, typename XDataType>
+void welford_update(WelfordState<T>& state,
+                    const XDataType* p_x,
+                    std::size_t stride,
+                    std::size_t length)
+{
+    const std::size_t num_step = length / NumLane;
+
+    if(num_step < 2)
+    {
+        for(std::size_t i = 0; i < length; ++i)
+        {
+            state.Update(type_convert<T>(p_x[i * stride]));
+        }
+        return;
+    }
+
+    T mean[NumLane] = {};
+    T m2[NumLane]   = {};
+
+    for(std::size_t step = 0; step < num_step; ++step)
+    {
+        const T count           = static_cast<T>(step + 1);
+        const XDataType* p_lane = p_x + step * NumLane * stride;
+
+        for(index_t lane = 0; lane < NumLane; ++lane)
+        {
+            const T x     = type_convert<T>(p_lane[lane * stride]);
+            const T delta = x - mean[lane];
+            mean[lane] += delta / count;
+            m2[lane] += delta * (x - mean[lane]);
+        }
+    }
+
+    for(index_t lane = 0; lane < NumLane; ++lane)
+    {
+        state.Merge(WelfordState<T>{mean[lane], m2[lane], static_cast<long_index_t>(num_step)});
+    }
+
+    for(std::size_t i = num_step * NumLane; i < length; ++i)
+    {
+        state.Update(type_convert<T>(p_x[i * stride]));
+    }
+}
+
+// Sums of NumValue values, merged by addition
+template <typename T, index_t NumValue>
+struct SumState
+{
+    std::array<T, NumValue> sums{};
+
+    void Merge(const SumState& other)
+    {
+        for(index_t i = 0; i < NumValue; ++i)
+        {
+            sums[i] += other.sums[i];
+        }
+    }
+};
+
+// Index space over some dimensions of NumTensor tensors, the last dimension is the fastest
+template <index_t NumTensor>
+struct StridedSpace
+{
+    using Offsets = std::array<std::size_t, NumTensor>;
+
+    std::vector<std::size_t> lengths;
+    std::vector<Offsets> strides; // strides of all tensors for each dimension
+
+    // Append a (faster) dimension. Dimensions of length 1 are dropped, and the dimension is merged
+    // into the previous one if that is contiguous to it in all tensors.
+    void AddDim(std::size_t length, const Offsets& dim_strides)
+    {
+        if(length == 1)
+        {
+            return;
+        }
+
+        if(!lengths.empty())
+        {
+            bool is_contiguous = true;
+            for(index_t t = 0; t < NumTensor; ++t)
+            {
+                is_contiguous = is_contiguous && strides.back()[t] == dim_strides[t] * length;
+            }
+
+            if(is_contiguous)
+            {
+                lengths.back() *= length;
+                strides.back() = dim_strides;
+                return;
+            }
+        }
+
+        lengths.push_back(length);
+        strides.push_back(dim_strides);
+    }
+
+    std::size_t GetSize() const
+    {
+        std::size_t size = 1;
+        for(const auto length : lengths)
+        {
+            size *= length;
+        }
+        return size;
+    }
+
+    // Offsets of the linear index i added to offsets
+    Offsets GetOffsets(std::size_t i, Offsets offsets = {}) const
+    {
+        for(std::size_t dim = lengths.size(); dim-- > 0;)
+        {
+            const std::size_t idx = i % lengths[dim];
+            i /= lengths[dim];
+
+            for(index_t t = 0; t < NumTensor; ++t)
+            {
+                offsets[t] += idx * strides[dim][t];
+            }
+        }
+        return offsets;
+    }
+
+    // Call f(offsets, run_strides, run_length) for the runs of [begin, end) along the last
+    // dimension, offsets are relative to base
+    template <typename F>
+    void ForEachRun(std::size_t begin, std::size_t end, const Offsets& base, F&& f) const
+    {
+        if(lengths.empty())
+        {
+            if(begin < end)
+            {
+                f(base, Offsets{}, std::size_t{1});
+            }
+            return;
+        }
+
+        const std::size_t inner_length = lengths.back();
+        for(std::size_t i = begin; i < end;)
+        {
+            const std::size_t length = std::min(inner_length - i % inner_length, end - i);
+            f(GetOffsets(i, base), strides.back(), length);
+            i += length;
+        }
+    }
+};
+
+template <index_t NumTensor>
+struct NormalizationSpace
+{
+    StridedSpace<NumTensor> rows;   // invariant dimensions
+    StridedSpace<NumTensor> reduce; // reduce dimensions
+};
+
+template <typename ReduceDims>
+std::vector<int> get_invariant_dims(std::size_t rank, const ReduceDims& reduce_dims)
+{
+    std::vector<int> invariant_dims;
+    for(int dim = 0; dim < static_cast<int>(rank); ++dim)
+    {
+        if(std::find(reduce_dims.begin(), reduce_dims.end(), dim) == reduce_dims.end())
+        {
+            invariant_dims.push_back(dim);
+        }
+    }
+    return invariant_dims;
+}
+
+// Strides over all rank dimensions of a tensor that has the dimensions dims (in order of its own
+// dimensions) and is broadcast along the others
+template <typename Dims, typename Strides>
+std::vector<std::size_t> expand_strides(std::size_t rank, const Dims& dims, const Strides& strides)
+{
+    std::vector<std::size_t> full_strides(rank, 0);
+
+    auto stride = strides.begin();
+    for(const auto dim : dims)
+    {
+        full_strides.at(dim) = *stride++;
+    }
+    return full_strides;
+}
+
+// tensor_strides are the strides of each tensor over all dimensions, see expand_strides()
+template <index_t NumTensor, typename Lengths, typename ReduceDims>
+NormalizationSpace<NumTensor>
+make_normalization_space(const Lengths& lengths,
+                         const ReduceDims& reduce_dims,
+                         const std::array<std::vector<std::size_t>, NumTensor>& tensor_strides)
+{
+    NormalizationSpace<NumTensor> space;
+
+    for(std::size_t dim = 0; dim < lengths.size(); ++dim)
+    {
+        typename StridedSpace<NumTensor>::Offsets dim_strides;
+        for(index_t t = 0; t < NumTensor; ++t)
+        {
+            dim_strides[t] = tensor_strides[t].at(dim);
+        }
+
+        const bool is_reduce_dim =
+            std::find(reduce_dims.begin(), reduce_dims.end(), static_cast<int>(dim)) !=
+            reduce_dims.end();
+
+        (is_reduce_dim ? space.reduce : space.rows).AddDim(lengths[dim], dim_strides);
+    }
+    return space;
+}
+
+// Call f(i) for i in [0, num_work) on all CPU threads, a contiguous range of i per thread
+template <typename F>
+void parallel_for(std::size_t num_work, F&& f)
+{
+    const std::size_t num_thread = std::min<std::size_t>(
+        std::max(1u, std::thread::hardware_concurrency()), std::max<std::size_t>(num_work, 1));
+    const std::size_t work_per_thread = (num_work + num_thread - 1) / num_thread;
+
+    auto run_range = [&f](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; ++i)
+        {
+            f(i);
+        }
+    };
+
+    std::vector<joinable_thread> threads;
+    threads.reserve(num_thread);
+    for(std::size_t it = 1; it < num_thread; ++it)
+    {
+        const std::size_t begin = std::min(it * work_per_thread, num_work);
+        const std::size_t end   = std::min(begin + work_per_thread, num_work);
+        threads.emplace_back(run_range, begin, end);
+    }
+    run_range(0, std::min(work_per_thread, num_work));
+}
+
+// Number of chunks the reduce space of each row is split into
+inline std::size_t get_num_chunk(std::size_t num_row, std::size_t reduce_size)
+{
+    constexpr std::size_t min_chunk_size = 4096;
+
+    const std::size_t num_thread = std::max(1u, std::thread::hardware_concurrency());
+    const std::size_t max_chunk  = std::max<std::size_t>(reduce_size / min_chunk_size, 1);
+
+    return std::min((num_thread + num_row - 1) / std::max<std::size_t>(num_row, 1), max_chunk);
+}
+
+// Reduce the reduce space of each row into a State, f_run(row, state, offsets, run_strides,
+// run_length) accumulates a run. Partial states of the chunks of a row are merged in order.
+template <typename State, index_t NumTensor, typename FRun>
+std::vector<State> reduce_rows(const NormalizationSpace<NumTensor>& space, FRun&& f_run)
+{
+    const std::size_t num_row     = space.rows.GetSize();
+    const std::size_t reduce_size = space.reduce.GetSize();
+    const std::size_t num_chunk   = get_num_chunk(num_row, reduce_size);
+
+    std::vector<State> partial_states(num_row * num_chunk);
+
+    parallel_for(num_row * num_chunk, [&](std::size_t i) {
+        const std::size_t row   = i / num_chunk;
+        const std::size_t chunk = i % num_chunk;
+
+        space.reduce.ForEachRun(reduce_size * chunk / num_chunk,
+                                reduce_size * (chunk + 1) / num_chunk,
+                                space.rows.GetOffsets(row),
+                                [&](const auto& offsets, const auto& strides, std::size_t length) {
+                                    f_run(row, partial_states[i], offsets, strides, length);
+                                });
+    });
+
+    if(num_chunk == 1)
+    {
+        return partial_states;
+    }
+
+    std::vector<State> states(num_row);
+    for(std::size_t row = 0; row < num_row; ++row)
+    {
+        states[row] = partial_states[row * num_chunk];
+        for(std::size_t chunk = 1; chunk < num_chunk; ++chunk)
+        {
+            states[row].Merge(partial_states[row * num_chunk + chunk]);
+        }
+    }
+    return states;
+}
+
+// Reduce the reduce space of a single row into a State like reduce_rows(), with the same chunks
+// merged in the same order so that the result is the same, but on the calling thread only
+template <typename State, index_t NumTensor, typename FRun>
+State reduce_row(const NormalizationSpace<NumTensor>& space, std::size_t row, FRun&& f_run)
+{
+    const std::size_t num_row     = space.rows.GetSize();
+    const std::size_t reduce_size = space.reduce.GetSize();
+    const std::size_t num_chunk   = get_num_chunk(num_row, reduce_size);
+
+    State state;
+    for(std::size_t chunk = 0; chunk < num_chunk; ++chunk)
+    {
+        State partial_state;
+        space.reduce.ForEachRun(reduce_size * chunk / num_chunk,
+                                reduce_size * (chunk + 1) / num_chunk,
+                                space.rows.GetOffsets(row),
+                                [&](const auto& offsets, const auto& strides, std::size_t length) {
+                                    f_run(row, partial_state, offsets, strides, length);
+                                });
+
+        if(chunk == 0)
+        {
+            state = partial_state;
+        }
+        else
+        {
+            state.Merge(partial_state);
+        }
+    }
+    return state;
+}
+
+// Row of the element idx (over all dimensions) of a space made by make_normalization_space(),
+// the rows are ordered like the invariant dimensions
+template <typename Lengths, typename ReduceDims, typename Index>
+std::size_t
+get_row_of_element(const Lengths& lengths, const ReduceDims& reduce_dims, const Index& idx)
+{
+    std::size_t row = 0;
+    for(const int dim : get_invariant_dims(lengths.size(), reduce_dims))
+    {
+        row = row * lengths[dim] + idx[dim];
+    }
+    return row;
+}
+
+// Call f_run(row, offsets, run_strides, run_length) for all runs of all rows on all CPU threads
+template <index_t NumTensor, typename FRun>
+void for_each_row_run(const NormalizationSpace<NumTensor>& space, FRun&& f_run)
+{
+    const std::size_t num_row     = space.rows.GetSize();
+    const std::size_t reduce_size = space.reduce.GetSize();
+    const std::size_t num_chunk   = get_num_chunk(num_row, reduce_size);
+
+    parallel_for(num_row * num_chunk, [&](std::size_t i) {
+        const std::size_t row   = i / num_chunk;
+        const std::size_t chunk = i % num_chunk;
+
+        space.reduce.ForEachRun(reduce_size * chunk / num_chunk,
+                                reduce_size * (chunk + 1) / num_chunk,
+                                space.rows.GetOffsets(row),
+                                [&](const auto& offsets, const auto& strides, std::size_t length) {
+                                    f_run(row, offsets, strides, length);
+                                });
+    });
+}
+
+// Welford mean/variance over the reduce space of each row, x is tensor XTensor of the space
+template <typename ComputeDataType, index_t XTensor = 0, index_t NumTensor, typename XDataType>
+std::vector<WelfordState<ComputeDataType>>
+welford_rows(const NormalizationSpace<NumTensor>& space, const XDataType* p_x)
+{
+    return reduce_rows<WelfordState<ComputeDataType>>(
+        space,
+        [&](std::size_t,
+            auto& state,
+            const auto& offsets,
+            const auto& strides,
+            std::size_t length) {
+            welford_update(state, p_x + offsets[XTensor], strides[XTensor], length);
+        });
+}
+
+// Welford mean/variance over the reduce space of a single row, the same as welford_rows()[row]
+template <typename ComputeDataType, index_t XTensor = 0, index_t NumTensor, typename XDataType>
+WelfordState<ComputeDataType>
+welford_row(const NormalizationSpace<NumTensor>& space, std::size_t row, const XDataType* p_x)
+{
+    return reduce_row<WelfordState<ComputeDataType>>(
+        space,
+        row,
+        [&](std::size_t,
+            auto& state,
+            const auto& offsets,
+            const auto& strides,
+            std::size_t length) {
+            welford_update(state, p_x + offsets[XTensor], strides[XTensor], length);
+        });
+}
+
+namespace detail {
+
+// y = gamma * (x - mean) * inv_std + beta along a run of a row
+template <typename ComputeDataType,
+          typename Offsets,
+          typename XDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename YDataType,
+          typename YElementwiseOperation>
+void normalize_run(const Offsets& offsets,
+                   const Offsets& strides,
+                   std::size_t length,
+                   ComputeDataType mean,
+                   ComputeDataType inv_std,
+                   const XDataType* p_x,
+                   const GammaDataType* p_gamma,
+                   const BetaDataType* p_beta,
+                   YDataType* p_y,
+                   const YElementwiseOperation& y_elementwise_op)
+{
+    for(std::size_t i = 0; i < length; ++i)
+    {
+        const auto x     = type_convert<ComputeDataType>(p_x[offsets[0] + i * strides[0]]);
+        const auto gamma = type_convert<ComputeDataType>(p_gamma[offsets[2] + i * strides[2]]);
+        const auto beta  = type_convert<ComputeDataType>(p_beta[offsets[3] + i * strides[3]]);
+
+        ComputeDataType y = (x - mean) * inv_std * gamma + beta;
+        y_elementwise_op(y, y);
+        p_y[offsets[1] + i * strides[1]] = type_convert<YDataType>(y);
+    }
+}
+
+} // namespace detail
+
+// y = gamma * (x - mean) * inv_std + beta with the mean and inv_std of each row, x, y, gamma and
+// beta are the tensors 0, 1, 2 and 3 of the space
+template <typename ComputeDataType,
+          index_t NumTensor,
+          typename XDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename YDataType,
+          typename YElementwiseOperation>
+void normalize_rows(const NormalizationSpace<NumTensor>& space,
+                    const std::vector<ComputeDataType>& mean,
+                    const std::vector<ComputeDataType>& inv_std,
+                    const XDataType* p_x,
+                    const GammaDataType* p_gamma,
+                    const BetaDataType* p_beta,
+                    YDataType* p_y,
+                    const YElementwiseOperation& y_elementwise_op)
+{
+    static_assert(NumTensor >= 4, "x, y, gamma and beta are required");
+
+    for_each_row_run(
+        space,
+        [&](std::size_t row, const auto& offsets, const auto& strides, std::size_t length) {
+            detail::normalize_run(offsets,
+                                  strides,
+                                  length,
+                                  mean[row],
+                                  inv_std[row],
+                                  p_x,
+                                  p_gamma,
+                                  p_beta,
+                                  p_y,
+                                  y_elementwise_op);
+        });
+}
+
+// normalize_rows() of a single row, on the calling thread
+template <typename ComputeDataType,
+          index_t NumTensor,
+          typename XDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename YDataType,
+          typename YElementwiseOperation>
+void normalize_row(const NormalizationSpace<NumTensor>& space,
+                   std::size_t row,
+                   ComputeDataType mean,
+                   ComputeDataType inv_std,
+                   const XDataType* p_x,
+                   const GammaDataType* p_gamma,
+                   const BetaDataType* p_beta,
+                   YDataType* p_y,
+                   const YElementwiseOperation& y_elementwise_op)
+{
+    static_assert(NumTensor >= 4, "x, y, gamma and beta are required");
+
+    space.reduce.ForEachRun(
+        0,
+        space.reduce.GetSize(),
+        space.rows.GetOffsets(row),
+        [&](const auto& offsets, const auto& strides, std::size_t length) {
+            detail::normalize_run(offsets,
+                                  strides,
+                                  length,
+                                  mean,
+                                  inv_std,
+                                  p_x,
+                                  p_gamma,
+                                  p_beta,
+                                  p_y,
+                                  y_elementwise_op);
+        });
+}
+
+// Gradient of x of layernorm and groupnorm, dy, x, gamma and dx are the tensors 0, 1, 2 and 3
+// of the space. Per row:
+//     ds = sum(dy * gamma * x), db = sum(dy * gamma)
+//     b  = (db * mean - ds) * rstd^3 / reduce_size, c = -b * mean - db * rstd / reduce_size
+//     dx = dy * gamma * rstd + b * x + c
+template <typename ComputeDataType,
+          index_t NumTensor,
+          typename DYDataType,
+          typename XDataType,
+          typename GammaDataType,
+          typename DXDataType>
+void normalization_bwd_data(const NormalizationSpace<NumTensor>& space,
+                            const std::vector<ComputeDataType>& mean,
+                            const std::vector<ComputeDataType>& rstd,
+                            const DYDataType* p_dy,
+                            const XDataType* p_x,
+                            const GammaDataType* p_gamma,
+                            DXDataType* p_dx)
+{
+    static_assert(NumTensor >= 4, "dy, x, gamma and dx are required");
+
+    const auto sums = reduce_rows<SumState<ComputeDataType, 2>>(
+        space,
+        [&](std::size_t,
+            auto& state,
+            const auto& offsets,
+            const auto& strides,
+            std::size_t length) {
+            ComputeDataType ds = 0;
+            ComputeDataType db = 0;
+            for(std::size_t i = 0; i < length; ++i)
+            {
+                const auto dy = type_convert<ComputeDataType>(p_dy[offsets[0] + i * strides[0]]);
+                const auto x  = type_convert<ComputeDataType>(p_x[offsets[1] + i * strides[1]]);
+                const auto gamma =
+                    type_convert<ComputeDataType>(p_gamma[offsets[2] + i * strides[2]]);
+
+                ds += dy * gamma * x;
+                db += dy * gamma;
+            }
+            state.sums[0] += ds;
+            state.sums[1] += db;
+        });
+
+    const auto reduce_size = static_cast<ComputeDataType>(space.reduce.GetSize());
+
+    for_each_row_run(
+        space,
+        [&](std::size_t row, const auto& offsets, const auto& strides, std::size_t length) {
+            const ComputeDataType ds = sums[row].sums[0];
+            const ComputeDataType db = sums[row].sums[1];
+            const ComputeDataType b =
+                (db * mean[row] - ds) * rstd[row] * rstd[row] * rstd[row] / reduce_size;
+            const ComputeDataType c = -b * mean[row] - db * rstd[row] / reduce_size;
+
+            for(std::size_t i = 0; i < length; ++i)
+            {
+                const auto dy = type_convert<ComputeDataType>(p_dy[offsets[0] + i * strides[0]]);
+                const auto x  = type_convert<ComputeDataType>(p_x[offsets[1] + i * strides[1]]);
+                const auto gamma =
+                    type_convert<ComputeDataType>(p_gamma[offsets[2] + i * strides[2]]);
+
+                p_dx[offsets[3] + i * strides[3]] =
+                    type_convert<DXDataType>(dy * gamma * rstd[row] + b * x + c);
+            }
+        });
+}
+
+// Gradient of gamma and beta of layernorm and groupnorm. The rows of the space are the dimensions
+// of gamma, dy, x, mean and rstd are the tensors 0, 1, 2 and 3 of the space. Per row:
+//     dgamma = sum(dy * (x - mean) * rstd), dbeta = sum(dy)
+template <typename ComputeDataType,
+          index_t NumTensor,
+          typename DYDataType,
+          typename XDataType,
+          typename MeanInvStdDataType>
+std::vector<SumState<ComputeDataType, 2>>
+normalization_bwd_gamma_beta(const NormalizationSpace<NumTensor>& space,
+                             const DYDataType* p_dy,
+                             const XDataType* p_x,
+                             const MeanInvStdDataType* p_mean,
+                             const MeanInvStdDataType* p_rstd)
+{
+    static_assert(NumTensor >= 4, "dy, x, mean and rstd are required");
+
+    return reduce_rows<SumState<ComputeDataType, 2>>(
+        space,
+        [&](std::size_t,
+            auto& state,
+            const auto& offsets,
+            const auto& strides,
+            std::size_t length) {
+            ComputeDataType dgamma = 0;
+            ComputeDataType dbeta  = 0;
+            for(std::size_t i = 0; i < length; ++i)
+            {
+                const auto dy = type_convert<ComputeDataType>(p_dy[offsets[0] + i * strides[0]]);
+                const auto x  = type_convert<ComputeDataType>(p_x[offsets[1] + i * strides[1]]);
+                const auto mean =
+                    type_convert<ComputeDataType>(p_mean[offsets[2] + i * strides[2]]);
+                const auto rstd =
+                    type_convert<ComputeDataType>(p_rstd[offsets[3] + i * strides[3]]);
+
+                dgamma += dy * rstd * (x - mean);
+                dbeta += dy;
+            }
+            state.sums[0] += dgamma;
+            state.sums[1] += dbeta;
+        });
+}
+
+} // namespace host_normalization
+} // namespace ck
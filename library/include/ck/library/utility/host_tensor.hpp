@@ -4,10 +4,15 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <iterator>
 #include <numeric>
 #include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -259,6 +264,68 @@ auto make_ParallelTensorFunctor(F f, Xs... xs)
     return ParallelTensorFunctor<F, Xs...>(f, xs...);
 }
 
+namespace ck {
+namespace utils {
+
+// Pack num values of [-8, 7] into (num + 1) / 2 bytes of pk_int4_t, 8 values at a time in a
+// 64-bit register (the host is little-endian)
+inline void pack_int4(const int8_t* p_src, std::size_t num, pk_int4_t* p_dst)
+{
+    std::size_t i = 0;
+    for(; i + 8 <= num; i += 8)
+    {
+        std::uint64_t x;
+        std::memcpy(&x, p_src + i, 8);
+
+        // 16-bit lanes of (low nibble, high nibble) to bytes
+        x = (x & 0x0F0F0F0F0F0F0F0Full) | ((x & 0x0F0F0F0F0F0F0F0Full) >> 4);
+        x &= 0x00FF00FF00FF00FFull;
+        x = (x | (x >> 8)) & 0x0000FFFF0000FFFFull;
+        x = (x | (x >> 16)) & 0x00000000FFFFFFFFull;
+
+        const auto y = static_cast<std::uint32_t>(x);
+        std::memcpy(p_dst + i / 2, &y, 4);
+    }
+    for(; i < num; i += 2)
+    {
+        const int lo = p_src[i] & 0xF;
+        const int hi = i + 1 < num ? p_src[i + 1] & 0xF : 0;
+
+        p_dst[i / 2].data = static_cast<int8_t>(lo | (hi << 4));
+    }
+}
+
+// Unpack num values from (num + 1) / 2 bytes of pk_int4_t, inverse of pack_int4()
+inline void unpack_int4(const pk_int4_t* p_src, std::size_t num, int8_t* p_dst)
+{
+    std::size_t i = 0;
+    for(; i + 8 <= num; i += 8)
+    {
+        std::uint32_t y;
+        std::memcpy(&y, p_src + i / 2, 4);
+
+        // bytes to 16-bit lanes of (low nibble, high nibble)
+        std::uint64_t x = y;
+        x = (x | (x << 16)) & 0x0000FFFF0000FFFFull;
+        x = (x | (x << 8)) & 0x00FF00FF00FF00FFull;
+        x = (x & 0x000F000F000F000Full) | ((x & 0x00F000F000F000F0ull) << 4);
+
+        // sign extension, 0xF0 is added to the bytes with bit 3 set
+        x |= (x & 0x0808080808080808ull) * 0x1E;
+
+        std::memcpy(p_dst + i, &x, 8);
+    }
+    for(; i < num; ++i)
+    {
+        const int nibble = (static_cast<std::uint8_t>(p_src[i / 2].data) >> (4 * (i % 2))) & 0xF;
+
+        p_dst[i] = static_cast<int8_t>((nibble ^ 8) - 8);
+    }
+}
+
+} // namespace utils
+} // namespace ck
+
 template <typename T>
 struct Tensor
 {
@@ -374,95 +441,108 @@ struct Tensor
         ForEach_impl(std::forward<const F>(f), idx, size_t(0));
     }
 
+    // Maximum rank of the tensors filled by GenerateTensorValue()
+    static constexpr std::size_t MaxGenerateRank = 16;
+
+    // Elements generated by a thread at least, below which more threads do not help
+    static constexpr std::size_t MinGeneratePerThread = 1 << 14;
+
+    // Set each element to g(i0, i1, ...) of its multi-index. The linear index range is split in
+    // contiguous chunks, one per thread, walked row by row of the last dimension
     template <typename G>
     void GenerateTensorValue(G g, std::size_t num_thread = 1)
     {
-        switch(mDesc.GetNumOfDimension())
+        const auto ranks = std::make_index_sequence<MaxGenerateRank>{};
+        if(!GenerateTensorValueOfAnyRank(g, num_thread, ranks))
         {
-        case 1: {
-            auto f = [&](auto i) { (*this)(i) = g(i); };
-            make_ParallelTensorFunctor(f, mDesc.GetLengths()[0])(num_thread);
-            break;
-        }
-        case 2: {
-            auto f = [&](auto i0, auto i1) { (*this)(i0, i1) = g(i0, i1); };
-            make_ParallelTensorFunctor(f, mDesc.GetLengths()[0], mDesc.GetLengths()[1])(num_thread);
-            break;
-        }
-        case 3: {
-            auto f = [&](auto i0, auto i1, auto i2) { (*this)(i0, i1, i2) = g(i0, i1, i2); };
-            make_ParallelTensorFunctor(
-                f, mDesc.GetLengths()[0], mDesc.GetLengths()[1], mDesc.GetLengths()[2])(num_thread);
-            break;
-        }
-        case 4: {
-            auto f = [&](auto i0, auto i1, auto i2, auto i3) {
-                (*this)(i0, i1, i2, i3) = g(i0, i1, i2, i3);
-            };
-            make_ParallelTensorFunctor(f,
-                                       mDesc.GetLengths()[0],
-                                       mDesc.GetLengths()[1],
-                                       mDesc.GetLengths()[2],
-                                       mDesc.GetLengths()[3])(num_thread);
-            break;
-        }
-        case 5: {
-            auto f = [&](auto i0, auto i1, auto i2, auto i3, auto i4) {
-                (*this)(i0, i1, i2, i3, i4) = g(i0, i1, i2, i3, i4);
-            };
-            make_ParallelTensorFunctor(f,
-                                       mDesc.GetLengths()[0],
-                                       mDesc.GetLengths()[1],
-                                       mDesc.GetLengths()[2],
-                                       mDesc.GetLengths()[3],
-                                       mDesc.GetLengths()[4])(num_thread);
-            break;
+            throw std::runtime_error("unspported dimension");
         }
-        case 6: {
-            auto f = [&](auto i0, auto i1, auto i2, auto i3, auto i4, auto i5) {
-                (*this)(i0, i1, i2, i3, i4, i5) = g(i0, i1, i2, i3, i4, i5);
-            };
-            make_ParallelTensorFunctor(f,
-                                       mDesc.GetLengths()[0],
-                                       mDesc.GetLengths()[1],
-                                       mDesc.GetLengths()[2],
-                                       mDesc.GetLengths()[3],
-                                       mDesc.GetLengths()[4],
-                                       mDesc.GetLengths()[5])(num_thread);
-            break;
-        }
-        case 12: {
-            auto f = [&](auto i0,
-                         auto i1,
-                         auto i2,
-                         auto i3,
-                         auto i4,
-                         auto i5,
-                         auto i6,
-                         auto i7,
-                         auto i8,
-                         auto i9,
-                         auto i10,
-                         auto i11) {
-                (*this)(i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11) =
-                    g(i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11);
+    }
+
+    template <typename G, std::size_t... Ranks>
+    bool GenerateTensorValueOfAnyRank(G& g, std::size_t num_thread, std::index_sequence<Ranks...>)
+    {
+        const std::size_t rank = mDesc.GetNumOfDimension();
+        return ((rank == Ranks + 1 &&
+                 GenerateTensorValueOfRank(g, num_thread, std::make_index_sequence<Ranks + 1>{})) ||
+                ...);
+    }
+
+    template <typename G, std::size_t... Dims>
+    bool GenerateTensorValueOfRank(G& g, std::size_t num_thread, std::index_sequence<Dims...>)
+    {
+        constexpr std::size_t NDim = sizeof...(Dims);
+
+        // generators of a fixed rank are only called for that rank
+        if constexpr(std::is_invocable_v<G&, decltype(Dims)...>)
+        {
+            const auto& lens       = mDesc.GetLengths();
+            const auto& strides    = mDesc.GetStrides();
+            const std::size_t size = mDesc.GetElementSize();
+            if(size == 0)
+            {
+                return true;
+            }
+
+            auto generate = [&](std::size_t begin, std::size_t end) {
+                std::array<std::size_t, NDim> idx;
+                for(std::size_t i = begin, d = NDim; d-- > 0;)
+                {
+                    idx[d] = i % lens[d];
+                    i /= lens[d];
+                }
+
+                const std::size_t row_stride = strides[NDim - 1];
+                for(std::size_t i = begin; i < end;)
+                {
+                    const std::size_t row_end = std::min(end, i + lens[NDim - 1] - idx[NDim - 1]);
+
+                    T* p = mData.data() + mDesc.GetOffsetFromMultiIndex(idx[Dims]...);
+                    if(row_stride == 1)
+                    {
+                        for(; i < row_end; ++i, ++idx[NDim - 1])
+                        {
+                            *p++ = g(idx[Dims]...);
+                        }
+                    }
+                    else
+                    {
+                        for(; i < row_end; ++i, ++idx[NDim - 1], p += row_stride)
+                        {
+                            *p = g(idx[Dims]...);
+                        }
+                    }
+
+                    for(std::size_t d = NDim - 1; d > 0 && idx[d] == lens[d]; --d)
+                    {
+                        idx[d] = 0;
+                        ++idx[d - 1];
+                    }
+                }
             };
-            make_ParallelTensorFunctor(f,
-                                       mDesc.GetLengths()[0],
-                                       mDesc.GetLengths()[1],
-                                       mDesc.GetLengths()[2],
-                                       mDesc.GetLengths()[3],
-                                       mDesc.GetLengths()[4],
-                                       mDesc.GetLengths()[5],
-                                       mDesc.GetLengths()[6],
-                                       mDesc.GetLengths()[7],
-                                       mDesc.GetLengths()[8],
-                                       mDesc.GetLengths()[9],
-                                       mDesc.GetLengths()[10],
-                                       mDesc.GetLengths()[11])(num_thread);
-            break;
+
+            num_thread = std::max<std::size_t>(
+                1,
+                std::min(num_thread, (size + MinGeneratePerThread - 1) / MinGeneratePerThread));
+            const std::size_t work_per_thread = (size + num_thread - 1) / num_thread;
+
+            std::vector<joinable_thread> threads(num_thread - 1);
+            for(std::size_t it = 1; it < num_thread; ++it)
+            {
+                const std::size_t iw_begin = std::min(it * work_per_thread, size);
+                const std::size_t iw_end   = std::min((it + 1) * work_per_thread, size);
+
+                threads[it - 1] = joinable_thread(generate, iw_begin, iw_end);
+            }
+            generate(0, std::min(work_per_thread, size));
+
+            return true;
         }
-        default: throw std::runtime_error("unspported dimension");
+        else
+        {
+            (void)g;
+            (void)num_thread;
+            return false;
         }
     }
 
@@ -531,3 +611,294 @@ struct Tensor
     Descriptor mDesc;
     Data mData;
 };
+
+// Reference to an int4 element of a Tensor<ck::pk_int4_t>, reads and writes its nibble
+template <bool IsConst>
+struct PackedInt4Reference
+{
+    using Byte = std::conditional_t<IsConst, const ck::pk_int4_t, ck::pk_int4_t>;
+
+    Byte* mpData;
+    std::size_t mOffset;
+
+    operator int8_t() const
+    {
+        const auto byte  = static_cast<std::uint8_t>(mpData[mOffset / 2].data);
+        const int nibble = (byte >> (4 * (mOffset % 2))) & 0xF;
+
+        return static_cast<int8_t>((nibble ^ 8) - 8);
+    }
+
+    template <bool IsConst_ = IsConst, typename = std::enable_if_t<!IsConst_>>
+    const PackedInt4Reference& operator=(int8_t value) const
+    {
+        const int shift = 4 * (mOffset % 2);
+        auto& byte     = mpData[mOffset / 2].data;
+
+        byte = static_cast<int8_t>((byte & ~(0xF << shift)) | ((value & 0xF) << shift));
+        return *this;
+    }
+
+    // assign the element, not the reference
+    const PackedInt4Reference& operator=(const PackedInt4Reference& other) const
+    {
+        return *this = static_cast<int8_t>(other);
+    }
+
+    template <bool IsConst_>
+    const PackedInt4Reference& operator=(const PackedInt4Reference<IsConst_>& other) const
+    {
+        return *this = static_cast<int8_t>(other);
+    }
+
+    PackedInt4Reference(const PackedInt4Reference&) = default;
+
+    PackedInt4Reference(Byte* p_data, std::size_t offset) : mpData(p_data), mOffset(offset) {}
+
+    friend std::ostream& operator<<(std::ostream& os, const PackedInt4Reference& ref)
+    {
+        return os << static_cast<int>(static_cast<int8_t>(ref));
+    }
+};
+
+// Random access iterator over the int4 elements of a Tensor<ck::pk_int4_t>, the value type is
+// int8_t so that fillers, check_err and LogRange work on the unpacked values
+template <bool IsConst>
+struct PackedInt4Iterator
+{
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = int8_t;
+    using difference_type   = std::ptrdiff_t;
+    using reference         = PackedInt4Reference<IsConst>;
+    using pointer           = void;
+
+    using Byte = typename reference::Byte;
+
+    Byte* mpData;
+    std::size_t mOffset;
+
+    reference operator*() const { return reference{mpData, mOffset}; }
+
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    PackedInt4Iterator& operator++()
+    {
+        ++mOffset;
+        return *this;
+    }
+
+    PackedInt4Iterator operator++(int) { return PackedInt4Iterator{mpData, mOffset++}; }
+
+    PackedInt4Iterator& operator--()
+    {
+        --mOffset;
+        return *this;
+    }
+
+    PackedInt4Iterator operator--(int) { return PackedInt4Iterator{mpData, mOffset--}; }
+
+    PackedInt4Iterator& operator+=(difference_type n)
+    {
+        mOffset += n;
+        return *this;
+    }
+
+    PackedInt4Iterator& operator-=(difference_type n)
+    {
+        mOffset -= n;
+        return *this;
+    }
+
+    friend PackedInt4Iterator operator+(PackedInt4Iterator it, difference_type n)
+    {
+        return it += n;
+    }
+
+    friend PackedInt4Iterator operator+(difference_type n, PackedInt4Iterator it)
+    {
+        return it += n;
+    }
+
+    friend PackedInt4Iterator operator-(PackedInt4Iterator it, difference_type n)
+    {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const PackedInt4Iterator& x, const PackedInt4Iterator& y)
+    {
+        return static_cast<difference_type>(x.mOffset) - static_cast<difference_type>(y.mOffset);
+    }
+
+    friend bool operator==(const PackedInt4Iterator& x, const PackedInt4Iterator& y)
+    {
+        return x.mOffset == y.mOffset;
+    }
+
+    friend bool operator!=(const PackedInt4Iterator& x, const PackedInt4Iterator& y)
+    {
+        return x.mOffset != y.mOffset;
+    }
+
+    friend bool operator<(const PackedInt4Iterator& x, const PackedInt4Iterator& y)
+    {
+        return x.mOffset < y.mOffset;
+    }
+
+    friend bool operator>(const PackedInt4Iterator& x, const PackedInt4Iterator& y)
+    {
+        return y < x;
+    }
+
+    friend bool operator<=(const PackedInt4Iterator& x, const PackedInt4Iterator& y)
+    {
+        return !(y < x);
+    }
+
+    friend bool operator>=(const PackedInt4Iterator& x, const PackedInt4Iterator& y)
+    {
+        return !(x < y);
+    }
+};
+
+// Tensor of int4 values stored two per byte (see ck::pk_int4_t), mData holds the bytes that are
+// uploaded to the device as they are. Elements are accessed through PackedInt4Reference, the
+// element space, size() and the iterators are the ones of the int4 values.
+template <>
+struct Tensor<ck::pk_int4_t>
+{
+    using Descriptor = HostTensorDescriptor;
+    using Data       = std::vector<ck::pk_int4_t>;
+
+    using iterator       = PackedInt4Iterator<false>;
+    using const_iterator = PackedInt4Iterator<true>;
+
+    template <typename X>
+    Tensor(std::initializer_list<X> lens) : Tensor(Descriptor(lens))
+    {
+    }
+
+    template <typename X, typename Y>
+    Tensor(std::initializer_list<X> lens, std::initializer_list<Y> strides)
+        : Tensor(Descriptor(lens, strides))
+    {
+    }
+
+    template <typename Lengths>
+    Tensor(const Lengths& lens) : Tensor(Descriptor(lens))
+    {
+    }
+
+    template <typename Lengths, typename Strides>
+    Tensor(const Lengths& lens, const Strides& strides) : Tensor(Descriptor(lens, strides))
+    {
+    }
+
+    Tensor(const Descriptor& desc) : mDesc(desc), mData((mDesc.GetElementSpaceSize() + 1) / 2)
+    {
+    }
+
+    // unpack into an int8_t buffer once, then convert
+    template <typename OutT>
+    Tensor<OutT> CopyAsType() const
+    {
+        Tensor<OutT> ret(mDesc);
+
+        std::vector<int8_t> values(size());
+        ck::utils::unpack_int4(mData.data(), values.size(), values.data());
+
+        ck::ranges::transform(
+            values, ret.mData.begin(), [](int8_t value) { return ck::type_convert<OutT>(value); });
+
+        return ret;
+    }
+
+    Tensor()              = delete;
+    Tensor(const Tensor&) = default;
+    Tensor(Tensor&&)      = default;
+
+    ~Tensor() = default;
+
+    Tensor& operator=(const Tensor&) = default;
+    Tensor& operator=(Tensor&&) = default;
+
+    // convert into an int8_t buffer, then pack; values are expected to be in [-8, 7]
+    template <typename FromT>
+    explicit Tensor(const Tensor<FromT>& other) : Tensor(other.mDesc)
+    {
+        std::vector<int8_t> values(other.mData.size());
+        ck::ranges::transform(other.mData, values.begin(), [](auto value) {
+            return ck::type_convert<int8_t>(value);
+        });
+
+        ck::utils::pack_int4(values.data(), values.size(), mData.data());
+    }
+
+    decltype(auto) GetLengths() const { return mDesc.GetLengths(); }
+
+    decltype(auto) GetStrides() const { return mDesc.GetStrides(); }
+
+    std::size_t GetNumOfDimension() const { return mDesc.GetNumOfDimension(); }
+
+    std::size_t GetElementSize() const { return mDesc.GetElementSize(); }
+
+    std::size_t GetElementSpaceSize() const { return mDesc.GetElementSpaceSize(); }
+
+    std::size_t GetElementSpaceSizeInBytes() const { return sizeof(ck::pk_int4_t) * mData.size(); }
+
+    void SetZero() { ck::ranges::fill<ck::pk_int4_t>(mData, ck::pk_int4_t{0}); }
+
+    // neighbouring elements share a byte, so the values are generated unpacked by the threads
+    template <typename G>
+    void GenerateTensorValue(G g, std::size_t num_thread = 1)
+    {
+        Tensor<int8_t> values(mDesc);
+        values.GenerateTensorValue(g, num_thread);
+
+        ck::utils::pack_int4(values.mData.data(), values.mData.size(), mData.data());
+    }
+
+    template <typename... Is>
+    std::size_t GetOffsetFromMultiIndex(Is... is) const
+    {
+        return mDesc.GetOffsetFromMultiIndex(is...);
+    }
+
+    template <typename... Is>
+    PackedInt4Reference<false> operator()(Is... is)
+    {
+        return {mData.data(), mDesc.GetOffsetFromMultiIndex(is...)};
+    }
+
+    template <typename... Is>
+    PackedInt4Reference<true> operator()(Is... is) const
+    {
+        return {mData.data(), mDesc.GetOffsetFromMultiIndex(is...)};
+    }
+
+    PackedInt4Reference<false> operator()(std::vector<std::size_t> idx)
+    {
+        return {mData.data(), mDesc.GetOffsetFromMultiIndex(idx)};
+    }
+
+    PackedInt4Reference<true> operator()(std::vector<std::size_t> idx) const
+    {
+        return {mData.data(), mDesc.GetOffsetFromMultiIndex(idx)};
+    }
+
+    iterator begin() { return {mData.data(), 0}; }
+
+    iterator end() { return {mData.data(), size()}; }
+
+    Data::pointer data() { return mData.data(); }
+
+    const_iterator begin() const { return {mData.data(), 0}; }
+
+    const_iterator end() const { return {mData.data(), size()}; }
+
+    Data::const_pointer data() const { return mData.data(); }
+
+    std::size_t size() const { return mDesc.GetElementSpaceSize(); }
+
+    Descriptor mDesc;
+    Data mData;
+};
@@ -1,19 +1,80 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 #include <numeric>
 #include <random>
+#include <type_traits>
 
 #include "ck/ck.hpp"
 
+namespace ck {
+namespace utils {
+
+// Default seed of a random generator, a hash (FNV-1a) of the file and the line where it is
+// constructed: the same from one run to the next and independent of the generators constructed
+// before it. Generators constructed on the same line get the same seed, pass the seed explicitly
+// to make them differ.
+constexpr unsigned int get_source_location_seed(const char* file, unsigned int line)
+{
+    unsigned int seed = 2166136261u;
+    for(; *file != '\0'; ++file)
+    {
+        seed = (seed ^ static_cast<unsigned char>(*file)) * 16777619u;
+    }
+    return (seed ^ line) * 16777619u;
+}
+
+// Random bits as a pure function of a seed and a multi-index (splitmix64 rounds), so that the
+// random tensors do not depend on the number of threads generating them
+template <typename... Is>
+std::uint64_t get_random_bits(std::uint64_t seed, Is... is)
+{
+    auto mix = [](std::uint64_t x) {
+        x += 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    };
+
+    std::uint64_t bits = mix(seed);
+    ((bits = mix(bits ^ static_cast<std::uint64_t>(is))), ...);
+    return bits;
+}
+
+// Uniform in [0, 1), from the 24 high bits
+inline float get_random_unit_float(std::uint64_t bits)
+{
+    return static_cast<float>(bits >> 40) * (1.f / 16777216.f);
+}
+
+// Uniform in [min_value, max_value)
+template <typename... Is>
+int get_random_int(unsigned int seed, int min_value, int max_value, Is... is)
+{
+    const auto range = static_cast<std::uint64_t>(max_value - min_value);
+    return min_value + static_cast<int>(get_random_bits(seed, is...) % range);
+}
+
+// Uniform in [min_value, max_value)
+template <typename... Is>
+float get_random_float(unsigned int seed, float min_value, float max_value, Is... is)
+{
+    const float x = get_random_unit_float(get_random_bits(seed, is...));
+    return min_value + x * (max_value - min_value);
+}
+
+} // namespace utils
+} // namespace ck
+
 template <typename T>
 struct GeneratorTensor_0
 {
     template <typename... Is>
-    T operator()(Is...)
+    T operator()(Is...) const
     {
         return T{0};
     }
@@ -25,7 +86,7 @@ struct GeneratorTensor_1
     T value = 1;
 
     template <typename... Is>
-    T operator()(Is...)
+    T operator()(Is...) const
     {
         return value;
     }
@@ -37,7 +98,7 @@ struct GeneratorTensor_1<ck::half_t>
     float value = 1.0;
 
     template <typename... Is>
-    ck::bhalf_t operator()(Is...)
+    ck::bhalf_t operator()(Is...) const
     {
         return ck::type_convert<ck::half_t>(value);
     }
@@ -49,7 +110,7 @@ struct GeneratorTensor_1<ck::bhalf_t>
     float value = 1.0;
 
     template <typename... Is>
-    ck::bhalf_t operator()(Is...)
+    ck::bhalf_t operator()(Is...) const
     {
         return ck::type_convert<ck::bhalf_t>(value);
     }
@@ -62,7 +123,7 @@ struct GeneratorTensor_1<ck::f8_t>
     float value = 1.0;
 
     template <typename... Is>
-    ck::bhalf_t operator()(Is...)
+    ck::bhalf_t operator()(Is...) const
     {
         return ck::type_convert<ck::f8_t>(value);
     }
@@ -75,7 +136,7 @@ struct GeneratorTensor_1<int8_t>
     int8_t value = 1;
 
     template <typename... Is>
-    int8_t operator()(Is...)
+    int8_t operator()(Is...) const
     {
         return value;
     }
@@ -84,26 +145,28 @@ struct GeneratorTensor_1<int8_t>
 template <typename T>
 struct GeneratorTensor_2
 {
-    int min_value = 0;
-    int max_value = 1;
+    int min_value     = 0;
+    int max_value     = 1;
+    unsigned int seed = ck::utils::get_source_location_seed(__builtin_FILE(), __builtin_LINE());
 
     template <typename... Is>
-    T operator()(Is...)
+    T operator()(Is... is) const
     {
-        return static_cast<T>((std::rand() % (max_value - min_value)) + min_value);
+        return static_cast<T>(ck::utils::get_random_int(seed, min_value, max_value, is...));
     }
 };
 
 template <>
 struct GeneratorTensor_2<ck::bhalf_t>
 {
-    int min_value = 0;
-    int max_value = 1;
+    int min_value     = 0;
+    int max_value     = 1;
+    unsigned int seed = ck::utils::get_source_location_seed(__builtin_FILE(), __builtin_LINE());
 
     template <typename... Is>
-    ck::bhalf_t operator()(Is...)
+    ck::bhalf_t operator()(Is... is) const
     {
-        float tmp = (std::rand() % (max_value - min_value)) + min_value;
+        float tmp = ck::utils::get_random_int(seed, min_value, max_value, is...);
         return ck::type_convert<ck::bhalf_t>(tmp);
     }
 };
@@ -111,13 +174,14 @@ struct GeneratorTensor_2<ck::bhalf_t>
 template <>
 struct GeneratorTensor_2<int8_t>
 {
-    int min_value = 0;
-    int max_value = 1;
+    int min_value     = 0;
+    int max_value     = 1;
+    unsigned int seed = ck::utils::get_source_location_seed(__builtin_FILE(), __builtin_LINE());
 
     template <typename... Is>
-    int8_t operator()(Is...)
+    int8_t operator()(Is... is) const
     {
-        return (std::rand() % (max_value - min_value)) + min_value;
+        return ck::utils::get_random_int(seed, min_value, max_value, is...);
     }
 };
 
@@ -125,13 +189,14 @@ struct GeneratorTensor_2<int8_t>
 template <>
 struct GeneratorTensor_2<ck::f8_t>
 {
-    int min_value = 0;
-    int max_value = 1;
+    int min_value     = 0;
+    int max_value     = 1;
+    unsigned int seed = ck::utils::get_source_location_seed(__builtin_FILE(), __builtin_LINE());
 
     template <typename... Is>
-    ck::f8_t operator()(Is...)
+    ck::f8_t operator()(Is... is) const
     {
-        float tmp = (std::rand() % (max_value - min_value)) + min_value;
+        float tmp = ck::utils::get_random_int(seed, min_value, max_value, is...);
         return ck::type_convert<ck::f8_t>(tmp);
     }
 };
@@ -141,13 +206,14 @@ struct GeneratorTensor_2<ck::f8_t>
 template <>
 struct GeneratorTensor_2<ck::bf8_t>
 {
-    int min_value = 0;
-    int max_value = 1;
+    int min_value     = 0;
+    int max_value     = 1;
+    unsigned int seed = ck::utils::get_source_location_seed(__builtin_FILE(), __builtin_LINE());
 
     template <typename... Is>
-    ck::bf8_t operator()(Is...)
+    ck::bf8_t operator()(Is... is) const
     {
-        float tmp = (std::rand() % (max_value - min_value)) + min_value;
+        float tmp = ck::utils::get_random_int(seed, min_value, max_value, is...);
         return ck::type_convert<ck::bf8_t>(tmp);
     }
 };
@@ -156,30 +222,28 @@ struct GeneratorTensor_2<ck::bf8_t>
 template <typename T>
 struct GeneratorTensor_3
 {
-    float min_value = 0;
-    float max_value = 1;
+    float min_value   = 0;
+    float max_value   = 1;
+    unsigned int seed = ck::utils::get_source_location_seed(__builtin_FILE(), __builtin_LINE());
 
     template <typename... Is>
-    T operator()(Is...)
+    T operator()(Is... is) const
     {
-        float tmp = float(std::rand()) / float(RAND_MAX);
-
-        return static_cast<T>(min_value + tmp * (max_value - min_value));
+        return static_cast<T>(ck::utils::get_random_float(seed, min_value, max_value, is...));
     }
 };
 
 template <>
 struct GeneratorTensor_3<ck::bhalf_t>
 {
-    float min_value = 0;
-    float max_value = 1;
+    float min_value   = 0;
+    float max_value   = 1;
+    unsigned int seed = ck::utils::get_source_location_seed(__builtin_FILE(), __builtin_LINE());
 
     template <typename... Is>
-    ck::bhalf_t operator()(Is...)
+    ck::bhalf_t operator()(Is... is) const
     {
-        float tmp = float(std::rand()) / float(RAND_MAX);
-
-        float fp32_tmp = min_value + tmp * (max_value - min_value);
+        float fp32_tmp = ck::utils::get_random_float(seed, min_value, max_value, is...);
 
         return ck::type_convert<ck::bhalf_t>(fp32_tmp);
     }
@@ -189,15 +253,14 @@ struct GeneratorTensor_3<ck::bhalf_t>
 template <>
 struct GeneratorTensor_3<ck::f8_t>
 {
-    float min_value = 0;
-    float max_value = 1;
+    float min_value   = 0;
+    float max_value   = 1;
+    unsigned int seed = ck::utils::get_source_location_seed(__builtin_FILE(), __builtin_LINE());
 
     template <typename... Is>
-    ck::f8_t operator()(Is...)
+    ck::f8_t operator()(Is... is) const
     {
-        float tmp = float(std::rand()) / float(RAND_MAX);
-
-        float fp32_tmp = min_value + tmp * (max_value - min_value);
+        float fp32_tmp = ck::utils::get_random_float(seed, min_value, max_value, is...);
 
         return ck::type_convert<ck::f8_t>(fp32_tmp);
     }
@@ -208,15 +271,14 @@ struct GeneratorTensor_3<ck::f8_t>
 template <>
 struct GeneratorTensor_3<ck::bf8_t>
 {
-    float min_value = 0;
-    float max_value = 1;
+    float min_value   = 0;
+    float max_value   = 1;
+    unsigned int seed = ck::utils::get_source_location_seed(__builtin_FILE(), __builtin_LINE());
 
     template <typename... Is>
-    ck::bf8_t operator()(Is...)
+    ck::bf8_t operator()(Is... is) const
     {
-        float tmp = float(std::rand()) / float(RAND_MAX);
-
-        float fp32_tmp = min_value + tmp * (max_value - min_value);
+        float fp32_tmp = ck::utils::get_random_float(seed, min_value, max_value, is...);
 
         return ck::type_convert<ck::bf8_t>(fp32_tmp);
     }
@@ -226,16 +288,23 @@ struct GeneratorTensor_3<ck::bf8_t>
 template <typename T>
 struct GeneratorTensor_4
 {
-    std::mt19937 generator;
-    std::normal_distribution<float> distribution;
+    float mean_;
+    float stddev_;
+    unsigned int seed_;
 
     GeneratorTensor_4(float mean, float stddev, unsigned int seed = 1)
-        : generator(seed), distribution(mean, stddev){};
+        : mean_(mean), stddev_(stddev), seed_(seed){};
 
+    // normal distribution, by the Box-Muller transform of 2 uniform values
     template <typename... Is>
-    T operator()(Is...)
+    T operator()(Is... is) const
     {
-        float tmp = distribution(generator);
+        const std::uint64_t bits = ck::utils::get_random_bits(seed_, is...);
+
+        const float u0 = ck::utils::get_random_unit_float(bits) + 1.f / 16777216.f;
+        const float u1 = ck::utils::get_random_unit_float(bits << 24);
+
+        float tmp = mean_ + stddev_ * std::sqrt(-2.f * std::log(u0)) * std::cos(6.2831853f * u1);
 
         return ck::type_convert<T>(tmp);
     }
@@ -259,7 +328,7 @@ struct GeneratorTensor_Checkboard
 template <ck::index_t Dim>
 struct GeneratorTensor_Sequential
 {
-    template <typename... Ts>
+    template <typename... Ts, typename = std::enable_if_t<(sizeof...(Ts) > Dim)>>
     float operator()(Ts... Xs) const
     {
         std::array<ck::index_t, sizeof...(Ts)> dims = {{static_cast<ck::index_t>(Xs)...}};
@@ -272,7 +341,7 @@ struct GeneratorTensor_Diagonal
 {
     T value{1};
 
-    template <typename... Ts>
+    template <typename... Ts, typename = std::enable_if_t<(sizeof...(Ts) >= NumEffectiveDim)>>
     T operator()(Ts... Xs) const
     {
         std::array<ck::index_t, sizeof...(Ts)> dims = {{static_cast<ck::index_t>(Xs)...}};
@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/type_convert.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+// Verification of device results for sweeps over many instances, where computing the full host
+// reference (and comparing all the elements) costs more than running the instances. The checks
+// go from cheap to complete:
+//
+//  1. check_row_sums: the sums of the rows of the result against sums computed from the inputs
+//     without the reference (e.g. get_gemm_reference_row_sums in O(M * K + K * N)). Catches whole
+//     rows or tiles of wrong values.
+//  2. check_err_sampled: the result at a few random indices against the reference computed at
+//     these indices only (e.g. with ReferenceGemm::Invoker::RunElement).
+//  3. check_err against the full reference, only run if one of the above fails, to report the
+//     errors like without sampling.
+namespace ck {
+namespace utils {
+
+namespace detail {
+
+template <typename T>
+double to_double(const T& x)
+{
+    if constexpr(std::is_integral_v<T>)
+    {
+        return static_cast<double>(x);
+    }
+    else
+    {
+        return static_cast<double>(type_convert<float>(x));
+    }
+}
+
+} // namespace detail
+
+// Relative tolerance of the row sums of a result of type T, relative to the magnitudes of the
+// rows. Larger than the rounding of T to allow for the accumulation in lower precision.
+template <typename T>
+constexpr double get_default_row_sum_rtol()
+{
+    if constexpr(std::is_same_v<T, double>)
+        return 1e-10;
+    else if constexpr(std::is_same_v<T, float>)
+        return 1e-4;
+    else if constexpr(std::is_same_v<T, half_t>)
+        return 2e-3;
+    else if constexpr(std::is_same_v<T, bhalf_t>)
+        return 1.6e-2;
+    else if constexpr(std::is_integral_v<T>)
+        return 0;
+    else
+        return 0.13;
+}
+
+// Sums of the rows of a tensor, a row being all the elements with the same index along dimension
+// 0. The sums and the magnitudes (sums of the absolute values) are accumulated in double.
+struct RowSums
+{
+    std::vector<double> sums;
+    std::vector<double> magnitudes;
+};
+
+template <typename T>
+RowSums get_row_sums(const Tensor<T>& t)
+{
+    const auto& lengths = t.mDesc.GetLengths();
+
+    const std::size_t num_row = lengths[0];
+    const std::size_t row_len = t.mDesc.GetElementSize() / std::max<std::size_t>(num_row, 1);
+
+    RowSums row_sums{std::vector<double>(num_row), std::vector<double>(num_row)};
+
+    auto f = [&](auto row) {
+        std::vector<std::size_t> idx(lengths.size(), 0);
+        idx[0] = row;
+
+        double sum       = 0;
+        double magnitude = 0;
+        for(std::size_t i = 0; i < row_len; ++i)
+        {
+            const double x = detail::to_double(t(idx));
+            sum += x;
+            magnitude += std::abs(x);
+
+            // next index of the row, last dimension fastest
+            for(std::size_t d = lengths.size() - 1; d > 0 && ++idx[d] == lengths[d]; --d)
+            {
+                idx[d] = 0;
+            }
+        }
+
+        row_sums.sums[row]       = sum;
+        row_sums.magnitudes[row] = magnitude;
+    };
+
+    make_ParallelTensorFunctor(f, num_row)(std::thread::hardware_concurrency());
+
+    return row_sums;
+}
+
+// Row sums of C = A * B computed from A and B only, sum_n C[m, n] = sum_k A[m, k] * sum_n B[k, n].
+// The magnitudes bound the accumulation errors, sum_k |A[m, k]| * sum_n |B[k, n]|. Only valid for
+// GEMMs without element-wise operations (PassThrough).
+template <typename ADataType, typename BDataType>
+RowSums get_gemm_reference_row_sums(const Tensor<ADataType>& a_m_k, const Tensor<BDataType>& b_k_n)
+{
+    const std::size_t M = a_m_k.mDesc.GetLengths()[0];
+    const std::size_t K = a_m_k.mDesc.GetLengths()[1];
+
+    const RowSums b_row_sums = get_row_sums(b_k_n);
+
+    RowSums row_sums{std::vector<double>(M), std::vector<double>(M)};
+
+    auto f = [&](auto m) {
+        double sum       = 0;
+        double magnitude = 0;
+        for(std::size_t k = 0; k < K; ++k)
+        {
+            const double a = detail::to_double(a_m_k(m, k));
+            sum += a * b_row_sums.sums[k];
+            magnitude += std::abs(a) * b_row_sums.magnitudes[k];
+        }
+
+        row_sums.sums[m]       = sum;
+        row_sums.magnitudes[m] = magnitude;
+    };
+
+    make_ParallelTensorFunctor(f, M)(std::thread::hardware_concurrency());
+
+    return row_sums;
+}
+
+// Compares the row sums of out to the ones of the reference. Row m passes if the difference of the
+// sums is at most rtol * ref.magnitudes[m] + atol * (length of the rows).
+template <typename T>
+bool check_row_sums(const Tensor<T>& out,
+                    const RowSums& ref,
+                    const std::string& msg = "Error: Incorrect row sums!",
+                    double rtol            = get_default_row_sum_rtol<T>(),
+                    double atol            = 0)
+{
+    const RowSums out_row_sums = get_row_sums(out);
+
+    if(out_row_sums.sums.size() != ref.sums.size())
+    {
+        std::cerr << msg << " out rows != ref rows, :" << out_row_sums.sums.size()
+                  << " != " << ref.sums.size() << std::endl;
+        return false;
+    }
+
+    const std::size_t num_row = ref.sums.size();
+    const double row_len =
+        static_cast<double>(out.mDesc.GetElementSize() / std::max<std::size_t>(num_row, 1));
+
+    int err_count = 0;
+    for(std::size_t m = 0; m < num_row; ++m)
+    {
+        const double o   = out_row_sums.sums[m];
+        const double r   = ref.sums[m];
+        const double err = std::abs(o - r);
+
+        if(err > rtol * ref.magnitudes[m] + atol * row_len || !std::isfinite(o))
+        {
+            if(++err_count < 5)
+            {
+                std::cerr << msg << std::setw(12) << std::setprecision(7) << " row " << m
+                          << " sum: " << o << " != " << r << std::endl;
+            }
+        }
+    }
+
+    if(err_count > 0)
+    {
+        std::cerr << msg << " " << err_count << " of " << num_row << " rows are wrong" << std::endl;
+    }
+
+    return err_count == 0;
+}
+
+// Compares out to the reference at num_samples random indices (drawn with seed) plus the first and
+// the last index. ref_at(idx) returns the reference at the index idx (std::vector<std::size_t>).
+// The samples are compared with check_err, tolerances are the ones of check_err for T.
+template <typename T, typename RefAt, typename... Tolerances>
+bool check_err_sampled(const Tensor<T>& out,
+                       RefAt&& ref_at,
+                       std::size_t num_samples,
+                       unsigned seed,
+                       const std::string& msg,
+                       Tolerances... tolerances)
+{
+    const auto& lengths = out.mDesc.GetLengths();
+
+    if(out.mDesc.GetElementSize() == 0)
+    {
+        return true;
+    }
+
+    std::vector<std::vector<std::size_t>> indices;
+    indices.reserve(num_samples + 2);
+
+    indices.emplace_back(lengths.size(), 0);
+    indices.emplace_back(lengths.begin(), lengths.end());
+    for(auto& i : indices.back())
+    {
+        i -= 1;
+    }
+
+    std::mt19937 gen(seed);
+    for(std::size_t s = 0; s < num_samples; ++s)
+    {
+        std::vector<std::size_t> idx(lengths.size());
+        for(std::size_t d = 0; d < lengths.size(); ++d)
+        {
+            idx[d] = std::uniform_int_distribution<std::size_t>{0, lengths[d] - 1}(gen);
+        }
+        indices.push_back(std::move(idx));
+    }
+
+    std::vector<T> out_samples;
+    std::vector<T> ref_samples;
+    out_samples.reserve(indices.size());
+    ref_samples.reserve(indices.size());
+
+    for(const auto& idx : indices)
+    {
+        out_samples.push_back(out(idx));
+        ref_samples.push_back(ref_at(idx));
+    }
+
+    return check_err(out_samples, ref_samples, msg, tolerances...);
+}
+
+} // namespace utils
+} // namespace ck
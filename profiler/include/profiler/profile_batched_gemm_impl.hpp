@@ -21,6 +21,8 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
 
+#include "profiler/profiler_result.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -206,8 +208,9 @@ bool profile_batched_gemm_impl(int do_verification,
 
             std::string op_name = op_ptr->GetTypeString();
 
-            float ave_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            const auto stream_config = StreamConfig{nullptr, time_kernel};
+
+            float ave_time = invoker_ptr->Run(argument_ptr.get(), stream_config);
 
             std::size_t flop = std::size_t(2) * BatchCount * M * N * K;
 
@@ -230,11 +233,13 @@ bool profile_batched_gemm_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            bool instance_pass = true;
             if(do_verification)
             {
                 c_device_buf.FromDevice(c_g_m_n_device_result.mData.data());
 
-                pass = pass & ck::utils::check_err(c_g_m_n_device_result, c_g_m_n_host_result);
+                instance_pass = ck::utils::check_err(c_g_m_n_device_result, c_g_m_n_host_result);
+                pass          = pass & instance_pass;
 
                 if(do_log)
                 {
@@ -247,6 +252,28 @@ bool profile_batched_gemm_impl(int do_verification,
                         << std::endl;
                 }
             }
+
+            auto result = ProfilerResult{"batched_gemm",
+                                         get_data_type_names<ADataType, BDataType, CDataType>(),
+                                         get_layout_names<ALayout, BLayout, CLayout>()};
+            result.AddProblemDim("M", M)
+                .AddProblemDim("N", N)
+                .AddProblemDim("K", K)
+                .AddProblemDim("BatchCount", BatchCount)
+                .AddProblemDim("StrideA", StrideA)
+                .AddProblemDim("StrideB", StrideB)
+                .AddProblemDim("StrideC", StrideC)
+                .AddProblemDim("BatchStrideA", BatchStrideA)
+                .AddProblemDim("BatchStrideB", BatchStrideB)
+                .AddProblemDim("BatchStrideC", BatchStrideC)
+                .SetPerf(op_name,
+                         ave_time,
+                         tflops,
+                         gb_per_sec,
+                         stream_config.cold_niters_,
+                         stream_config.nrepeat_)
+                .SetVerification(do_verification, instance_pass);
+            write_profiler_result(result);
         }
         else
         {
@@ -18,6 +18,8 @@
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_data.hpp"
 
+#include "profiler/profiler_result.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -208,8 +210,9 @@ bool profile_conv_bwd_data_impl(int do_verification,
 
             auto invoker_ptr = op_ptr->MakeInvokerPointer();
 
-            float avg_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            const auto stream_config = StreamConfig{nullptr, time_kernel};
+
+            float avg_time = invoker_ptr->Run(argument_ptr.get(), stream_config);
 
             std::size_t flop      = conv_param.GetFlops();
             std::size_t num_btype = conv_param.GetByte<InDataType, WeiDataType, OutDataType>();
@@ -228,11 +231,13 @@ bool profile_conv_bwd_data_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            bool instance_pass = true;
             if(do_verification)
             {
                 in_device_buf.FromDevice(input_device_result.mData.data());
 
-                pass = pass & ck::utils::check_err(input_device_result, input_host_result);
+                instance_pass = ck::utils::check_err(input_device_result, input_host_result);
+                pass          = pass & instance_pass;
 
                 if(do_log)
                 {
@@ -253,6 +258,20 @@ bool profile_conv_bwd_data_impl(int do_verification,
                     std::cout << std::endl;
                 }
             }
+
+            auto result =
+                ProfilerResult{"conv_bwd_data",
+                               get_data_type_names<InDataType, WeiDataType, OutDataType>(),
+                               get_layout_names<InLayout, WeiLayout, OutLayout>()};
+            result.AddConvProblem(conv_param)
+                .SetPerf(op_name,
+                         avg_time,
+                         tflops,
+                         gb_per_sec,
+                         stream_config.cold_niters_,
+                         stream_config.nrepeat_)
+                .SetVerification(do_verification, instance_pass);
+            write_profiler_result(result);
         }
         else
         {
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -15,6 +15,8 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd_bias_activation.hpp"
 
+#include "profiler/profiler_result.hpp"
+
 namespace ck {
 namespace tensor_operation {
 namespace device {
@@ -178,6 +180,18 @@ void profile_conv_fwd_bias_relu_impl(int do_verification,
         throw std::runtime_error("wrong! no device Conv instance found");
     }
 
+    const auto conv_param = ck::utils::conv::ConvParam{NDimSpatial,
+                                                       1,
+                                                       N,
+                                                       K,
+                                                       C,
+                                                       filter_spatial_lengths,
+                                                       input_spatial_lengths,
+                                                       conv_filter_strides,
+                                                       conv_filter_dilations,
+                                                       input_left_pads,
+                                                       input_right_pads};
+
     std::string best_conv_name;
     float best_ave_time   = 0;
     float best_tflops     = 0;
@@ -211,8 +225,9 @@ void profile_conv_fwd_bias_relu_impl(int do_verification,
         {
             std::string conv_name = op_ptr->GetTypeString();
 
-            float ave_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            const auto stream_config = StreamConfig{nullptr, time_kernel};
+
+            float ave_time = invoker_ptr->Run(argument_ptr.get(), stream_config);
 
             std::size_t flop = std::size_t(2) * N * K * Ho * Wo * C * Y * X;
 
@@ -235,11 +250,13 @@ void profile_conv_fwd_bias_relu_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            bool instance_pass = true;
             if(do_verification)
             {
                 out_device_buf.FromDevice(out_n_k_ho_wo_device_result.mData.data());
 
-                ck::utils::check_err(out_n_k_ho_wo_device_result, out_n_k_ho_wo_host_result);
+                instance_pass =
+                    ck::utils::check_err(out_n_k_ho_wo_device_result, out_n_k_ho_wo_host_result);
 
                 if(do_log)
                 {
@@ -255,6 +272,20 @@ void profile_conv_fwd_bias_relu_impl(int do_verification,
                         << std::endl;
                 }
             }
+
+            auto result =
+                ProfilerResult{"conv_fwd_bias_relu",
+                               get_data_type_names<InDataType, WeiDataType, OutDataType>(),
+                               get_layout_names<InLayout, WeiLayout, OutLayout>()};
+            result.AddConvProblem(conv_param)
+                .SetPerf(conv_name,
+                         ave_time,
+                         tflops,
+                         gb_per_sec,
+                         stream_config.cold_niters_,
+                         stream_config.nrepeat_)
+                .SetVerification(do_verification, instance_pass);
+            write_profiler_result(result);
         }
     }
 
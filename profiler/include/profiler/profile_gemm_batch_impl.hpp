@@ -0,0 +1,368 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/gemm.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/literals.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/utility/fill.hpp"
+
+#include "profiler/profiler_result.hpp"
+
+namespace ck {
+namespace profiler {
+
+struct GemmBatchShape
+{
+    int M;
+    int N;
+    int K;
+    int StrideA;
+    int StrideB;
+    int StrideC;
+};
+
+// Profile all GEMM shapes from the list with a single set of device op instances.
+//
+// Host and device buffers are allocated (and A/B initialized and copied to device) once for the
+// largest shape; every shape uses the prefix of these buffers. While the instances are profiled on
+// shape i, the host reference of shape i + 1 is computed asynchronously. The best instance of each
+// shape is written as a line of the CSV results file.
+template <typename ALayout,
+          typename BLayout,
+          typename CLayout,
+          typename ADataType,
+          typename BDataType,
+          typename AccDataType,
+          typename CDataType>
+int profile_gemm_batch_impl(int do_verification,
+                            int init_method,
+                            bool do_log,
+                            bool time_kernel,
+                            const std::vector<GemmBatchShape>& shapes,
+                            const std::string& result_file,
+                            int n_warmup,
+                            int n_iter)
+{
+    bool pass = true;
+
+    auto f_host_tensor_descriptor =
+        [](std::size_t row, std::size_t col, std::size_t stride, auto layout) {
+            using namespace ck::literals;
+
+            if(is_same<decltype(layout), tensor_layout::gemm::RowMajor>::value)
+            {
+                return HostTensorDescriptor({row, col}, {stride, 1_uz});
+            }
+            else
+            {
+                return HostTensorDescriptor({row, col}, {1_uz, stride});
+            }
+        };
+
+    auto f_a_desc = [&](const GemmBatchShape& s) {
+        return f_host_tensor_descriptor(s.M, s.K, s.StrideA, ALayout{});
+    };
+    auto f_b_desc = [&](const GemmBatchShape& s) {
+        return f_host_tensor_descriptor(s.K, s.N, s.StrideB, BLayout{});
+    };
+    auto f_c_desc = [&](const GemmBatchShape& s) {
+        return f_host_tensor_descriptor(s.M, s.N, s.StrideC, CLayout{});
+    };
+
+    if(shapes.empty())
+    {
+        std::cout << "no GEMM shapes to profile" << std::endl;
+        return pass;
+    }
+
+    // find the largest shape of each tensor, buffers are allocated once
+    std::size_t a_max_space = 0;
+    std::size_t b_max_space = 0;
+    std::size_t c_max_space = 0;
+    std::size_t a_max_shape = 0;
+    std::size_t b_max_shape = 0;
+    for(std::size_t i = 0; i < shapes.size(); ++i)
+    {
+        const std::size_t a_space = f_a_desc(shapes[i]).GetElementSpaceSize();
+        const std::size_t b_space = f_b_desc(shapes[i]).GetElementSpaceSize();
+        if(a_space > a_max_space)
+        {
+            a_max_space = a_space;
+            a_max_shape = i;
+        }
+        if(b_space > b_max_space)
+        {
+            b_max_space = b_space;
+            b_max_shape = i;
+        }
+        c_max_space = std::max(c_max_space, f_c_desc(shapes[i]).GetElementSpaceSize());
+    }
+
+    // A and B hold the data of the largest shape, which is generated once. A smaller shape reads
+    // the start of this data through its own descriptor (a strided sub-block of it), so its
+    // elements differ from those of a separate profiler run of that shape.
+    Tensor<ADataType> a_m_k(f_a_desc(shapes[a_max_shape]));
+    Tensor<BDataType> b_k_n(f_b_desc(shapes[b_max_shape]));
+
+    switch(init_method)
+    {
+    case 0:
+        ck::utils::FillConstant<ADataType>{static_cast<ADataType>(1.f)}(a_m_k);
+        ck::utils::FillConstant<BDataType>{static_cast<BDataType>(1.f)}(b_k_n);
+        break;
+    case 1:
+        ck::utils::FillUniformDistributionIntegerValue<ADataType>{-5.f, 5.f}(a_m_k);
+        ck::utils::FillUniformDistributionIntegerValue<BDataType>{-5.f, 5.f}(b_k_n);
+        break;
+    default:
+        ck::utils::FillUniformDistribution<ADataType>{-1.f, 1.f}(a_m_k);
+        ck::utils::FillUniformDistribution<BDataType>{-1.f, 1.f}(b_k_n);
+    }
+
+    using AElementOp = ck::tensor_operation::element_wise::PassThrough;
+    using BElementOp = ck::tensor_operation::element_wise::PassThrough;
+    using CElementOp = ck::tensor_operation::element_wise::PassThrough;
+
+    const auto a_element_op = AElementOp{};
+    const auto b_element_op = BElementOp{};
+    const auto c_element_op = CElementOp{};
+
+    DeviceMem a_device_buf(sizeof(ADataType) * a_max_space);
+    DeviceMem b_device_buf(sizeof(BDataType) * b_max_space);
+    DeviceMem c_device_buf(sizeof(CDataType) * c_max_space);
+
+    a_device_buf.ToDevice(a_m_k.mData.data());
+    b_device_buf.ToDevice(b_k_n.mData.data());
+
+    using DeviceOp = ck::tensor_operation::device::DeviceGemm<ALayout,
+                                                              BLayout,
+                                                              CLayout,
+                                                              ADataType,
+                                                              BDataType,
+                                                              CDataType,
+                                                              AElementOp,
+                                                              BElementOp,
+                                                              CElementOp>;
+
+    // get device op instances, shared by all shapes
+    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+        DeviceOp>::GetInstances();
+
+    std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
+
+    using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
+                                                                            BDataType,
+                                                                            CDataType,
+                                                                            AccDataType,
+                                                                            AElementOp,
+                                                                            BElementOp,
+                                                                            CElementOp>;
+
+    // Switch A/B to the shape and start its reference. A/B are not accessed by the main thread
+    // until the returned future is ready.
+    auto f_run_reference_async = [&](const GemmBatchShape& shape, Tensor<CDataType>& c_m_n) {
+        a_m_k.mDesc = f_a_desc(shape);
+        b_k_n.mDesc = f_b_desc(shape);
+
+        return std::async(std::launch::async, [&, p_c_m_n = &c_m_n]() {
+            auto ref_op       = ReferenceGemmInstance{};
+            auto ref_invoker  = ref_op.MakeInvoker();
+            auto ref_argument = ref_op.MakeArgument(
+                a_m_k, b_k_n, *p_c_m_n, a_element_op, b_element_op, c_element_op);
+
+            ref_invoker.Run(ref_argument);
+        });
+    };
+
+    std::ofstream result_stream(result_file);
+    if(!result_stream)
+    {
+        std::cout << "cannot open results file " << result_file << std::endl;
+        return false;
+    }
+    result_stream << "M,N,K,StrideA,StrideB,StrideC,num_supported_instances,best_instance,"
+                     "best_ave_time_ms,best_tflops,best_gb_per_sec,pass"
+                  << std::endl;
+
+    // host references of the current and the next shape
+    std::vector<Tensor<CDataType>> c_m_n_host_results;
+    c_m_n_host_results.reserve(2);
+    c_m_n_host_results.emplace_back(f_c_desc(shapes[0]));
+    c_m_n_host_results.emplace_back(f_c_desc(shapes[0]));
+
+    std::future<void> next_reference;
+    if(do_verification)
+    {
+        next_reference = f_run_reference_async(shapes[0], c_m_n_host_results[0]);
+    }
+
+    for(std::size_t shape_id = 0; shape_id < shapes.size(); ++shape_id)
+    {
+        const auto& shape = shapes[shape_id];
+        const int M       = shape.M;
+        const int N       = shape.N;
+        const int K       = shape.K;
+        const int StrideA = shape.StrideA;
+        const int StrideB = shape.StrideB;
+        const int StrideC = shape.StrideC;
+
+        Tensor<CDataType>& c_m_n_host_result = c_m_n_host_results[shape_id % 2];
+        Tensor<CDataType> c_m_n_device_result(f_c_desc(shape));
+
+        std::cout << "shape " << shape_id << ": M = " << M << " N = " << N << " K = " << K
+                  << " StrideA = " << StrideA << " StrideB = " << StrideB
+                  << " StrideC = " << StrideC << std::endl;
+
+        bool shape_pass = true;
+        if(do_verification)
+        {
+            // reference of this shape was computed while the previous shape was profiled
+            next_reference.get();
+
+            if(shape_id + 1 < shapes.size())
+            {
+                Tensor<CDataType>& c_m_n_next = c_m_n_host_results[(shape_id + 1) % 2];
+                c_m_n_next = Tensor<CDataType>(f_c_desc(shapes[shape_id + 1]));
+                next_reference = f_run_reference_async(shapes[shape_id + 1], c_m_n_next);
+            }
+        }
+
+        std::size_t flop = std::size_t(2) * M * N * K;
+
+        std::size_t num_btype =
+            sizeof(ADataType) * M * K + sizeof(BDataType) * K * N + sizeof(CDataType) * M * N;
+
+        std::string best_op_name;
+        float best_ave_time   = 0;
+        float best_tflops     = 0;
+        float best_gb_per_sec = 0;
+        int num_supported     = 0;
+
+        // profile device op instances
+        for(auto& op_ptr : op_ptrs)
+        {
+            auto argument_ptr =
+                op_ptr->MakeArgumentPointer(static_cast<ADataType*>(a_device_buf.GetDeviceBuffer()),
+                                            static_cast<BDataType*>(b_device_buf.GetDeviceBuffer()),
+                                            static_cast<CDataType*>(c_device_buf.GetDeviceBuffer()),
+                                            M,
+                                            N,
+                                            K,
+                                            StrideA,
+                                            StrideB,
+                                            StrideC,
+                                            a_element_op,
+                                            b_element_op,
+                                            c_element_op);
+
+            auto invoker_ptr = op_ptr->MakeInvokerPointer();
+
+            if(op_ptr->IsSupportedArgument(argument_ptr.get()))
+            {
+                ++num_supported;
+
+                // re-init C to zero before profiling next kernel
+                c_device_buf.SetZero();
+
+                std::string op_name = op_ptr->GetTypeString();
+
+                float avg_time = invoker_ptr->Run(
+                    argument_ptr.get(), StreamConfig{nullptr, time_kernel, 0, n_warmup, n_iter});
+
+                float tflops = static_cast<float>(flop) / 1.E9 / avg_time;
+
+                float gb_per_sec = num_btype / 1.E6 / avg_time;
+
+                std::cout << "Perf: " << std::setw(10) << avg_time << " ms, " << tflops
+                          << " TFlops, " << gb_per_sec << " GB/s, " << op_name << std::endl;
+
+                if(tflops > best_tflops)
+                {
+                    best_op_name    = op_name;
+                    best_ave_time   = avg_time;
+                    best_tflops     = tflops;
+                    best_gb_per_sec = gb_per_sec;
+                }
+
+                bool instance_pass = true;
+                if(do_verification)
+                {
+                    c_device_buf.FromDevice(c_m_n_device_result.mData.data(),
+                                            sizeof(CDataType) *
+                                                c_m_n_device_result.mDesc.GetElementSpaceSize());
+
+                    instance_pass = ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
+                    shape_pass    = shape_pass & instance_pass;
+
+                    if(do_log)
+                    {
+                        LogRangeAsType<float>(
+                            std::cout << "c_host  : ", c_m_n_host_result.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(
+                            std::cout << "c_device: ", c_m_n_device_result.mData, ",")
+                            << std::endl;
+                    }
+                }
+
+                auto result = ProfilerResult{"gemm",
+                                             get_data_type_names<ADataType, BDataType, CDataType>(),
+                                             get_layout_names<ALayout, BLayout, CLayout>()};
+                result.AddProblemDim("M", M)
+                    .AddProblemDim("N", N)
+                    .AddProblemDim("K", K)
+                    .AddProblemDim("StrideA", StrideA)
+                    .AddProblemDim("StrideB", StrideB)
+                    .AddProblemDim("StrideC", StrideC)
+                    .SetPerf(op_name, avg_time, tflops, gb_per_sec, n_warmup, n_iter)
+                    .SetVerification(do_verification, instance_pass);
+                write_profiler_result(result);
+            }
+            else
+            {
+                std::cout << op_ptr->GetTypeString() << " does not support this problem"
+                          << std::endl;
+            }
+        }
+
+        std::cout << "Best Perf: M = " << M << " N = " << N << " K = " << K
+                  << " StrideA = " << StrideA << " StrideB = " << StrideB
+                  << " StrideC = " << StrideC << " : " << best_ave_time << " ms, " << best_tflops
+                  << " TFlops, " << best_gb_per_sec << " GB/s, " << best_op_name << std::endl;
+
+        result_stream << M << "," << N << "," << K << "," << StrideA << "," << StrideB << ","
+                      << StrideC << "," << num_supported << ",\"" << best_op_name << "\","
+                      << best_ave_time << "," << best_tflops << "," << best_gb_per_sec << ","
+                      << (do_verification ? (shape_pass ? "1" : "0") : "") << std::endl;
+
+        pass = pass && shape_pass;
+    }
+
+    std::cout << "results of " << shapes.size() << " shapes written to " << result_file
+              << std::endl;
+
+    return pass;
+}
+
+} // namespace profiler
+} // namespace ck
@@ -19,6 +19,8 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/profiler_result.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -188,8 +190,9 @@ bool profile_gemm_bilinear_impl(int do_verification,
             // re-init E to zero before profiling a kernel
             e_device_buf.SetZero();
 
-            float ave_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            const auto stream_config = StreamConfig{nullptr, time_kernel};
+
+            float ave_time = invoker_ptr->Run(argument_ptr.get(), stream_config);
 
             std::size_t flop = std::size_t(2) * M * N * K;
 
@@ -211,12 +214,34 @@ bool profile_gemm_bilinear_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            bool instance_pass = true;
             if(do_verification)
             {
                 e_device_buf.FromDevice(e_m_n_device_result.mData.data());
 
-                pass = pass && ck::utils::check_err(e_m_n_device_result, e_m_n_host_result);
+                instance_pass = ck::utils::check_err(e_m_n_device_result, e_m_n_host_result);
+                pass          = pass && instance_pass;
             }
+
+            auto result = ProfilerResult{
+                "gemm_bilinear",
+                get_data_type_names<ADataType, BDataType, DDataType, EDataType>(),
+                get_layout_names<ALayout, BLayout, DLayout, ELayout>()};
+            result.AddProblemDim("M", M)
+                .AddProblemDim("N", N)
+                .AddProblemDim("K", K)
+                .AddProblemDim("StrideA", StrideA)
+                .AddProblemDim("StrideB", StrideB)
+                .AddProblemDim("StrideD", StrideD)
+                .AddProblemDim("StrideE", StrideE)
+                .SetPerf(op_name,
+                         ave_time,
+                         tflops,
+                         gb_per_sec,
+                         stream_config.cold_niters_,
+                         stream_config.nrepeat_)
+                .SetVerification(do_verification, instance_pass);
+            write_profiler_result(result);
         }
         else
         {
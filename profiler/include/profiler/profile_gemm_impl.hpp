@@ -20,9 +20,12 @@
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
+#include "ck/library/utility/sampled_verification.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 #include "ck/library/utility/fill.hpp"
 
+#include "profiler/profiler_result.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -117,29 +120,46 @@ int profile_gemm_impl(int do_verification,
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
-    // Run reference op
-    if(do_verification)
-    {
-        using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
-                                                                                BDataType,
-                                                                                CDataType,
-                                                                                AccDataType,
-                                                                                AElementOp,
-                                                                                BElementOp,
-                                                                                CElementOp>;
+    using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
+                                                                            BDataType,
+                                                                            CDataType,
+                                                                            AccDataType,
+                                                                            AElementOp,
+                                                                            BElementOp,
+                                                                            CElementOp>;
+
+    auto ref_op      = ReferenceGemmInstance{};
+    auto ref_invoker = ref_op.MakeInvoker();
 
-        auto ref_op      = ReferenceGemmInstance{};
-        auto ref_invoker = ref_op.MakeInvoker();
+    auto ref_argument = ref_op.MakeArgument(
+        a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
 
-        auto ref_argument = ref_op.MakeArgument(
-            a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
+    // with sampled verification the instances are checked with the row sums of C and the reference
+    // at a few elements, the full reference is only computed if an instance fails these checks
+    const bool sampled_verification =
+        do_verification && !do_log && is_sampled_verification_enabled();
+    bool is_ref_computed = false;
 
+    ck::utils::RowSums ref_row_sums;
+
+    // Run reference op
+    if(sampled_verification)
+    {
+        ref_row_sums = ck::utils::get_gemm_reference_row_sums(a_m_k, b_k_n);
+    }
+    else if(do_verification)
+    {
         ref_invoker.Run(ref_argument);
+        is_ref_computed = true;
     }
 
     float best_tflops    = 0;
     int best_instance_id = 0;
 
+    // statistics of the timed instances, only with adaptive timing
+    std::vector<std::string> timed_op_names;
+    std::vector<TimingStatistics> timed_statistics;
+
     int instance_id = 0;
     // profile device op instances
     for(auto& op_ptr : op_ptrs)
@@ -167,8 +187,11 @@ int profile_gemm_impl(int do_verification,
 
             std::string op_name = op_ptr->GetTypeString();
 
+            TimingStatistics statistics;
+
             float avg_time = invoker_ptr->Run(
-                argument_ptr.get(), StreamConfig{nullptr, time_kernel, 0, n_warmup, n_iter});
+                argument_ptr.get(),
+                make_profiler_stream_config(time_kernel, n_warmup, n_iter, &statistics));
 
             std::size_t flop = std::size_t(2) * M * N * K;
 
@@ -182,17 +205,53 @@ int profile_gemm_impl(int do_verification,
             std::cout << "Perf: " << std::setw(10) << avg_time << " ms, " << tflops << " TFlops, "
                       << gb_per_sec << " GB/s, " << op_name << std::endl;
 
+            if(statistics.num_samples > 0)
+            {
+                std::cout << "      " << statistics << std::endl;
+
+                timed_op_names.push_back(op_name);
+                timed_statistics.push_back(statistics);
+            }
+
             if(tflops > best_tflops)
             {
                 best_instance_id = instance_id;
                 best_tflops      = tflops;
             }
 
+            bool instance_pass = true;
             if(do_verification)
             {
                 c_device_buf.FromDevice(c_m_n_device_result.mData.data());
 
-                pass = pass & ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
+                bool is_checked = false;
+                if(sampled_verification)
+                {
+                    auto ref_at = [&](const std::vector<std::size_t>& idx) {
+                        ReferenceGemmInstance::Invoker::RunElement(ref_argument, idx[0], idx[1]);
+                        return c_m_n_host_result(idx);
+                    };
+
+                    is_checked =
+                        ck::utils::check_row_sums(c_m_n_device_result, ref_row_sums) &&
+                        ck::utils::check_err_sampled(c_m_n_device_result,
+                                                     ref_at,
+                                                     num_verification_samples,
+                                                     instance_id,
+                                                     "Error: Incorrect results!");
+                }
+
+                if(!is_checked)
+                {
+                    if(!is_ref_computed)
+                    {
+                        ref_invoker.Run(ref_argument);
+                        is_ref_computed = true;
+                    }
+
+                    instance_pass = ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
+                }
+                pass = pass & instance_pass;
 
                 if(do_log)
                 {
@@ -204,6 +263,20 @@ int profile_gemm_impl(int do_verification,
                         << std::endl;
                 }
             }
+
+            auto result = ProfilerResult{"gemm",
+                                         get_data_type_names<ADataType, BDataType, CDataType>(),
+                                         get_layout_names<ALayout, BLayout, CLayout>()};
+            result.AddProblemDim("M", M)
+                .AddProblemDim("N", N)
+                .AddProblemDim("K", K)
+                .AddProblemDim("StrideA", StrideA)
+                .AddProblemDim("StrideB", StrideB)
+                .AddProblemDim("StrideC", StrideC)
+                .SetPerf(op_name, avg_time, tflops, gb_per_sec, n_warmup, n_iter)
+                .SetTimingStatistics(statistics)
+                .SetVerification(do_verification, instance_pass);
+            write_profiler_result(result);
         }
         else
         {
@@ -213,6 +286,11 @@ int profile_gemm_impl(int do_verification,
         instance_id++;
     }
 
+    if(!timed_statistics.empty())
+    {
+        print_timing_ranking(timed_op_names, timed_statistics);
+    }
+
     sleep(2);
 
     // Run the best instance again
@@ -239,7 +317,7 @@ int profile_gemm_impl(int do_verification,
             std::string op_name = op_ptr->GetTypeString();
 
             float avg_time = invoker_ptr->Run(argument_ptr.get(),
-                                              StreamConfig{nullptr, time_kernel, 0, 50, 200});
+                                              make_profiler_stream_config(time_kernel, 50, 200));
 
             std::size_t flop = std::size_t(2) * M * N * K;
 
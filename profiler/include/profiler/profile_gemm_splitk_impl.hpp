@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -21,6 +21,8 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/profiler_result.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -182,11 +184,13 @@ bool profile_gemm_splitk_impl(int do_verification,
                 invoker_ptr->Run(argument_ptr.get(),
                                  StreamConfig{nullptr, false, 0, n_warmup, n_iter});
 
+                bool instance_pass = true;
                 if(do_verification)
                 {
                     c_device_buf.FromDevice(c_m_n_device_result.mData.data());
 
-                    pass = pass & ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
+                    instance_pass = ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
+                    pass          = pass & instance_pass;
 
                     if(do_log)
                     {
@@ -219,6 +223,20 @@ bool profile_gemm_splitk_impl(int do_verification,
                           << " TFlops, " << gb_per_sec << " GB/s, " << op_name << ", KBatch "
                           << kbatch_curr << std::endl;
 
+                auto result = ProfilerResult{"gemm_splitk",
+                                             get_data_type_names<ADataType, BDataType, CDataType>(),
+                                             get_layout_names<ALayout, BLayout, CLayout>()};
+                result.AddProblemDim("M", M)
+                    .AddProblemDim("N", N)
+                    .AddProblemDim("K", K)
+                    .AddProblemDim("StrideA", StrideA)
+                    .AddProblemDim("StrideB", StrideB)
+                    .AddProblemDim("StrideC", StrideC)
+                    .AddProblemDim("KBatch", kbatch_curr)
+                    .SetPerf(op_name, ave_time, tflops, gb_per_sec, n_warmup, n_iter)
+                    .SetVerification(do_verification, instance_pass);
+                write_profiler_result(result);
+
 #if defined CK_ENABLE_FP8
                 // set softer tolerances for fp8
                 if constexpr(is_same_v<ADataType, f8_t> || is_same_v<BDataType, f8_t> ||
@@ -21,6 +21,8 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/profiler_result.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -189,6 +191,7 @@ bool profile_gemm_universal_impl(int do_verification,
                 invoker_ptr->Run(argument_ptr.get(),
                                  StreamConfig{nullptr, false, 0, n_warmup, n_iter});
 
+                bool instance_pass = true;
                 if(do_verification)
                 {
                     c_device_buf.FromDevice(c_m_n_device_result.mData.data());
@@ -201,16 +204,18 @@ bool profile_gemm_universal_impl(int do_verification,
                         std::string msg = "Error: Incorrect results!";
                         double rtol     = 1e-1;
                         double atol     = 1e-1;
-                        pass            = pass & ck::utils::check_err(
-                                          c_m_n_device_result, c_m_n_host_result, msg, rtol, atol);
+                        instance_pass   = ck::utils::check_err(
+                            c_m_n_device_result, c_m_n_host_result, msg, rtol, atol);
                     }
                     else
                     {
 #endif
-                        pass = pass & ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
+                        instance_pass =
+                            ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
 #if defined CK_ENABLE_FP8
                     }
 #endif
+                    pass = pass & instance_pass;
 
                     if(do_log)
                     {
@@ -249,6 +254,20 @@ bool profile_gemm_universal_impl(int do_verification,
                           << " TFlops, " << gb_per_sec << " GB/s, " << op_name << ", KBatch "
                           << kbatch_curr << std::endl;
 
+                auto result = ProfilerResult{"gemm_universal",
+                                             get_data_type_names<ADataType, BDataType, CDataType>(),
+                                             get_layout_names<ALayout, BLayout, CLayout>()};
+                result.AddProblemDim("M", M)
+                    .AddProblemDim("N", N)
+                    .AddProblemDim("K", K)
+                    .AddProblemDim("StrideA", StrideA)
+                    .AddProblemDim("StrideB", StrideB)
+                    .AddProblemDim("StrideC", StrideC)
+                    .AddProblemDim("KBatch", kbatch_curr)
+                    .SetPerf(op_name, ave_time, tflops, gb_per_sec, n_warmup, n_iter)
+                    .SetVerification(do_verification, instance_pass);
+                write_profiler_result(result);
+
                 if(tflops > best_tflops)
                 {
                     best_op_name    = op_name;
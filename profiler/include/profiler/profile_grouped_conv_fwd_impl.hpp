@@ -18,10 +18,13 @@
 #include "ck/library/utility/device_memory.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/sampled_verification.hpp"
 #include "ck/library/utility/convolution_parameter.hpp"
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
 
+#include "profiler/profiler_result.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -110,35 +113,63 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
     in_device_buf.ToDevice(input.mData.data());
     wei_device_buf.ToDevice(weight.mData.data());
 
+    using ReferenceConvInstance = ck::tensor_operation::host::ReferenceConvFwd<NDimSpatial,
+                                                                               InDataType,
+                                                                               WeiDataType,
+                                                                               OutDataType,
+                                                                               InElementOp,
+                                                                               WeiElementOp,
+                                                                               OutElementOp>;
+
+    auto ref_conv     = ReferenceConvInstance{};
+    auto ref_invoker  = ref_conv.MakeInvoker();
+    auto ref_argument = ref_conv.MakeArgument(input,
+                                              weight,
+                                              host_output,
+                                              conv_param.conv_filter_strides_,
+                                              conv_param.conv_filter_dilations_,
+                                              conv_param.input_left_pads_,
+                                              conv_param.input_right_pads_,
+                                              in_element_op,
+                                              wei_element_op,
+                                              out_element_op);
+
+    // init host output to zero
+    host_output.SetZero();
+
+    // with sampled verification the instances are checked with the reference at a few elements,
+    // the full reference is only computed if an instance fails this check
+    const bool sampled_verification =
+        do_verification && !do_log && is_sampled_verification_enabled();
+    bool is_ref_computed = false;
+
     // run reference op
-    if(do_verification)
+    if(do_verification && !sampled_verification)
     {
-        auto ref_conv = ck::tensor_operation::host::ReferenceConvFwd<NDimSpatial,
-                                                                     InDataType,
-                                                                     WeiDataType,
-                                                                     OutDataType,
-                                                                     InElementOp,
-                                                                     WeiElementOp,
-                                                                     OutElementOp>{};
-
-        auto ref_invoker  = ref_conv.MakeInvoker();
-        auto ref_argument = ref_conv.MakeArgument(input,
-                                                  weight,
-                                                  host_output,
-                                                  conv_param.conv_filter_strides_,
-                                                  conv_param.conv_filter_dilations_,
-                                                  conv_param.input_left_pads_,
-                                                  conv_param.input_right_pads_,
-                                                  in_element_op,
-                                                  wei_element_op,
-                                                  out_element_op);
-
-        // init host output to zero
-        host_output.SetZero();
-
         ref_invoker.Run(ref_argument);
+        is_ref_computed = true;
     }
 
+    // reference at the output element idx (g, n, k, [do, [ho,]] wo)
+    auto ref_at = [&](const std::vector<std::size_t>& idx) {
+        if constexpr(NDimSpatial == 1)
+        {
+            ReferenceConvInstance::Invoker::RunElement(
+                ref_argument, idx[0], idx[1], idx[2], idx[3]);
+        }
+        else if constexpr(NDimSpatial == 2)
+        {
+            ReferenceConvInstance::Invoker::RunElement(
+                ref_argument, idx[0], idx[1], idx[2], idx[3], idx[4]);
+        }
+        else if constexpr(NDimSpatial == 3)
+        {
+            ReferenceConvInstance::Invoker::RunElement(
+                ref_argument, idx[0], idx[1], idx[2], idx[3], idx[4], idx[5]);
+        }
+        return host_output(idx);
+    };
+
     std::string best_op_name;
     float best_avg_time   = 0;
     float best_tflops     = 0;
@@ -147,6 +178,8 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
     // profile device op instances
     bool pass = true;
 
+    int instance_id = 0;
+
     auto run_impl = [&](auto& op_ptr, auto& argument_ptr) {
         if(op_ptr->IsSupportedArgument(argument_ptr.get()))
         {
@@ -157,8 +190,9 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
 
             auto invoker_ptr = op_ptr->MakeInvokerPointer();
 
-            float avg_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            const auto stream_config = StreamConfig{nullptr, time_kernel};
+
+            float avg_time = invoker_ptr->Run(argument_ptr.get(), stream_config);
 
             std::size_t flop      = conv_param.GetFlops();
             std::size_t num_btype = conv_param.GetByte<InDataType, WeiDataType, OutDataType>();
@@ -178,11 +212,32 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            bool instance_pass = true;
             if(do_verification)
             {
                 out_device_buf.FromDevice(device_output.mData.data());
 
-                pass = pass & ck::utils::check_err(device_output, host_output);
+                bool is_checked = false;
+                if(sampled_verification)
+                {
+                    is_checked = ck::utils::check_err_sampled(device_output,
+                                                              ref_at,
+                                                              num_verification_samples,
+                                                              instance_id,
+                                                              "Error: Incorrect results!");
+                }
+
+                if(!is_checked)
+                {
+                    if(!is_ref_computed)
+                    {
+                        ref_invoker.Run(ref_argument);
+                        is_ref_computed = true;
+                    }
+
+                    instance_pass = ck::utils::check_err(device_output, host_output);
+                }
+                pass = pass & instance_pass;
 
                 if(do_log)
                 {
@@ -194,11 +249,27 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
                         << std::endl;
                 }
             }
+
+            auto result =
+                ProfilerResult{"grouped_conv_fwd",
+                               get_data_type_names<InDataType, WeiDataType, OutDataType>(),
+                               get_layout_names<InLayout, WeiLayout, OutLayout>()};
+            result.AddConvProblem(conv_param)
+                .SetPerf(op_name,
+                         avg_time,
+                         tflops,
+                         gb_per_sec,
+                         stream_config.cold_niters_,
+                         stream_config.nrepeat_)
+                .SetVerification(do_verification, instance_pass);
+            write_profiler_result(result);
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
         }
+
+        instance_id++;
     };
 
     using DeviceOp = ck::tensor_operation::device::DeviceGroupedConvFwdMultipleABD<NDimSpatial,
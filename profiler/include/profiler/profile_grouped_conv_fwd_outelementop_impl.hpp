@@ -6,6 +6,8 @@
 #include "ck/library/utility/device_memory.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 
+#include "profiler/profiler_result.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -191,6 +193,10 @@ bool profile_grouped_conv_fwd_outelementop_impl(int do_verification,
     // initialize out_element_op for each iteration
     const auto out_element_op = OutElementOp{scale_in, scale_wei, scale_out};
 
+    const std::string out_element_op_name =
+        is_same_v<OutElementOp, ck::tensor_operation::element_wise::ConvScale> ? "ConvScale"
+                                                                                : "ConvInvscale";
+
     std::cout << "scale_in: " << scale_in << std::endl;
     std::cout << "scale_wei: " << scale_wei << std::endl;
     std::cout << "scale_out: " << scale_out << std::endl;
@@ -244,8 +250,9 @@ bool profile_grouped_conv_fwd_outelementop_impl(int do_verification,
 
             auto invoker_ptr = op_ptr->MakeInvokerPointer();
 
-            float avg_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            const auto stream_config = StreamConfig{nullptr, time_kernel};
+
+            float avg_time = invoker_ptr->Run(argument_ptr.get(), stream_config);
 
             std::size_t flop      = conv_param.GetFlops();
             std::size_t num_btype = conv_param.GetByte<InDataType, WeiDataType, OutDataType>();
@@ -265,15 +272,17 @@ bool profile_grouped_conv_fwd_outelementop_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            bool instance_pass = true;
             if(do_verification)
             {
                 out_device_buf.FromDevice(device_output.mData.data());
 
-                pass = pass & ck::utils::check_err(device_output,
-                                                   host_output,
-                                                   "Error: Device and Host results do not match!",
-                                                   get_rtol<OutDataType>(),
-                                                   get_atol<OutDataType>());
+                instance_pass = ck::utils::check_err(device_output,
+                                                     host_output,
+                                                     "Error: Device and Host results do not match!",
+                                                     get_rtol<OutDataType>(),
+                                                     get_atol<OutDataType>());
+                pass          = pass & instance_pass;
 
                 if(do_log)
                 {
@@ -289,6 +298,21 @@ bool profile_grouped_conv_fwd_outelementop_impl(int do_verification,
                         << std::endl;
                 }
             }
+
+            auto result =
+                ProfilerResult{"grouped_conv_fwd_outelementop",
+                               get_data_type_names<InDataType, WeiDataType, OutDataType>(),
+                               get_layout_names<InLayout, WeiLayout, OutLayout>()};
+            result.AddConvProblem(conv_param)
+                .AddProblemName("OutElementOp", out_element_op_name)
+                .SetPerf(op_name,
+                         avg_time,
+                         tflops,
+                         gb_per_sec,
+                         stream_config.cold_niters_,
+                         stream_config.nrepeat_)
+                .SetVerification(do_verification, instance_pass);
+            write_profiler_result(result);
         }
         else
         {
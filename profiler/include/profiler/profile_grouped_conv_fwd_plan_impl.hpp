@@ -0,0 +1,263 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/grouped_convolution_forward.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_plan_cache.hpp"
+
+#include "ck/library/utility/algorithm.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+
+namespace ck {
+namespace profiler {
+
+// Host time of making arguments vs rebinding the pointers of an existing argument (plan) for all
+// grouped conv fwd instances, reported per device op family. No kernel is launched.
+template <ck::index_t NDimSpatial,
+          typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          typename InDataType,
+          typename WeiDataType,
+          typename OutDataType>
+bool profile_grouped_conv_fwd_plan_impl(int n_repeat, const ck::utils::conv::ConvParam& conv_param)
+{
+    using InElementOp  = ck::tensor_operation::element_wise::PassThrough;
+    using WeiElementOp = ck::tensor_operation::element_wise::PassThrough;
+    using OutElementOp = ck::tensor_operation::element_wise::PassThrough;
+
+    const auto in_g_n_c_wis_desc =
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param);
+
+    const auto wei_g_k_c_xs_desc =
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(conv_param);
+
+    const auto out_g_n_k_wos_desc =
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(conv_param);
+
+    std::array<ck::index_t, NDimSpatial + 3> a_g_n_c_wis_lengths{};
+    std::array<ck::index_t, NDimSpatial + 3> a_g_n_c_wis_strides{};
+    std::array<ck::index_t, NDimSpatial + 3> b_g_k_c_xs_lengths{};
+    std::array<ck::index_t, NDimSpatial + 3> b_g_k_c_xs_strides{};
+    std::array<ck::index_t, NDimSpatial + 3> e_g_n_k_wos_lengths{};
+    std::array<ck::index_t, NDimSpatial + 3> e_g_n_k_wos_strides{};
+    std::array<ck::index_t, NDimSpatial> conv_filter_strides{};
+    std::array<ck::index_t, NDimSpatial> conv_filter_dilations{};
+    std::array<ck::index_t, NDimSpatial> input_left_pads{};
+    std::array<ck::index_t, NDimSpatial> input_right_pads{};
+
+    auto copy = [](const auto& x, auto& y) { ck::ranges::copy(x, y.begin()); };
+
+    copy(in_g_n_c_wis_desc.GetLengths(), a_g_n_c_wis_lengths);
+    copy(in_g_n_c_wis_desc.GetStrides(), a_g_n_c_wis_strides);
+    copy(wei_g_k_c_xs_desc.GetLengths(), b_g_k_c_xs_lengths);
+    copy(wei_g_k_c_xs_desc.GetStrides(), b_g_k_c_xs_strides);
+    copy(out_g_n_k_wos_desc.GetLengths(), e_g_n_k_wos_lengths);
+    copy(out_g_n_k_wos_desc.GetStrides(), e_g_n_k_wos_strides);
+    copy(conv_param.conv_filter_strides_, conv_filter_strides);
+    copy(conv_param.conv_filter_dilations_, conv_filter_dilations);
+    copy(conv_param.input_left_pads_, input_left_pads);
+    copy(conv_param.input_right_pads_, input_right_pads);
+
+    // two sets of buffers, pointers are swapped between repetitions
+    DeviceMem in_device_buf(sizeof(InDataType) * in_g_n_c_wis_desc.GetElementSpaceSize());
+    DeviceMem wei_device_buf(sizeof(WeiDataType) * wei_g_k_c_xs_desc.GetElementSpaceSize());
+    DeviceMem out_device_buf(sizeof(OutDataType) * out_g_n_k_wos_desc.GetElementSpaceSize());
+    DeviceMem in_device_buf2(sizeof(InDataType) * in_g_n_c_wis_desc.GetElementSpaceSize());
+    DeviceMem out_device_buf2(sizeof(OutDataType) * out_g_n_k_wos_desc.GetElementSpaceSize());
+
+    const void* p_ins[2] = {in_device_buf.GetDeviceBuffer(), in_device_buf2.GetDeviceBuffer()};
+    void* p_outs[2]      = {out_device_buf.GetDeviceBuffer(), out_device_buf2.GetDeviceBuffer()};
+    const void* p_wei    = wei_device_buf.GetDeviceBuffer();
+
+    using DeviceOp = ck::tensor_operation::device::DeviceGroupedConvFwdMultipleABD<NDimSpatial,
+                                                                                   InLayout,
+                                                                                   WeiLayout,
+                                                                                   ck::Tuple<>,
+                                                                                   OutLayout,
+                                                                                   InDataType,
+                                                                                   WeiDataType,
+                                                                                   ck::Tuple<>,
+                                                                                   OutDataType,
+                                                                                   InElementOp,
+                                                                                   WeiElementOp,
+                                                                                   OutElementOp>;
+
+    auto make_argument = [&](DeviceOp& op, int i) {
+        return op.MakeArgumentPointer(p_ins[i % 2],
+                                      p_wei,
+                                      {},
+                                      p_outs[i % 2],
+                                      a_g_n_c_wis_lengths,
+                                      a_g_n_c_wis_strides,
+                                      b_g_k_c_xs_lengths,
+                                      b_g_k_c_xs_strides,
+                                      {},
+                                      {},
+                                      e_g_n_k_wos_lengths,
+                                      e_g_n_k_wos_strides,
+                                      conv_filter_strides,
+                                      conv_filter_dilations,
+                                      input_left_pads,
+                                      input_right_pads,
+                                      InElementOp{},
+                                      WeiElementOp{},
+                                      OutElementOp{});
+    };
+
+    auto update_pointers =
+        [&](DeviceOp& op, ck::tensor_operation::device::BaseArgument* p_arg, int i) {
+            return op.UpdatePointers(p_arg, p_ins[i % 2], p_wei, {}, p_outs[i % 2]);
+        };
+
+    using Clock = std::chrono::steady_clock;
+
+    auto time_us = [&](auto f) {
+        const auto start = Clock::now();
+        for(int i = 0; i < n_repeat; ++i)
+        {
+            f(i);
+        }
+        const std::chrono::duration<double, std::micro> elapsed = Clock::now() - start;
+        return elapsed.count() / n_repeat;
+    };
+
+    // device op name without template parameters
+    auto get_family = [](const std::string& op_name) {
+        const auto end = op_name.find_first_of("< ");
+        return op_name.substr(0, end);
+    };
+
+    struct FamilyTime
+    {
+        int num_instances  = 0;
+        int num_supported  = 0;
+        int num_rebindable = 0;
+        double make_us     = 0;
+        double update_us   = 0;
+    };
+
+    std::map<std::string, FamilyTime> families;
+
+    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+        DeviceOp>::GetInstances();
+
+    std::cout << "ckProfiler found " << op_ptrs.size() << " instances" << std::endl;
+
+    bool pass = true;
+
+    for(auto& op_ptr : op_ptrs)
+    {
+        const std::string op_name = op_ptr->GetTypeString();
+
+        auto argument_ptr = make_argument(*op_ptr, 0);
+
+        FamilyTime& family = families[get_family(op_name)];
+        ++family.num_instances;
+
+        if(op_ptr->IsSupportedArgument(argument_ptr.get()))
+        {
+            ++family.num_supported;
+        }
+
+        family.make_us += time_us([&](int i) { argument_ptr = make_argument(*op_ptr, i); });
+
+        if(update_pointers(*op_ptr, argument_ptr.get(), 0))
+        {
+            ++family.num_rebindable;
+            family.update_us +=
+                time_us([&](int i) { update_pointers(*op_ptr, argument_ptr.get(), i); });
+
+            // rebinding must not change whether the instance supports the problem
+            argument_ptr               = make_argument(*op_ptr, 1);
+            const bool supported_fresh = op_ptr->IsSupportedArgument(argument_ptr.get());
+            update_pointers(*op_ptr, argument_ptr.get(), 0);
+            const bool supported_rebound = op_ptr->IsSupportedArgument(argument_ptr.get());
+            if(supported_fresh != supported_rebound)
+            {
+                std::cout << op_name << ": IsSupportedArgument differs after UpdatePointers"
+                          << std::endl;
+                pass = false;
+            }
+        }
+    }
+
+    std::cout << std::setw(56) << std::left << "family" << std::right << std::setw(10)
+              << "instances" << std::setw(11) << "supported" << std::setw(16) << "make arg [us]"
+              << std::setw(18) << "update ptrs [us]" << std::endl;
+
+    for(const auto& [name, family] : families)
+    {
+        std::cout << std::setw(56) << std::left << name << std::right << std::setw(10)
+                  << family.num_instances << std::setw(11) << family.num_supported
+                  << std::setw(16) << family.make_us / family.num_instances << std::setw(18);
+        if(family.num_rebindable > 0)
+        {
+            std::cout << family.update_us / family.num_rebindable;
+        }
+        else
+        {
+            std::cout << "n/a";
+        }
+        std::cout << std::endl;
+    }
+
+    // cost of a plan cache lookup, the first call selects the instance
+    ck::tensor_operation::device::instance::DeviceOperationPlanCache<DeviceOp> cache;
+
+    const auto key = ck::tensor_operation::device::instance::MakePlanKey(a_g_n_c_wis_lengths,
+                                                                          a_g_n_c_wis_strides,
+                                                                          b_g_k_c_xs_lengths,
+                                                                          b_g_k_c_xs_strides,
+                                                                          e_g_n_k_wos_lengths,
+                                                                          e_g_n_k_wos_strides,
+                                                                          conv_filter_strides,
+                                                                          conv_filter_dilations,
+                                                                          input_left_pads,
+                                                                          input_right_pads,
+                                                                          InElementOp{},
+                                                                          WeiElementOp{},
+                                                                          OutElementOp{});
+
+    const auto get_plan = [&](int i) {
+        return cache.Get(
+            key,
+            [&](DeviceOp& op) { return make_argument(op, i); },
+            [&](DeviceOp& op, ck::tensor_operation::device::BaseArgument* p_arg) {
+                return update_pointers(op, p_arg, i);
+            });
+    };
+
+    const auto start = Clock::now();
+    const auto plan  = get_plan(0);
+    const std::chrono::duration<double, std::micro> miss_us = Clock::now() - start;
+
+    if(plan == nullptr)
+    {
+        std::cout << "no instance supports this problem" << std::endl;
+        return pass;
+    }
+
+    const double hit_us = time_us([&](int i) { get_plan(i); });
+
+    std::cout << "plan cache: miss " << miss_us.count() << " us, hit " << hit_us << " us, "
+              << plan->op->GetTypeString() << std::endl;
+
+    return pass;
+}
+
+} // namespace profiler
+} // namespace ck
@@ -95,16 +95,21 @@ bool profile_grouped_gemm_fixed_nk_impl(int do_verification,
                       << "]:" << c_m_n_device_results[i].mDesc << std::endl;
         }
         std::size_t num_thread = 1;
+
+        // distinct seeds for each group
+        const unsigned int seed = 16 * i;
+
         switch(init_method)
         {
         case 0: break;
         case 1:
-            a_m_k[i].GenerateTensorValue(GeneratorTensor_2<ADataType>{-5, 5}, num_thread);
-            b_k_n[i].GenerateTensorValue(GeneratorTensor_2<BDataType>{-5, 5}, num_thread);
+            a_m_k[i].GenerateTensorValue(GeneratorTensor_2<ADataType>{-5, 5, seed}, num_thread);
+            b_k_n[i].GenerateTensorValue(GeneratorTensor_2<BDataType>{-5, 5, seed + 1}, num_thread);
             break;
         default:
-            a_m_k[i].GenerateTensorValue(GeneratorTensor_3<ADataType>{0.0, 1.0}, num_thread);
-            b_k_n[i].GenerateTensorValue(GeneratorTensor_3<BDataType>{-0.5, 0.5}, num_thread);
+            a_m_k[i].GenerateTensorValue(GeneratorTensor_3<ADataType>{0.0, 1.0, seed}, num_thread);
+            b_k_n[i].GenerateTensorValue(GeneratorTensor_3<BDataType>{-0.5, 0.5, seed + 1},
+                                         num_thread);
         }
     }
 
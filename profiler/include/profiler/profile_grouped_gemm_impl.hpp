@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -22,6 +22,8 @@
 #include "ck/library/utility/fill.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/profiler_result.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -94,16 +96,21 @@ bool profile_grouped_gemm_impl(int do_verification,
                       << "]:" << c_m_n_device_results[i].mDesc << std::endl;
         }
         std::size_t num_thread = 1;
+
+        // distinct seeds for each group
+        const unsigned int seed = 16 * i;
+
         switch(init_method)
         {
         case 0: break;
         case 1:
-            a_m_k[i].GenerateTensorValue(GeneratorTensor_2<ADataType>{-5, 5}, num_thread);
-            b_k_n[i].GenerateTensorValue(GeneratorTensor_2<BDataType>{-5, 5}, num_thread);
+            a_m_k[i].GenerateTensorValue(GeneratorTensor_2<ADataType>{-5, 5, seed}, num_thread);
+            b_k_n[i].GenerateTensorValue(GeneratorTensor_2<BDataType>{-5, 5, seed + 1}, num_thread);
             break;
         default:
-            a_m_k[i].GenerateTensorValue(GeneratorTensor_3<ADataType>{0.0, 1.0}, num_thread);
-            b_k_n[i].GenerateTensorValue(GeneratorTensor_3<BDataType>{-0.5, 0.5}, num_thread);
+            a_m_k[i].GenerateTensorValue(GeneratorTensor_3<ADataType>{0.0, 1.0, seed}, num_thread);
+            b_k_n[i].GenerateTensorValue(GeneratorTensor_3<BDataType>{-0.5, 0.5, seed + 1},
+                                         num_thread);
         }
     }
 
@@ -267,9 +274,9 @@ bool profile_grouped_gemm_impl(int do_verification,
                 invoker_ptr->Run(argument_ptr.get(),
                                  StreamConfig{nullptr, false, 0, n_warmup, n_iter});
 
+                bool instance_pass = true;
                 if(do_verification)
                 {
-                    bool instance_pass = true;
                     for(std::size_t i = 0; i < gemm_descs.size(); i++)
                     {
 
@@ -314,21 +321,22 @@ bool profile_grouped_gemm_impl(int do_verification,
                 float ave_time = invoker_ptr->Run(
                     argument_ptr.get(), StreamConfig{nullptr, time_kernel, 0, n_warmup, n_iter});
 
-                if(time_kernel)
+                std::size_t flop = 0, num_btype = 0;
+                for(std::size_t i = 0; i < gemm_descs.size(); i++)
                 {
-                    std::size_t flop = 0, num_btype = 0;
-                    for(std::size_t i = 0; i < gemm_descs.size(); i++)
-                    {
-                        flop += std::size_t(2) * Ms[i] * Ns[i] * Ks[i];
+                    flop += std::size_t(2) * Ms[i] * Ns[i] * Ks[i];
 
-                        num_btype += sizeof(ADataType) * Ms[i] * Ks[i] +
-                                     sizeof(BDataType) * Ks[i] * Ns[i] +
-                                     sizeof(CDataType) * Ms[i] * Ns[i];
-                    }
+                    num_btype += sizeof(ADataType) * Ms[i] * Ks[i] +
+                                 sizeof(BDataType) * Ks[i] * Ns[i] +
+                                 sizeof(CDataType) * Ms[i] * Ns[i];
+                }
+
+                float tflops = static_cast<float>(flop) / 1.E9 / ave_time;
 
-                    float tflops = static_cast<float>(flop) / 1.E9 / ave_time;
+                float gb_per_sec = num_btype / 1.E6 / ave_time;
 
-                    float gb_per_sec = num_btype / 1.E6 / ave_time;
+                if(time_kernel)
+                {
                     std::cout << "Perf: " << std::setw(10) << ave_time << " ms, " << tflops
                               << " TFlops, " << gb_per_sec << " GB/s, " << gemm_name << ", KBatch "
                               << kbatch_curr << std::endl;
@@ -342,6 +350,20 @@ bool profile_grouped_gemm_impl(int do_verification,
                         best_kbatch     = kbatch_curr;
                     }
                 }
+
+                auto result = ProfilerResult{"grouped_gemm",
+                                             get_data_type_names<ADataType, BDataType, CDataType>(),
+                                             get_layout_names<ALayout, BLayout, CLayout>()};
+                result.AddProblemDims("Ms", Ms)
+                    .AddProblemDims("Ns", Ns)
+                    .AddProblemDims("Ks", Ks)
+                    .AddProblemDims("StrideAs", StrideAs)
+                    .AddProblemDims("StrideBs", StrideBs)
+                    .AddProblemDims("StrideCs", StrideCs)
+                    .AddProblemDim("KBatch", kbatch_curr)
+                    .SetPerf(gemm_name, ave_time, tflops, gb_per_sec, n_warmup, n_iter)
+                    .SetVerification(do_verification, instance_pass);
+                write_profiler_result(result);
             }
             else
             {
@@ -22,6 +22,8 @@
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
 
+#include "profiler/profiler_result.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -110,12 +112,14 @@ bool profile_permute_scale_impl(int do_verification,
             b_device_buf.SetZero();
             invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, false});
 
+            bool instance_pass = true;
             if(do_verification)
             {
                 b_device_buf.FromDevice(b.mData.data());
 
-                pass &= ck::utils::check_err(
+                instance_pass = ck::utils::check_err(
                     b.mData, host_b.mData, "Error: Incorrect results b", 1e-3, 1e-3);
+                pass &= instance_pass;
 
                 if(do_log)
                 {
@@ -127,8 +131,9 @@ bool profile_permute_scale_impl(int do_verification,
 
             std::string op_name = op_ptr->GetTypeString();
 
-            float ave_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            const auto stream_config = StreamConfig{nullptr, time_kernel};
+
+            float ave_time = invoker_ptr->Run(argument_ptr.get(), stream_config);
 
             std::size_t flop = std::size_t(2) * a.mDesc.GetElementSpaceSize() / sizeof(ADataType);
 
@@ -142,6 +147,20 @@ bool profile_permute_scale_impl(int do_verification,
             std::cout << "Perf: " << std::setw(10) << ave_time << " ms, " << tflops << " TFlops, "
                       << gb_per_sec << " GB/s, " << op_name << std::endl;
 
+            auto result =
+                ProfilerResult{"permute_scale", get_data_type_names<ADataType, BDataType>(), {}};
+            result.AddProblemDims("lengths", lengths_vector)
+                .AddProblemDims("input_strides", input_strides_vector)
+                .AddProblemDims("output_strides", output_strides_vector)
+                .SetPerf(op_name,
+                         ave_time,
+                         tflops,
+                         gb_per_sec,
+                         stream_config.cold_niters_,
+                         stream_config.nrepeat_)
+                .SetVerification(do_verification, instance_pass);
+            write_profiler_result(result);
+
             if(tflops > best_tflops)
             {
                 best_instance_name = op_name;
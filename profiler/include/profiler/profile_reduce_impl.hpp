@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -14,6 +14,8 @@
 #include "ck/library/utility/host_common_util.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 
+#include "profiler/profiler_result.hpp"
+
 namespace ck {
 namespace tensor_operation {
 namespace device {
@@ -379,8 +381,9 @@ bool profile_reduce_impl_impl(bool do_verification,
 
             auto invoker_ptr = reduce_ptr->MakeInvokerPointer();
 
-            float avg_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            const auto stream_config = StreamConfig{nullptr, time_kernel};
+
+            float avg_time = invoker_ptr->Run(argument_ptr.get(), stream_config);
 
             std::size_t num_bytes =
                 invariant_total_length * reduce_total_length * sizeof(InDataType) +
@@ -398,9 +401,9 @@ bool profile_reduce_impl_impl(bool do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            bool single_pass = true;
             if(do_verification)
             {
-                bool single_pass;
 
                 out_dev.FromDevice(out.mData.data());
                 single_pass = ck::utils::check_err(out, out_ref);
@@ -419,6 +422,22 @@ bool profile_reduce_impl_impl(bool do_verification,
                 pass = pass && single_pass;
             };
 
+            auto result = ProfilerResult{
+                "reduce", get_data_type_names<InDataType, AccDataType, OutDataType>(), {}};
+            result.AddProblemDims("inLengths", inLengths)
+                .AddProblemDims("reduceDims", reduceDims)
+                .AddProblemDim("ReduceOpId", static_cast<long_index_t>(ReduceOpId))
+                .AddProblemDim("PropagateNan", PropagateNan)
+                .AddProblemDim("UseIndex", UseIndex)
+                .SetPerf(reduce_name,
+                         avg_time,
+                         0,
+                         gb_per_sec,
+                         stream_config.cold_niters_,
+                         stream_config.nrepeat_)
+                .SetVerification(do_verification, single_pass);
+            write_profiler_result(result);
+
             if(do_dumpout)
             {
                 dumpBufferToFile("dump_in.bin", in.mData.data(), in.mDesc.GetElementSize());
@@ -0,0 +1,315 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/stream_config.hpp"
+#include "ck/host_utility/timing_statistics.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/env.hpp"
+
+#include "ck/library/utility/convolution_parameter.hpp"
+
+// export CK_PROFILER_RESULT_FILE=<file.jsonl> to append a JSON line per profiled instance
+CK_DECLARE_ENV_VAR_STR(CK_PROFILER_RESULT_FILE)
+
+// export CK_PROFILER_ADAPTIVE_TIMING=1 to time the instances until the confidence interval of their
+// median time converges instead of a fixed number of iterations
+CK_DECLARE_ENV_VAR_BOOL(CK_PROFILER_ADAPTIVE_TIMING)
+
+// export CK_PROFILER_SAMPLED_VERIFICATION=1 to verify the instances with row sums and a sample of
+// the output, the full reference is only computed for the instances failing these checks
+CK_DECLARE_ENV_VAR_BOOL(CK_PROFILER_SAMPLED_VERIFICATION)
+
+namespace ck {
+namespace profiler {
+
+template <typename T>
+constexpr const char* get_data_type_name()
+{
+    if constexpr(is_same_v<T, double>)
+        return "fp64";
+    else if constexpr(is_same_v<T, float>)
+        return "fp32";
+    else if constexpr(is_same_v<T, half_t>)
+        return "fp16";
+    else if constexpr(is_same_v<T, bhalf_t>)
+        return "bf16";
+    else if constexpr(is_same_v<T, int32_t>)
+        return "int32";
+    else if constexpr(is_same_v<T, int8_t>)
+        return "int8";
+    else if constexpr(is_same_v<T, f8_t>)
+        return "fp8";
+    else if constexpr(is_same_v<T, bf8_t>)
+        return "bf8";
+    else
+        return "unknown";
+}
+
+template <typename... Ts>
+std::vector<std::string> get_data_type_names()
+{
+    return {get_data_type_name<Ts>()...};
+}
+
+template <typename... Layouts>
+std::vector<std::string> get_layout_names()
+{
+    return {Layouts::name...};
+}
+
+enum struct VerificationResult
+{
+    NotRun,
+    Pass,
+    Fail,
+};
+
+// One profiled (instance, problem) pair. Problem dimensions are kept in order of insertion.
+struct ProfilerResult
+{
+    std::string op_name;
+    std::vector<std::string> data_types;
+    std::vector<std::string> layouts;
+    std::vector<std::pair<std::string, std::string>> problem; // name, JSON value
+    std::string instance;
+    float ave_time   = 0;
+    float tflops     = 0;
+    float gb_per_sec = 0;
+    int n_warmup     = 0;
+    int n_iter       = 0;
+    TimingStatistics timing; // only with adaptive timing
+    VerificationResult verification = VerificationResult::NotRun;
+
+    ProfilerResult& AddProblemDim(const std::string& name, long_index_t value)
+    {
+        problem.emplace_back(name, std::to_string(value));
+        return *this;
+    }
+
+    // for identifiers (e.g. the name of an element-wise operation), the value is not escaped
+    ProfilerResult& AddProblemName(const std::string& name, const std::string& value)
+    {
+        problem.emplace_back(name, "\"" + value + "\"");
+        return *this;
+    }
+
+    template <typename Range>
+    ProfilerResult& AddProblemDims(const std::string& name, const Range& values)
+    {
+        std::string json = "[";
+        for(const auto& v : values)
+        {
+            json += (json.size() > 1 ? "," : "") + std::to_string(v);
+        }
+        problem.emplace_back(name, json + "]");
+        return *this;
+    }
+
+    ProfilerResult& AddConvProblem(const ck::utils::conv::ConvParam& conv_param)
+    {
+        return AddProblemDim("NDimSpatial", conv_param.num_dim_spatial_)
+            .AddProblemDim("G", conv_param.G_)
+            .AddProblemDim("N", conv_param.N_)
+            .AddProblemDim("K", conv_param.K_)
+            .AddProblemDim("C", conv_param.C_)
+            .AddProblemDims("filter_spatial_lengths", conv_param.filter_spatial_lengths_)
+            .AddProblemDims("input_spatial_lengths", conv_param.input_spatial_lengths_)
+            .AddProblemDims("conv_filter_strides", conv_param.conv_filter_strides_)
+            .AddProblemDims("conv_filter_dilations", conv_param.conv_filter_dilations_)
+            .AddProblemDims("input_left_pads", conv_param.input_left_pads_)
+            .AddProblemDims("input_right_pads", conv_param.input_right_pads_);
+    }
+
+    ProfilerResult& SetPerf(const std::string& instance_name,
+                            float ave_time_ms,
+                            float tflops_value,
+                            float gb_per_sec_value,
+                            int n_warmup_value,
+                            int n_iter_value)
+    {
+        instance   = instance_name;
+        ave_time   = ave_time_ms;
+        tflops     = tflops_value;
+        gb_per_sec = gb_per_sec_value;
+        n_warmup   = n_warmup_value;
+        n_iter     = n_iter_value;
+        return *this;
+    }
+
+    ProfilerResult& SetTimingStatistics(const TimingStatistics& statistics)
+    {
+        timing = statistics;
+        return *this;
+    }
+
+    ProfilerResult& SetVerification(bool do_verification, bool pass)
+    {
+        verification = !do_verification ? VerificationResult::NotRun
+                       : pass            ? VerificationResult::Pass
+                                         : VerificationResult::Fail;
+        return *this;
+    }
+};
+
+namespace detail {
+
+inline std::string to_json_string(const std::string& str)
+{
+    std::string json = "\"";
+    for(const char c : str)
+    {
+        switch(c)
+        {
+        case '"': json += "\\\""; break;
+        case '\\': json += "\\\\"; break;
+        case '\n': json += "\\n"; break;
+        case '\t': json += "\\t"; break;
+        default: json += c;
+        }
+    }
+    return json + "\"";
+}
+
+inline std::string to_json_array(const std::vector<std::string>& strs)
+{
+    std::string json = "[";
+    for(std::size_t i = 0; i < strs.size(); ++i)
+    {
+        json += (i > 0 ? "," : "") + to_json_string(strs[i]);
+    }
+    return json + "]";
+}
+
+inline std::string to_json_number(float value)
+{
+    // time is 0 (and throughput infinite) if kernels are not timed
+    if(!std::isfinite(value))
+    {
+        return "null";
+    }
+    std::ostringstream json;
+    json << value;
+    return json.str();
+}
+
+} // namespace detail
+
+inline std::string to_json(const ProfilerResult& result)
+{
+    static constexpr const char* verification_names[] = {"not_run", "pass", "fail"};
+    const auto verification = verification_names[static_cast<int>(result.verification)];
+
+    std::ostringstream json;
+    json << "{\"op\":" << detail::to_json_string(result.op_name)
+         << ",\"data_types\":" << detail::to_json_array(result.data_types)
+         << ",\"layouts\":" << detail::to_json_array(result.layouts) << ",\"problem\":{";
+    for(std::size_t i = 0; i < result.problem.size(); ++i)
+    {
+        json << (i > 0 ? "," : "") << detail::to_json_string(result.problem[i].first) << ":"
+             << result.problem[i].second;
+    }
+    json << "},\"instance\":" << detail::to_json_string(result.instance)
+         << ",\"ave_time_ms\":" << detail::to_json_number(result.ave_time)
+         << ",\"tflops\":" << detail::to_json_number(result.tflops)
+         << ",\"gb_per_sec\":" << detail::to_json_number(result.gb_per_sec)
+         << ",\"n_warmup\":" << result.n_warmup << ",\"n_iter\":" << result.n_iter;
+    if(result.timing.num_samples > 0)
+    {
+        json << ",\"median_ms\":" << detail::to_json_number(result.timing.median_ms)
+             << ",\"p90_ms\":" << detail::to_json_number(result.timing.p90_ms)
+             << ",\"ci_ms\":[" << detail::to_json_number(result.timing.ci_low_ms) << ","
+             << detail::to_json_number(result.timing.ci_high_ms)
+             << "],\"num_samples\":" << result.timing.num_samples
+             << ",\"num_outliers\":" << result.timing.num_outliers;
+    }
+    json << ",\"verification\":\"" << verification << "\"}";
+    return json.str();
+}
+
+inline bool is_adaptive_timing_enabled()
+{
+    return ck::EnvIsEnabled(CK_ENV(CK_PROFILER_ADAPTIVE_TIMING));
+}
+
+inline bool is_sampled_verification_enabled()
+{
+    return ck::EnvIsEnabled(CK_ENV(CK_PROFILER_SAMPLED_VERIFICATION));
+}
+
+// number of random output elements compared to the reference by the sampled verification
+constexpr std::size_t num_verification_samples = 1024;
+
+// StreamConfig to time an instance, n_warmup and n_iter are ignored by the adaptive timing which
+// writes its statistics to *p_statistics
+inline StreamConfig make_profiler_stream_config(bool time_kernel,
+                                                int n_warmup,
+                                                int n_iter,
+                                                TimingStatistics* p_statistics = nullptr)
+{
+    StreamConfig stream_config{nullptr, time_kernel, 0, n_warmup, n_iter};
+    stream_config.adaptive_timing_   = is_adaptive_timing_enabled();
+    stream_config.timing_statistics_ = p_statistics;
+    return stream_config;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const TimingStatistics& statistics)
+{
+    return os << "median " << statistics.median_ms << " ms, p90 " << statistics.p90_ms
+              << " ms, 95% CI [" << statistics.ci_low_ms << ", " << statistics.ci_high_ms
+              << "] ms, " << statistics.num_samples << " samples, " << statistics.num_outliers
+              << " outliers";
+}
+
+// Print the instances that cannot be told apart from the fastest one
+inline void print_timing_ranking(const std::vector<std::string>& instances,
+                                 const std::vector<TimingStatistics>& statistics)
+{
+    const std::vector<int> ranks = rank_timing_statistics(statistics);
+
+    std::cout << "Instances tied with the fastest (overlapping confidence intervals):" << std::endl;
+    for(std::size_t i = 0; i < instances.size(); ++i)
+    {
+        if(ranks[i] == 1)
+        {
+            std::cout << "    " << instances[i] << ": " << statistics[i] << std::endl;
+        }
+    }
+}
+
+// Append result as a JSON line to $CK_PROFILER_RESULT_FILE, no-op if the variable is not set.
+// Use script/ck_perf_db.py to import the files into a SQLite database and compare runs.
+inline void write_profiler_result(const ProfilerResult& result)
+{
+    const std::string& file_name = ck::EnvGetString(CK_ENV(CK_PROFILER_RESULT_FILE));
+    if(file_name.empty())
+    {
+        return;
+    }
+
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    std::ofstream file(file_name, std::ios::app);
+    if(!file)
+    {
+        std::cerr << "cannot open profiler result file " << file_name << std::endl;
+        return;
+    }
+    file << to_json(result) << std::endl;
+}
+
+} // namespace profiler
+} // namespace ck
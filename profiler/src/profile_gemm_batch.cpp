@@ -0,0 +1,368 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "profiler/profile_gemm_batch_impl.hpp"
+#include "profiler_operation_registry.hpp"
+
+enum struct GemmMatrixLayout
+{
+    MK_KN_MN, // 0
+    MK_NK_MN, // 1
+    KM_KN_MN, // 2
+    KM_NK_MN, // 3
+};
+
+enum struct GemmDataType
+{
+    F32_F32_F32,    // 0
+    F16_F16_F16,    // 1
+    BF16_BF16_BF16, // 2
+    INT8_INT8_INT8, // 3
+    F8_F8_F8,       // 4
+};
+
+#define OP_NAME "gemm_batch"
+#define OP_DESC "GEMM, list of shapes"
+
+namespace {
+
+using ck::profiler::GemmBatchShape;
+
+void print_helper_msg()
+{
+    std::cout << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+              << "arg2: data type (0: fp32; 1: fp16; 2: bf16; 3: int8; 4: fp8)\n"
+              << "arg3: matrix layout (0: A[m, k] * B[k, n] = C[m, n];\n"
+              << "                     1: A[m, k] * B[n, k] = C[m, n];\n"
+              << "                     2: A[k, m] * B[k, n] = C[m, n];\n"
+              << "                     3: A[k, m] * B[n, k] = C[m, n])\n"
+              << "arg4: verification (0: no; 1: yes)\n"
+              << "arg5: initialization (0: no init; 1: integer value; 2: decimal value)\n"
+              << "arg6: print tensor value (0: no; 1: yes)\n"
+              << "arg7: time kernel (0: no, 1: yes)\n"
+              << "arg8: shape list file, either CSV with lines M,N,K[,StrideA,StrideB,StrideC]\n"
+              << "      or JSON array of objects {\"M\": .., \"N\": .., \"K\": .., ...}\n"
+              << "      (stride -1 or missing: packed)\n"
+              << "arg9: results file (CSV, one line per shape)\n"
+              << "optional:\n"
+              << "arg10: number of warm-up cycles (default 1)\n"
+              << "arg11: number of iterations (default 10)\n"
+              << std::endl;
+}
+
+// JSON: [{"M": 384, "N": 768, "K": 768, "StrideA": -1}, ...]
+std::vector<GemmBatchShape> parse_json_shapes(const std::string& text)
+{
+    std::vector<GemmBatchShape> shapes;
+
+    auto f_get_value = [](const std::string& object, const std::string& key, int default_value) {
+        const auto key_pos = object.find("\"" + key + "\"");
+        if(key_pos == std::string::npos)
+        {
+            return default_value;
+        }
+        const auto colon_pos = object.find(':', key_pos);
+        if(colon_pos == std::string::npos)
+        {
+            throw std::runtime_error("wrong! missing value of " + key);
+        }
+        return std::stoi(object.substr(colon_pos + 1));
+    };
+
+    std::size_t begin = text.find('{');
+    while(begin != std::string::npos)
+    {
+        const std::size_t end = text.find('}', begin);
+        if(end == std::string::npos)
+        {
+            throw std::runtime_error("wrong! unterminated JSON object in shape list");
+        }
+        const std::string object = text.substr(begin, end - begin + 1);
+
+        shapes.push_back({f_get_value(object, "M", 0),
+                          f_get_value(object, "N", 0),
+                          f_get_value(object, "K", 0),
+                          f_get_value(object, "StrideA", -1),
+                          f_get_value(object, "StrideB", -1),
+                          f_get_value(object, "StrideC", -1)});
+
+        begin = text.find('{', end);
+    }
+
+    return shapes;
+}
+
+// CSV: M,N,K[,StrideA,StrideB,StrideC] per line, header line and '#' comments are skipped
+std::vector<GemmBatchShape> parse_csv_shapes(const std::string& text)
+{
+    std::vector<GemmBatchShape> shapes;
+
+    std::istringstream lines(text);
+    std::string line;
+    while(std::getline(lines, line))
+    {
+        line = line.substr(0, line.find('#'));
+
+        std::vector<std::string> items;
+        std::istringstream in(line);
+        std::string item;
+        while(std::getline(in, item, ','))
+        {
+            items.push_back(item);
+        }
+
+        const auto first = line.find_first_not_of(" \t\r");
+        if(first == std::string::npos ||
+           !(std::isdigit(static_cast<unsigned char>(line[first])) || line[first] == '-'))
+        {
+            // empty or header line
+            continue;
+        }
+
+        if(items.size() != 3 && items.size() != 6)
+        {
+            throw std::runtime_error("wrong! expected M,N,K[,StrideA,StrideB,StrideC]: " + line);
+        }
+
+        GemmBatchShape shape{
+            std::stoi(items[0]), std::stoi(items[1]), std::stoi(items[2]), -1, -1, -1};
+        if(items.size() == 6)
+        {
+            shape.StrideA = std::stoi(items[3]);
+            shape.StrideB = std::stoi(items[4]);
+            shape.StrideC = std::stoi(items[5]);
+        }
+        shapes.push_back(shape);
+    }
+
+    return shapes;
+}
+
+std::vector<GemmBatchShape> read_shapes(const std::string& file_name)
+{
+    std::ifstream file(file_name);
+    if(!file)
+    {
+        throw std::runtime_error("wrong! cannot open shape list " + file_name);
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string text = buffer.str();
+
+    const auto first = text.find_first_not_of(" \t\r\n");
+    if(first != std::string::npos && (text[first] == '[' || text[first] == '{'))
+    {
+        return parse_json_shapes(text);
+    }
+
+    return parse_csv_shapes(text);
+}
+
+} // namespace
+
+int profile_gemm_batch(int argc, char* argv[])
+{
+    if(argc != 10 && argc != 12)
+    {
+        print_helper_msg();
+        exit(1);
+    }
+
+    const auto data_type       = static_cast<GemmDataType>(std::stoi(argv[2]));
+    const auto layout          = static_cast<GemmMatrixLayout>(std::stoi(argv[3]));
+    const bool do_verification = std::stoi(argv[4]);
+    const int init_method      = std::stoi(argv[5]);
+    const bool do_log          = std::stoi(argv[6]);
+    const bool time_kernel     = std::stoi(argv[7]);
+
+    const auto shapes             = read_shapes(argv[8]);
+    const std::string result_file = argv[9];
+
+    int n_warmup = 1;
+    int n_iter   = 10;
+    if(argc == 12)
+    {
+        n_warmup = std::stoi(argv[10]);
+        n_iter   = std::stoi(argv[11]);
+    }
+
+    using F32 = float;
+    using F16 = ck::half_t;
+#ifdef CK_ENABLE_BF16
+    using BF16 = ck::bhalf_t;
+#endif
+#ifdef CK_ENABLE_INT8
+    using INT8  = int8_t;
+    using INT32 = int32_t;
+#endif
+#ifdef CK_ENABLE_FP8
+    using F8 = ck::f8_t;
+#endif
+
+    using Row = ck::tensor_layout::gemm::RowMajor;
+    using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+    auto profile = [&](auto a_layout,
+                       auto b_layout,
+                       auto c_layout,
+                       auto a_type,
+                       auto b_type,
+                       auto acc_type,
+                       auto c_type) {
+        using ALayout = decltype(a_layout);
+        using BLayout = decltype(b_layout);
+        using CLayout = decltype(c_layout);
+
+        using ADataType   = decltype(a_type);
+        using BDataType   = decltype(b_type);
+        using AccDataType = decltype(acc_type);
+        using CDataType   = decltype(c_type);
+
+        // resolve default (packed) strides
+        std::vector<GemmBatchShape> layout_shapes = shapes;
+        for(auto& s : layout_shapes)
+        {
+            const int DefaultStrideA = ck::is_same_v<ALayout, Row> ? s.K : s.M;
+            const int DefaultStrideB = ck::is_same_v<BLayout, Row> ? s.N : s.K;
+            const int DefaultStrideC = ck::is_same_v<CLayout, Row> ? s.N : s.M;
+
+            s.StrideA = (s.StrideA < 0) ? DefaultStrideA : s.StrideA;
+            s.StrideB = (s.StrideB < 0) ? DefaultStrideB : s.StrideB;
+            s.StrideC = (s.StrideC < 0) ? DefaultStrideC : s.StrideC;
+        }
+
+        bool pass = ck::profiler::profile_gemm_batch_impl<ALayout,
+                                                          BLayout,
+                                                          CLayout,
+                                                          ADataType,
+                                                          BDataType,
+                                                          AccDataType,
+                                                          CDataType>(do_verification,
+                                                                     init_method,
+                                                                     do_log,
+                                                                     time_kernel,
+                                                                     layout_shapes,
+                                                                     result_file,
+                                                                     n_warmup,
+                                                                     n_iter);
+
+        return pass ? 0 : 1;
+    };
+
+    if(data_type != GemmDataType::F32_F32_F32 && data_type != GemmDataType::F16_F16_F16 &&
+       data_type != GemmDataType::BF16_BF16_BF16 && data_type != GemmDataType::INT8_INT8_INT8 &&
+       data_type != GemmDataType::F8_F8_F8)
+    {
+        // dummy clause before the else clauses for different data types
+        std::cout << "Gemm batch: this data_type is not implemented" << std::endl;
+        return 1;
+    }
+#ifdef CK_ENABLE_FP32
+    else if(data_type == GemmDataType::F32_F32_F32 && layout == GemmMatrixLayout::MK_KN_MN)
+    {
+        return profile(Row{}, Row{}, Row{}, F32{}, F32{}, F32{}, F32{});
+    }
+    else if(data_type == GemmDataType::F32_F32_F32 && layout == GemmMatrixLayout::MK_NK_MN)
+    {
+        return profile(Row{}, Col{}, Row{}, F32{}, F32{}, F32{}, F32{});
+    }
+    else if(data_type == GemmDataType::F32_F32_F32 && layout == GemmMatrixLayout::KM_KN_MN)
+    {
+        return profile(Col{}, Row{}, Row{}, F32{}, F32{}, F32{}, F32{});
+    }
+    else if(data_type == GemmDataType::F32_F32_F32 && layout == GemmMatrixLayout::KM_NK_MN)
+    {
+        return profile(Col{}, Col{}, Row{}, F32{}, F32{}, F32{}, F32{});
+    }
+#endif
+#ifdef CK_ENABLE_FP16
+    else if(data_type == GemmDataType::F16_F16_F16 && layout == GemmMatrixLayout::MK_KN_MN)
+    {
+        return profile(Row{}, Row{}, Row{}, F16{}, F16{}, F32{}, F16{});
+    }
+    else if(data_type == GemmDataType::F16_F16_F16 && layout == GemmMatrixLayout::MK_NK_MN)
+    {
+        return profile(Row{}, Col{}, Row{}, F16{}, F16{}, F32{}, F16{});
+    }
+    else if(data_type == GemmDataType::F16_F16_F16 && layout == GemmMatrixLayout::KM_KN_MN)
+    {
+        return profile(Col{}, Row{}, Row{}, F16{}, F16{}, F32{}, F16{});
+    }
+    else if(data_type == GemmDataType::F16_F16_F16 && layout == GemmMatrixLayout::KM_NK_MN)
+    {
+        return profile(Col{}, Col{}, Row{}, F16{}, F16{}, F32{}, F16{});
+    }
+#endif
+#ifdef CK_ENABLE_BF16
+    else if(data_type == GemmDataType::BF16_BF16_BF16 && layout == GemmMatrixLayout::MK_KN_MN)
+    {
+        return profile(Row{}, Row{}, Row{}, BF16{}, BF16{}, F32{}, BF16{});
+    }
+    else if(data_type == GemmDataType::BF16_BF16_BF16 && layout == GemmMatrixLayout::MK_NK_MN)
+    {
+        return profile(Row{}, Col{}, Row{}, BF16{}, BF16{}, F32{}, BF16{});
+    }
+    else if(data_type == GemmDataType::BF16_BF16_BF16 && layout == GemmMatrixLayout::KM_KN_MN)
+    {
+        return profile(Col{}, Row{}, Row{}, BF16{}, BF16{}, F32{}, BF16{});
+    }
+    else if(data_type == GemmDataType::BF16_BF16_BF16 && layout == GemmMatrixLayout::KM_NK_MN)
+    {
+        return profile(Col{}, Col{}, Row{}, BF16{}, BF16{}, F32{}, BF16{});
+    }
+#endif
+#ifdef CK_ENABLE_INT8
+    else if(data_type == GemmDataType::INT8_INT8_INT8 && layout == GemmMatrixLayout::MK_KN_MN)
+    {
+        return profile(Row{}, Row{}, Row{}, INT8{}, INT8{}, INT32{}, INT8{});
+    }
+    else if(data_type == GemmDataType::INT8_INT8_INT8 && layout == GemmMatrixLayout::MK_NK_MN)
+    {
+        return profile(Row{}, Col{}, Row{}, INT8{}, INT8{}, INT32{}, INT8{});
+    }
+    else if(data_type == GemmDataType::INT8_INT8_INT8 && layout == GemmMatrixLayout::KM_KN_MN)
+    {
+        return profile(Col{}, Row{}, Row{}, INT8{}, INT8{}, INT32{}, INT8{});
+    }
+    else if(data_type == GemmDataType::INT8_INT8_INT8 && layout == GemmMatrixLayout::KM_NK_MN)
+    {
+        return profile(Col{}, Col{}, Row{}, INT8{}, INT8{}, INT32{}, INT8{});
+    }
+#endif
+#ifdef CK_ENABLE_FP8
+    else if(data_type == GemmDataType::F8_F8_F8 && layout == GemmMatrixLayout::MK_KN_MN)
+    {
+        return profile(Row{}, Row{}, Row{}, F8{}, F8{}, F32{}, F8{});
+    }
+    else if(data_type == GemmDataType::F8_F8_F8 && layout == GemmMatrixLayout::MK_NK_MN)
+    {
+        return profile(Row{}, Col{}, Row{}, F8{}, F8{}, F32{}, F8{});
+    }
+    else if(data_type == GemmDataType::F8_F8_F8 && layout == GemmMatrixLayout::KM_KN_MN)
+    {
+        return profile(Col{}, Row{}, Row{}, F8{}, F8{}, F32{}, F8{});
+    }
+    else if(data_type == GemmDataType::F8_F8_F8 && layout == GemmMatrixLayout::KM_NK_MN)
+    {
+        return profile(Col{}, Col{}, Row{}, F8{}, F8{}, F32{}, F8{});
+    }
+#endif
+    else
+    {
+        std::cout << "Gemm batch: this data_type & layout is not implemented" << std::endl;
+
+        return 1;
+    }
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_gemm_batch);
@@ -0,0 +1,320 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+"""
+Local database of ckProfiler results and regression check between two runs.
+
+ckProfiler appends a JSON line per profiled (instance, problem) pair to the file given by
+CK_PROFILER_RESULT_FILE. This script imports such files into a SQLite database as named runs and
+compares two runs, either per instance or per problem (best instance of each problem).
+
+Example:
+    CK_PROFILER_RESULT_FILE=base.jsonl ./bin/ckProfiler gemm 1 1 1 1 0 1 3840 4096 4096 -1 -1 -1
+    python3 script/ck_perf_db.py import perf.db base base.jsonl
+    python3 script/ck_perf_db.py import perf.db new new.jsonl
+    python3 script/ck_perf_db.py compare perf.db base new --threshold 0.05
+
+Runs can also be given as JSON Lines files instead of run names, then no database is needed:
+    python3 script/ck_perf_db.py compare - base.jsonl new.jsonl
+
+A result is reported as regression if the mean time grows by more than the relative threshold
+and, if a key was profiled several times in both runs, the growth is also larger than
+--sigma standard errors of the difference (Welch).
+
+Only timed records can be compared. Ops without timed records in one of the runs (not profiled,
+run without timing or profiled by a ckProfiler op which does not write results) are listed
+instead of being left out of the comparison; --ops names the ops which are expected in both runs:
+    python3 script/ck_perf_db.py compare perf.db base new --ops gemm,grouped_gemm,conv_fwd
+
+The exit code is 1 if there are regressions or verification failures in the new run, or if an op
+of the base run or of --ops has no timed records in the new run.
+"""
+import argparse
+import datetime
+import json
+import math
+import os
+import sqlite3
+import sys
+
+SCHEMA = """
+CREATE TABLE IF NOT EXISTS runs (
+    id INTEGER PRIMARY KEY AUTOINCREMENT,
+    name TEXT UNIQUE NOT NULL,
+    created TEXT NOT NULL,
+    source TEXT
+);
+CREATE TABLE IF NOT EXISTS results (
+    run_id INTEGER NOT NULL REFERENCES runs(id),
+    op TEXT NOT NULL,
+    data_types TEXT NOT NULL,
+    layouts TEXT NOT NULL,
+    problem TEXT NOT NULL,
+    instance TEXT NOT NULL,
+    ave_time_ms REAL,
+    tflops REAL,
+    gb_per_sec REAL,
+    n_warmup INTEGER,
+    n_iter INTEGER,
+    verification TEXT
+);
+CREATE INDEX IF NOT EXISTS results_run ON results(run_id);
+"""
+
+COLUMNS = ("op", "data_types", "layouts", "problem", "instance", "ave_time_ms", "tflops",
+           "gb_per_sec", "n_warmup", "n_iter", "verification")
+
+
+def canonical(value):
+    return json.dumps(value, sort_keys=True, separators=(",", ":"))
+
+
+def read_jsonl(path):
+    records = []
+    with open(path) as f:
+        for line_number, line in enumerate(f, 1):
+            line = line.strip()
+            if not line:
+                continue
+            try:
+                r = json.loads(line)
+            except json.JSONDecodeError as e:
+                # a line can be truncated if ckProfiler was killed
+                sys.stderr.write("{}:{}: skipped ({})\n".format(path, line_number, e))
+                continue
+            records.append({
+                "op": r["op"],
+                "data_types": canonical(r.get("data_types", [])),
+                "layouts": canonical(r.get("layouts", [])),
+                "problem": canonical(r.get("problem", {})),
+                "instance": r.get("instance", ""),
+                "ave_time_ms": r.get("ave_time_ms"),
+                "tflops": r.get("tflops"),
+                "gb_per_sec": r.get("gb_per_sec"),
+                "n_warmup": r.get("n_warmup"),
+                "n_iter": r.get("n_iter"),
+                "verification": r.get("verification", "not_run"),
+            })
+    return records
+
+
+def open_db(path):
+    db = sqlite3.connect(path)
+    db.executescript(SCHEMA)
+    return db
+
+
+def import_run(db, name, paths):
+    if db.execute("SELECT id FROM runs WHERE name = ?", (name,)).fetchone():
+        raise SystemExit("run '{}' already exists".format(name))
+    cursor = db.execute("INSERT INTO runs(name, created, source) VALUES (?, ?, ?)",
+                        (name, datetime.datetime.now().isoformat(timespec="seconds"),
+                         ",".join(os.path.abspath(p) for p in paths)))
+    run_id = cursor.lastrowid
+    count = 0
+    for path in paths:
+        records = read_jsonl(path)
+        db.executemany(
+            "INSERT INTO results(run_id, {}) VALUES (?, {})".format(
+                ", ".join(COLUMNS), ", ".join("?" * len(COLUMNS))),
+            [(run_id,) + tuple(r[c] for c in COLUMNS) for r in records])
+        count += len(records)
+    db.commit()
+    return count
+
+
+def load_run(db, run):
+    """Run name in the database or JSON Lines file."""
+    if run.endswith(".jsonl") and os.path.isfile(run):
+        return read_jsonl(run)
+    if db is None:
+        raise SystemExit("'{}' is not a JSON Lines file and no database is given".format(run))
+    row = db.execute("SELECT id FROM runs WHERE name = ?", (run,)).fetchone()
+    if row is None:
+        raise SystemExit("run '{}' not found".format(run))
+    cursor = db.execute("SELECT {} FROM results WHERE run_id = ?".format(", ".join(COLUMNS)),
+                        (row[0],))
+    return [dict(zip(COLUMNS, values)) for values in cursor]
+
+
+def problem_key(r):
+    return (r["op"], r["data_types"], r["layouts"], r["problem"])
+
+
+def mean_std(values):
+    n = len(values)
+    mean = sum(values) / n
+    var = sum((v - mean) ** 2 for v in values) / (n - 1) if n > 1 else 0.0
+    return mean, math.sqrt(var), n
+
+
+def group_times(records, key):
+    groups = {}
+    for r in records:
+        if r["ave_time_ms"] is None or r["ave_time_ms"] <= 0:
+            continue
+        groups.setdefault(key(r), []).append(r["ave_time_ms"])
+    return {k: mean_std(v) for k, v in groups.items()}
+
+
+def best_times(records):
+    """Best (minimal) mean time over the instances of each problem."""
+    per_instance = group_times(records, lambda r: problem_key(r) + (r["instance"],))
+    best = {}
+    for k, stats in per_instance.items():
+        if k[:-1] not in best or stats[0] < best[k[:-1]][0][0]:
+            best[k[:-1]] = (stats, k[-1])
+    return best
+
+
+def timed_record_counts(records):
+    """Number of records and of timed records of each op."""
+    counts = {}
+    for r in records:
+        count = counts.setdefault(r["op"], [0, 0])
+        count[0] += 1
+        if r["ave_time_ms"] is not None and r["ave_time_ms"] > 0:
+            count[1] += 1
+    return counts
+
+
+def ops_without_timed_records(base_records, new_records, expected_ops):
+    """Ops of either run or of expected_ops lacking timed records in a run."""
+    base = timed_record_counts(base_records)
+    new = timed_record_counts(new_records)
+    ops = []
+    for op in sorted(set(base) | set(new) | set(expected_ops)):
+        base_count, new_count = base.get(op, [0, 0]), new.get(op, [0, 0])
+        if base_count[1] == 0 or new_count[1] == 0:
+            ops.append((op, base_count, new_count))
+    return ops
+
+
+def is_regression(base, new, threshold, sigma):
+    (base_mean, base_std, base_n), (new_mean, new_std, new_n) = base, new
+    if new_mean <= base_mean * (1.0 + threshold):
+        return False
+    if base_n > 1 and new_n > 1:
+        stderr = math.sqrt(base_std ** 2 / base_n + new_std ** 2 / new_n)
+        return new_mean - base_mean > sigma * stderr
+    return True
+
+
+def format_key(key):
+    op, data_types, layouts, problem = key[:4]
+    text = "{} {} {} {}".format(op, ",".join(json.loads(data_types)),
+                                ",".join(json.loads(layouts)), problem)
+    return text if len(key) == 4 else text + " " + key[4]
+
+
+def compare(base_records, new_records, threshold, sigma, per_instance):
+    regressions = []
+    improvements = []
+    if per_instance:
+        key = lambda r: problem_key(r) + (r["instance"],)
+        base = group_times(base_records, key)
+        new = group_times(new_records, key)
+        for k in sorted(base.keys() & new.keys()):
+            if is_regression(base[k], new[k], threshold, sigma):
+                regressions.append((k, base[k][0], new[k][0], ""))
+            elif is_regression(new[k], base[k], threshold, sigma):
+                improvements.append((k, base[k][0], new[k][0], ""))
+        missing = sorted(base.keys() - new.keys())
+    else:
+        base = best_times(base_records)
+        new = best_times(new_records)
+        for k in sorted(base.keys() & new.keys()):
+            (base_stats, base_instance), (new_stats, new_instance) = base[k], new[k]
+            note = "" if base_instance == new_instance else "best instance changed"
+            if is_regression(base_stats, new_stats, threshold, sigma):
+                regressions.append((k, base_stats[0], new_stats[0], note))
+            elif is_regression(new_stats, base_stats, threshold, sigma):
+                improvements.append((k, base_stats[0], new_stats[0], note))
+        missing = sorted(base.keys() - new.keys())
+    return regressions, improvements, missing
+
+
+def print_changes(title, changes):
+    print("{} ({}):".format(title, len(changes)))
+    for k, base_ms, new_ms, note in changes:
+        print("  {:+7.1%}  {:.4f} ms -> {:.4f} ms  {}{}".format(
+            new_ms / base_ms - 1.0, base_ms, new_ms, format_key(k),
+            "  (" + note + ")" if note else ""))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="ckProfiler results database")
+    subparsers = parser.add_subparsers(dest="command", required=True)
+
+    p_import = subparsers.add_parser("import", help="import JSON Lines files as a run")
+    p_import.add_argument("db", help="SQLite database file")
+    p_import.add_argument("run", help="run name")
+    p_import.add_argument("files", nargs="+", help="JSON Lines files written by ckProfiler")
+
+    p_list = subparsers.add_parser("list", help="list runs")
+    p_list.add_argument("db", help="SQLite database file")
+
+    p_compare = subparsers.add_parser("compare", help="compare two runs")
+    p_compare.add_argument("db", help="SQLite database file ('-' if runs are JSON Lines files)")
+    p_compare.add_argument("base", help="baseline run name or JSON Lines file")
+    p_compare.add_argument("new", help="new run name or JSON Lines file")
+    p_compare.add_argument("--threshold", type=float, default=0.05,
+                           help="relative slowdown reported as regression (default 0.05)")
+    p_compare.add_argument("--sigma", type=float, default=3.0,
+                           help="required number of standard errors if a key was profiled "
+                           "several times in both runs (default 3)")
+    p_compare.add_argument("--per-instance", action="store_true",
+                           help="compare every instance instead of the best instance per problem")
+    p_compare.add_argument("--show-improvements", action="store_true")
+    p_compare.add_argument("--ops", default="",
+                           help="comma separated ops expected to have timed records in both runs")
+    args = parser.parse_args()
+
+    if args.command == "import":
+        db = open_db(args.db)
+        count = import_run(db, args.run, args.files)
+        print("imported {} results as run '{}'".format(count, args.run))
+        return 0
+
+    if args.command == "list":
+        db = open_db(args.db)
+        for name, created, count in db.execute(
+                "SELECT name, created, (SELECT COUNT(*) FROM results WHERE run_id = runs.id) "
+                "FROM runs ORDER BY id"):
+            print("{:<32} {:<20} {:>8} results".format(name, created, count))
+        return 0
+
+    db = None if args.db == "-" else open_db(args.db)
+    base_records = load_run(db, args.base)
+    new_records = load_run(db, args.new)
+
+    regressions, improvements, missing = compare(base_records, new_records, args.threshold,
+                                                 args.sigma, args.per_instance)
+    failures = [r for r in new_records if r["verification"] == "fail"]
+    expected_ops = [op for op in args.ops.split(",") if op]
+    untimed_ops = ops_without_timed_records(base_records, new_records, expected_ops)
+    lost_ops = [op for op, base_count, new_count in untimed_ops
+                if new_count[1] == 0 and (base_count[1] > 0 or op in expected_ops)]
+
+    print_changes("regressions", regressions)
+    if args.show_improvements:
+        print_changes("improvements", improvements)
+    if missing:
+        print("missing in new run ({}):".format(len(missing)))
+        for k in missing:
+            print("  " + format_key(k))
+    if untimed_ops:
+        print("ops without timed records ({}):".format(len(untimed_ops)))
+        for op, base_count, new_count in untimed_ops:
+            print("  {:<32} base: {} records ({} timed), new: {} records ({} timed)".format(
+                op, base_count[0], base_count[1], new_count[0], new_count[1]))
+    if failures:
+        print("verification failures in new run ({}):".format(len(failures)))
+        for r in failures:
+            print("  " + format_key(problem_key(r) + (r["instance"],)))
+
+    return 1 if regressions or failures or lost_ops else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+"""
+Compile-time microbenchmark of the Sequence metafunctions (ck::Sequence and ck_tile::sequence).
+
+For every metafunction, namespace and sequence size a translation unit with a number of distinct
+instances is generated and compiled with clang -ftime-trace. The script reports the frontend time
+and the number of class/function template instantiations of each translation unit.
+
+Example (ck/config.h is generated in the build directory):
+    python3 script/profile_sequence_compile_time.py --sizes 4,8,16,32 --instances 64 \
+        --extra-flags="-I build/include"
+"""
+import argparse
+import json
+import os
+import random
+import subprocess
+import sys
+import tempfile
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+
+NAMESPACES = {
+    "ck": {
+        "header": "ck/utility/sequence.hpp",
+        "seq": "ck::Sequence",
+        "less": "ck::math::less<ck::index_t>",
+        "equal": "ck::math::equal<ck::index_t>",
+        "plus": "ck::math::plus<ck::index_t>",
+    },
+    "ck_tile": {
+        "header": "ck_tile/core.hpp",
+        "seq": "ck_tile::sequence",
+        "less": "ck_tile::less<ck_tile::index_t>",
+        "equal": "ck_tile::equal<ck_tile::index_t>",
+        "plus": "ck_tile::plus<ck_tile::index_t>",
+    },
+}
+
+# metafunction name -> (expression generator, "values" or "permutation" input)
+METAFUNCTIONS = {
+    "sequence_sort": (
+        lambda ns, s, n: "typename {0}::sequence_sort<{1}, {2}>::type".format(
+            ns["prefix"], s, ns["less"]),
+        "values"),
+    "sequence_unique_sort": (
+        lambda ns, s, n: "typename {0}::sequence_unique_sort<{1}, {2}, {3}>::type".format(
+            ns["prefix"], s, ns["less"], ns["equal"]),
+        "values"),
+    "sequence_map_inverse": (
+        lambda ns, s, n: "typename {0}::sequence_map_inverse<{1}>::type".format(ns["prefix"], s),
+        "permutation"),
+    "is_valid_sequence_map": (
+        lambda ns, s, n: "{0}<{1}::is_valid_sequence_map<{2}>::value>".format(
+            ns["seq"], ns["prefix"], s),
+        "permutation"),
+    "sequence_reverse_inclusive_scan": (
+        lambda ns, s, n: "typename {0}::sequence_reverse_inclusive_scan<{1}, {2}, 0>::type".format(
+            ns["prefix"], s, ns["plus"]),
+        "values"),
+    "sequence_split": (
+        lambda ns, s, n: "typename {0}::sequence_split<{1}, {2}>::right_type".format(
+            ns["prefix"], s, n // 2),
+        "values"),
+    "sequence_reverse": (
+        lambda ns, s, n: "typename {0}::sequence_reverse<{1}>::type".format(ns["prefix"], s),
+        "values"),
+    "sequence_reduce": (
+        lambda ns, s, n: "typename {0}::sequence_reduce<{2}, {1}, {1}, {1}>::type".format(
+            ns["prefix"], s, ns["plus"]),
+        "values"),
+}
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description="Measure compile time of ck::Sequence / ck_tile::sequence metafunctions")
+    parser.add_argument("--compiler",
+                        default=os.environ.get("CXX", "/opt/rocm/llvm/bin/clang++"),
+                        help="clang++ used for compilation (default: $CXX or ROCm clang++)")
+    parser.add_argument("--include-dir",
+                        default=os.path.join(SCRIPT_DIR, "..", "include"),
+                        help="composable_kernel include directory")
+    parser.add_argument("--namespaces", default="ck,ck_tile",
+                        help="comma separated list of: " + ",".join(NAMESPACES))
+    parser.add_argument("--metafunctions", default=",".join(METAFUNCTIONS),
+                        help="comma separated list of: " + ",".join(METAFUNCTIONS))
+    parser.add_argument("--sizes", default="4,8,16,32", help="comma separated sequence sizes")
+    parser.add_argument("--instances", type=int, default=32,
+                        help="number of distinct instances per translation unit")
+    parser.add_argument("--extra-flags", default="", help="extra compiler flags")
+    return parser.parse_args()
+
+
+def make_source(ns_name, mf_name, size, instances):
+    ns = dict(NAMESPACES[ns_name], prefix=ns_name)
+    expr, kind = METAFUNCTIONS[mf_name]
+    rng = random.Random(size * 1000 + instances)
+
+    lines = ['#include "{}"'.format(ns["header"]), ""]
+    for i in range(instances):
+        if kind == "permutation":
+            values = list(range(size))
+            rng.shuffle(values)
+        else:
+            values = [rng.randint(-size, 4 * size) for _ in range(size)]
+        seq = "{}<{}>".format(ns["seq"], ", ".join(map(str, values)))
+        lines.append("using instance_{} = {};".format(i, expr(ns, seq, size)))
+        lines.append("[[maybe_unused]] instance_{0} value_{0};".format(i))
+    return "\n".join(lines) + "\n"
+
+
+def compile_and_trace(args, source, work_dir):
+    src_path = os.path.join(work_dir, "tu.cpp")
+    trace_path = os.path.join(work_dir, "tu.json")
+    with open(src_path, "w") as f:
+        f.write(source)
+
+    cmd = [args.compiler, "-x", "hip", "--offload-host-only", "-std=c++17", "-fsyntax-only",
+           "-ftime-trace=" + trace_path, "-ftime-trace-granularity=0",
+           "-I", os.path.abspath(args.include_dir), src_path] + args.extra_flags.split()
+    result = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+    if result.returncode != 0:
+        sys.stderr.write(result.stdout)
+        raise RuntimeError("compilation failed: " + " ".join(cmd))
+
+    with open(trace_path) as f:
+        events = json.load(f)["traceEvents"]
+
+    frontend_us = sum(e.get("dur", 0) for e in events if e.get("name") == "Frontend")
+    class_inst = sum(1 for e in events if e.get("name") == "InstantiateClass")
+    function_inst = sum(1 for e in events if e.get("name") == "InstantiateFunction")
+    return frontend_us / 1000.0, class_inst, function_inst
+
+
+def main():
+    args = parse_args()
+    sizes = [int(s) for s in args.sizes.split(",")]
+
+    print("{:<8} {:<32} {:>5} {:>14} {:>12} {:>12}".format(
+        "ns", "metafunction", "size", "frontend(ms)", "class_inst", "func_inst"))
+    with tempfile.TemporaryDirectory() as work_dir:
+        # baseline: header only, subtracted from all measurements
+        baselines = {}
+        for ns_name in args.namespaces.split(","):
+            baselines[ns_name] = compile_and_trace(
+                args, '#include "{}"\n'.format(NAMESPACES[ns_name]["header"]), work_dir)
+
+        for ns_name in args.namespaces.split(","):
+            base_ms, base_class, base_func = baselines[ns_name]
+            for mf_name in args.metafunctions.split(","):
+                for size in sizes:
+                    source = make_source(ns_name, mf_name, size, args.instances)
+                    ms, class_inst, function_inst = compile_and_trace(args, source, work_dir)
+                    print("{:<8} {:<32} {:>5} {:>14.1f} {:>12} {:>12}".format(
+                        ns_name, mf_name, size, ms - base_ms, class_inst - base_class,
+                        function_inst - base_func))
+
+
+if __name__ == "__main__":
+    main()
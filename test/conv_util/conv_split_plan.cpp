@@ -0,0 +1,302 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/conv_split_plan.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/algorithm.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_data.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_weight.hpp"
+
+namespace {
+
+using ck::tensor_operation::device::ConvSplitDirection;
+using ck::tensor_operation::device::MakeConvSplitPlan;
+using ck::tensor_operation::device::ConvSubProblem;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+template <typename Lengths>
+std::vector<ck::long_index_t> to_long(const Lengths& values)
+{
+    return std::vector<ck::long_index_t>(values.begin(), values.end());
+}
+
+// result of the direction (out, in or wei) from the other two tensors
+template <ck::index_t NDimSpatial>
+void run_reference_conv(ConvSplitDirection direction,
+                        Tensor<float>& in,
+                        Tensor<float>& wei,
+                        Tensor<float>& out,
+                        const ConvSubProblem<NDimSpatial>& problem)
+{
+    const auto strides    = to_long(problem.conv_filter_strides);
+    const auto dilations  = to_long(problem.conv_filter_dilations);
+    const auto left_pads  = to_long(problem.input_left_pads);
+    const auto right_pads = to_long(problem.input_right_pads);
+
+    if(direction == ConvSplitDirection::Forward)
+    {
+        auto ref_conv = ck::tensor_operation::host::ReferenceConvFwd<NDimSpatial,
+                                                                     float,
+                                                                     float,
+                                                                     float,
+                                                                     PassThrough,
+                                                                     PassThrough,
+                                                                     PassThrough>{};
+        auto ref_argument = ref_conv.MakeArgument(
+            in, wei, out, strides, dilations, left_pads, right_pads, {}, {}, {});
+        ref_conv.MakeInvoker().Run(ref_argument);
+    }
+    else if(direction == ConvSplitDirection::BackwardData)
+    {
+        auto ref_conv = ck::tensor_operation::host::ReferenceConvBwdData<NDimSpatial,
+                                                                         float,
+                                                                         float,
+                                                                         float,
+                                                                         PassThrough,
+                                                                         PassThrough,
+                                                                         PassThrough>{};
+        auto ref_argument = ref_conv.MakeArgument(
+            in, wei, out, strides, dilations, left_pads, right_pads, {}, {}, {});
+        ref_conv.MakeInvoker().Run(ref_argument);
+    }
+    else
+    {
+        auto ref_conv = ck::tensor_operation::host::ReferenceConvBwdWeight<NDimSpatial,
+                                                                           float,
+                                                                           float,
+                                                                           float,
+                                                                           PassThrough,
+                                                                           PassThrough,
+                                                                           PassThrough>{};
+        auto ref_argument = ref_conv.MakeArgument(
+            in, wei, out, strides, dilations, left_pads, right_pads, {}, {}, {});
+        ref_conv.MakeInvoker().Run(ref_argument);
+    }
+}
+
+// Computes the convolution whole and as the sub-problems of a plan limited to max_bytes. The
+// views of the sub-problems are cut out of the whole tensors by their offsets and the strides of
+// the whole tensors, every element of the result has to be written by exactly one sub-problem.
+template <ck::index_t NDimSpatial, typename InLayout, typename WeiLayout, typename OutLayout>
+void check_conv_split(ConvSplitDirection direction,
+                      const ck::utils::conv::ConvParam& conv_param,
+                      ck::long_index_t max_bytes,
+                      std::size_t min_num_sub_problems)
+{
+    const auto in_desc =
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param);
+    const auto wei_desc =
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(conv_param);
+    const auto out_desc =
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(conv_param);
+
+    ConvSubProblem<NDimSpatial> whole{};
+
+    auto copy = [](const auto& x, auto& y) { ck::ranges::copy(x, y.begin()); };
+
+    copy(in_desc.GetLengths(), whole.in_g_n_c_wis_lengths);
+    copy(in_desc.GetStrides(), whole.in_g_n_c_wis_strides);
+    copy(wei_desc.GetLengths(), whole.wei_g_k_c_xs_lengths);
+    copy(wei_desc.GetStrides(), whole.wei_g_k_c_xs_strides);
+    copy(out_desc.GetLengths(), whole.out_g_n_k_wos_lengths);
+    copy(out_desc.GetStrides(), whole.out_g_n_k_wos_strides);
+    copy(conv_param.conv_filter_strides_, whole.conv_filter_strides);
+    copy(conv_param.conv_filter_dilations_, whole.conv_filter_dilations);
+    copy(conv_param.input_left_pads_, whole.input_left_pads);
+    copy(conv_param.input_right_pads_, whole.input_right_pads);
+
+    Tensor<float> in(in_desc);
+    Tensor<float> wei(wei_desc);
+    Tensor<float> out(out_desc);
+
+    // integer values, the sums of the sub-problems are exact
+    ck::utils::FillUniformDistributionIntegerValue<float>{-3.f, 3.f}(in.begin(), in.end());
+    ck::utils::FillUniformDistributionIntegerValue<float>{-3.f, 3.f}(wei.begin(), wei.end());
+    ck::utils::FillUniformDistributionIntegerValue<float>{-3.f, 3.f}(out.begin(), out.end());
+
+    Tensor<float>& result = direction == ConvSplitDirection::Forward        ? out
+                            : direction == ConvSplitDirection::BackwardData ? in
+                                                                            : wei;
+
+    run_reference_conv<NDimSpatial>(direction, in, wei, out, whole);
+
+    const Tensor<float> expected = result;
+    result.SetZero();
+
+    const auto plan = MakeConvSplitPlan<NDimSpatial>(direction,
+                                                     whole.in_g_n_c_wis_lengths,
+                                                     whole.in_g_n_c_wis_strides,
+                                                     whole.wei_g_k_c_xs_lengths,
+                                                     whole.wei_g_k_c_xs_strides,
+                                                     whole.out_g_n_k_wos_lengths,
+                                                     whole.out_g_n_k_wos_strides,
+                                                     whole.conv_filter_strides,
+                                                     whole.conv_filter_dilations,
+                                                     whole.input_left_pads,
+                                                     whole.input_right_pads,
+                                                     {4, 4, 4},
+                                                     max_bytes);
+
+    ASSERT_TRUE(plan.IsValid());
+    EXPECT_GE(plan.GetNumSubProblems(), min_num_sub_problems);
+
+    std::vector<int> num_writes(result.mData.size(), 0);
+
+    for(const auto& sub : plan.sub_problems_)
+    {
+        Tensor<float> sub_in(sub.in_g_n_c_wis_lengths, sub.in_g_n_c_wis_strides);
+        Tensor<float> sub_wei(sub.wei_g_k_c_xs_lengths, sub.wei_g_k_c_xs_strides);
+        Tensor<float> sub_out(sub.out_g_n_k_wos_lengths, sub.out_g_n_k_wos_strides);
+
+        for(const auto* sub_tensor : {&sub_in, &sub_wei, &sub_out})
+        {
+            ASSERT_LE(static_cast<ck::long_index_t>(sub_tensor->mData.size() * 4), max_bytes);
+        }
+
+        // the views have the strides of the whole tensors, their element spaces are windows
+        auto gather = [](const Tensor<float>& x, ck::long_index_t offset, Tensor<float>& y) {
+            ASSERT_LE(offset + y.mData.size(), x.mData.size());
+            std::copy_n(x.mData.begin() + offset, y.mData.size(), y.mData.begin());
+        };
+
+        gather(in, sub.in_offset, sub_in);
+        gather(wei, sub.wei_offset, sub_wei);
+        gather(out, sub.out_offset, sub_out);
+
+        run_reference_conv<NDimSpatial>(direction, sub_in, sub_wei, sub_out, sub);
+
+        Tensor<float>& sub_result = direction == ConvSplitDirection::Forward        ? sub_out
+                                    : direction == ConvSplitDirection::BackwardData ? sub_in
+                                                                                    : sub_wei;
+
+        const ck::long_index_t offset = direction == ConvSplitDirection::Forward ? sub.out_offset
+                                        : direction == ConvSplitDirection::BackwardData
+                                            ? sub.in_offset
+                                            : sub.wei_offset;
+
+        sub_result.ForEach([&](auto& self, auto idx) {
+            const std::size_t i = offset + self.GetOffsetFromMultiIndex(idx);
+            result.mData[i]     = self(idx);
+            num_writes[i]++;
+        });
+    }
+
+    result.ForEach([&](auto& self, auto idx) {
+        EXPECT_EQ(num_writes[self.GetOffsetFromMultiIndex(idx)], 1);
+    });
+
+    EXPECT_TRUE(ck::utils::check_err(result, expected));
+}
+
+constexpr std::array<ConvSplitDirection, 3> all_directions{ConvSplitDirection::Forward,
+                                                           ConvSplitDirection::BackwardData,
+                                                           ConvSplitDirection::BackwardWeight};
+
+} // namespace
+
+TEST(ConvSplitPlan, ProblemThatFitsIsNotSplit)
+{
+    using namespace ck::tensor_layout::convolution;
+
+    const ck::utils::conv::ConvParam conv_param{
+        2, 2, 4, 8, 6, {3, 3}, {12, 10}, {2, 1}, {1, 2}, {1, 1}, {1, 1}};
+
+    for(const auto direction : all_directions)
+    {
+        check_conv_split<2, NHWGC, GKYXC, NHWGK>(direction, conv_param, 1 << 20, 1);
+    }
+
+    const auto plan = MakeConvSplitPlan<1>(ConvSplitDirection::Forward,
+                                           {1, 2, 3, 10},
+                                           {60, 30, 10, 1},
+                                           {1, 4, 3, 3},
+                                           {36, 9, 3, 1},
+                                           {1, 2, 4, 8},
+                                           {64, 32, 8, 1},
+                                           {1},
+                                           {1},
+                                           {0},
+                                           {0},
+                                           {2, 2, 2});
+    ASSERT_EQ(plan.GetNumSubProblems(), 1u);
+    EXPECT_EQ(plan.sub_problems_[0].in_offset, 0);
+    EXPECT_EQ(plan.sub_problems_[0].out_g_n_k_wos_lengths[3], 8);
+}
+
+TEST(ConvSplitPlan, Conv1D)
+{
+    using namespace ck::tensor_layout::convolution;
+
+    // stride larger than the filter, inputs between the windows are not used
+    const ck::utils::conv::ConvParam conv_param{1, 2, 3, 4, 5, {2}, {71}, {3}, {1}, {2}, {1}};
+
+    for(const auto direction : all_directions)
+    {
+        check_conv_split<1, GNWC, GKXC, GNWK>(direction, conv_param, 400, 4);
+    }
+}
+
+TEST(ConvSplitPlan, Conv2D)
+{
+    using namespace ck::tensor_layout::convolution;
+
+    const ck::utils::conv::ConvParam conv_param{
+        2, 3, 2, 5, 4, {3, 3}, {29, 23}, {2, 2}, {1, 1}, {1, 1}, {1, 1}};
+
+    for(const auto direction : all_directions)
+    {
+        check_conv_split<2, NHWGC, GKYXC, NHWGK>(direction, conv_param, 4096, 4);
+        check_conv_split<2, GNHWC, GKYXC, GNHWK>(direction, conv_param, 4096, 4);
+    }
+}
+
+TEST(ConvSplitPlan, Conv3DSingleImage)
+{
+    using namespace ck::tensor_layout::convolution;
+
+    // one image: forward and backward data split the spatial dimensions
+    const ck::utils::conv::ConvParam conv_param{
+        3, 1, 1, 4, 3, {3, 3, 3}, {19, 14, 11}, {1, 1, 1}, {2, 1, 1}, {2, 1, 0}, {2, 1, 1}};
+
+    check_conv_split<3, NDHWGC, GKZYXC, NDHWGK>(ConvSplitDirection::Forward, conv_param, 8192, 4);
+    check_conv_split<3, NDHWGC, GKZYXC, NDHWGK>(
+        ConvSplitDirection::BackwardData, conv_param, 8192, 4);
+    check_conv_split<3, NDHWGC, GKZYXC, NDHWGK>(
+        ConvSplitDirection::BackwardWeight, conv_param, 16384, 2);
+}
+
+TEST(ConvSplitPlan, ProblemThatCanNotBeSplit)
+{
+    // backward weight can only split G, K and C, a single filter larger than max_bytes can not be
+    // split
+    const auto plan = MakeConvSplitPlan<1>(ConvSplitDirection::BackwardWeight,
+                                           {1, 4, 1, 100},
+                                           {400, 100, 1, 1},
+                                           {1, 1, 1, 50},
+                                           {50, 50, 50, 1},
+                                           {1, 4, 1, 51},
+                                           {204, 51, 1, 1},
+                                           {1},
+                                           {1},
+                                           {0},
+                                           {0},
+                                           {4, 4, 4},
+                                           100);
+    EXPECT_FALSE(plan.IsValid());
+}
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "ck/utility/data_type.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+using ck::pk_int4_t;
+
+TEST(PkInt4, PackUnpack)
+{
+    for(std::size_t num = 0; num < 40; ++num)
+    {
+        std::vector<int8_t> values(num);
+        for(std::size_t i = 0; i < num; ++i)
+        {
+            values[i] = static_cast<int8_t>(static_cast<int>(i * 7 % 16) - 8);
+        }
+
+        std::vector<pk_int4_t> packed((num + 1) / 2);
+        ck::utils::pack_int4(values.data(), num, packed.data());
+
+        for(std::size_t i = 0; i < num; ++i)
+        {
+            const int nibble = (static_cast<uint8_t>(packed[i / 2].data) >> (4 * (i % 2))) & 0xF;
+            EXPECT_EQ((nibble ^ 8) - 8, values[i]) << num << " " << i;
+        }
+
+        std::vector<int8_t> unpacked(num);
+        ck::utils::unpack_int4(packed.data(), num, unpacked.data());
+        EXPECT_EQ(unpacked, values) << num;
+    }
+}
+
+TEST(PkInt4, HostTensor)
+{
+    // column-major, odd element space
+    Tensor<int8_t> ref({3, 5}, {1, 3});
+    ck::utils::FillUniformDistributionIntegerValue<int8_t>{-8.f, 7.f}(ref);
+
+    Tensor<pk_int4_t> packed(ref);
+    EXPECT_EQ(packed.GetElementSpaceSizeInBytes(), 8u);
+    EXPECT_EQ(packed.size(), 15u);
+
+    for(std::size_t m = 0; m < 3; ++m)
+    {
+        for(std::size_t n = 0; n < 5; ++n)
+        {
+            EXPECT_EQ(packed(m, n), ref(m, n));
+        }
+    }
+
+    packed(1, 2) = -3;
+    ref(1, 2)    = -3;
+    EXPECT_TRUE(ck::utils::check_err(packed, ref));
+    EXPECT_TRUE(ck::utils::check_err(packed.CopyAsType<float>(), ref.CopyAsType<float>()));
+
+    Tensor<pk_int4_t> filled(ref.mDesc);
+    ck::utils::FillUniformDistributionIntegerValue<int8_t>{-8.f, 7.f}(filled);
+    EXPECT_TRUE(ck::utils::check_err(filled, Tensor<int8_t>(filled)));
+
+    std::ostringstream os;
+    Tensor<pk_int4_t> small({3});
+    small.GenerateTensorValue(
+        [](auto i) { return static_cast<int8_t>(5 - 6 * static_cast<int>(i)); }, 2);
+    LogRange(os, small, ",");
+    EXPECT_EQ(os.str(), "5,-1,-7");
+}
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -150,14 +150,14 @@ struct TestGemm
         Tensor<CDataType> c_m_n_device_result(
             f_host_tensor_descriptor(params.M, params.N, params.StrideC, CLayout{}));
 
-        auto f_generate_tensor_value = [](auto& tensor, auto type) {
+        auto f_generate_tensor_value = [](auto& tensor, auto type, unsigned int seed) {
             using dataType = decltype(type);
 
-            tensor.GenerateTensorValue(GeneratorTensor_2<dataType>{-5, 5});
+            tensor.GenerateTensorValue(GeneratorTensor_2<dataType>{-5, 5, seed});
         };
 
-        f_generate_tensor_value(a_m_k, ADataType{});
-        f_generate_tensor_value(b_k_n, BDataType{});
+        f_generate_tensor_value(a_m_k, ADataType{}, 1);
+        f_generate_tensor_value(b_k_n, BDataType{}, 2);
 
         std::cout << "a_m_k: " << a_m_k.mDesc << std::endl;
         std::cout << "b_k_n: " << b_k_n.mDesc << std::endl;
@@ -0,0 +1,444 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/host_utility/kernel_arg_arena.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_grouped_gemm_xdl.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+namespace {
+
+// Host stand-in for the copies of KernelArgArena. Copies are queued like on a stream and only
+// done when they are waited for, so that a host buffer written too early is noticed by the
+// kernels queued after the copies (Launch).
+struct HostKernelArgCopier
+{
+    void* AllocateHost(std::size_t size) { return std::malloc(size); }
+
+    void FreeHost(void* p)
+    {
+        Flush();
+        std::free(p);
+    }
+
+    void CopyToDevice(void* p_dst, const void* p_src, std::size_t size, hipStream_t)
+    {
+        Launch([=]() { std::memcpy(p_dst, p_src, size); });
+    }
+
+    void RecordCopies(int slot, hipStream_t) { recorded[slot] = num_issued + queue.size(); }
+
+    void WaitCopies(int slot)
+    {
+        while(num_issued < recorded[slot])
+        {
+            Issue();
+        }
+    }
+
+    void Launch(std::function<void()> f) { queue.push_back(std::move(f)); }
+
+    void Flush()
+    {
+        while(!queue.empty())
+        {
+            Issue();
+        }
+    }
+
+    void Issue()
+    {
+        queue.front()();
+        queue.pop_front();
+        num_issued++;
+    }
+
+    std::deque<std::function<void()>> queue;
+    std::size_t num_issued  = 0;
+    std::size_t recorded[2] = {0, 0};
+};
+
+struct TestKernelArg
+{
+    int values[13];
+};
+
+using TestArena = ck::KernelArgArena<TestKernelArg, HostKernelArgCopier>;
+
+} // namespace
+
+TEST(KernelArgArena, UploadMatchesArguments)
+{
+    std::mt19937 gen(11939);
+
+    constexpr std::size_t max_count = 300;
+
+    std::vector<TestKernelArg> device_a(max_count);
+    std::vector<TestKernelArg> device_b(max_count);
+
+    TestArena arena(4 * sizeof(TestKernelArg));
+    arena.EnableDeltaUploads(true);
+
+    std::vector<TestKernelArg> args(100);
+    for(auto& arg : args)
+    {
+        std::generate(std::begin(arg.values), std::end(arg.values), gen);
+    }
+
+    std::vector<TestKernelArg>* device = &device_a;
+
+    for(int step = 0; step < 500; ++step)
+    {
+        const int action = gen() % 8;
+
+        if(action == 0)
+        {
+            args.resize(1 + gen() % max_count);
+        }
+        else if(action == 1)
+        {
+            device = device == &device_a ? &device_b : &device_a;
+        }
+
+        // change a few arguments
+        const int num_changes = gen() % 4;
+        for(int i = 0; i < num_changes; ++i)
+        {
+            args[gen() % args.size()].values[gen() % 13] = gen();
+        }
+
+        const std::size_t num_bytes =
+            arena.Upload(args.data(), args.size(), device->data(), nullptr);
+
+        // ranges of the changed arguments with gaps of at most 4 arguments
+        if(action > 1 && step > 0)
+        {
+            EXPECT_LE(num_bytes, num_changes * 5 * sizeof(TestKernelArg));
+        }
+
+        // a kernel reading the arguments after the upload, copies and kernels of several steps
+        // are queued
+        arena.GetCopier().Launch([device, expected = args, step]() {
+            EXPECT_EQ(std::memcmp(device->data(),
+                                  expected.data(),
+                                  expected.size() * sizeof(TestKernelArg)),
+                      0)
+                << "step " << step;
+        });
+
+        if(gen() % 4 == 0)
+        {
+            arena.GetCopier().Flush();
+        }
+    }
+
+    arena.GetCopier().Flush();
+}
+
+TEST(KernelArgArena, UnchangedArgumentsAreNotCopied)
+{
+    std::vector<TestKernelArg> device(64);
+    std::vector<TestKernelArg> args(64);
+
+    for(std::size_t i = 0; i < args.size(); ++i)
+    {
+        std::fill(std::begin(args[i].values), std::end(args[i].values), i);
+    }
+
+    TestArena arena(0);
+    arena.EnableDeltaUploads(true);
+
+    EXPECT_EQ(arena.Upload(args.data(), args.size(), device.data(), nullptr),
+              args.size() * sizeof(TestKernelArg));
+    EXPECT_EQ(arena.Upload(args.data(), args.size(), device.data(), nullptr), 0u);
+
+    args[3].values[0]  = -1;
+    args[40].values[7] = -1;
+
+    EXPECT_EQ(arena.Upload(args.data(), args.size(), device.data(), nullptr),
+              2 * sizeof(TestKernelArg));
+    EXPECT_EQ(arena.GetNumCopies(), 2u);
+
+    arena.Invalidate();
+    EXPECT_EQ(arena.Upload(args.data(), args.size(), device.data(), nullptr),
+              args.size() * sizeof(TestKernelArg));
+    EXPECT_EQ(arena.GetNumCopies(), 1u);
+
+    arena.GetCopier().Flush();
+    EXPECT_EQ(std::memcmp(device.data(), args.data(), args.size() * sizeof(TestKernelArg)), 0);
+}
+
+TEST(KernelArgArena, AllArgumentsAreCopiedByDefault)
+{
+    std::vector<TestKernelArg> device(64);
+    std::vector<TestKernelArg> args(64);
+
+    TestArena arena(0);
+
+    EXPECT_EQ(arena.Upload(args.data(), args.size(), device.data(), nullptr),
+              args.size() * sizeof(TestKernelArg));
+
+    // the device buffer is written by something else than an arena
+    arena.GetCopier().Flush();
+    std::fill(std::begin(device[7].values), std::end(device[7].values), -1);
+
+    EXPECT_EQ(arena.Upload(args.data(), args.size(), device.data(), nullptr),
+              args.size() * sizeof(TestKernelArg));
+
+    arena.GetCopier().Flush();
+    EXPECT_EQ(std::memcmp(device.data(), args.data(), args.size() * sizeof(TestKernelArg)), 0);
+}
+
+TEST(KernelArgArena, SharedDeviceBuffer)
+{
+    std::vector<TestKernelArg> device(64);
+    std::vector<TestKernelArg> args_x(64);
+    std::vector<TestKernelArg> args_y(64);
+
+    for(std::size_t i = 0; i < args_x.size(); ++i)
+    {
+        std::fill(std::begin(args_x[i].values), std::end(args_x[i].values), i);
+        std::fill(std::begin(args_y[i].values), std::end(args_y[i].values), -static_cast<int>(i));
+    }
+
+    TestArena arena_x(0);
+    TestArena arena_y(0);
+    arena_x.EnableDeltaUploads(true);
+    arena_y.EnableDeltaUploads(true);
+
+    // upload args to device[offset, 64), returns the number of copied bytes
+    const auto upload = [&](TestArena& arena, const std::vector<TestKernelArg>& args, int offset) {
+        const std::size_t num_bytes =
+            arena.Upload(args.data(), args.size() - offset, device.data() + offset, nullptr);
+        arena.GetCopier().Flush();
+        return num_bytes;
+    };
+
+    const auto is_uploaded = [&](const std::vector<TestKernelArg>& args, int offset) {
+        return std::memcmp(device.data() + offset,
+                           args.data(),
+                           (args.size() - offset) * sizeof(TestKernelArg)) == 0;
+    };
+
+    upload(arena_x, args_x, 0);
+    EXPECT_EQ(upload(arena_x, args_x, 0), 0u);
+
+    // y overwrites the arguments of x, which are all copied again by the next upload of x
+    EXPECT_EQ(upload(arena_y, args_y, 0), args_y.size() * sizeof(TestKernelArg));
+    EXPECT_TRUE(is_uploaded(args_y, 0));
+
+    EXPECT_EQ(upload(arena_x, args_x, 0), args_x.size() * sizeof(TestKernelArg));
+    EXPECT_TRUE(is_uploaded(args_x, 0));
+
+    // y overwrites a part of the buffer of x
+    EXPECT_EQ(upload(arena_y, args_y, 32), (args_y.size() - 32) * sizeof(TestKernelArg));
+
+    EXPECT_EQ(upload(arena_x, args_x, 0), args_x.size() * sizeof(TestKernelArg));
+    EXPECT_TRUE(is_uploaded(args_x, 0));
+
+    // the buffer of y is overwritten by x, y copies all its arguments again
+    EXPECT_EQ(upload(arena_y, args_y, 32), (args_y.size() - 32) * sizeof(TestKernelArg));
+    EXPECT_EQ(upload(arena_y, args_y, 32), 0u);
+}
+
+template <ck::index_t... Is>
+using S = ck::Sequence<Is...>;
+
+using F16         = ck::half_t;
+using F32         = float;
+using Row         = ck::tensor_layout::gemm::RowMajor;
+using Col         = ck::tensor_layout::gemm::ColumnMajor;
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+static constexpr auto GemmMNKPadding = ck::tensor_operation::device::GemmSpecialization::MNKPadding;
+
+// clang-format off
+using DeviceGroupedGemmInstance = ck::tensor_operation::device::DeviceGroupedGemm_Xdl
+        < Row, Col, ck::Tuple<>, Row, F16, F16, F32, F16, ck::Tuple<>, F16, PassThrough, PassThrough, PassThrough, GemmMNKPadding, 1, 256, 256, 128, 32, 8, 8, 32, 32, 4, 2, S<4, 64, 1>, S<1, 0, 2>, S<1, 0, 2>, 2, 8, 8, 1, S<4, 64, 1>, S<1, 0, 2>, S<1, 0, 2>, 2, 8, 8, 1, 1, 1, S<1, 32, 1, 8>, 8>;
+// clang-format on
+
+TEST(DeviceGroupedGemmXdl, UpdateArgumentMatchesNewArgument)
+{
+    using Argument = DeviceGroupedGemmInstance::Argument;
+
+    std::mt19937 gen(20394);
+
+    constexpr int group_count = 64;
+    constexpr int N           = 512;
+    constexpr int K           = 256;
+
+    std::vector<ck::tensor_operation::device::GemmDesc> gemm_descs;
+    for(int i = 0; i < group_count; ++i)
+    {
+        gemm_descs.push_back({static_cast<int>(gen() % 1000), N, K, K, K, N, {}});
+    }
+
+    std::vector<char> buffer(3 * group_count);
+    std::vector<const void*> p_As(group_count, buffer.data());
+    std::vector<const void*> p_Bs(group_count, buffer.data() + group_count);
+    std::vector<std::array<const void*, 0>> p_Ds(group_count);
+    std::vector<void*> p_Es(group_count, buffer.data() + 2 * group_count);
+
+    DeviceGroupedGemmInstance gemm;
+
+    auto argument = gemm.MakeArgument(
+        p_As, p_Bs, p_Ds, p_Es, gemm_descs, PassThrough{}, PassThrough{}, PassThrough{});
+
+    for(int step = 0; step < 50; ++step)
+    {
+        // a few groups change their size (also from or to 0), all pointers change
+        for(int i = 0; i < 3; ++i)
+        {
+            gemm_descs[gen() % group_count].M_ = gen() % 4 == 0 ? 0 : gen() % 1000;
+        }
+        for(int i = 0; i < group_count; ++i)
+        {
+            p_As[i] = buffer.data() + gen() % buffer.size();
+            p_Es[i] = buffer.data() + gen() % buffer.size();
+        }
+
+        ASSERT_TRUE(gemm.UpdateArgument(&argument, p_As, p_Bs, p_Ds, p_Es, gemm_descs));
+
+        const Argument expected(
+            p_As, p_Bs, p_Ds, p_Es, gemm_descs, PassThrough{}, PassThrough{}, PassThrough{});
+
+        ASSERT_EQ(argument.grid_size_, expected.grid_size_);
+        ASSERT_EQ(argument.skipped_group_count_, expected.skipped_group_count_);
+        ASSERT_EQ(argument.gemm_desc_kernel_arg_.size(), expected.gemm_desc_kernel_arg_.size());
+
+        for(std::size_t i = 0; i < expected.gemm_desc_kernel_arg_.size(); ++i)
+        {
+            const auto& x = argument.gemm_desc_kernel_arg_[i];
+            const auto& y = expected.gemm_desc_kernel_arg_[i];
+
+            EXPECT_EQ(x.a_ptr_, y.a_ptr_);
+            EXPECT_EQ(x.b_ptr_, y.b_ptr_);
+            EXPECT_EQ(x.e_ptr_, y.e_ptr_);
+            EXPECT_EQ(x.BlockStart_, y.BlockStart_);
+            EXPECT_EQ(x.BlockEnd_, y.BlockEnd_);
+            EXPECT_EQ(x.block_2_etile_map_.BlockStart_, y.block_2_etile_map_.BlockStart_);
+            EXPECT_EQ(x.e_grid_desc_m_n_.GetLength(ck::Number<0>{}),
+                      y.e_grid_desc_m_n_.GetLength(ck::Number<0>{}));
+            EXPECT_EQ(x.a_grid_desc_ak0_m_ak1_.GetLength(ck::Number<1>{}),
+                      y.a_grid_desc_ak0_m_ak1_.GetLength(ck::Number<1>{}));
+        }
+    }
+}
+
+TEST(DeviceGroupedGemmXdl, SizeChangeWithinTileUploadsOneGroup)
+{
+    using KernelArg = DeviceGroupedGemmInstance::GemmBiasTransKernelArg;
+
+    constexpr int group_count = 32;
+
+    std::vector<ck::tensor_operation::device::GemmDesc> gemm_descs(
+        group_count, {200, 256, 64, 64, 64, 256, {}});
+
+    std::vector<char> buffer(1);
+    std::vector<const void*> p_As(group_count, buffer.data());
+    std::vector<const void*> p_Bs(group_count, buffer.data());
+    std::vector<std::array<const void*, 0>> p_Ds(group_count);
+    std::vector<void*> p_Es(group_count, buffer.data());
+
+    DeviceGroupedGemmInstance gemm;
+
+    auto argument = gemm.MakeArgument(
+        p_As, p_Bs, p_Ds, p_Es, gemm_descs, PassThrough{}, PassThrough{}, PassThrough{});
+
+    std::vector<KernelArg> device(group_count);
+
+    ck::KernelArgArena<KernelArg, HostKernelArgCopier> arena(0);
+    arena.EnableDeltaUploads(true);
+
+    arena.Upload(argument.gemm_desc_kernel_arg_.data(),
+                 argument.gemm_desc_kernel_arg_.size(),
+                 device.data(),
+                 nullptr);
+
+    // same number of tiles (MPerBlock 256), only the kernel argument of group 5 changes
+    gemm_descs[5].M_ = 160;
+    gemm.UpdateArgument(&argument, p_As, p_Bs, p_Ds, p_Es, gemm_descs);
+
+    EXPECT_EQ(arena.Upload(argument.gemm_desc_kernel_arg_.data(),
+                           argument.gemm_desc_kernel_arg_.size(),
+                           device.data(),
+                           nullptr),
+              sizeof(KernelArg));
+
+    // one more tile, the following groups start one block later
+    gemm_descs[5].M_ = 300;
+    gemm.UpdateArgument(&argument, p_As, p_Bs, p_Ds, p_Es, gemm_descs);
+
+    EXPECT_EQ(arena.Upload(argument.gemm_desc_kernel_arg_.data(),
+                           argument.gemm_desc_kernel_arg_.size(),
+                           device.data(),
+                           nullptr),
+              (group_count - 5) * sizeof(KernelArg));
+
+    arena.GetCopier().Flush();
+    EXPECT_EQ(std::memcmp(device.data(),
+                          argument.gemm_desc_kernel_arg_.data(),
+                          group_count * sizeof(KernelArg)),
+              0);
+}
+
+TEST(DeviceGroupedGemmXdl, UpdateArgumentBeyondWorkspaceFails)
+{
+    std::vector<ck::tensor_operation::device::GemmDesc> gemm_descs(
+        4, {200, 256, 64, 64, 64, 256, {}});
+
+    std::vector<char> buffer(1);
+    std::vector<const void*> p_As(gemm_descs.size(), buffer.data());
+    std::vector<const void*> p_Bs(gemm_descs.size(), buffer.data());
+    std::vector<std::array<const void*, 0>> p_Ds(gemm_descs.size());
+    std::vector<void*> p_Es(gemm_descs.size(), buffer.data());
+
+    DeviceGroupedGemmInstance gemm;
+
+    auto argument = gemm.MakeArgument(
+        p_As, p_Bs, p_Ds, p_Es, gemm_descs, PassThrough{}, PassThrough{}, PassThrough{});
+
+    // the workspace is only read by runs
+    std::vector<char> workspace(gemm.GetWorkSpaceSize(&argument));
+    gemm.SetWorkSpacePointer(&argument, workspace.data());
+
+    // fewer groups fit into the workspace
+    gemm_descs.pop_back();
+    p_As.pop_back();
+    p_Bs.pop_back();
+    p_Ds.pop_back();
+    p_Es.pop_back();
+    ASSERT_TRUE(gemm.UpdateArgument(&argument, p_As, p_Bs, p_Ds, p_Es, gemm_descs));
+    EXPECT_EQ(argument.group_count_, 3);
+
+    // more groups than the workspace was sized for are rejected, the argument is not changed
+    gemm_descs.resize(5, gemm_descs.front());
+    p_As.resize(5, buffer.data());
+    p_Bs.resize(5, buffer.data());
+    p_Ds.resize(5);
+    p_Es.resize(5, buffer.data());
+    EXPECT_FALSE(gemm.UpdateArgument(&argument, p_As, p_Bs, p_Ds, p_Es, gemm_descs));
+    EXPECT_EQ(argument.group_count_, 3);
+    EXPECT_EQ(gemm.GetWorkSpaceSize(&argument), workspace.size() * 3 / 4);
+
+    // unless the argument gets a workspace for them
+    gemm_descs.pop_back();
+    p_As.pop_back();
+    p_Bs.pop_back();
+    p_Ds.pop_back();
+    p_Es.pop_back();
+    ASSERT_TRUE(gemm.UpdateArgument(&argument, p_As, p_Bs, p_Ds, p_Es, gemm_descs));
+    EXPECT_EQ(argument.group_count_, 4);
+}
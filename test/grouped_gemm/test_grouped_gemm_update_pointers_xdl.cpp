@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_grouped_gemm_xdl.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+
+namespace {
+
+template <ck::index_t... Is>
+using S = ck::Sequence<Is...>;
+
+using F16         = ck::half_t;
+using F32         = float;
+using Row         = ck::tensor_layout::gemm::RowMajor;
+using Col         = ck::tensor_layout::gemm::ColumnMajor;
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+static constexpr auto GemmMNKPadding = ck::tensor_operation::device::GemmSpecialization::MNKPadding;
+
+// clang-format off
+using DeviceGroupedGemmInstance = ck::tensor_operation::device::DeviceGroupedGemm_Xdl
+        < Row, Col, ck::Tuple<>, Row, F16, F16, F32, F16, ck::Tuple<>, F16, PassThrough, PassThrough, PassThrough, GemmMNKPadding, 1, 256, 256, 128, 32, 8, 8, 32, 32, 4, 2, S<4, 64, 1>, S<1, 0, 2>, S<1, 0, 2>, 2, 8, 8, 1, S<4, 64, 1>, S<1, 0, 2>, S<1, 0, 2>, 2, 8, 8, 1, 1, 1, S<1, 32, 1, 8>, 8>;
+// clang-format on
+
+using ReferenceGemmInstance = ck::tensor_operation::host::
+    ReferenceGemm<F16, F16, F16, F32, PassThrough, PassThrough, PassThrough>;
+
+constexpr std::size_t N = 128;
+constexpr std::size_t K = 64;
+
+// A, B and E of every group in host and device memory, E as computed by the reference GEMM
+class GroupedGemmTensors
+{
+    public:
+    GroupedGemmTensors(const std::vector<int>& Ms, unsigned int seed)
+    {
+        for(std::size_t i = 0; i < Ms.size(); ++i)
+        {
+            const std::size_t M = Ms[i];
+
+            a_m_k_.emplace_back(std::vector<std::size_t>{M, K}, std::vector<std::size_t>{K, 1});
+            b_k_n_.emplace_back(std::vector<std::size_t>{K, N}, std::vector<std::size_t>{1, K});
+            e_m_n_.emplace_back(std::vector<std::size_t>{M, N}, std::vector<std::size_t>{N, 1});
+
+            const auto seed_i = static_cast<unsigned int>(seed + 2 * i);
+            a_m_k_[i].GenerateTensorValue(GeneratorTensor_2<F16>{-5, 5, seed_i});
+            b_k_n_[i].GenerateTensorValue(GeneratorTensor_2<F16>{-5, 5, seed_i + 1});
+
+            auto ref_argument = ReferenceGemmInstance{}.MakeArgument(
+                a_m_k_[i], b_k_n_[i], e_m_n_[i], PassThrough{}, PassThrough{}, PassThrough{});
+            ReferenceGemmInstance{}.MakeInvoker().Run(ref_argument);
+
+            a_device_.push_back(
+                std::make_unique<DeviceMem>(sizeof(F16) * a_m_k_[i].mDesc.GetElementSpaceSize()));
+            b_device_.push_back(
+                std::make_unique<DeviceMem>(sizeof(F16) * b_k_n_[i].mDesc.GetElementSpaceSize()));
+            e_device_.push_back(
+                std::make_unique<DeviceMem>(sizeof(F16) * e_m_n_[i].mDesc.GetElementSpaceSize()));
+
+            a_device_[i]->ToDevice(a_m_k_[i].mData.data());
+            b_device_[i]->ToDevice(b_k_n_[i].mData.data());
+            e_device_[i]->SetZero();
+
+            p_As.push_back(a_device_[i]->GetDeviceBuffer());
+            p_Bs.push_back(b_device_[i]->GetDeviceBuffer());
+            p_Es.push_back(e_device_[i]->GetDeviceBuffer());
+
+            gemm_descs.push_back({Ms[i],
+                                  static_cast<int>(N),
+                                  static_cast<int>(K),
+                                  static_cast<int>(K),
+                                  static_cast<int>(K),
+                                  static_cast<int>(N),
+                                  {}});
+        }
+
+        p_Ds.resize(Ms.size());
+    }
+
+    void ClearE()
+    {
+        for(auto& e : e_device_)
+        {
+            e->SetZero();
+        }
+    }
+
+    // the device E of every group is the reference E, or 0 if is_zero
+    bool CheckE(bool is_zero = false) const
+    {
+        bool pass = true;
+        for(std::size_t i = 0; i < e_m_n_.size(); ++i)
+        {
+            Tensor<F16> e_m_n(e_m_n_[i].mDesc);
+            e_device_[i]->FromDevice(e_m_n.mData.data());
+
+            if(is_zero)
+            {
+                Tensor<F16> zero(e_m_n_[i].mDesc);
+                zero.SetZero();
+                pass = pass && ck::utils::check_err(e_m_n, zero);
+            }
+            else
+            {
+                pass = pass && ck::utils::check_err(e_m_n, e_m_n_[i]);
+            }
+        }
+        return pass;
+    }
+
+    std::vector<const void*> p_As;
+    std::vector<const void*> p_Bs;
+    std::vector<std::array<const void*, 0>> p_Ds;
+    std::vector<void*> p_Es;
+    std::vector<ck::tensor_operation::device::GemmDesc> gemm_descs;
+
+    private:
+    std::vector<Tensor<F16>> a_m_k_;
+    std::vector<Tensor<F16>> b_k_n_;
+    std::vector<Tensor<F16>> e_m_n_;
+
+    std::vector<std::unique_ptr<DeviceMem>> a_device_;
+    std::vector<std::unique_ptr<DeviceMem>> b_device_;
+    std::vector<std::unique_ptr<DeviceMem>> e_device_;
+};
+
+} // namespace
+
+TEST(DeviceGroupedGemmXdl, UpdatePointersRunsOnNewTensors)
+{
+    // a group with M = 0 has no kernel argument
+    const std::vector<int> Ms{256, 0, 130, 64};
+
+    GroupedGemmTensors x(Ms, 1);
+    GroupedGemmTensors y(Ms, 101);
+
+    DeviceGroupedGemmInstance gemm;
+
+    auto argument = gemm.MakeArgument(
+        x.p_As, x.p_Bs, x.p_Ds, x.p_Es, x.gemm_descs, PassThrough{}, PassThrough{}, PassThrough{});
+    auto invoker = gemm.MakeInvoker();
+
+    ASSERT_TRUE(gemm.IsSupportedArgument(argument));
+
+    DeviceMem workspace(gemm.GetWorkSpaceSize(&argument));
+    gemm.SetWorkSpacePointer(&argument, workspace.GetDeviceBuffer());
+
+    invoker.Run(argument, StreamConfig{nullptr, false});
+    EXPECT_TRUE(x.CheckE());
+
+    ASSERT_TRUE(gemm.UpdatePointers(&argument, y.p_As, y.p_Bs, y.p_Ds, y.p_Es));
+
+    // the tensors of the previous pointers are not written anymore
+    x.ClearE();
+    invoker.Run(argument, StreamConfig{nullptr, false});
+    EXPECT_TRUE(y.CheckE());
+    EXPECT_TRUE(x.CheckE(true));
+
+    // pointers of another number of groups are rejected, the argument is not changed
+    auto p_As = x.p_As;
+    auto p_Bs = x.p_Bs;
+    auto p_Ds = x.p_Ds;
+    auto p_Es = x.p_Es;
+    p_As.pop_back();
+    p_Bs.pop_back();
+    p_Ds.pop_back();
+    p_Es.pop_back();
+
+    EXPECT_FALSE(gemm.UpdatePointers(&argument, p_As, p_Bs, p_Ds, p_Es));
+
+    y.ClearE();
+    invoker.Run(argument, StreamConfig{nullptr, false});
+    EXPECT_TRUE(y.CheckE());
+}
+
+TEST(DeviceGroupedGemmXdl, ArgumentsSharingWorkspace)
+{
+    GroupedGemmTensors x({256, 130, 64}, 1);
+    GroupedGemmTensors y({64, 300}, 101);
+
+    DeviceGroupedGemmInstance gemm;
+
+    auto argument_x = gemm.MakeArgument(
+        x.p_As, x.p_Bs, x.p_Ds, x.p_Es, x.gemm_descs, PassThrough{}, PassThrough{}, PassThrough{});
+    auto argument_y = gemm.MakeArgument(
+        y.p_As, y.p_Bs, y.p_Ds, y.p_Es, y.gemm_descs, PassThrough{}, PassThrough{}, PassThrough{});
+    auto invoker = gemm.MakeInvoker();
+
+    ASSERT_TRUE(gemm.IsSupportedArgument(argument_x));
+    ASSERT_TRUE(gemm.IsSupportedArgument(argument_y));
+
+    DeviceMem workspace(
+        std::max(gemm.GetWorkSpaceSize(&argument_x), gemm.GetWorkSpaceSize(&argument_y)));
+    gemm.SetWorkSpacePointer(&argument_x, workspace.GetDeviceBuffer());
+    gemm.SetWorkSpacePointer(&argument_y, workspace.GetDeviceBuffer());
+    ASSERT_TRUE(gemm.SetKernelArgDeltaUpload(&argument_x, true));
+    ASSERT_TRUE(gemm.SetKernelArgDeltaUpload(&argument_y, true));
+
+    // every run finds the kernel arguments of the other argument in the workspace
+    for(int step = 0; step < 3; ++step)
+    {
+        x.ClearE();
+        invoker.Run(argument_x, StreamConfig{nullptr, false});
+        EXPECT_TRUE(x.CheckE()) << "step " << step;
+
+        y.ClearE();
+        invoker.Run(argument_y, StreamConfig{nullptr, false});
+        EXPECT_TRUE(y.CheckE()) << "step " << step;
+    }
+}
@@ -0,0 +1,268 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <numeric>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/tensor_description/tensor_descriptor_helper.hpp"
+#include "ck/tensor_operation/gpu/device/convolution_forward_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/operator_transform/transform_conv_fwd_to_gemm.hpp"
+
+#include "ck/library/utility/algorithm.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_descriptor.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+
+using namespace ck;
+
+static constexpr auto I0 = Number<0>{};
+static constexpr auto I1 = Number<1>{};
+
+TEST(HostDescriptor, GatherScatterNaiveDescriptor)
+{
+    // [4, 5, 6] view of a packed [6, 4, 5] buffer
+    const auto desc = make_naive_tensor_descriptor(make_tuple(4, 5, 6), make_tuple(5, 1, 20));
+
+    std::vector<float> src(120);
+    std::iota(src.begin(), src.end(), 0.f);
+
+    std::vector<float> dst(120);
+    host_descriptor::gather(desc, src.data(), dst.data());
+
+    for(int i = 0; i < 4; ++i)
+    {
+        for(int j = 0; j < 5; ++j)
+        {
+            for(int k = 0; k < 6; ++k)
+            {
+                EXPECT_EQ(dst[(i * 5 + j) * 6 + k], src[i * 5 + j + k * 20]);
+            }
+        }
+    }
+
+    std::vector<float> back(120, -1.f);
+    host_descriptor::scatter(desc, dst.data(), back.data());
+    EXPECT_EQ(back, src);
+}
+
+TEST(HostDescriptor, IncrementalWalkMatchesCoordinates)
+{
+    // padded windows of an image merged into an im2col like [N * Ho * Wo, Y * X] matrix
+    constexpr index_t N = 3, Hi = 11, Wi = 9, Y = 3, X = 2;
+    constexpr index_t Ho = 6, Wo = 6;
+
+    const auto in_n_hi_wi = make_naive_tensor_descriptor(make_tuple(N, Hi, Wi),
+                                                         make_tuple(Hi * Wi * 2, Wi * 2, 2));
+
+    const auto in_n_hip_wip = transform_tensor_descriptor(
+        in_n_hi_wi,
+        make_tuple(make_pass_through_transform(N),
+                   make_pad_transform(Hi, 2, 1),
+                   make_pad_transform(Wi, 1, 2)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}));
+
+    const auto in_n_y_ho_x_wo = transform_tensor_descriptor(
+        in_n_hip_wip,
+        make_tuple(make_pass_through_transform(N),
+                   make_embed_transform(make_tuple(Y, Ho), make_tuple(1, 2)),
+                   make_embed_transform(make_tuple(X, Wo), make_tuple(2, 2))),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}),
+        make_tuple(Sequence<0>{}, Sequence<1, 2>{}, Sequence<3, 4>{}));
+
+    const auto desc = transform_tensor_descriptor(
+        in_n_y_ho_x_wo,
+        make_tuple(make_merge_transform(make_tuple(N, Ho, Wo)),
+                   make_merge_transform(make_tuple(Y, X))),
+        make_tuple(Sequence<0, 2, 4>{}, Sequence<1, 3>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    const std::size_t size = host_descriptor::get_visible_size(desc);
+    ASSERT_EQ(size, std::size_t{N * Ho * Wo * Y * X});
+
+    std::vector<long_index_t> offsets(size, -1);
+    std::vector<int> is_valids(size, -1);
+
+    host_descriptor::for_each_offset(
+        desc,
+        [&](std::size_t i, long_index_t offset, bool is_valid) {
+            offsets[i]   = offset;
+            is_valids[i] = is_valid;
+        },
+        3);
+
+    for(index_t m = 0; m < N * Ho * Wo; ++m)
+    {
+        for(index_t k = 0; k < Y * X; ++k)
+        {
+            const auto coord = make_tensor_coordinate(desc, make_multi_index(m, k));
+            const bool is_valid =
+                coordinate_has_valid_offset_assuming_visible_index_is_valid(desc, coord);
+            const std::size_t i = m * Y * X + k;
+
+            EXPECT_EQ(is_valids[i], static_cast<int>(is_valid)) << m << " " << k;
+            if(is_valid)
+            {
+                EXPECT_EQ(offsets[i], coord.GetOffset()) << m << " " << k;
+            }
+        }
+    }
+}
+
+// The GEMM of the gathered im2col (A), weight (B) and output (C) descriptors of
+// TransformConvFwdToGemm is the convolution of the reference.
+TEST(HostDescriptor, ConvFwdToGemmDescriptors)
+{
+    using InLayout  = tensor_layout::convolution::NHWGC;
+    using WeiLayout = tensor_layout::convolution::GKYXC;
+    using OutLayout = tensor_layout::convolution::NHWGK;
+
+    using PassThrough = tensor_operation::element_wise::PassThrough;
+
+    const utils::conv::ConvParam conv_param{
+        2, 2, 2, 8, 6, {3, 3}, {13, 11}, {2, 1}, {1, 2}, {1, 1}, {1, 1}};
+
+    const auto in_desc =
+        utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param);
+    const auto wei_desc =
+        utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(conv_param);
+    const auto out_desc =
+        utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(conv_param);
+
+    Tensor<float> in(in_desc);
+    Tensor<float> wei(wei_desc);
+    Tensor<float> out(out_desc);
+
+    utils::FillUniformDistributionIntegerValue<float>{-3.f, 3.f}(in.begin(), in.end());
+    utils::FillUniformDistributionIntegerValue<float>{-3.f, 3.f}(wei.begin(), wei.end());
+
+    auto ref_conv = tensor_operation::host::
+        ReferenceConvFwd<2, float, float, float, PassThrough, PassThrough, PassThrough>{};
+    auto ref_argument = ref_conv.MakeArgument(in,
+                                              wei,
+                                              out,
+                                              conv_param.conv_filter_strides_,
+                                              conv_param.conv_filter_dilations_,
+                                              conv_param.input_left_pads_,
+                                              conv_param.input_right_pads_,
+                                              PassThrough{},
+                                              PassThrough{},
+                                              PassThrough{});
+    ref_conv.MakeInvoker().Run(ref_argument);
+
+    std::array<index_t, 5> a_g_n_c_wis_lengths{};
+    std::array<index_t, 5> a_g_n_c_wis_strides{};
+    std::array<index_t, 5> b_g_k_c_xs_lengths{};
+    std::array<index_t, 5> b_g_k_c_xs_strides{};
+    std::array<index_t, 5> c_g_n_k_wos_lengths{};
+    std::array<index_t, 5> c_g_n_k_wos_strides{};
+    std::array<index_t, 2> conv_filter_strides{};
+    std::array<index_t, 2> conv_filter_dilations{};
+    std::array<index_t, 2> input_left_pads{};
+    std::array<index_t, 2> input_right_pads{};
+
+    auto copy = [](const auto& x, auto& y) { ranges::copy(x, y.begin()); };
+
+    copy(in_desc.GetLengths(), a_g_n_c_wis_lengths);
+    copy(in_desc.GetStrides(), a_g_n_c_wis_strides);
+    copy(wei_desc.GetLengths(), b_g_k_c_xs_lengths);
+    copy(wei_desc.GetStrides(), b_g_k_c_xs_strides);
+    copy(out_desc.GetLengths(), c_g_n_k_wos_lengths);
+    copy(out_desc.GetStrides(), c_g_n_k_wos_strides);
+    copy(conv_param.conv_filter_strides_, conv_filter_strides);
+    copy(conv_param.conv_filter_dilations_, conv_filter_dilations);
+    copy(conv_param.input_left_pads_, input_left_pads);
+    copy(conv_param.input_right_pads_, input_right_pads);
+
+    const tensor_operation::TransformConvFwdToGemm<
+        2,
+        tensor_operation::device::ConvolutionForwardSpecialization::Default>
+        conv_to_gemm{a_g_n_c_wis_lengths,
+                     a_g_n_c_wis_strides,
+                     b_g_k_c_xs_lengths,
+                     b_g_k_c_xs_strides,
+                     c_g_n_k_wos_lengths,
+                     c_g_n_k_wos_strides,
+                     conv_filter_strides,
+                     conv_filter_dilations,
+                     input_left_pads,
+                     input_right_pads};
+
+    const auto a_desc = conv_to_gemm.MakeADescriptor_M_K<InLayout>();
+    const auto b_desc = conv_to_gemm.MakeBDescriptor_N_K<WeiLayout>();
+    const auto c_desc = conv_to_gemm.MakeCDescriptor_M_N<OutLayout>();
+
+    const index_t M = a_desc.GetLength(I0);
+    const index_t K = a_desc.GetLength(I1);
+    const index_t N = b_desc.GetLength(I0);
+
+    ASSERT_EQ(b_desc.GetLength(I1), K);
+    ASSERT_EQ(c_desc.GetLength(I0), M);
+    ASSERT_EQ(c_desc.GetLength(I1), N);
+
+    const index_t Ho = out_desc.GetLengths()[3];
+    const index_t Wo = out_desc.GetLengths()[4];
+    const index_t C  = wei_desc.GetLengths()[2];
+    const index_t X  = wei_desc.GetLengths()[4];
+
+    // the descriptors are the ones of a group, the pointers are moved to the group
+    for(index_t g = 0; g < conv_param.G_; ++g)
+    {
+        std::vector<float> a(M * K);
+        std::vector<float> b(N * K);
+        std::vector<float> c(M * N);
+
+        host_descriptor::gather(a_desc, in.mData.data() + g * a_g_n_c_wis_strides[0], a.data());
+        host_descriptor::gather(b_desc, wei.mData.data() + g * b_g_k_c_xs_strides[0], b.data());
+        host_descriptor::gather(c_desc, out.mData.data() + g * c_g_n_k_wos_strides[0], c.data());
+
+        // im2col: A[(n, ho, wo), (y, x, c)] = in[g, n, c, hi, wi], 0 in the padding
+        for(index_t m = 0; m < M; ++m)
+        {
+            const index_t n  = m / (Ho * Wo);
+            const index_t ho = m / Wo % Ho;
+            const index_t wo = m % Wo;
+
+            for(index_t k = 0; k < K; ++k)
+            {
+                const index_t y  = k / (X * C);
+                const index_t x  = k / C % X;
+                const index_t ci = k % C;
+
+                const long_index_t hi = ho * conv_param.conv_filter_strides_[0] +
+                                        y * conv_param.conv_filter_dilations_[0] -
+                                        conv_param.input_left_pads_[0];
+                const long_index_t wi = wo * conv_param.conv_filter_strides_[1] +
+                                        x * conv_param.conv_filter_dilations_[1] -
+                                        conv_param.input_left_pads_[1];
+
+                const bool in_image = hi >= 0 && hi < conv_param.input_spatial_lengths_[0] &&
+                                      wi >= 0 && wi < conv_param.input_spatial_lengths_[1];
+
+                EXPECT_EQ(a[m * K + k], in_image ? in(g, n, ci, hi, wi) : 0.f);
+            }
+        }
+
+        for(index_t m = 0; m < M; ++m)
+        {
+            for(index_t n = 0; n < N; ++n)
+            {
+                float acc = 0;
+                for(index_t k = 0; k < K; ++k)
+                {
+                    acc += a[m * K + k] * b[n * K + k];
+                }
+                EXPECT_EQ(acc, c[m * N + n]);
+            }
+        }
+    }
+}
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/host_element_wise.hpp"
+
+using namespace ck::tensor_operation::element_wise;
+
+namespace {
+
+constexpr std::size_t Length = 1000;
+
+// the span implementation gives the same bits as the operation applied to each element
+template <typename Y, typename Op, typename... Xs>
+void CheckSpanOperation(const Op& op, const std::vector<Xs>&... xs)
+{
+    const std::size_t n = Length;
+
+    std::vector<Y> y_span(n), y_scalar(n);
+    ck::host_element_wise::apply_element_wise(op, n, y_span.data(), xs.data()...);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        op(y_scalar[i], xs[i]...);
+    }
+
+    EXPECT_EQ(std::memcmp(y_span.data(), y_scalar.data(), n * sizeof(Y)), 0);
+}
+
+// same with the operation applied in place (p_y == p_x)
+template <typename Op>
+void CheckSpanOperationInPlace(const Op& op, const std::vector<float>& x)
+{
+    const std::size_t n = Length;
+
+    std::vector<float> y_span(x), y_scalar(n);
+    ck::host_element_wise::apply_element_wise(op, n, y_span.data(), y_span.data());
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        op(y_scalar[i], x[i]);
+    }
+
+    EXPECT_EQ(std::memcmp(y_span.data(), y_scalar.data(), n * sizeof(float)), 0);
+}
+
+std::vector<float> GetRandomFloats(std::size_t n, unsigned int seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> dis(-6.f, 6.f);
+
+    std::vector<float> x(n);
+    for(auto& v : x)
+    {
+        v = dis(gen);
+    }
+    return x;
+}
+
+} // namespace
+
+TEST(HostElementWise, Unary)
+{
+    const auto x = GetRandomFloats(Length, 0);
+
+    CheckSpanOperation<float>(PassThrough{}, x);
+    CheckSpanOperation<float>(Scale{0.3f}, x);
+    CheckSpanOperation<float>(Relu{}, x);
+    CheckSpanOperation<float>(FastGelu{}, x);
+    CheckSpanOperation<ck::half_t>(PassThrough{}, x);
+}
+
+TEST(HostElementWise, UnaryInPlace)
+{
+    const auto x = GetRandomFloats(Length, 7);
+
+    CheckSpanOperationInPlace(PassThrough{}, x);
+    CheckSpanOperationInPlace(Scale{0.3f}, x);
+    CheckSpanOperationInPlace(Relu{}, x);
+    CheckSpanOperationInPlace(FastGelu{}, x);
+}
+
+TEST(HostElementWise, Binary)
+{
+    const auto x0 = GetRandomFloats(Length, 1);
+    const auto x1 = GetRandomFloats(Length, 2);
+
+    CheckSpanOperation<float>(Bilinear{2.f, -0.5f}, x0, x1);
+    CheckSpanOperation<float>(AddFastGelu{}, x0, x1);
+    CheckSpanOperation<float>(AddRelu{}, x0, x1);
+}
+
+TEST(HostElementWise, Ternary)
+{
+    const auto c  = GetRandomFloats(Length, 3);
+    const auto d0 = GetRandomFloats(Length, 4);
+    const auto d1 = GetRandomFloats(Length, 5);
+
+    CheckSpanOperation<float>(AddAddFastGelu{}, c, d0, d1);
+    CheckSpanOperation<float>(AddAdd{}, c, d0, d1);
+}
+
+TEST(HostElementWise, Quantization)
+{
+    const auto x = GetRandomFloats(Length, 6);
+
+    std::vector<int32_t> q(Length);
+    for(std::size_t i = 0; i < Length; ++i)
+    {
+        q[i] = static_cast<int32_t>(100.f * x[i]);
+    }
+
+    CheckSpanOperation<int8_t>(Activation_Mul_Clamp<Relu>{0.5f, Relu{}}, q);
+    CheckSpanOperation<float>(Activation_Mul_Clamp<Relu>{0.5f, Relu{}}, x);
+    CheckSpanOperation<int8_t>(Activation_Mul_Clamp<PassThrough>{0.5f, PassThrough{}}, q);
+}
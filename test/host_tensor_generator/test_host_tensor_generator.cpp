@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+
+TEST(HostTensorGenerator, IndependentOfNumThread)
+{
+    const std::vector<std::size_t> lens{37, 65, 29};
+
+    const GeneratorTensor_2<int8_t> g2{-5, 5};
+    const GeneratorTensor_3<float> g3{-1.f, 1.f};
+    const GeneratorTensor_4<float> g4{0.f, 1.f};
+
+    Tensor<int8_t> a1(lens), a8(lens);
+    Tensor<float> b1(lens), b8(lens), c1(lens), c8(lens);
+    a1.GenerateTensorValue(g2, 1);
+    a8.GenerateTensorValue(g2, 8);
+    b1.GenerateTensorValue(g3, 1);
+    b8.GenerateTensorValue(g3, 8);
+    c1.GenerateTensorValue(g4, 1);
+    c8.GenerateTensorValue(g4, 8);
+
+    EXPECT_EQ(a1.mData, a8.mData);
+    EXPECT_EQ(b1.mData, b8.mData);
+    EXPECT_EQ(c1.mData, c8.mData);
+
+    // each value is a function of the seed and the multi-index only
+    EXPECT_EQ(a8(3, 64, 2), g2(3, 64, 2));
+    EXPECT_EQ(b8(36, 0, 28), g3(36, 0, 28));
+
+    double sum = 0, sum_sq = 0;
+    for(std::size_t i = 0; i < a1.mData.size(); ++i)
+    {
+        EXPECT_GE(a1.mData[i], -5);
+        EXPECT_LT(a1.mData[i], 5);
+        EXPECT_GE(b1.mData[i], -1.f);
+        EXPECT_LT(b1.mData[i], 1.f);
+        sum += c1.mData[i];
+        sum_sq += c1.mData[i] * c1.mData[i];
+    }
+    const double mean = sum / c1.mData.size();
+    EXPECT_NEAR(mean, 0., 0.02);
+    EXPECT_NEAR(sum_sq / c1.mData.size() - mean * mean, 1., 0.02);
+}
+
+TEST(HostTensorGenerator, Seed)
+{
+    Tensor<float> a({64, 64}), b({64, 64}), c({64, 64});
+    a.GenerateTensorValue(GeneratorTensor_3<float>{0.f, 1.f, 7u});
+    b.GenerateTensorValue(GeneratorTensor_3<float>{0.f, 1.f, 7u});
+    c.GenerateTensorValue(GeneratorTensor_3<float>{0.f, 1.f});
+
+    EXPECT_EQ(a.mData, b.mData);
+    EXPECT_NE(a.mData, c.mData);
+}
+
+TEST(HostTensorGenerator, AnyRank)
+{
+    Tensor<float> t7(std::vector<std::size_t>{2, 3, 1, 2, 3, 2, 5});
+    t7.GenerateTensorValue(GeneratorTensor_Sequential<4>{}, 4);
+    EXPECT_EQ(t7(1, 2, 0, 1, 2, 1, 4), 2.f);
+    EXPECT_EQ(t7(1, 2, 0, 1, 1, 1, 4), 1.f);
+
+    Tensor<float> t13(std::vector<std::size_t>(13, 2));
+    t13.GenerateTensorValue(GeneratorTensor_Sequential<12>{});
+    EXPECT_EQ(t13(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1), 1.f);
+    EXPECT_EQ(t13(1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0), 0.f);
+
+    Tensor<float> t17(std::vector<std::size_t>(17, 1));
+    EXPECT_THROW(t17.GenerateTensorValue(GeneratorTensor_1<float>{}), std::runtime_error);
+}
+
+TEST(HostTensorGenerator, Strided)
+{
+    // transposed, the last dimension is not contiguous
+    Tensor<std::size_t> t(HostTensorDescriptor({300u, 70u}, {1u, 300u}));
+    t.GenerateTensorValue([](std::size_t i, std::size_t j) { return 1000 * i + j; }, 3);
+
+    for(std::size_t i = 0; i < 300; ++i)
+    {
+        for(std::size_t j = 0; j < 70; ++j)
+        {
+            ASSERT_EQ(t.mData[i + 300 * j], 1000 * i + j);
+        }
+    }
+}
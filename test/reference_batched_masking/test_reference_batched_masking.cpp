@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <functional>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck_tile/core.hpp"
+#include "ck_tile/host.hpp"
+#include "ck_tile/ops/fmha/block/block_masking.hpp"
+
+using namespace ck_tile;
+
+namespace {
+
+constexpr index_t Batch = 2;
+constexpr index_t K     = 16; // hdim_q
+constexpr index_t O     = 8;  // hdim_v
+
+// the masking of every element of c_b_m_n checked with IsOutOfBound, as the attention references
+// did before the row ranges
+template <typename MaskingType>
+void MaskElementWise(HostTensor<float>& c_b_m_n, const MaskingType& mask)
+{
+    const auto& lengths = c_b_m_n.get_lengths();
+
+    for(std::size_t b = 0; b < lengths[0]; ++b)
+        for(std::size_t m = 0; m < lengths[1]; ++m)
+            for(std::size_t n = 0; n < lengths[2]; ++n)
+            {
+                if(mask.IsOutOfBound(m, n))
+                {
+                    c_b_m_n(b, m, n) = -numeric<float>::infinity();
+                }
+            }
+}
+
+template <typename MaskingType>
+void CheckMask(const MaskingType& mask, index_t M, index_t N)
+{
+    const auto row_ranges = make_masking_row_ranges(mask, M, N);
+
+    ASSERT_EQ(row_ranges.size(), static_cast<std::size_t>(M));
+
+    // the row ranges are exactly the elements which are not out of bound
+    for(index_t m = 0; m < M; ++m)
+    {
+        for(index_t n = 0; n < N; ++n)
+        {
+            const bool is_in_range = row_ranges[m].begin <= n && n < row_ranges[m].end;
+
+            EXPECT_EQ(is_in_range, !mask.IsOutOfBound(m, n)) << "m = " << m << ", n = " << n;
+        }
+    }
+
+    HostTensor<float> q({Batch, M, K});
+    HostTensor<float> k({Batch, N, K});
+    HostTensor<float> v({Batch, O, N});
+
+    FillUniformDistribution<float>{-2.f, 2.f, 1}(q);
+    FillUniformDistribution<float>{-2.f, 2.f, 2}(k);
+    FillUniformDistribution<float>{-2.f, 2.f, 3}(v);
+
+    // S = Q * K^T, masking, P = softmax(S), O = P * V on all the elements
+    HostTensor<float> s_ref({Batch, M, N});
+    HostTensor<float> p_ref({Batch, M, N});
+    HostTensor<float> o_ref({Batch, M, O});
+    HostTensor<float> lse_ref({Batch, M});
+
+    reference_batched_gemm<float, float, float, float>(q, k, s_ref);
+    MaskElementWise(s_ref, mask);
+    reference_batched_softmax<float, float, float>(s_ref, p_ref, identity{}, std::ref(lse_ref));
+    reference_batched_gemm<float, float, float, float>(p_ref, v, o_ref);
+
+    // the same on the unmasked elements only
+    HostTensor<float> s({Batch, M, N});
+    HostTensor<float> p({Batch, M, N});
+    HostTensor<float> o({Batch, M, O});
+    HostTensor<float> lse({Batch, M});
+
+    reference_batched_masked_gemm<float, float, float, float>(q, k, s, row_ranges);
+    reference_batched_masked_softmax<float, float, float>(
+        s, p, row_ranges, identity{}, std::ref(lse));
+    reference_batched_gemm_with_masked_a<float, float, float, float>(p, v, o, row_ranges);
+
+    EXPECT_EQ(s.mData, s_ref.mData);
+    EXPECT_EQ(p.mData, p_ref.mData);
+    EXPECT_EQ(o.mData, o_ref.mData);
+    EXPECT_EQ(lse.mData, lse_ref.mData);
+}
+
+} // namespace
+
+TEST(ReferenceBatchedMasking, NoMask)
+{
+    CheckMask(GenericAttentionMask<false>{37, 29}, 37, 29);
+}
+
+TEST(ReferenceBatchedMasking, CausalTopLeft)
+{
+    using Mask = GenericAttentionMask<true, false>;
+
+    CheckMask(make_generic_attention_mask_from_lr_window<Mask>(-1, 0, 37, 29, true), 37, 29);
+    CheckMask(make_generic_attention_mask_from_lr_window<Mask>(-1, 0, 29, 37, true), 29, 37);
+}
+
+TEST(ReferenceBatchedMasking, CausalBottomRight)
+{
+    using Mask = GenericAttentionMask<true, false>;
+
+    // the first 8 rows are fully masked
+    CheckMask(make_generic_attention_mask_from_lr_window<Mask>(-1, 0, 37, 29, false), 37, 29);
+    CheckMask(make_generic_attention_mask_from_lr_window<Mask>(-1, 0, 29, 37, false), 29, 37);
+}
+
+TEST(ReferenceBatchedMasking, GenericWindow)
+{
+    using Mask = GenericAttentionMask<true, true>;
+
+    CheckMask(make_generic_attention_mask_from_lr_window<Mask>(5, 3, 37, 29, true), 37, 29);
+    CheckMask(make_generic_attention_mask_from_lr_window<Mask>(0, 0, 29, 37, true), 29, 37);
+    // the first 8 rows are fully masked
+    CheckMask(make_generic_attention_mask_from_lr_window<Mask>(4, 0, 37, 29, false), 37, 29);
+    // the last rows are fully masked
+    CheckMask(Mask{2, 1, 37, 29}, 37, 29);
+}
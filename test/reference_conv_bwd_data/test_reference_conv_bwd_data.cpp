@@ -0,0 +1,259 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_column_to_image.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_data.hpp"
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using namespace ck::tensor_layout::convolution;
+
+namespace {
+
+struct ConvProblem
+{
+    std::vector<ck::long_index_t> in_lengths;
+    std::vector<ck::long_index_t> filter_lengths;
+    std::vector<ck::long_index_t> strides;
+    std::vector<ck::long_index_t> dilations;
+    std::vector<ck::long_index_t> left_pads;
+    std::vector<ck::long_index_t> right_pads;
+
+    std::vector<ck::long_index_t> GetOutputLengths() const
+    {
+        std::vector<ck::long_index_t> out_lengths;
+        for(std::size_t d = 0; d < in_lengths.size(); ++d)
+        {
+            const ck::long_index_t x_eff = (filter_lengths[d] - 1) * dilations[d] + 1;
+            out_lengths.push_back(
+                (in_lengths[d] + left_pads[d] + right_pads[d] - x_eff) / strides[d] + 1);
+        }
+        return out_lengths;
+    }
+};
+
+std::vector<std::size_t> GetLengths(std::size_t i0,
+                                    std::size_t i1,
+                                    std::size_t i2,
+                                    const std::vector<ck::long_index_t>& spatial_lengths)
+{
+    std::vector<std::size_t> lengths{i0, i1, i2};
+    lengths.insert(lengths.end(), spatial_lengths.begin(), spatial_lengths.end());
+    return lengths;
+}
+
+std::size_t GetSize(const std::vector<ck::long_index_t>& spatial_lengths)
+{
+    std::size_t size = 1;
+    for(auto length : spatial_lengths)
+    {
+        size *= length;
+    }
+    return size;
+}
+
+// Spatial coordinates of a row-major offset
+std::vector<std::size_t> GetSpatialIndex(std::size_t offset,
+                                         const std::vector<ck::long_index_t>& spatial_lengths)
+{
+    std::vector<std::size_t> idx(spatial_lengths.size());
+    for(std::size_t d = spatial_lengths.size(); d-- > 0;)
+    {
+        idx[d] = offset % spatial_lengths[d];
+        offset /= spatial_lengths[d];
+    }
+    return idx;
+}
+
+// Scatter form of the transposed convolution, in double: calls f(out_idx, tap, in_idx) with the
+// spatial coordinates of every (output position, filter tap) and the input position reading them
+template <typename F>
+void ForEachTerm(const ConvProblem& problem, F f)
+{
+    const auto out_lengths = problem.GetOutputLengths();
+
+    for(std::size_t o = 0; o < GetSize(out_lengths); ++o)
+    {
+        const auto out_idx = GetSpatialIndex(o, out_lengths);
+        for(std::size_t t = 0; t < GetSize(problem.filter_lengths); ++t)
+        {
+            const auto tap = GetSpatialIndex(t, problem.filter_lengths);
+
+            std::vector<std::size_t> in_idx;
+            for(std::size_t d = 0; d < out_idx.size(); ++d)
+            {
+                const ck::long_index_t x = out_idx[d] * problem.strides[d] +
+                                           tap[d] * problem.dilations[d] - problem.left_pads[d];
+                if(x < 0 || x >= problem.in_lengths[d])
+                {
+                    break;
+                }
+                in_idx.push_back(x);
+            }
+            if(in_idx.size() == out_idx.size())
+            {
+                f(o, t, in_idx);
+            }
+        }
+    }
+}
+
+std::vector<std::size_t> Concat(std::vector<std::size_t> idx, const std::vector<std::size_t>& b)
+{
+    idx.insert(idx.end(), b.begin(), b.end());
+    return idx;
+}
+
+template <ck::index_t NDimSpatial>
+void CheckConvBwdData(const ConvProblem& problem)
+{
+    constexpr std::size_t G = 2;
+    constexpr std::size_t N = 3;
+    constexpr std::size_t K = 5;
+    constexpr std::size_t C = 4;
+
+    const auto out_lengths = problem.GetOutputLengths();
+
+    Tensor<float> input(GetLengths(G, N, C, problem.in_lengths));
+    Tensor<float> weight(GetLengths(G, K, C, problem.filter_lengths));
+    Tensor<float> output(GetLengths(G, N, K, out_lengths));
+
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> dis(-1.f, 1.f);
+    for(auto* t : {&input, &weight, &output})
+    {
+        for(auto& x : t->mData)
+        {
+            x = dis(gen);
+        }
+    }
+
+    using ReferenceInstance = ck::tensor_operation::host::ReferenceConvBwdData<NDimSpatial,
+                                                                               float,
+                                                                               float,
+                                                                               float,
+                                                                               PassThrough,
+                                                                               PassThrough,
+                                                                               PassThrough>;
+
+    auto argument = ReferenceInstance::MakeArgument(input,
+                                                    weight,
+                                                    output,
+                                                    problem.strides,
+                                                    problem.dilations,
+                                                    problem.left_pads,
+                                                    problem.right_pads,
+                                                    PassThrough{},
+                                                    PassThrough{},
+                                                    PassThrough{});
+    ReferenceInstance::MakeInvoker().Run(argument);
+
+    std::vector<double> expected(input.mDesc.GetElementSpaceSize(), 0);
+    ForEachTerm(problem, [&](std::size_t o, std::size_t t, const std::vector<std::size_t>& in_idx) {
+        const auto out_idx = GetSpatialIndex(o, out_lengths);
+        const auto tap     = GetSpatialIndex(t, problem.filter_lengths);
+        for(std::size_t g = 0; g < G; ++g)
+        {
+            for(std::size_t n = 0; n < N; ++n)
+            {
+                for(std::size_t c = 0; c < C; ++c)
+                {
+                    for(std::size_t k = 0; k < K; ++k)
+                    {
+                        expected[input.mDesc.GetOffsetFromMultiIndex(Concat({g, n, c}, in_idx))] +=
+                            double{output(Concat({g, n, k}, out_idx))} *
+                            weight(Concat({g, k, c}, tap));
+                    }
+                }
+            }
+        }
+    });
+
+    input.ForEach([&](auto& self, auto idx) {
+        EXPECT_NEAR(self(idx), expected[input.mDesc.GetOffsetFromMultiIndex(idx)], 1e-5);
+    });
+}
+
+template <ck::index_t NDimSpatial, typename ImageLayout>
+void CheckColumnToImage(const ConvProblem& problem)
+{
+    constexpr std::size_t N = 3;
+    constexpr std::size_t C = 5;
+
+    const std::size_t out_size    = GetSize(problem.GetOutputLengths());
+    const std::size_t filter_size = GetSize(problem.filter_lengths);
+
+    Tensor<float> column(std::vector<std::size_t>{1, N * out_size, filter_size * C});
+    Tensor<float> image(GetLengths(1, N, C, problem.in_lengths));
+
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> dis(-1.f, 1.f);
+    for(auto* t : {&column, &image})
+    {
+        for(auto& x : t->mData)
+        {
+            x = dis(gen);
+        }
+    }
+
+    // the columns are added to the image
+    std::vector<double> expected(image.mData.begin(), image.mData.end());
+    ForEachTerm(problem, [&](std::size_t o, std::size_t t, const std::vector<std::size_t>& in_idx) {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            for(std::size_t c = 0; c < C; ++c)
+            {
+                expected[image.mDesc.GetOffsetFromMultiIndex(Concat({0, n, c}, in_idx))] +=
+                    column(0, n * out_size + o, t * C + c);
+            }
+        }
+    });
+
+    using ReferenceInstance = ck::tensor_operation::host::
+        ReferenceColumnToImage<NDimSpatial, ImageLayout, float, float>;
+
+    auto reference = ReferenceInstance{};
+    auto argument  = ReferenceInstance::MakeArgument(column,
+                                                    image,
+                                                    problem.filter_lengths,
+                                                    problem.strides,
+                                                    problem.dilations,
+                                                    problem.left_pads,
+                                                    problem.right_pads);
+    ASSERT_TRUE(reference.IsSupportedArgument(argument));
+    ReferenceInstance::MakeInvoker().Run(argument);
+
+    image.ForEach([&](auto& self, auto idx) {
+        EXPECT_NEAR(self(idx), expected[image.mDesc.GetOffsetFromMultiIndex(idx)], 1e-5);
+    });
+}
+
+const ConvProblem Problem1D{{37}, {3}, {2}, {1}, {1}, {1}};
+
+// overlapping and skipped input positions, padding on both sides
+const ConvProblem Problem2D{{13, 11}, {3, 2}, {2, 3}, {2, 1}, {1, 0}, {2, 1}};
+
+const ConvProblem Problem3D{{5, 7, 6}, {2, 3, 3}, {1, 2, 2}, {1, 1, 2}, {0, 1, 2}, {1, 1, 0}};
+
+} // namespace
+
+TEST(ReferenceConvBwdData, Conv1D) { CheckConvBwdData<1>(Problem1D); }
+
+TEST(ReferenceConvBwdData, Conv2D) { CheckConvBwdData<2>(Problem2D); }
+
+TEST(ReferenceConvBwdData, Conv3D) { CheckConvBwdData<3>(Problem3D); }
+
+TEST(ReferenceColumnToImage, Image1D) { CheckColumnToImage<1, GNWC>(Problem1D); }
+
+TEST(ReferenceColumnToImage, Image2D) { CheckColumnToImage<2, GNHWC>(Problem2D); }
+
+TEST(ReferenceColumnToImage, Image3D) { CheckColumnToImage<3, GNDHWC>(Problem3D); }
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #include <cmath>
 #include <cstdlib>
@@ -19,6 +19,7 @@
 #include "ck/library/utility/convolution_parameter.hpp"
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd_quantization.hpp"
 
 namespace {
 
@@ -390,3 +391,151 @@ TEST(ReferenceConvolutionFWD, Conv3DGNCDHWStridesDilations)
     EXPECT_TRUE(ck::utils::check_err(
         out_tensor, ref_data, "Error [case 2]: incorrect results!", 1e-4f, 1e-6f));
 }
+
+// int8 convolutions run on the int8 GEMM engine, checked against the direct computation of every
+// output element (both accumulate exactly in int32)
+TEST(ReferenceConvolutionFWD, Conv2DInt8StridesDilationsPadding)
+{
+    using InLayout  = ck::tensor_layout::convolution::GNHWC;
+    using WeiLayout = ck::tensor_layout::convolution::GKYXC;
+    using OutLayout = ck::tensor_layout::convolution::GNHWK;
+
+    ck::utils::conv::ConvParam conv_param(2,
+                                          2,
+                                          3,
+                                          37,
+                                          71,
+                                          std::vector<ck::index_t>{3, 3},
+                                          std::vector<ck::index_t>{13, 11},
+                                          std::vector<ck::index_t>{2, 1},
+                                          std::vector<ck::index_t>{1, 2},
+                                          std::vector<ck::index_t>{1, 2},
+                                          std::vector<ck::index_t>{1, 2});
+
+    Tensor<int8_t> input(
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param));
+    Tensor<int8_t> weights(
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(
+            conv_param));
+    Tensor<int32_t> output(
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(
+            conv_param));
+    Tensor<int32_t> output_elements(output.mDesc);
+
+    ck::utils::FillUniformDistributionIntegerValue<int8_t>{-128.f, 127.f}(input);
+    ck::utils::FillUniformDistributionIntegerValue<int8_t>{-128.f, 127.f}(weights);
+
+    using ReferenceInstance = ck::tensor_operation::host::
+        ReferenceConvFwd<2, int8_t, int8_t, int32_t, InElementOp, WeiElementOp, OutElementOp>;
+
+    auto make_argument = [&](Tensor<int32_t>& out) {
+        return ReferenceInstance::MakeArgument(input,
+                                               weights,
+                                               out,
+                                               conv_param.conv_filter_strides_,
+                                               conv_param.conv_filter_dilations_,
+                                               conv_param.input_left_pads_,
+                                               conv_param.input_right_pads_,
+                                               InElementOp{},
+                                               WeiElementOp{},
+                                               OutElementOp{});
+    };
+
+    auto argument = make_argument(output);
+    ReferenceInstance::MakeInvoker().Run(argument);
+
+    auto element_argument = make_argument(output_elements);
+    const auto& lengths   = output.GetLengths();
+    for(std::size_t g = 0; g < lengths[0]; ++g)
+        for(std::size_t n = 0; n < lengths[1]; ++n)
+            for(std::size_t k = 0; k < lengths[2]; ++k)
+                for(std::size_t ho = 0; ho < lengths[3]; ++ho)
+                    for(std::size_t wo = 0; wo < lengths[4]; ++wo)
+                        ReferenceInstance::Invoker::RunElement(element_argument, g, n, k, ho, wo);
+
+    EXPECT_TRUE(ck::utils::check_err(output, output_elements));
+}
+
+// the requantized output of ReferenceConvFwdQuantization is the output operation applied to every
+// element of the int32 convolution
+TEST(ReferenceConvolutionFWD, Conv2DInt8Requantization)
+{
+    using InLayout  = ck::tensor_layout::convolution::GNHWC;
+    using WeiLayout = ck::tensor_layout::convolution::GKYXC;
+    using OutLayout = ck::tensor_layout::convolution::GNHWK;
+
+    using Relu      = ck::tensor_operation::element_wise::Relu;
+    using RequantOp = ck::tensor_operation::element_wise::Add_Activation_Mul2_Clamp<Relu>;
+
+    const RequantOp requant_op{Relu{}};
+
+    ck::utils::conv::ConvParam conv_param(2,
+                                          2,
+                                          3,
+                                          37,
+                                          71,
+                                          std::vector<ck::index_t>{3, 3},
+                                          std::vector<ck::index_t>{13, 11},
+                                          std::vector<ck::index_t>{2, 1},
+                                          std::vector<ck::index_t>{1, 2},
+                                          std::vector<ck::index_t>{1, 2},
+                                          std::vector<ck::index_t>{1, 2});
+
+    const auto out_desc =
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(conv_param);
+
+    // per channel bias and requantization scales
+    std::vector<std::size_t> channel_strides(out_desc.GetNumOfDimension(), 0);
+    channel_strides[0] = conv_param.K_;
+    channel_strides[2] = 1;
+    const HostTensorDescriptor channel_desc(out_desc.GetLengths(), channel_strides);
+
+    Tensor<int8_t> input(
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param));
+    Tensor<int8_t> weights(
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(
+            conv_param));
+    Tensor<int32_t> bias(channel_desc);
+    Tensor<float> scale(channel_desc);
+    Tensor<int32_t> acc(out_desc);
+    Tensor<int8_t> output(out_desc);
+    Tensor<int8_t> expected(out_desc);
+
+    ck::utils::FillUniformDistributionIntegerValue<int8_t>{-128.f, 127.f}(input);
+    ck::utils::FillUniformDistributionIntegerValue<int8_t>{-128.f, 127.f}(weights);
+    ck::utils::FillUniformDistributionIntegerValue<int32_t>{-20000.f, 20000.f}(bias);
+    ck::utils::FillUniformDistribution<float>{1e-4f, 1e-3f}(scale);
+
+    auto ref_conv = ck::tensor_operation::host::
+        ReferenceConvFwd<2, int8_t, int8_t, int32_t, InElementOp, WeiElementOp, OutElementOp>{};
+    auto ref_argument = ref_conv.MakeArgument(input,
+                                              weights,
+                                              acc,
+                                              conv_param.conv_filter_strides_,
+                                              conv_param.conv_filter_dilations_,
+                                              conv_param.input_left_pads_,
+                                              conv_param.input_right_pads_,
+                                              InElementOp{},
+                                              WeiElementOp{},
+                                              OutElementOp{});
+    ref_conv.MakeInvoker().Run(ref_argument);
+
+    expected.ForEach(
+        [&](auto& self, auto idx) { requant_op(self(idx), acc(idx), bias(idx), scale(idx)); });
+
+    auto quantized_conv = ck::tensor_operation::host::
+        ReferenceConvFwdQuantization<2, int8_t, RequantOp, int32_t, float>{};
+    auto quantized_argument = quantized_conv.MakeArgument(input,
+                                                          weights,
+                                                          output,
+                                                          conv_param.conv_filter_strides_,
+                                                          conv_param.conv_filter_dilations_,
+                                                          conv_param.input_left_pads_,
+                                                          conv_param.input_right_pads_,
+                                                          requant_op,
+                                                          bias,
+                                                          scale);
+    quantized_conv.MakeInvoker().Run(quantized_argument);
+
+    EXPECT_TRUE(ck::utils::check_err(output, expected));
+}
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_elementwise.hpp"
+
+namespace {
+
+struct ScaleSquare
+{
+    void operator()(float& y, const float& x) const { y = 2.f * x * x; }
+};
+
+struct AddMul
+{
+    void operator()(float& y, const float& x0, const float& x1, const float& x2) const
+    {
+        y = (x0 + x1) * x2;
+    }
+};
+
+template <ck::index_t NumATensors, typename ElementOp>
+void RunReference(const std::array<Tensor<float>, NumATensors>& as,
+                  Tensor<float>& b,
+                  ElementOp element_op)
+{
+    using ReferenceInstance =
+        ck::tensor_operation::host::ReferenceElementwise<NumATensors, float, float, ElementOp>;
+
+    auto ref_argument = ReferenceInstance::MakeArgument(as, b, element_op);
+    ReferenceInstance::MakeInvoker().Run(ref_argument);
+}
+
+} // namespace
+
+TEST(ReferenceElementwise, Permute)
+{
+    // NCHW to NHWC, walked by tiles of W and C
+    const std::size_t N = 2, C = 67, H = 3, W = 45;
+
+    std::array<Tensor<float>, 1> as{Tensor<float>(std::vector<std::size_t>{N, C, H, W})};
+    as[0].GenerateTensorValue(GeneratorTensor_3<float>{-1.f, 1.f});
+    Tensor<float> b(HostTensorDescriptor({N, C, H, W}, {H * W * C, 1, W * C, C}));
+
+    RunReference<1>(as, b, ScaleSquare{});
+
+    for(std::size_t n = 0; n < N; ++n)
+        for(std::size_t c = 0; c < C; ++c)
+            for(std::size_t h = 0; h < H; ++h)
+                for(std::size_t w = 0; w < W; ++w)
+                {
+                    const float x = as[0](n, c, h, w);
+                    ASSERT_EQ(b.mData[((n * H + h) * W + w) * C + c], 2.f * x * x);
+                }
+}
+
+TEST(ReferenceElementwise, Broadcast)
+{
+    const std::size_t M = 37, N = 70000;
+
+    // x1 is a column of length 1 along N, x2 a row of stride 0 along M
+    std::array<Tensor<float>, 3> as{Tensor<float>(std::vector<std::size_t>{M, N}),
+                                    Tensor<float>(std::vector<std::size_t>{M, 1}),
+                                    Tensor<float>(HostTensorDescriptor({M, N}, {0u, 1u}))};
+    // distinct seeds for each input
+    for(std::size_t i = 0; i < as.size(); ++i)
+    {
+        const unsigned int seed = i;
+        as[i].GenerateTensorValue(GeneratorTensor_3<float>{-1.f, 1.f, seed});
+    }
+    Tensor<float> b(std::vector<std::size_t>{M, N});
+
+    RunReference<3>(as, b, AddMul{});
+
+    for(std::size_t m = 0; m < M; ++m)
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            ASSERT_EQ(b(m, n), (as[0](m, n) + as[1](m, 0)) * as[2].mData[n]);
+        }
+}
+
+TEST(ReferenceElementwise, InconsistentLengths)
+{
+    std::array<Tensor<float>, 1> as{Tensor<float>(std::vector<std::size_t>{4, 3})};
+    Tensor<float> b(std::vector<std::size_t>{4, 5});
+
+    EXPECT_THROW(RunReference<1>(as, b, ScaleSquare{}), std::runtime_error);
+}
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm_ab_scale.hpp"
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+namespace {
+
+// 8-bit A (converted by table) and 16-bit B
+using ReferenceInstance = ck::tensor_operation::host::
+    ReferenceGemmABScale<int8_t, float, ck::half_t, float, float, float, PassThrough>;
+
+constexpr std::size_t M = 67;
+constexpr std::size_t N = 150;
+constexpr std::size_t K = 300;
+
+std::size_t GetNumBlocks(std::size_t length, std::size_t block)
+{
+    return (length + block - 1) / block;
+}
+
+class TestReferenceGemmABScale : public ::testing::Test
+{
+    protected:
+    // e = a * b with the scales of the blocks of (block_m, block_n, block_k), checked against the
+    // GEMM of the scaled a and b computed in double
+    void Run(std::size_t block_m, std::size_t block_n, std::size_t block_k)
+    {
+        std::mt19937 gen(0);
+        std::uniform_int_distribution<int> dis_a(-128, 127);
+        std::uniform_real_distribution<float> dis_b(-1.f, 1.f);
+        std::uniform_real_distribution<float> dis_scale(0.f, 1.f);
+
+        Tensor<int8_t> a0_m_k(std::vector<std::size_t>{M, K});
+        Tensor<float> a1_m_k(
+            std::vector<std::size_t>{GetNumBlocks(M, block_m), GetNumBlocks(K, block_k)});
+        // column-major B
+        Tensor<ck::half_t> b0_k_n(std::vector<std::size_t>{K, N}, std::vector<std::size_t>{1, K});
+        Tensor<float> b1_k_n(
+            std::vector<std::size_t>{GetNumBlocks(K, block_k), GetNumBlocks(N, block_n)});
+        Tensor<float> e_m_n(std::vector<std::size_t>{M, N});
+
+        for(auto& x : a0_m_k.mData)
+        {
+            x = static_cast<int8_t>(dis_a(gen));
+        }
+        for(auto& x : b0_k_n.mData)
+        {
+            x = ck::type_convert<ck::half_t>(dis_b(gen));
+        }
+        for(auto* scale : {&a1_m_k, &b1_k_n})
+        {
+            for(auto& x : scale->mData)
+            {
+                x = dis_scale(gen);
+            }
+        }
+
+        auto argument = ReferenceInstance::MakeArgument(
+            a0_m_k, a1_m_k, b0_k_n, b1_k_n, e_m_n, block_m, block_n, block_k, PassThrough{});
+        ReferenceInstance::MakeInvoker().Run(argument);
+
+        for(std::size_t m = 0; m < M; ++m)
+        {
+            for(std::size_t n = 0; n < N; ++n)
+            {
+                double e     = 0;
+                double e_abs = 0;
+                for(std::size_t k = 0; k < K; ++k)
+                {
+                    const double x = a0_m_k(m, k) * double{a1_m_k(m / block_m, k / block_k)} *
+                                     ck::type_convert<float>(b0_k_n(k, n)) *
+                                     b1_k_n(k / block_k, n / block_n);
+                    e += x;
+                    e_abs += std::abs(x);
+                }
+                EXPECT_NEAR(e_m_n(m, n), e, 1e-5 * e_abs);
+            }
+        }
+    }
+};
+
+} // namespace
+
+TEST_F(TestReferenceGemmABScale, Blocks) { Run(1, 128, 128); }
+
+TEST_F(TestReferenceGemmABScale, Blocks2D) { Run(16, 32, 64); }
+
+// scales of gemm_multiply_multiply
+TEST_F(TestReferenceGemmABScale, RowColumn) { Run(1, 1, K); }
+
+TEST_F(TestReferenceGemmABScale, InconsistentScaleLengths)
+{
+    Tensor<int8_t> a0_m_k(std::vector<std::size_t>{M, K});
+    Tensor<float> a1_m_k(std::vector<std::size_t>{M, 2});
+    Tensor<ck::half_t> b0_k_n(std::vector<std::size_t>{K, N});
+    Tensor<float> b1_k_n(std::vector<std::size_t>{3, N});
+    Tensor<float> e_m_n(std::vector<std::size_t>{M, N});
+
+    auto argument = ReferenceInstance::MakeArgument(
+        a0_m_k, a1_m_k, b0_k_n, b1_k_n, e_m_n, 1, 1, 128, PassThrough{});
+    EXPECT_THROW(ReferenceInstance::MakeInvoker().Run(argument), std::runtime_error);
+}
@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/utility/host_int8_gemm.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm_multiple_d.hpp"
+
+using namespace ck::tensor_operation::element_wise;
+
+namespace {
+
+// K is not a multiple of the SIMD lanes of the int8 engine
+constexpr std::size_t M = 37;
+constexpr std::size_t N = 29;
+constexpr std::size_t K = 4099;
+
+class TestReferenceInt8Gemm : public ::testing::Test
+{
+    protected:
+    void SetUp() override
+    {
+        std::mt19937 gen(0);
+        std::uniform_int_distribution<int> dis(-128, 127);
+
+        for(auto* t : {&a_m_k, &b_k_n})
+        {
+            for(auto& x : t->mData)
+            {
+                x = static_cast<int8_t>(dis(gen));
+            }
+        }
+        // c(0, 0) > 2^24, which float accumulation would round
+        std::uniform_int_distribution<int> dis_large(100, 127);
+        for(std::size_t k = 0; k < K; ++k)
+        {
+            a_m_k(0, k) = static_cast<int8_t>(dis_large(gen));
+            b_k_n(k, 0) = static_cast<int8_t>(dis_large(gen));
+        }
+        for(auto& x : bias_m_n.mData)
+        {
+            x = dis(gen) * 1000;
+        }
+    }
+
+    // exact A * B, computed in int64
+    int64_t GetProduct(std::size_t m, std::size_t n) const
+    {
+        int64_t sum = 0;
+        for(std::size_t k = 0; k < K; ++k)
+        {
+            sum += int64_t{a_m_k(m, k)} * b_k_n(k, n);
+        }
+        return sum;
+    }
+
+    Tensor<int8_t> a_m_k = Tensor<int8_t>(std::vector<std::size_t>{M, K});
+    // column-major B, the layout of most int8 GEMMs
+    Tensor<int8_t> b_k_n =
+        Tensor<int8_t>(std::vector<std::size_t>{K, N}, std::vector<std::size_t>{1, K});
+    // per-channel bias, broadcast along M
+    Tensor<int32_t> bias_m_n =
+        Tensor<int32_t>(std::vector<std::size_t>{M, N}, std::vector<std::size_t>{0, 1});
+};
+
+} // namespace
+
+TEST_F(TestReferenceInt8Gemm, Int32Output)
+{
+    using ReferenceInstance = ck::tensor_operation::host::
+        ReferenceGemm<int8_t, int8_t, int32_t, int32_t, PassThrough, PassThrough, PassThrough>;
+
+    Tensor<int32_t> c_m_n(std::vector<std::size_t>{M, N});
+
+    auto argument = ReferenceInstance::MakeArgument(
+        a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+    ReferenceInstance::MakeInvoker().Run(argument);
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            EXPECT_EQ(c_m_n(m, n), GetProduct(m, n));
+        }
+    }
+}
+
+TEST_F(TestReferenceInt8Gemm, Requantization)
+{
+    using CElementOp = Activation_Mul_Clamp<Relu>;
+    using ReferenceInstance =
+        ck::tensor_operation::host::ReferenceGemm<int8_t,
+                                                  int8_t,
+                                                  int8_t,
+                                                  int32_t,
+                                                  PassThrough,
+                                                  PassThrough,
+                                                  CElementOp>;
+
+    const auto c_element_op = CElementOp{1.f / 4096, Relu{}};
+
+    Tensor<int8_t> c_m_n(std::vector<std::size_t>{M, N});
+
+    auto argument = ReferenceInstance::MakeArgument(
+        a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, c_element_op);
+    ReferenceInstance::MakeInvoker().Run(argument);
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            int8_t c = 0;
+            c_element_op(c, static_cast<int32_t>(GetProduct(m, n)));
+            EXPECT_EQ(c_m_n(m, n), c);
+        }
+    }
+}
+
+TEST_F(TestReferenceInt8Gemm, BiasRequantization)
+{
+    using CDEElementOp = Add_Activation_Mul_Clamp<Relu>;
+    using ReferenceInstance =
+        ck::tensor_operation::host::ReferenceGemmMultipleD<int8_t,
+                                                           int8_t,
+                                                           ck::Tuple<int32_t>,
+                                                           int8_t,
+                                                           int32_t,
+                                                           PassThrough,
+                                                           PassThrough,
+                                                           CDEElementOp>;
+
+    const auto cde_element_op = CDEElementOp{1.f / 4096, Relu{}};
+
+    Tensor<int8_t> e_m_n(std::vector<std::size_t>{M, N});
+
+    const std::array<Tensor<int32_t>, 1> ds_m_n{bias_m_n};
+    auto argument = ReferenceInstance::MakeArgument(
+        a_m_k, b_k_n, ds_m_n, e_m_n, PassThrough{}, PassThrough{}, cde_element_op);
+    ReferenceInstance::MakeInvoker().Run(argument);
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            int8_t e = 0;
+            cde_element_op(e, static_cast<int32_t>(GetProduct(m, n)), bias_m_n(m, n));
+            EXPECT_EQ(e_m_n(m, n), e);
+        }
+    }
+}
+
+// beyond K = 131071 the int32 sums can overflow, the engine refuses such GEMMs
+TEST(HostInt8Gemm, KBound)
+{
+    std::vector<int8_t> a(ck::host_int8_gemm::MaxK + 1, -128);
+    std::vector<int8_t> b(ck::host_int8_gemm::MaxK + 1, -128);
+
+    int32_t c = 0;
+    const auto store = [&](std::size_t, const int32_t* p_c_row) { c = p_c_row[0]; };
+
+    ck::host_int8_gemm::Gemm(a.data(), b.data(), 1, 1, ck::host_int8_gemm::MaxK, store);
+    EXPECT_EQ(c, 131071 * 16384);
+
+    EXPECT_THROW(
+        ck::host_int8_gemm::Gemm(a.data(), b.data(), 1, 1, ck::host_int8_gemm::MaxK + 1, store),
+        std::runtime_error);
+}
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <gtest/gtest.h>
+
+#include "ck_tile/core.hpp"
+#include "ck_tile/host.hpp"
+#include "ck_tile/host/reference/reference_layernorm2d.hpp"
+
+using namespace ck_tile;
+
+namespace {
+
+constexpr std::size_t M   = 5;
+constexpr float Epsilon   = 1e-5f;
+constexpr index_t NumLane = 8; // Welford lanes of reference_layernorm2d_fwd
+
+// mean and 1 / sqrt(variance + epsilon) of row m, with a two-pass computation in double
+void TwoPassStatistics(const HostTensor<float>& x_m_n,
+                       std::size_t m,
+                       double& mean,
+                       double& inv_std)
+{
+    const std::size_t N = x_m_n.get_lengths()[1];
+
+    double sum = 0;
+    for(std::size_t n = 0; n < N; ++n)
+    {
+        sum += x_m_n(m, n);
+    }
+    mean = sum / N;
+
+    double sum_of_squares = 0;
+    for(std::size_t n = 0; n < N; ++n)
+    {
+        const double d = x_m_n(m, n) - mean;
+        sum_of_squares += d * d;
+    }
+    inv_std = 1. / std::sqrt(sum_of_squares / N + Epsilon);
+}
+
+// rows of N elements uniformly distributed in [x_min, x_max]
+void CheckStatistics(std::size_t N, float x_min, float x_max, uint32_t seed)
+{
+    HostTensor<float> x_m_n({M, N});
+    HostTensor<float> gamma_n({N});
+    HostTensor<float> beta_n({N});
+    HostTensor<float> y_m_n({M, N});
+    HostTensor<float> mean_m({M});
+    HostTensor<float> inv_std_m({M});
+
+    FillUniformDistribution<float>{x_min, x_max, seed}(x_m_n);
+    FillUniformDistribution<float>{-1.f, 1.f, seed + 1}(gamma_n);
+    FillUniformDistribution<float>{-1.f, 1.f, seed + 2}(beta_n);
+
+    reference_layernorm2d_fwd<float, float, float, float, float, float, float>(
+        x_m_n, gamma_n, beta_n, y_m_n, mean_m, inv_std_m, Epsilon);
+
+    // a few float roundings of the magnitude of the inputs for the mean. The variance computed
+    // in float has a relative error of a few roundings of mean / std (the differences to the mean
+    // are rounded at the magnitude of the mean), a sum of squares minus the squared mean would have
+    // an error of the order of (mean / std)^2
+    constexpr double eps   = std::numeric_limits<float>::epsilon();
+    const double mean_atol = 4 * eps * std::max(std::abs(x_min), std::abs(x_max));
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        double mean, inv_std;
+        TwoPassStatistics(x_m_n, m, mean, inv_std);
+
+        const double inv_std_rtol = 4 * eps * (1 + std::abs(mean) * inv_std);
+
+        EXPECT_NEAR(mean_m(m), mean, mean_atol) << "N = " << N << ", m = " << m;
+        EXPECT_NEAR(inv_std_m(m), inv_std, inv_std_rtol * inv_std) << "N = " << N << ", m = " << m;
+    }
+}
+
+} // namespace
+
+TEST(ReferenceLayernorm2d, RowsShorterThanLanes)
+{
+    for(index_t N = 1; N < NumLane; ++N)
+    {
+        CheckStatistics(N, -2.f, 2.f, N);
+    }
+}
+
+TEST(ReferenceLayernorm2d, RowsNotMultipleOfLanes)
+{
+    for(index_t N : {NumLane + 1, 3 * NumLane - 1, 125, 1001, 4099})
+    {
+        CheckStatistics(N, -2.f, 2.f, N);
+    }
+}
+
+TEST(ReferenceLayernorm2d, RowsMultipleOfLanes)
+{
+    for(index_t N : {NumLane, 2 * NumLane, 1024, 4096})
+    {
+        CheckStatistics(N, -2.f, 2.f, N);
+    }
+}
+
+// mean / std of about 10^4, the tolerance of inv_std would not be met by a variance computed as the
+// mean of the squares minus the squared mean
+TEST(ReferenceLayernorm2d, LargeMeanSmallVariance)
+{
+    for(index_t N : {3, NumLane, 13, 1000, 4099})
+    {
+        CheckStatistics(N, 999.9f, 1000.1f, N);
+        CheckStatistics(N, 9999.f, 10001.f, N);
+    }
+}
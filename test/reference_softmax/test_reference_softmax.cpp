@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_softmax.hpp"
+
+namespace {
+
+using ReferenceInstance = ck::tensor_operation::host::ReferenceSoftmax<float, float, float>;
+
+constexpr double Alpha = 0.7;
+constexpr double Beta  = 0.2;
+
+// out = alpha * softmax(in) + beta * out over reduce_dims, checked against the softmax computed
+// in double
+void CheckSoftmax(const std::vector<std::size_t>& lengths,
+                  const std::vector<std::size_t>& strides,
+                  const std::vector<ck::index_t>& reduce_dims)
+{
+    Tensor<float> in(lengths, strides);
+    Tensor<float> out(lengths);
+
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> dis(-10.f, 10.f);
+    for(auto& x : in.mData)
+    {
+        x = dis(gen);
+    }
+    for(auto& x : out.mData)
+    {
+        x = dis(gen);
+    }
+    const Tensor<float> out_initial = out;
+
+    auto argument = ReferenceInstance::MakeArgument(in, out, Alpha, Beta, reduce_dims);
+    ReferenceInstance::MakeInvoker().Run(argument);
+
+    // index of the row of an element: its index with the reduced dimensions set to 0
+    auto get_row = [&](std::vector<std::size_t> idx) {
+        for(auto dim : reduce_dims)
+        {
+            idx[dim] = 0;
+        }
+        return in.mDesc.GetOffsetFromMultiIndex(idx);
+    };
+
+    std::vector<double> max(in.mDesc.GetElementSpaceSize(), -1e30);
+    std::vector<double> sum(in.mDesc.GetElementSpaceSize(), 0);
+    in.ForEach([&](auto& self, auto idx) {
+        max[get_row(idx)] = std::max(max[get_row(idx)], double{self(idx)});
+    });
+    in.ForEach([&](auto& self, auto idx) {
+        sum[get_row(idx)] += std::exp(self(idx) - max[get_row(idx)]);
+    });
+
+    double max_err = 0;
+    in.ForEach([&](auto& self, auto idx) {
+        const double y = Alpha * std::exp(self(idx) - max[get_row(idx)]) / sum[get_row(idx)] +
+                         Beta * out_initial(idx);
+        max_err        = std::max(max_err, std::abs(y - out(idx)));
+    });
+    EXPECT_LT(max_err, 1e-6);
+}
+
+} // namespace
+
+TEST(ReferenceSoftmax, LastDim) { CheckSoftmax({8, 5, 300}, {1500, 300, 1}, {2}); }
+
+TEST(ReferenceSoftmax, InnerDims) { CheckSoftmax({4, 6, 7, 9}, {378, 63, 9, 1}, {1, 3}); }
+
+TEST(ReferenceSoftmax, OuterDims) { CheckSoftmax({6, 7, 10, 3}, {210, 30, 3, 1}, {0, 1, 2}); }
+
+TEST(ReferenceSoftmax, Strided) { CheckSoftmax({5, 20, 30}, {1, 5, 100}, {1, 2}); }
+
+// rows longer than a chunk, normalized with the online max and sum
+TEST(ReferenceSoftmax, LongRows) { CheckSoftmax({3, 40, 1000}, {40000, 1000, 1}, {1, 2}); }
+
+TEST(ReferenceSoftmax, AllDims) { CheckSoftmax({30, 700}, {700, 1}, {0, 1}); }
@@ -0,0 +1,305 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/reduction_operator_mapping.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/sampled_verification.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_groupnorm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_layernorm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_reduce.hpp"
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using ReferenceGemmInstance = ck::tensor_operation::host::
+    ReferenceGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+class TestSampledVerification : public ::testing::Test
+{
+    protected:
+    void SetUp() override
+    {
+        ck::utils::FillUniformDistributionIntegerValue<float>{-5.f, 5.f}(a_m_k);
+        ck::utils::FillUniformDistributionIntegerValue<float>{-5.f, 5.f}(b_k_n);
+
+        ref_invoker.Run(ref_argument);
+    }
+
+    // reference computed at the requested elements only
+    bool CheckSampled(const Tensor<float>& out)
+    {
+        auto ref_argument_at = ref_gemm.MakeArgument(
+            a_m_k, b_k_n, c_m_n_at, PassThrough{}, PassThrough{}, PassThrough{});
+
+        auto ref_at = [&](const std::vector<std::size_t>& idx) {
+            ReferenceGemmInstance::Invoker::RunElement(ref_argument_at, idx[0], idx[1]);
+            return c_m_n_at(idx);
+        };
+
+        return ck::utils::check_err_sampled(out, ref_at, 64, 0, "Error: Incorrect results!");
+    }
+
+    static constexpr std::size_t M = 37;
+    static constexpr std::size_t N = 45;
+    static constexpr std::size_t K = 29;
+
+    Tensor<float> a_m_k    = Tensor<float>(std::vector<std::size_t>{M, K});
+    Tensor<float> b_k_n    = Tensor<float>(std::vector<std::size_t>{K, N});
+    Tensor<float> c_m_n    = Tensor<float>(std::vector<std::size_t>{M, N});
+    Tensor<float> c_m_n_at = Tensor<float>(std::vector<std::size_t>{M, N});
+
+    ReferenceGemmInstance ref_gemm;
+    ReferenceGemmInstance::Invoker ref_invoker   = ref_gemm.MakeInvoker();
+    ReferenceGemmInstance::Argument ref_argument =
+        ref_gemm.MakeArgument(a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+};
+
+TEST_F(TestSampledVerification, PassOnCorrectResult)
+{
+    const auto ref_row_sums = ck::utils::get_gemm_reference_row_sums(a_m_k, b_k_n);
+
+    EXPECT_TRUE(ck::utils::check_row_sums(c_m_n, ref_row_sums));
+    EXPECT_TRUE(CheckSampled(c_m_n));
+}
+
+TEST_F(TestSampledVerification, DetectWrongRow)
+{
+    const auto ref_row_sums = ck::utils::get_gemm_reference_row_sums(a_m_k, b_k_n);
+
+    for(std::size_t n = 0; n < N; ++n)
+    {
+        c_m_n(11, n) += 1.f;
+    }
+
+    EXPECT_FALSE(ck::utils::check_row_sums(c_m_n, ref_row_sums));
+}
+
+TEST_F(TestSampledVerification, DetectWrongElements)
+{
+    // wrong elements with correct row sums
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n + 1 < N; n += 2)
+        {
+            c_m_n(m, n) += 1.f;
+            c_m_n(m, n + 1) -= 1.f;
+        }
+    }
+
+    EXPECT_TRUE(ck::utils::check_row_sums(
+        c_m_n, ck::utils::get_gemm_reference_row_sums(a_m_k, b_k_n)));
+    EXPECT_FALSE(CheckSampled(c_m_n));
+}
+
+TEST(ReferenceConvFwd, RunElementMatchesRun)
+{
+    using InLayout  = ck::tensor_layout::convolution::GNHWC;
+    using WeiLayout = ck::tensor_layout::convolution::GKYXC;
+    using OutLayout = ck::tensor_layout::convolution::GNHWK;
+
+    const ck::utils::conv::ConvParam conv_param{
+        2, 2, 3, 5, 4, {3, 2}, {9, 7}, {2, 1}, {1, 2}, {1, 0}, {0, 1}};
+
+    Tensor<float> in(
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param));
+    Tensor<float> wei(
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(
+            conv_param));
+    Tensor<float> out(
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(
+            conv_param));
+    Tensor<float> out_at(out.mDesc);
+
+    ck::utils::FillUniformDistributionIntegerValue<float>{-3.f, 3.f}(in);
+    ck::utils::FillUniformDistributionIntegerValue<float>{-3.f, 3.f}(wei);
+
+    using ReferenceConvFwdInstance = ck::tensor_operation::host::
+        ReferenceConvFwd<2, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    auto make_argument = [&](Tensor<float>& output) {
+        return ReferenceConvFwdInstance{}.MakeArgument(in,
+                                                       wei,
+                                                       output,
+                                                       conv_param.conv_filter_strides_,
+                                                       conv_param.conv_filter_dilations_,
+                                                       conv_param.input_left_pads_,
+                                                       conv_param.input_right_pads_,
+                                                       PassThrough{},
+                                                       PassThrough{},
+                                                       PassThrough{});
+    };
+
+    auto ref_argument    = make_argument(out);
+    auto ref_argument_at = make_argument(out_at);
+
+    ReferenceConvFwdInstance{}.MakeInvoker().Run(ref_argument);
+
+    out_at.ForEach([&](auto&, const auto& idx) {
+        ReferenceConvFwdInstance::Invoker::RunElement(
+            ref_argument_at, idx[0], idx[1], idx[2], idx[3], idx[4]);
+    });
+
+    EXPECT_TRUE(ck::utils::check_err(out_at, out));
+}
+
+TEST(ReferenceReduce, RunElementMatchesRun)
+{
+    constexpr ck::ReduceTensorOp ReduceOpId = ck::ReduceTensorOp::MAX;
+
+    using ReduceOperation = ck::reduce_binary_operator<ReduceOpId>::opType;
+    using InElementwiseOperation =
+        ck::reduce_unary_operator<ReduceOpId, true, true>::InElementwiseOperation;
+    using AccElementwiseOperation =
+        ck::reduce_unary_operator<ReduceOpId, true, true>::AccElementwiseOperation;
+
+    using ReferenceReduceInstance =
+        ck::tensor_operation::host::ReferenceReduce<float,
+                                                    float,
+                                                    float,
+                                                    3,
+                                                    2,
+                                                    ReduceOperation,
+                                                    InElementwiseOperation,
+                                                    AccElementwiseOperation,
+                                                    false,
+                                                    true>;
+
+    // reduce the dimensions 0 and 2 of a [7, 5, 11] tensor
+    Tensor<float> in(std::vector<std::size_t>{7, 5, 11});
+    Tensor<float> out(std::vector<std::size_t>{5});
+    Tensor<float> out_at(std::vector<std::size_t>{5});
+    Tensor<int32_t> out_index(std::vector<std::size_t>{5});
+    Tensor<int32_t> out_index_at(std::vector<std::size_t>{5});
+
+    ck::utils::FillUniformDistributionIntegerValue<float>{-50.f, 50.f}(in);
+
+    auto make_argument = [&](Tensor<float>& output, Tensor<int32_t>& output_index) {
+        return ReferenceReduceInstance::Argument{{7, 5, 11},
+                                                 {55, 11, 1},
+                                                 {5},
+                                                 {1},
+                                                 {0, 2},
+                                                 1.0,
+                                                 0.0,
+                                                 in.mData.data(),
+                                                 output.mData.data(),
+                                                 output_index.mData.data(),
+                                                 InElementwiseOperation{},
+                                                 AccElementwiseOperation{}};
+    };
+
+    auto ref_argument    = make_argument(out, out_index);
+    auto ref_argument_at = make_argument(out_at, out_index_at);
+
+    ReferenceReduceInstance::Invoker{}.Run(ref_argument);
+
+    for(ck::index_t i = 0; i < 5; ++i)
+    {
+        ReferenceReduceInstance::Invoker::RunElement(ref_argument_at, {i});
+    }
+
+    EXPECT_TRUE(ck::utils::check_err(out_at, out));
+    EXPECT_TRUE(ck::utils::check_err(out_index_at, out_index));
+}
+
+TEST(ReferenceLayernorm, RunRowMatchesRun)
+{
+    using ReferenceLayernormInstance = ck::tensor_operation::host::
+        ReferenceLayernorm<float, float, float, float, float, float, PassThrough, 3, 2>;
+
+    // normalize the dimensions 1 and 2 of a [6, 9, 13] tensor
+    Tensor<float> x(std::vector<std::size_t>{6, 9, 13});
+    Tensor<float> gamma(std::vector<std::size_t>{9, 13});
+    Tensor<float> beta(std::vector<std::size_t>{9, 13});
+    Tensor<float> y(x.mDesc);
+    Tensor<float> y_at(x.mDesc);
+    Tensor<float> save_mean(std::vector<std::size_t>{6});
+    Tensor<float> save_mean_at(std::vector<std::size_t>{6});
+    Tensor<float> save_inv_std(std::vector<std::size_t>{6});
+    Tensor<float> save_inv_std_at(std::vector<std::size_t>{6});
+
+    ck::utils::FillUniformDistributionIntegerValue<float>{-5.f, 5.f}(x);
+    ck::utils::FillUniformDistributionIntegerValue<float>{-5.f, 5.f}(gamma);
+    ck::utils::FillUniformDistributionIntegerValue<float>{-5.f, 5.f}(beta);
+
+    auto make_argument = [&](Tensor<float>& output, Tensor<float>& mean, Tensor<float>& inv_std) {
+        return ReferenceLayernormInstance{}.MakeArgument(
+            x, gamma, beta, output, mean, inv_std, PassThrough{}, {6, 9, 13}, {1, 2}, 1e-4f);
+    };
+
+    auto ref_argument    = make_argument(y, save_mean, save_inv_std);
+    auto ref_argument_at = make_argument(y_at, save_mean_at, save_inv_std_at);
+
+    ReferenceLayernormInstance{}.MakeInvoker().Run(ref_argument);
+
+    for(std::size_t m = 0; m < 6; ++m)
+    {
+        ReferenceLayernormInstance::Invoker::RunRow(ref_argument_at,
+                                                    std::vector<std::size_t>{m, 0, 0});
+    }
+
+    EXPECT_TRUE(ck::utils::check_err(y_at, y));
+    EXPECT_TRUE(ck::utils::check_err(save_mean_at, save_mean));
+    EXPECT_TRUE(ck::utils::check_err(save_inv_std_at, save_inv_std));
+}
+
+TEST(ReferenceGroupnorm, RunRowMatchesRun)
+{
+    using ReferenceGroupnormInstance = ck::tensor_operation::host::
+        ReferenceGroupnorm<float, float, float, float, float, float, PassThrough>;
+
+    // N, H, W, G, C
+    const std::vector<ck::index_t> lengths{3, 5, 7, 4, 6};
+
+    Tensor<float> x(std::vector<std::size_t>{3, 5, 7, 4, 6});
+    Tensor<float> gamma(std::vector<std::size_t>{4, 6});
+    Tensor<float> beta(std::vector<std::size_t>{4, 6});
+    Tensor<float> y(x.mDesc);
+    Tensor<float> y_at(x.mDesc);
+    Tensor<float> save_mean(std::vector<std::size_t>{3, 4});
+    Tensor<float> save_mean_at(std::vector<std::size_t>{3, 4});
+    Tensor<float> save_inv_std(std::vector<std::size_t>{3, 4});
+    Tensor<float> save_inv_std_at(std::vector<std::size_t>{3, 4});
+
+    ck::utils::FillUniformDistributionIntegerValue<float>{-5.f, 5.f}(x);
+    ck::utils::FillUniformDistributionIntegerValue<float>{-5.f, 5.f}(gamma);
+    ck::utils::FillUniformDistributionIntegerValue<float>{-5.f, 5.f}(beta);
+
+    auto make_argument = [&](Tensor<float>& output, Tensor<float>& mean, Tensor<float>& inv_std) {
+        return ReferenceGroupnormInstance{}.MakeArgument(
+            x, gamma, beta, output, mean, inv_std, PassThrough{}, lengths, 1e-6f);
+    };
+
+    auto ref_argument    = make_argument(y, save_mean, save_inv_std);
+    auto ref_argument_at = make_argument(y_at, save_mean_at, save_inv_std_at);
+
+    ReferenceGroupnormInstance{}.MakeInvoker().Run(ref_argument);
+
+    for(std::size_t n = 0; n < 3; ++n)
+    {
+        for(std::size_t g = 0; g < 4; ++g)
+        {
+            ReferenceGroupnormInstance::Invoker::RunRow(ref_argument_at,
+                                                        std::vector<std::size_t>{n, 0, 0, g, 0});
+        }
+    }
+
+    EXPECT_TRUE(ck::utils::check_err(y_at, y));
+    EXPECT_TRUE(ck::utils::check_err(save_mean_at, save_mean));
+    EXPECT_TRUE(ck::utils::check_err(save_inv_std_at, save_inv_std));
+}
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <type_traits>
+#include <gtest/gtest.h>
+
+#include "ck/utility/common_header.hpp"
+
+using namespace ck;
+
+namespace {
+using Values = Sequence<5, 3, 3, 9, 1, 5, 0, 7, 3, 2, 8, 8, 4>;
+using Map    = Sequence<3, 0, 4, 1, 2>;
+
+struct Greater
+{
+    __host__ __device__ constexpr bool operator()(index_t x, index_t y) const { return x > y; }
+};
+} // namespace
+
+TEST(TestSequence, Generate)
+{
+    using seq0 = typename arithmetic_sequence_gen<3, 17, 3>::type;
+    using seq1 = typename arithmetic_sequence_gen<17, 3, -4>::type;
+    using seq2 = typename arithmetic_sequence_gen<3, 1, 1>::type;
+    using seq3 = typename arithmetic_sequence_gen<0, 4, 1>::type;
+    EXPECT_TRUE((is_same_v<seq0, Sequence<3, 6, 9, 12>>));
+    EXPECT_TRUE((is_same_v<seq1, Sequence<17, 13, 9>>));
+    EXPECT_TRUE((is_same_v<seq2, Sequence<>>));
+    EXPECT_TRUE((is_same_v<seq3, Sequence<0, 1, 2, 3>>));
+    EXPECT_TRUE((is_same_v<make_index_sequence<0>, Sequence<>>));
+    EXPECT_TRUE((is_same_v<typename uniform_sequence_gen<3, 7>::type, Sequence<7, 7, 7>>));
+}
+
+TEST(TestSequence, ReverseSplitModify)
+{
+    EXPECT_TRUE((is_same_v<decltype(Values::Reverse()),
+                           Sequence<4, 8, 8, 2, 3, 7, 0, 5, 1, 9, 3, 3, 5>>));
+    EXPECT_TRUE((is_same_v<decltype(Sequence<>::Reverse()), Sequence<>>));
+    EXPECT_TRUE((is_same_v<decltype(Values::PopBack()),
+                           Sequence<5, 3, 3, 9, 1, 5, 0, 7, 3, 2, 8, 8>>));
+    using split = sequence_split<Values, 5>;
+    EXPECT_TRUE((is_same_v<typename split::left_type, Sequence<5, 3, 3, 9, 1>>));
+    EXPECT_TRUE((is_same_v<typename split::right_type, Sequence<5, 0, 7, 3, 2, 8, 8, 4>>));
+    EXPECT_TRUE((is_same_v<decltype(Map::Modify(Number<2>{}, Number<100>{})),
+                           Sequence<3, 0, 100, 1, 2>>));
+    EXPECT_TRUE((is_same_v<decltype(modify_sequence_elements_by_ids(
+                               Map{}, Sequence<10, 11, 12>{}, Sequence<2, 4, 2>{})),
+                           Sequence<3, 0, 12, 1, 11>>));
+    EXPECT_TRUE((is_same_v<decltype(pick_sequence_elements_by_mask(
+                               Map{}, Sequence<1, 0, 1, 1, 0>{})),
+                           Sequence<3, 4, 1>>));
+}
+
+TEST(TestSequence, Sort)
+{
+    using sort = sequence_sort<Values, math::less<index_t>>;
+    EXPECT_TRUE(
+        (is_same_v<typename sort::type, Sequence<0, 1, 2, 3, 3, 3, 4, 5, 5, 7, 8, 8, 9>>));
+    // order of equal values is the same as in the recursive merge sort
+    EXPECT_TRUE((is_same_v<typename sort::sorted2unsorted_map,
+                           Sequence<6, 4, 9, 8, 2, 1, 12, 5, 0, 7, 11, 10, 3>>));
+
+    // merging always compares with operator<, only length 2 ranges are ordered by Compare
+    using sort_greater = sequence_sort<Values, Greater>;
+    EXPECT_TRUE(
+        (is_same_v<typename sort_greater::type, Sequence<0, 3, 3, 5, 1, 5, 7, 3, 8, 4, 8, 2, 9>>));
+
+    using unique_sort = sequence_unique_sort<Values, math::less<index_t>, math::equal<index_t>>;
+    EXPECT_TRUE((is_same_v<typename unique_sort::type, Sequence<0, 1, 2, 3, 4, 5, 7, 8, 9>>));
+    EXPECT_TRUE((is_same_v<typename unique_sort::sorted2unsorted_map,
+                           Sequence<6, 4, 9, 8, 12, 5, 7, 11, 3>>));
+
+    EXPECT_TRUE((is_same_v<typename sequence_sort<Sequence<>, math::less<index_t>>::type,
+                           Sequence<>>));
+}
+
+TEST(TestSequence, Map)
+{
+    EXPECT_TRUE(is_valid_sequence_map<Map>::value);
+    EXPECT_FALSE(is_valid_sequence_map<Values>::value);
+    EXPECT_FALSE((is_valid_sequence_map<Sequence<0, 0>>::value));
+    EXPECT_FALSE((is_valid_sequence_map<Sequence<0, 2>>::value));
+    EXPECT_TRUE((is_same_v<typename sequence_map_inverse<Map>::type, Sequence<1, 3, 4, 0, 2>>));
+    EXPECT_TRUE((is_same_v<decltype(Map::ReorderGivenOld2New(Sequence<1, 2, 0, 4, 3>{})),
+                           Sequence<4, 3, 0, 2, 1>>));
+}
+
+TEST(TestSequence, ScanReduce)
+{
+    EXPECT_TRUE((is_same_v<decltype(reverse_inclusive_scan_sequence(
+                               Map{}, math::plus<index_t>{}, Number<1>{})),
+                           Sequence<11, 8, 8, 4, 3>>));
+    EXPECT_TRUE((is_same_v<decltype(reverse_exclusive_scan_sequence(
+                               Map{}, math::multiplies{}, Number<1>{})),
+                           Sequence<0, 8, 2, 2, 1>>));
+    EXPECT_TRUE((is_same_v<decltype(inclusive_scan_sequence(
+                               Map{}, math::plus<index_t>{}, Number<0>{})),
+                           Sequence<3, 3, 7, 8, 10>>));
+    EXPECT_TRUE((is_same_v<typename sequence_reduce<math::minus<index_t>,
+                                                    Map,
+                                                    Map,
+                                                    Sequence<1, 2, 3, 4, 5>>::type,
+                           Sequence<1, 2, 3, 4, 5>>));
+    EXPECT_TRUE((is_same_v<typename sequence_reduce<math::minus<index_t>,
+                                                    Map,
+                                                    Sequence<1, 2, 3, 4, 5>>::type,
+                           Sequence<2, -2, 1, -3, -3>>));
+}
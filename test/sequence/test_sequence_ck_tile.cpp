@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <type_traits>
+#include <gtest/gtest.h>
+
+#include "ck_tile/core.hpp"
+
+using namespace ck_tile;
+using std::is_same_v;
+
+namespace {
+using Values = sequence<5, 3, 3, 9, 1, 5, 0, 7, 3, 2, 8, 8, 4>;
+using Map    = sequence<3, 0, 4, 1, 2>;
+
+struct Greater
+{
+    CK_TILE_HOST_DEVICE constexpr bool operator()(index_t x, index_t y) const { return x > y; }
+};
+} // namespace
+
+TEST(TestSequenceCkTile, Generate)
+{
+    using seq0 = typename arithmetic_sequence_gen<3, 17, 3>::type;
+    using seq1 = typename arithmetic_sequence_gen<17, 3, -4>::type;
+    using seq2 = typename arithmetic_sequence_gen<3, 1, 1>::type;
+    using seq3 = typename arithmetic_sequence_gen<0, 4, 1>::type;
+    EXPECT_TRUE((is_same_v<seq0, sequence<3, 6, 9, 12>>));
+    EXPECT_TRUE((is_same_v<seq1, sequence<17, 13, 9>>));
+    EXPECT_TRUE((is_same_v<seq2, sequence<>>));
+    EXPECT_TRUE((is_same_v<seq3, sequence<0, 1, 2, 3>>));
+    EXPECT_TRUE((is_same_v<make_index_sequence<0>, sequence<>>));
+    EXPECT_TRUE((is_same_v<typename uniform_sequence_gen<3, 7>::type, sequence<7, 7, 7>>));
+}
+
+TEST(TestSequenceCkTile, ReverseSplitModify)
+{
+    EXPECT_TRUE((is_same_v<decltype(Values::reverse()),
+                           sequence<4, 8, 8, 2, 3, 7, 0, 5, 1, 9, 3, 3, 5>>));
+    EXPECT_TRUE((is_same_v<decltype(sequence<>::reverse()), sequence<>>));
+    EXPECT_TRUE((is_same_v<decltype(Values::pop_back()),
+                           sequence<5, 3, 3, 9, 1, 5, 0, 7, 3, 2, 8, 8>>));
+    using split = sequence_split<Values, 5>;
+    EXPECT_TRUE((is_same_v<typename split::left_type, sequence<5, 3, 3, 9, 1>>));
+    EXPECT_TRUE((is_same_v<typename split::right_type, sequence<5, 0, 7, 3, 2, 8, 8, 4>>));
+    EXPECT_TRUE((is_same_v<decltype(Map::modify(number<2>{}, number<100>{})),
+                           sequence<3, 0, 100, 1, 2>>));
+    EXPECT_TRUE((is_same_v<decltype(modify_sequence_elements_by_ids(
+                               Map{}, sequence<10, 11, 12>{}, sequence<2, 4, 2>{})),
+                           sequence<3, 0, 12, 1, 11>>));
+    EXPECT_TRUE((is_same_v<decltype(pick_sequence_elements_by_mask(
+                               Map{}, sequence<1, 0, 1, 1, 0>{})),
+                           sequence<3, 4, 1>>));
+}
+
+TEST(TestSequenceCkTile, Sort)
+{
+    using sort = sequence_sort<Values, less<index_t>>;
+    EXPECT_TRUE(
+        (is_same_v<typename sort::type, sequence<0, 1, 2, 3, 3, 3, 4, 5, 5, 7, 8, 8, 9>>));
+    // order of equal values is the same as in the recursive merge sort
+    EXPECT_TRUE((is_same_v<typename sort::sorted2unsorted_map,
+                           sequence<6, 4, 9, 8, 2, 1, 12, 5, 0, 7, 11, 10, 3>>));
+
+    // merging always compares with operator<, only length 2 ranges are ordered by Compare
+    using sort_greater = sequence_sort<Values, Greater>;
+    EXPECT_TRUE(
+        (is_same_v<typename sort_greater::type, sequence<0, 3, 3, 5, 1, 5, 7, 3, 8, 4, 8, 2, 9>>));
+
+    using unique_sort = sequence_unique_sort<Values, less<index_t>, equal<index_t>>;
+    EXPECT_TRUE((is_same_v<typename unique_sort::type, sequence<0, 1, 2, 3, 4, 5, 7, 8, 9>>));
+    EXPECT_TRUE((is_same_v<typename unique_sort::sorted2unsorted_map,
+                           sequence<6, 4, 9, 8, 12, 5, 7, 11, 3>>));
+
+    EXPECT_TRUE((is_same_v<typename sequence_sort<sequence<>, less<index_t>>::type,
+                           sequence<>>));
+}
+
+TEST(TestSequenceCkTile, Map)
+{
+    EXPECT_TRUE(is_valid_sequence_map<Map>::value);
+    EXPECT_FALSE(is_valid_sequence_map<Values>::value);
+    EXPECT_FALSE((is_valid_sequence_map<sequence<0, 0>>::value));
+    EXPECT_FALSE((is_valid_sequence_map<sequence<0, 2>>::value));
+    EXPECT_TRUE((is_same_v<typename sequence_map_inverse<Map>::type, sequence<1, 3, 4, 0, 2>>));
+    EXPECT_TRUE((is_same_v<decltype(Map::reorder_old_to_new(sequence<1, 2, 0, 4, 3>{})),
+                           sequence<4, 3, 0, 2, 1>>));
+}
+
+TEST(TestSequenceCkTile, ScanReduce)
+{
+    EXPECT_TRUE((is_same_v<decltype(reverse_inclusive_scan_sequence(
+                               Map{}, plus<index_t>{}, number<1>{})),
+                           sequence<11, 8, 8, 4, 3>>));
+    EXPECT_TRUE((is_same_v<decltype(reverse_exclusive_scan_sequence(
+                               Map{}, multiplies<index_t>{}, number<1>{})),
+                           sequence<0, 8, 2, 2, 1>>));
+    EXPECT_TRUE((is_same_v<decltype(inclusive_scan_sequence(
+                               Map{}, plus<index_t>{}, number<0>{})),
+                           sequence<3, 3, 7, 8, 10>>));
+    EXPECT_TRUE((is_same_v<typename sequence_reduce<minus<index_t>,
+                                                    Map,
+                                                    Map,
+                                                    sequence<1, 2, 3, 4, 5>>::type,
+                           sequence<1, 2, 3, 4, 5>>));
+    EXPECT_TRUE((is_same_v<typename sequence_reduce<minus<index_t>,
+                                                    Map,
+                                                    sequence<1, 2, 3, 4, 5>>::type,
+                           sequence<2, -2, 1, -3, -3>>));
+    EXPECT_TRUE((is_same_v<decltype(exclusive_scan_sequence(Map{}, plus<index_t>{}, number<0>{})),
+                           sequence<0, 3, 3, 7, 8>>));
+    EXPECT_TRUE((is_same_v<decltype(prefix_sum_sequence(Map{})), sequence<0, 3, 3, 7, 8, 10>>));
+}
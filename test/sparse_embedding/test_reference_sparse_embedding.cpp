@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_sparse_embedding3_forward_layernorm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_sparse_embeddings_forward_layernorm.hpp"
+
+namespace {
+
+// mean pooling of 2 tables
+struct Mean2
+{
+    template <typename E, typename A, typename B>
+    void operator()(E& e, const A& a, const B& b) const
+    {
+        e = (a + b) / 2;
+    }
+};
+
+constexpr std::size_t NumRows = 53;
+constexpr std::size_t Dim     = 300;
+constexpr std::size_t Length  = 77;
+constexpr float Epsilon       = 1e-5f;
+
+class TestReferenceSparseEmbedding : public ::testing::Test
+{
+    protected:
+    void SetUp() override
+    {
+        std::mt19937 gen(0);
+        std::uniform_real_distribution<float> dis(-1.f, 1.f);
+
+        // an offset large compared to the spread of the rows, for the precision of the variance
+        for(auto* emb : {&emb_a, &emb_b, &emb_c})
+        {
+            for(auto& x : emb->mData)
+            {
+                x = 100.f + dis(gen);
+            }
+        }
+        for(auto* index : {&index_a, &index_b, &index_c})
+        {
+            for(auto& i : index->mData)
+            {
+                i = static_cast<int64_t>(gen() % NumRows);
+            }
+        }
+        for(auto* t : {&gamma, &beta})
+        {
+            for(auto& x : t->mData)
+            {
+                x = dis(gen);
+            }
+        }
+    }
+
+    // max error of out against the layernorm of the rows pooled by pool, computed in double
+    template <typename Pool>
+    double GetMaxError(Pool pool) const
+    {
+        double max_err = 0;
+        for(std::size_t l = 0; l < Length; ++l)
+        {
+            std::vector<double> x(Dim);
+            double mean = 0;
+            for(std::size_t d = 0; d < Dim; ++d)
+            {
+                x[d] = pool(l, d);
+                mean += x[d];
+            }
+            mean /= Dim;
+
+            double var = 0;
+            for(std::size_t d = 0; d < Dim; ++d)
+            {
+                var += (x[d] - mean) * (x[d] - mean);
+            }
+            var /= Dim;
+
+            for(std::size_t d = 0; d < Dim; ++d)
+            {
+                const double y = (x[d] - mean) / std::sqrt(var + Epsilon) * gamma(d) + beta(d);
+                max_err        = std::max(max_err, std::abs(y - out(l, d)));
+            }
+        }
+        return max_err;
+    }
+
+    Tensor<float> emb_a = Tensor<float>(std::vector<std::size_t>{NumRows, Dim});
+    Tensor<float> emb_b = Tensor<float>(std::vector<std::size_t>{NumRows, Dim});
+    Tensor<float> emb_c = Tensor<float>(std::vector<std::size_t>{NumRows, Dim});
+
+    Tensor<int64_t> index_a = Tensor<int64_t>(std::vector<std::size_t>{Length});
+    Tensor<int64_t> index_b = Tensor<int64_t>(std::vector<std::size_t>{Length});
+    Tensor<int64_t> index_c = Tensor<int64_t>(std::vector<std::size_t>{Length});
+
+    Tensor<float> gamma = Tensor<float>(std::vector<std::size_t>{Dim});
+    Tensor<float> beta  = Tensor<float>(std::vector<std::size_t>{Dim});
+    Tensor<float> out   = Tensor<float>(std::vector<std::size_t>{Length, Dim});
+};
+
+} // namespace
+
+TEST_F(TestReferenceSparseEmbedding, Sum3)
+{
+    using ReferenceInstance = ck::tensor_operation::host::
+        ReferenceSparseEmbedding3ForwardLayernorm<float, int64_t, float, float, float, float>;
+
+    auto ref_argument = ReferenceInstance::MakeArgument(out,
+                                                        emb_a,
+                                                        emb_b,
+                                                        emb_c,
+                                                        index_a,
+                                                        index_b,
+                                                        index_c,
+                                                        gamma,
+                                                        beta,
+                                                        NumRows,
+                                                        Dim,
+                                                        Length,
+                                                        Epsilon);
+    ReferenceInstance::MakeInvoker().Run(ref_argument);
+
+    EXPECT_LT(GetMaxError([&](std::size_t l, std::size_t d) {
+                  return double{emb_a(index_a(l), d)} + emb_b(index_b(l), d) +
+                         emb_c(index_c(l), d);
+              }),
+              1e-3);
+}
+
+TEST_F(TestReferenceSparseEmbedding, Mean2)
+{
+    using ReferenceInstance = ck::tensor_operation::host::ReferenceSparseEmbeddingsForwardLayernorm<
+        float, int64_t, float, float, float, float, Mean2, 2>;
+
+    auto ref_argument = ReferenceInstance::MakeArgument(
+        out, {&emb_a, &emb_b}, {&index_a, &index_b}, gamma, beta, Epsilon);
+    ReferenceInstance::MakeInvoker().Run(ref_argument);
+
+    EXPECT_LT(GetMaxError([&](std::size_t l, std::size_t d) {
+                  return (double{emb_a(index_a(l), d)} + emb_b(index_b(l), d)) / 2;
+              }),
+              1e-3);
+}
+
+TEST_F(TestReferenceSparseEmbedding, IndexOutOfRange)
+{
+    using ReferenceInstance = ck::tensor_operation::host::ReferenceSparseEmbeddingsForwardLayernorm<
+        float, int64_t, float, float, float, float, Mean2, 2>;
+
+    index_b(5) = NumRows;
+
+    auto ref_argument = ReferenceInstance::MakeArgument(
+        out, {&emb_a, &emb_b}, {&index_a, &index_b}, gamma, beta, Epsilon);
+    EXPECT_THROW(ReferenceInstance::MakeInvoker().Run(ref_argument), std::runtime_error);
+}
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "ck/host_utility/timing_statistics.hpp"
+
+using ck::AdaptiveTimingSampler;
+using ck::TimingStatistics;
+
+namespace {
+
+// kernel times around time_ms with a relative noise, a fraction of them is preempted
+struct SyntheticTimes
+{
+    SyntheticTimes(float time_ms, float noise, float outlier_rate, unsigned seed)
+        : gen(seed),
+          normal(time_ms, noise * time_ms),
+          uniform(0.f, 1.f),
+          outlier_rate_(outlier_rate)
+    {
+    }
+
+    float operator()()
+    {
+        const float time = normal(gen);
+        return uniform(gen) < outlier_rate_ ? 5.f * time : time;
+    }
+
+    std::mt19937 gen;
+    std::normal_distribution<float> normal;
+    std::uniform_real_distribution<float> uniform;
+    float outlier_rate_;
+};
+
+} // namespace
+
+TEST(TimingStatistics, OutliersAreRejected)
+{
+    SyntheticTimes times(2.f, 0.01f, 0.05f, 1);
+
+    std::vector<float> samples(1000);
+    for(auto& sample : samples)
+    {
+        sample = times();
+    }
+
+    const TimingStatistics statistics = ck::compute_timing_statistics(samples);
+
+    EXPECT_NEAR(statistics.median_ms, 2.f, 0.01f);
+    EXPECT_NEAR(statistics.mean_ms, 2.f, 0.01f);
+    EXPECT_NEAR(statistics.p90_ms, 2.f * (1.f + 1.2816f * 0.01f), 0.01f);
+    EXPECT_GT(statistics.num_outliers, 30);
+    EXPECT_LT(statistics.num_outliers, 70);
+    EXPECT_EQ(statistics.num_samples + statistics.num_outliers, 1000);
+    EXPECT_LE(statistics.ci_low_ms, statistics.median_ms);
+    EXPECT_GE(statistics.ci_high_ms, statistics.median_ms);
+}
+
+TEST(TimingStatistics, ConfidenceIntervalCoversMedian)
+{
+    // the 95% confidence interval should contain the true median in about 95% of the streams
+    int num_covered = 0;
+    for(unsigned seed = 0; seed < 400; ++seed)
+    {
+        SyntheticTimes times(1.f, 0.05f, 0.f, seed);
+
+        std::vector<float> samples(50);
+        for(auto& sample : samples)
+        {
+            sample = times();
+        }
+
+        const TimingStatistics statistics = ck::compute_timing_statistics(samples);
+        num_covered += statistics.ci_low_ms <= 1.f && 1.f <= statistics.ci_high_ms;
+    }
+
+    EXPECT_GT(num_covered, 360);
+}
+
+TEST(TimingStatistics, SamplerConvergesOrSpendsBudget)
+{
+    // low noise: converges long before the budget
+    {
+        SyntheticTimes times(0.01f, 0.02f, 0.02f, 2);
+        AdaptiveTimingSampler sampler(0.01f, 1000.f);
+
+        while(!sampler.IsDone())
+        {
+            sampler.AddSample(times());
+        }
+
+        EXPECT_TRUE(sampler.IsConverged());
+        EXPECT_LT(sampler.GetSamples().size(), 200u);
+        EXPECT_NEAR(sampler.GetStatistics().median_ms, 0.01f, 0.0002f);
+    }
+
+    // long noisy kernel: stops at the budget
+    {
+        SyntheticTimes times(100.f, 0.5f, 0.f, 3);
+        AdaptiveTimingSampler sampler(0.001f, 1000.f);
+
+        while(!sampler.IsDone())
+        {
+            sampler.AddSample(times());
+        }
+
+        EXPECT_FALSE(sampler.IsConverged());
+        EXPECT_GE(sampler.GetElapsedTime(), 1000.f);
+        EXPECT_LT(sampler.GetElapsedTime(), 1000.f + 300.f);
+    }
+}
+
+TEST(TimingStatistics, RankingDetectsTies)
+{
+    auto make_statistics = [](float median, float half_width) {
+        TimingStatistics statistics;
+        statistics.median_ms  = median;
+        statistics.ci_low_ms  = median - half_width;
+        statistics.ci_high_ms = median + half_width;
+        return statistics;
+    };
+
+    const std::vector<TimingStatistics> statistics = {make_statistics(1.10f, 0.01f),
+                                                      make_statistics(1.00f, 0.02f),
+                                                      make_statistics(1.03f, 0.02f),
+                                                      make_statistics(1.50f, 0.01f),
+                                                      make_statistics(1.11f, 0.005f)};
+
+    const std::vector<int> ranks = ck::rank_timing_statistics(statistics);
+
+    EXPECT_EQ(ranks, (std::vector<int>{3, 1, 1, 5, 3}));
+}
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -325,14 +325,14 @@ struct TestWmma
         Tensor<CDataType> c_m_n_device_result(
             f_host_tensor_descriptor(params.M, params.N, params.StrideC, CLayout{}));
 
-        auto f_generate_tensor_value = [](auto& tensor, auto type) {
+        auto f_generate_tensor_value = [](auto& tensor, auto type, unsigned int seed) {
             using dataType = decltype(type);
 
-            tensor.GenerateTensorValue(GeneratorTensor_2<dataType>{-5, 5});
+            tensor.GenerateTensorValue(GeneratorTensor_2<dataType>{-5, 5, seed});
         };
 
-        f_generate_tensor_value(a_m_k, ADataType{});
-        f_generate_tensor_value(b_n_k, BDataType{});
+        f_generate_tensor_value(a_m_k, ADataType{}, 1);
+        f_generate_tensor_value(b_n_k, BDataType{}, 2);
 
         return std::make_tuple(a_m_k, b_n_k, c_m_n_host_result, c_m_n_device_result);
     }
@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <numeric>
+#include <cstdlib>
+#include <iostream>
+#include <initializer_list>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/utility/common_header.hpp"
+#include "ck/wrapper/layout.hpp"
+#include "ck/wrapper/tensor.hpp"
+#include "ck/wrapper/operations/host/copy.hpp"
+#include "ck/wrapper/operations/host/gemm.hpp"
+#include "ck/wrapper/utils/host_launch.hpp"
+
+// Test copy from Global to Global through local buffer and VGPR (host version of
+// test_wrapper_copy)
+TEST(TestHostCopy, GlobalToGlobalViaLocalAndRegisters)
+{
+    const auto shape =
+        ck::make_tuple(ck::make_tuple(ck::Number<2>{}, ck::Number<2>{}), ck::Number<256>{});
+    const auto strides =
+        ck::make_tuple(ck::make_tuple(ck::Number<1>{}, ck::Number<2>{}), ck::Number<4>{});
+    const auto layout = ck::wrapper::make_layout(shape, strides);
+
+    // 0, 1, 2, ..., size(shape) - 1
+    std::vector<ck::index_t> input_data(ck::wrapper::size(shape));
+    std::iota(input_data.begin(), input_data.end(), 0);
+    std::vector<ck::index_t> output_data(ck::wrapper::size(shape), 0);
+
+    const auto input_tensor = ck::wrapper::make_tensor<ck::wrapper::MemoryTypeEnum::Generic>(
+        static_cast<const ck::index_t*>(input_data.data()), layout);
+    auto output_tensor = ck::wrapper::make_tensor<ck::wrapper::MemoryTypeEnum::Generic>(
+        output_data.data(), layout);
+
+    const auto thread_layout =
+        ck::wrapper::make_layout(ck::make_tuple(ck::Number<1>{}, ck::Number<32>{}));
+    const auto tile_shape = ck::make_tuple(ck::Number<4>{}, ck::Number<64>{});
+
+    const ck::index_t grid_size_x = ck::math::integer_divide_ceil(
+        ck::wrapper::size<0>(input_tensor), ck::wrapper::size<0>(tile_shape));
+    const ck::index_t grid_size_y = ck::math::integer_divide_ceil(
+        ck::wrapper::size<1>(input_tensor), ck::wrapper::size<1>(tile_shape));
+
+    auto kernel = [&](ck::index_t block_idx_x, ck::index_t block_idx_y) {
+        std::vector<ck::index_t> local_buf(ck::wrapper::size(tile_shape));
+        const auto tensor_local = ck::wrapper::make_tensor<ck::wrapper::MemoryTypeEnum::Generic>(
+            local_buf.data(), ck::wrapper::make_layout(tile_shape));
+
+        const auto block_idxs = ck::make_tuple(block_idx_x, block_idx_y);
+        const auto input_local_tile =
+            ck::wrapper::make_local_tile(input_tensor, tile_shape, block_idxs);
+        const auto output_local_tile =
+            ck::wrapper::make_local_tile(output_tensor, tile_shape, block_idxs);
+
+        ck::wrapper::host::for_each_thread(
+            ck::wrapper::size(thread_layout), [&](ck::index_t thread_id) {
+                const auto input_local_partition =
+                    ck::wrapper::make_local_partition(input_local_tile, thread_layout, thread_id);
+                auto local_partition =
+                    ck::wrapper::make_local_partition(tensor_local, thread_layout, thread_id);
+                auto output_local_partition =
+                    ck::wrapper::make_local_partition(output_local_tile, thread_layout, thread_id);
+
+                auto tensor_vgpr =
+                    ck::wrapper::make_register_tensor<ck::wrapper::MemoryTypeEnum::Vgpr,
+                                                      ck::index_t>(
+                        ck::wrapper::make_layout(ck::wrapper::shape(local_partition)));
+
+                ck::wrapper::host::copy(input_local_partition, local_partition);
+                ck::wrapper::host::copy(local_partition, tensor_vgpr);
+                ck::wrapper::host::copy(tensor_vgpr, output_local_partition);
+            });
+    };
+    ck::wrapper::host::launch_and_time_kernel(StreamConfig{}, kernel, grid_size_x, grid_size_y);
+
+    EXPECT_TRUE(ck::utils::check_err(output_data, input_data));
+}
+
+// Test strided copy with layout change and type conversion
+TEST(TestHostCopy, StridedTransposeAndConvert)
+{
+    constexpr ck::index_t M = 37;
+    constexpr ck::index_t N = 45;
+
+    std::vector<ck::index_t> input_data(M * N);
+    std::iota(input_data.begin(), input_data.end(), 0);
+    std::vector<float> output_data(M * N, 0);
+
+    // Row-major input, column-major output
+    auto input_tensor = ck::wrapper::make_tensor<ck::wrapper::MemoryTypeEnum::Generic>(
+        static_cast<const ck::index_t*>(input_data.data()),
+        ck::wrapper::make_layout(ck::make_tuple(M, N), ck::make_tuple(N, 1)));
+    auto output_tensor = ck::wrapper::make_tensor<ck::wrapper::MemoryTypeEnum::Generic>(
+        output_data.data(), ck::wrapper::make_layout(ck::make_tuple(M, N), ck::make_tuple(1, M)));
+
+    // Copy left and right columns through sliced tensors
+    const auto left_cols  = ck::make_tuple(ck::wrapper::slice(), ck::wrapper::slice(0, N / 2));
+    const auto right_cols = ck::make_tuple(ck::wrapper::slice(), ck::wrapper::slice(N / 2, N));
+    auto output_left      = output_tensor(left_cols);
+    auto output_right     = output_tensor(right_cols);
+    ck::wrapper::host::copy(input_tensor(left_cols), output_left);
+    ck::wrapper::host::copy(input_tensor(right_cols), output_right);
+
+    std::vector<float> expected(M * N);
+    for(ck::index_t m = 0; m < M; m++)
+    {
+        for(ck::index_t n = 0; n < N; n++)
+        {
+            expected[m + n * M] = static_cast<float>(input_data[m * N + n]);
+        }
+    }
+    EXPECT_TRUE(ck::utils::check_err(output_data, expected));
+}
+
+template <typename DataType, bool Use3dTile>
+void PerformHostGemm(const ck::index_t M, const ck::index_t N, const ck::index_t K)
+{
+    using PassThrough           = ck::tensor_operation::element_wise::PassThrough;
+    using ReferenceGemmInstance = ck::tensor_operation::host::
+        ReferenceGemm<DataType, DataType, float, float, PassThrough, PassThrough, PassThrough>;
+
+    constexpr auto MPerBlock  = ck::Number<32>{};
+    constexpr auto NPerBlock  = ck::Number<48>{};
+    constexpr auto KPerBlock  = ck::Number<16>{};
+    constexpr auto K1         = ck::Number<4>{};
+    constexpr auto K0PerBlock = KPerBlock / K1;
+
+    Tensor<DataType> a_m_k(HostTensorDescriptor({M, K}));
+    Tensor<DataType> b_k_n(HostTensorDescriptor({K, N}, {1, K}));
+    Tensor<float> c_m_n_host_result(HostTensorDescriptor({M, N}));
+    Tensor<float> c_m_n_wrapper_result(HostTensorDescriptor({M, N}));
+    ck::utils::FillUniformDistributionIntegerValue<DataType>{-5.f, 5.f}(a_m_k);
+    ck::utils::FillUniformDistributionIntegerValue<DataType>{-5.f, 5.f}(b_k_n);
+    c_m_n_wrapper_result.SetZero();
+
+    auto ref_op       = ReferenceGemmInstance{};
+    auto ref_invoker  = ref_op.MakeInvoker();
+    auto ref_argument = ref_op.MakeArgument(
+        a_m_k, b_k_n, c_m_n_host_result, PassThrough{}, PassThrough{}, PassThrough{});
+    ref_invoker.Run(ref_argument);
+
+    // A (M, K) and B (N, K) are stored as row-major
+    auto make_ab_tensor = [&](const DataType* p_data, const ck::index_t MN) {
+        if constexpr(Use3dTile)
+        {
+            // (K0, MN, K1) view on the same data
+            const ck::index_t k1 = K1;
+            const auto layout    = ck::wrapper::make_layout(ck::make_tuple(K / k1, MN, k1),
+                                                         ck::make_tuple(k1, K, 1));
+            return ck::wrapper::make_tensor<ck::wrapper::MemoryTypeEnum::Global>(p_data, layout);
+        }
+        else
+        {
+            const auto layout =
+                ck::wrapper::make_layout(ck::make_tuple(MN, K), ck::make_tuple(K, 1));
+            return ck::wrapper::make_tensor<ck::wrapper::MemoryTypeEnum::Global>(p_data, layout);
+        }
+    };
+    const auto a_global_tensor = make_ab_tensor(a_m_k.mData.data(), M);
+    const auto b_global_tensor = make_ab_tensor(b_k_n.mData.data(), N);
+    const auto c_global_tensor = ck::wrapper::make_tensor<ck::wrapper::MemoryTypeEnum::Global>(
+        c_m_n_wrapper_result.mData.data(),
+        ck::wrapper::make_layout(ck::make_tuple(M, N), ck::make_tuple(N, 1)));
+
+    auto kernel = [&](ck::index_t block_idx_x, ck::index_t block_idx_y) {
+        const auto tile_shape = ck::make_tuple(MPerBlock, NPerBlock, KPerBlock);
+        auto c_local_tile =
+            ck::wrapper::make_local_tile(c_global_tensor,
+                                         tile_shape,
+                                         ck::make_tuple(block_idx_x, block_idx_y, 0),
+                                         ck::make_tuple(ck::Number<1>{},
+                                                        ck::Number<1>{},
+                                                        ck::wrapper::slice(KPerBlock)));
+
+        for(ck::index_t k = 0; k < K / KPerBlock; k++)
+        {
+            if constexpr(Use3dTile)
+            {
+                const auto tile_shape_k0_m_n_k1 =
+                    ck::make_tuple(K0PerBlock, MPerBlock, NPerBlock, K1);
+                const auto block_idxs   = ck::make_tuple(k, block_idx_x, block_idx_y, 0);
+                const auto a_local_tile = ck::wrapper::make_local_tile(
+                    a_global_tensor,
+                    tile_shape_k0_m_n_k1,
+                    block_idxs,
+                    ck::make_tuple(ck::Number<1>{},
+                                   ck::Number<1>{},
+                                   ck::wrapper::slice(NPerBlock),
+                                   ck::Number<1>{}));
+                const auto b_local_tile = ck::wrapper::make_local_tile(
+                    b_global_tensor,
+                    tile_shape_k0_m_n_k1,
+                    block_idxs,
+                    ck::make_tuple(ck::Number<1>{},
+                                   ck::wrapper::slice(MPerBlock),
+                                   ck::Number<1>{},
+                                   ck::Number<1>{}));
+                ck::wrapper::host::blockwise_gemm<float>(a_local_tile, b_local_tile, c_local_tile);
+            }
+            else
+            {
+                const auto block_idxs   = ck::make_tuple(block_idx_x, block_idx_y, k);
+                const auto a_local_tile = ck::wrapper::make_local_tile(
+                    a_global_tensor,
+                    tile_shape,
+                    block_idxs,
+                    ck::make_tuple(
+                        ck::Number<1>{}, ck::wrapper::slice(NPerBlock), ck::Number<1>{}));
+                const auto b_local_tile = ck::wrapper::make_local_tile(
+                    b_global_tensor,
+                    tile_shape,
+                    block_idxs,
+                    ck::make_tuple(
+                        ck::wrapper::slice(MPerBlock), ck::Number<1>{}, ck::Number<1>{}));
+                ck::wrapper::host::blockwise_gemm<float>(a_local_tile, b_local_tile, c_local_tile);
+            }
+        }
+    };
+    ck::wrapper::host::launch_and_time_kernel(StreamConfig{}, kernel, M / MPerBlock, N / NPerBlock);
+
+    EXPECT_TRUE(ck::utils::check_err(c_m_n_wrapper_result.mData, c_m_n_host_result.mData));
+}
+
+TEST(TestHostGemm, Float) { PerformHostGemm<float, false>(128, 192, 64); }
+TEST(TestHostGemm, Half) { PerformHostGemm<ck::half_t, false>(96, 144, 128); }
+TEST(TestHostGemm, Float3dTile) { PerformHostGemm<float, true>(128, 192, 64); }
+TEST(TestHostGemm, Int8) { PerformHostGemm<int8_t, false>(64, 96, 32); }